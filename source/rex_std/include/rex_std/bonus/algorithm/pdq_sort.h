@@ -0,0 +1,598 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: pdq_sort.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// Based on pattern-defeating quicksort by Orson Peters
+// https://github.com/orlp/pdqsort
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/algorithm/iter_swap.h"
+#include "rex_std/internal/algorithm/make_heap.h"
+#include "rex_std/internal/algorithm/min.h"
+#include "rex_std/internal/algorithm/sort_heap.h"
+#include "rex_std/internal/functional/greater.h"
+#include "rex_std/internal/functional/less.h"
+#include "rex_std/internal/iterator/iterator_traits.h"
+#include "rex_std/internal/math/log2.h"
+#include "rex_std/internal/type_traits/is_arithmetic.h"
+#include "rex_std/internal/type_traits/is_same.h"
+#include "rex_std/internal/utility/move.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // partitions below this size are sorted using insertion sort
+      inline constexpr card32 g_pdqsort_insertion_sort_threshold = 24;
+      // partitions above this size use tukey's ninther to select the pivot
+      inline constexpr card32 g_pdqsort_ninther_threshold = 128;
+      // when we detect an already sorted partition, attempt an insertion sort that allows this
+      // amount of element moves before giving up
+      inline constexpr card32 g_pdqsort_partial_insertion_sort_limit = 8;
+      // the number of elements the branchless partition looks at before swapping
+      inline constexpr card32 g_pdqsort_block_size = 64;
+      inline constexpr card32 g_pdqsort_cacheline_size = 64;
+
+      // the branchless partition only pays off if comparing is cheap and doesn't have side effects,
+      // which we only know for sure for the default comparisons of arithmetic types
+      template <typename T, typename Compare>
+      struct is_pdqsort_branchless_compare
+      {
+        static constexpr bool value = rsl::is_arithmetic_v<T> && (rsl::is_same_v<Compare, rsl::less<T>> || rsl::is_same_v<Compare, rsl::greater<T>>);
+      };
+
+      template <typename RandomAccessIterator>
+      struct pdqsort_partition_result
+      {
+        RandomAccessIterator pivot_pos;
+        bool already_partitioned;
+      };
+
+      // sorts [first, last) using insertion sort with the given comparison function
+      template <typename RandomAccessIterator, typename Compare>
+      void pdqsort_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+      {
+        using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+        if(first == last)
+        {
+          return;
+        }
+
+        for(RandomAccessIterator current = first + 1; current != last; ++current)
+        {
+          RandomAccessIterator sift      = current;
+          RandomAccessIterator sift_prev = current - 1;
+
+          // compare first so we can avoid 2 moves for an element already positioned correctly
+          if(compare(*sift, *sift_prev))
+          {
+            value_type tmp(rsl::move(*sift));
+
+            do // NOLINT(cppcoreguidelines-avoid-do-while)
+            {
+              *sift-- = rsl::move(*sift_prev);
+            } while(sift != first && compare(tmp, *--sift_prev));
+
+            *sift = rsl::move(tmp);
+          }
+        }
+      }
+
+      // sorts [first, last) using insertion sort with the given comparison function.
+      // assumes *(first - 1) is an element smaller than or equal to any element in [first, last)
+      template <typename RandomAccessIterator, typename Compare>
+      void pdqsort_unguarded_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+      {
+        using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+        if(first == last)
+        {
+          return;
+        }
+
+        for(RandomAccessIterator current = first + 1; current != last; ++current)
+        {
+          RandomAccessIterator sift      = current;
+          RandomAccessIterator sift_prev = current - 1;
+
+          if(compare(*sift, *sift_prev))
+          {
+            value_type tmp(rsl::move(*sift));
+
+            do // NOLINT(cppcoreguidelines-avoid-do-while)
+            {
+              *sift-- = rsl::move(*sift_prev);
+            } while(compare(tmp, *--sift_prev));
+
+            *sift = rsl::move(tmp);
+          }
+        }
+      }
+
+      // attempts to use insertion sort on [first, last).
+      // returns false if more than g_pdqsort_partial_insertion_sort_limit elements were moved
+      // and aborts sorting, returns true if the range got sorted.
+      template <typename RandomAccessIterator, typename Compare>
+      bool pdqsort_partial_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+      {
+        using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+        if(first == last)
+        {
+          return true;
+        }
+
+        card32 limit = 0;
+        for(RandomAccessIterator current = first + 1; current != last; ++current)
+        {
+          RandomAccessIterator sift      = current;
+          RandomAccessIterator sift_prev = current - 1;
+
+          if(compare(*sift, *sift_prev))
+          {
+            value_type tmp(rsl::move(*sift));
+
+            do // NOLINT(cppcoreguidelines-avoid-do-while)
+            {
+              *sift-- = rsl::move(*sift_prev);
+            } while(sift != first && compare(tmp, *--sift_prev));
+
+            *sift = rsl::move(tmp);
+            limit += static_cast<card32>(current - sift);
+          }
+
+          if(limit > g_pdqsort_partial_insertion_sort_limit)
+          {
+            return false;
+          }
+        }
+
+        return true;
+      }
+
+      template <typename RandomAccessIterator, typename Compare>
+      void pdqsort_sort2(RandomAccessIterator a, RandomAccessIterator b, Compare compare)
+      {
+        if(compare(*b, *a))
+        {
+          rsl::iter_swap(a, b);
+        }
+      }
+
+      // sorts the elements *a, *b and *c using the comparison function
+      template <typename RandomAccessIterator, typename Compare>
+      void pdqsort_sort3(RandomAccessIterator a, RandomAccessIterator b, RandomAccessIterator c, Compare compare)
+      {
+        pdqsort_sort2(a, b, compare);
+        pdqsort_sort2(b, c, compare);
+        pdqsort_sort2(a, b, compare);
+      }
+
+      // swaps the elements at the given offsets of both blocks.
+      // if the number of elements out of place on both sides isn't the same, the elements are moved in a cycle,
+      // which only needs 1 move per element instead of the 3 moves of a swap
+      template <typename RandomAccessIterator>
+      void pdqsort_swap_offsets(RandomAccessIterator first, RandomAccessIterator last, const uint8* offsetsLeft, const uint8* offsetsRight, card32 num, bool useSwaps)
+      {
+        using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+        if(useSwaps)
+        {
+          // this case is needed for the descending distribution, where we need
+          // to have proper swapping for pdqsort to remain O(n)
+          for(card32 i = 0; i < num; ++i)
+          {
+            rsl::iter_swap(first + offsetsLeft[i], last - offsetsRight[i]);
+          }
+        }
+        else if(num > 0)
+        {
+          RandomAccessIterator left  = first + offsetsLeft[0];
+          RandomAccessIterator right = last - offsetsRight[0];
+          value_type tmp(rsl::move(*left));
+          *left = rsl::move(*right);
+          for(card32 i = 1; i < num; ++i)
+          {
+            left   = first + offsetsLeft[i];
+            *right = rsl::move(*left);
+            right  = last - offsetsRight[i];
+            *left  = rsl::move(*right);
+          }
+          *right = rsl::move(tmp);
+        }
+      }
+
+      // partitions [first, last) around pivot *first using the comparison function.
+      // elements equal to the pivot are put in the right-hand partition.
+      // returns the position of the pivot after partitioning and whether the passed sequence already was correctly partitioned.
+      // assumes the pivot is a median of at least 3 elements and that [first, last) is at least g_pdqsort_insertion_sort_threshold long.
+      // the comparison results are stored in a block of offsets first, which are then swapped in bulk.
+      // this way there's no branch depending on the comparison, which the cpu can't predict for random data
+      template <typename RandomAccessIterator, typename Compare>
+      pdqsort_partition_result<RandomAccessIterator> pdqsort_partition_right_branchless(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+      {
+        using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+        // move pivot into local for speed
+        value_type pivot(rsl::move(*first));
+        RandomAccessIterator begin = first;
+        RandomAccessIterator end   = last;
+
+        // find the first element greater than or equal to the pivot (the median of 3 guarantees this exists)
+        while(compare(*++begin, pivot))
+        {
+        }
+
+        // find the first element strictly smaller than the pivot.
+        // we have to guard this search if there was no element before *begin
+        if(begin - 1 == first)
+        {
+          while(begin < end && !compare(*--end, pivot))
+          {
+          }
+        }
+        else
+        {
+          while(!compare(*--end, pivot))
+          {
+          }
+        }
+
+        // if the first pair of elements that should be swapped to partition are the same element,
+        // the passed in sequence already was correctly partitioned
+        const bool already_partitioned = begin >= end;
+        if(!already_partitioned)
+        {
+          rsl::iter_swap(begin, end);
+          ++begin;
+
+          // the offsets are aligned to a cacheline, so a block of offsets is loaded in a single cacheline
+          alignas(g_pdqsort_cacheline_size) uint8 offsets_left[g_pdqsort_block_size];
+          alignas(g_pdqsort_cacheline_size) uint8 offsets_right[g_pdqsort_block_size];
+
+          RandomAccessIterator offsets_left_base  = begin;
+          RandomAccessIterator offsets_right_base = end;
+          card32 num_left                         = 0;
+          card32 num_right                        = 0;
+          card32 start_left                       = 0;
+          card32 start_right                      = 0;
+
+          // fill up offset blocks with elements that are on the wrong side
+          while(begin < end)
+          {
+            // first we determine how much elements are considered for each offset block
+            const card64 num_unknown = static_cast<card64>(end - begin);
+            const card64 left_split  = num_left == 0 ? (num_right == 0 ? num_unknown / 2 : num_unknown) : 0;
+            const card64 right_split = num_right == 0 ? (num_unknown - left_split) : 0;
+            const card32 left_count  = static_cast<card32>((rsl::min)(left_split, static_cast<card64>(g_pdqsort_block_size)));
+            const card32 right_count = static_cast<card32>((rsl::min)(right_split, static_cast<card64>(g_pdqsort_block_size)));
+
+            // fill the offset blocks, the comparison result is added to the index instead of branching on it
+            for(card32 i = 0; i < left_count; ++i)
+            {
+              offsets_left[num_left] = static_cast<uint8>(i);
+              num_left += !compare(*begin, pivot);
+              ++begin;
+            }
+            for(card32 i = 0; i < right_count; ++i)
+            {
+              offsets_right[num_right] = static_cast<uint8>(i + 1);
+              num_right += compare(*--end, pivot);
+            }
+
+            // swap elements and update block sizes and begin/end boundaries
+            const card32 num = (rsl::min)(num_left, num_right);
+            pdqsort_swap_offsets(offsets_left_base, offsets_right_base, offsets_left + start_left, offsets_right + start_right, num, num_left == num_right);
+            num_left -= num;
+            num_right -= num;
+            start_left += num;
+            start_right += num;
+
+            if(num_left == 0)
+            {
+              start_left        = 0;
+              offsets_left_base = begin;
+            }
+
+            if(num_right == 0)
+            {
+              start_right        = 0;
+              offsets_right_base = end;
+            }
+          }
+
+          // we have now fully identified [begin, end)'s proper position. Swap the last elements.
+          if(num_left)
+          {
+            const uint8* remaining_left = offsets_left + start_left;
+            while(num_left--)
+            {
+              rsl::iter_swap(offsets_left_base + remaining_left[num_left], --end);
+            }
+            begin = end;
+          }
+          if(num_right)
+          {
+            const uint8* remaining_right = offsets_right + start_right;
+            while(num_right--)
+            {
+              rsl::iter_swap(offsets_right_base - remaining_right[num_right], begin);
+              ++begin;
+            }
+            end = begin;
+          }
+        }
+
+        // put the pivot in the right place
+        RandomAccessIterator pivot_pos = begin - 1;
+        *first                         = rsl::move(*pivot_pos);
+        *pivot_pos                     = rsl::move(pivot);
+
+        return {pivot_pos, already_partitioned};
+      }
+
+      // partitions [first, last) around pivot *first using the comparison function.
+      // elements equal to the pivot are put in the right-hand partition.
+      // returns the position of the pivot after partitioning and whether the passed sequence already was correctly partitioned.
+      // assumes the pivot is a median of at least 3 elements and that [first, last) is at least g_pdqsort_insertion_sort_threshold long.
+      template <typename RandomAccessIterator, typename Compare>
+      pdqsort_partition_result<RandomAccessIterator> pdqsort_partition_right(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+      {
+        using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+        // move pivot into local for speed
+        value_type pivot(rsl::move(*first));
+        RandomAccessIterator begin = first;
+        RandomAccessIterator end   = last;
+
+        // find the first element greater than or equal to the pivot (the median of 3 guarantees this exists)
+        while(compare(*++begin, pivot))
+        {
+        }
+
+        // find the first element strictly smaller than the pivot.
+        // we have to guard this search if there was no element before *begin
+        if(begin - 1 == first)
+        {
+          while(begin < end && !compare(*--end, pivot))
+          {
+          }
+        }
+        else
+        {
+          while(!compare(*--end, pivot))
+          {
+          }
+        }
+
+        // if the first pair of elements that should be swapped to partition are the same element,
+        // the passed in sequence already was correctly partitioned
+        const bool already_partitioned = begin >= end;
+
+        // keep swapping pairs of elements that are on the wrong side of the pivot.
+        // previously swapped pairs guard the searches, which is why the first iteration is special-cased above
+        while(begin < end)
+        {
+          rsl::iter_swap(begin, end);
+          while(compare(*++begin, pivot))
+          {
+          }
+          while(!compare(*--end, pivot))
+          {
+          }
+        }
+
+        // put the pivot in the right place
+        RandomAccessIterator pivot_pos = begin - 1;
+        *first                         = rsl::move(*pivot_pos);
+        *pivot_pos                     = rsl::move(pivot);
+
+        return {pivot_pos, already_partitioned};
+      }
+
+      // similar function to the one above, except elements equal to the pivot are put to the left of the pivot
+      // and it doesn't check or return if the passed sequence already was partitioned.
+      // since this is rarely used (the many equal case), and in that case pdqsort already has O(n) performance,
+      // no block partitioning is needed here
+      template <typename RandomAccessIterator, typename Compare>
+      RandomAccessIterator pdqsort_partition_left(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+      {
+        using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+        value_type pivot(rsl::move(*first));
+        RandomAccessIterator begin = first;
+        RandomAccessIterator end   = last;
+
+        while(compare(pivot, *--end))
+        {
+        }
+
+        if(end + 1 == last)
+        {
+          while(begin < end && !compare(pivot, *++begin))
+          {
+          }
+        }
+        else
+        {
+          while(!compare(pivot, *++begin))
+          {
+          }
+        }
+
+        while(begin < end)
+        {
+          rsl::iter_swap(begin, end);
+          while(compare(pivot, *--end))
+          {
+          }
+          while(!compare(pivot, *++begin))
+          {
+          }
+        }
+
+        RandomAccessIterator pivot_pos = end;
+        *first                         = rsl::move(*pivot_pos);
+        *pivot_pos                     = rsl::move(pivot);
+
+        return pivot_pos;
+      }
+
+      template <bool Branchless, typename RandomAccessIterator, typename Compare>
+      void pdqsort_loop(RandomAccessIterator first, RandomAccessIterator last, Compare compare, int32 badAllowed, bool leftmost = true) // NOLINT(misc-no-recursion)
+      {
+        using difference_type = typename rsl::iterator_traits<RandomAccessIterator>::difference_type;
+
+        // use a while loop for tail recursion elimination
+        while(true)
+        {
+          const difference_type size = last - first;
+
+          // insertion sort is faster for small arrays
+          if(size < static_cast<difference_type>(g_pdqsort_insertion_sort_threshold))
+          {
+            if(leftmost)
+            {
+              pdqsort_insertion_sort(first, last, compare);
+            }
+            else
+            {
+              pdqsort_unguarded_insertion_sort(first, last, compare);
+            }
+            return;
+          }
+
+          // choose pivot as median of 3 or pseudomedian of 9 (tukey's ninther)
+          const difference_type half = size / 2;
+          if(size > static_cast<difference_type>(g_pdqsort_ninther_threshold))
+          {
+            pdqsort_sort3(first, first + half, last - 1, compare);
+            pdqsort_sort3(first + 1, first + (half - 1), last - 2, compare);
+            pdqsort_sort3(first + 2, first + (half + 1), last - 3, compare);
+            pdqsort_sort3(first + (half - 1), first + half, first + (half + 1), compare);
+            rsl::iter_swap(first, first + half);
+          }
+          else
+          {
+            pdqsort_sort3(first + half, first, last - 1, compare);
+          }
+
+          // if *(first - 1) is the end of the right partition of a previous partition operation
+          // there is no element in [first, last) that is smaller than *(first - 1).
+          // then if our pivot compares equal to *(first - 1) we change strategy,
+          // putting equal elements in the left partition, greater elements in the right partition.
+          // we do not have to recurse on the left partition, since it's sorted (all equal).
+          if(!leftmost && !compare(*(first - 1), *first))
+          {
+            first = pdqsort_partition_left(first, last, compare) + 1;
+            continue;
+          }
+
+          // partition and get results
+          const pdqsort_partition_result<RandomAccessIterator> part_result = Branchless ? pdqsort_partition_right_branchless(first, last, compare) : pdqsort_partition_right(first, last, compare);
+          const RandomAccessIterator pivot_pos                             = part_result.pivot_pos;
+
+          // check for a highly unbalanced partition
+          const difference_type left_size  = pivot_pos - first;
+          const difference_type right_size = last - (pivot_pos + 1);
+          const bool highly_unbalanced     = left_size < size / 8 || right_size < size / 8;
+
+          if(highly_unbalanced)
+          {
+            // if we had too many bad partitions, switch to heapsort to guarantee O(n log n)
+            if(--badAllowed == 0)
+            {
+              rsl::make_heap(first, last, compare);
+              rsl::sort_heap(first, last, compare);
+              return;
+            }
+
+            // otherwise shuffle some elements around to break patterns an adversary could exploit
+            if(left_size >= static_cast<difference_type>(g_pdqsort_insertion_sort_threshold))
+            {
+              rsl::iter_swap(first, first + left_size / 4);
+              rsl::iter_swap(pivot_pos - 1, pivot_pos - left_size / 4);
+
+              if(left_size > static_cast<difference_type>(g_pdqsort_ninther_threshold))
+              {
+                rsl::iter_swap(first + 1, first + (left_size / 4 + 1));
+                rsl::iter_swap(first + 2, first + (left_size / 4 + 2));
+                rsl::iter_swap(pivot_pos - 2, pivot_pos - (left_size / 4 + 1));
+                rsl::iter_swap(pivot_pos - 3, pivot_pos - (left_size / 4 + 2));
+              }
+            }
+
+            if(right_size >= static_cast<difference_type>(g_pdqsort_insertion_sort_threshold))
+            {
+              rsl::iter_swap(pivot_pos + 1, pivot_pos + (1 + right_size / 4));
+              rsl::iter_swap(last - 1, last - right_size / 4);
+
+              if(right_size > static_cast<difference_type>(g_pdqsort_ninther_threshold))
+              {
+                rsl::iter_swap(pivot_pos + 2, pivot_pos + (2 + right_size / 4));
+                rsl::iter_swap(pivot_pos + 3, pivot_pos + (3 + right_size / 4));
+                rsl::iter_swap(last - 2, last - (1 + right_size / 4));
+                rsl::iter_swap(last - 3, last - (2 + right_size / 4));
+              }
+            }
+          }
+          else
+          {
+            // if we were decently balanced and we tried to sort an already partitioned
+            // sequence try to use insertion sort, this makes sorted and reversed input O(n)
+            if(part_result.already_partitioned && pdqsort_partial_insertion_sort(first, pivot_pos, compare) && pdqsort_partial_insertion_sort(pivot_pos + 1, last, compare))
+            {
+              return;
+            }
+          }
+
+          // sort the left partition first using recursion and do tail recursion elimination for the right-hand partition
+          pdqsort_loop<Branchless>(first, pivot_pos, compare, badAllowed, leftmost);
+          first    = pivot_pos + 1;
+          leftmost = false;
+        }
+      }
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // pattern-defeating quicksort, this is the algorithm used by rsl::sort.
+    // it's an introsort that recognizes patterns in the input.
+    // sorted, reversed and input with many equal elements are sorted in O(n)
+    // and input crafted to trigger quicksort's worst case falls back to heapsort after log(n) bad partitions.
+    // for arithmetic types sorted with rsl::less or rsl::greater it uses a branchless block partition
+    template <typename RandomAccessIterator, typename Compare>
+    void pdq_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+    {
+      using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+      if(first == last)
+      {
+        return;
+      }
+
+      constexpr bool branchless = internal::is_pdqsort_branchless_compare<value_type, Compare>::value;
+      internal::pdqsort_loop<branchless>(first, last, compare, static_cast<int32>(rsl::log2(last - first)));
+    }
+
+    template <typename RandomAccessIterator>
+    void pdq_sort(RandomAccessIterator first, RandomAccessIterator last)
+    {
+      using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+      rsl::pdq_sort(first, last, rsl::less<value_type>());
+    }
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,346 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: radix_sort.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/algorithm/insertion_sort.h"
+#include "rex_std/internal/algorithm/iter_swap.h"
+#include "rex_std/internal/bit/bit_cast.h"
+#include "rex_std/internal/iterator/iterator_traits.h"
+#include "rex_std/internal/memory/allocator.h"
+#include "rex_std/internal/type_traits/decay.h"
+#include "rex_std/internal/type_traits/invoke_result.h"
+#include "rex_std/internal/type_traits/is_arithmetic.h"
+#include "rex_std/internal/type_traits/is_floating_point.h"
+#include "rex_std/internal/type_traits/is_signed.h"
+#include "rex_std/internal/type_traits/is_trivially_copyable.h"
+#include "rex_std/internal/type_traits/make_unsigned.h"
+#include "rex_std/internal/utility/move.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // every pass of the radix sort sorts on 1 byte of the key
+      inline constexpr card32 g_radix_sort_bucket_count = 256;
+      // buckets of the string radix sort smaller than this are finished with an insertion sort
+      inline constexpr card32 g_string_radix_sort_insertion_threshold = 32;
+
+      template <card32 Size>
+      struct radix_key_type;
+      template <>
+      struct radix_key_type<1>
+      {
+        using type = uint8;
+      };
+      template <>
+      struct radix_key_type<2>
+      {
+        using type = uint16;
+      };
+      template <>
+      struct radix_key_type<4>
+      {
+        using type = uint32;
+      };
+      template <>
+      struct radix_key_type<8>
+      {
+        using type = uint64;
+      };
+
+      template <typename T>
+      using radix_key_t = typename radix_key_type<sizeof(T)>::type;
+
+      // converts the value to an unsigned integer that sorts in the same order as the value
+      template <typename T>
+      radix_key_t<T> to_radix_key(T value)
+      {
+        using key_type              = radix_key_t<T>;
+        constexpr key_type sign_bit = static_cast<key_type>(key_type(1) << (sizeof(T) * 8 - 1));
+        const key_type bits         = rsl::bit_cast<key_type>(value);
+
+        if constexpr(rsl::is_floating_point_v<T>)
+        {
+          // negative floats are stored as sign and magnitude, so their order is reversed.
+          // flipping all bits of a negative float and only the sign bit of a positive one
+          // results in unsigned integers in the same order as the floats
+          const key_type mask = (bits & sign_bit) ? static_cast<key_type>(~key_type(0)) : sign_bit;
+          return static_cast<key_type>(bits ^ mask);
+        }
+        else if constexpr(rsl::is_signed_v<T>)
+        {
+          // two's complement, flipping the sign bit moves the negative values in front of the positive ones
+          return static_cast<key_type>(bits ^ sign_bit);
+        }
+        else
+        {
+          return bits;
+        }
+      }
+
+      // moves the elements of [src, src + size) to dst, sorted on the byte of the key at the given pass.
+      // counts holds the number of elements of every byte value
+      template <typename SrcIterator, typename DstIterator, typename KeyExtractor>
+      void lsd_radix_sort_pass(SrcIterator src, DstIterator dst, card64 size, card64* counts, card32 pass, KeyExtractor& keyExtractor)
+      {
+        // turn the counts into the offset of each bucket
+        card64 offset = 0;
+        for(card32 bucket = 0; bucket < g_radix_sort_bucket_count; ++bucket)
+        {
+          const card64 bucket_size = counts[bucket];
+          counts[bucket]           = offset;
+          offset += bucket_size;
+        }
+
+        for(card64 i = 0; i < size; ++i)
+        {
+          const auto key     = to_radix_key(keyExtractor(src[i]));
+          const card64 index = counts[(key >> (pass * 8)) & 0xFF]++;
+          dst[static_cast<ptrdiff>(index)] = rsl::move(src[i]);
+        }
+      }
+
+      // lsd radix sort, sorts on the least significant byte first and on the most significant byte last.
+      // every pass is stable, so the order of the previous passes is kept for equal bytes.
+      // buffer needs room for last - first elements, the elements ping pong between the range and the buffer.
+      template <typename RandomAccessIterator, typename KeyExtractor>
+      void lsd_radix_sort(RandomAccessIterator first, RandomAccessIterator last, typename rsl::iterator_traits<RandomAccessIterator>::value_type* buffer, KeyExtractor keyExtractor)
+      {
+        using value_type            = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+        using key_type              = rsl::decay_t<rsl::invoke_result_t<KeyExtractor, const value_type&>>;
+        using radix_key             = radix_key_t<key_type>;
+        constexpr card32 num_passes = sizeof(radix_key);
+
+        static_assert(rsl::is_arithmetic_v<key_type>, "the key of a radix sort needs to be an arithmetic type");
+
+        const card64 size = static_cast<card64>(last - first);
+        if(size < 2)
+        {
+          return;
+        }
+
+        // count the bytes of all passes in a single read of the input
+        card64 counts[num_passes][g_radix_sort_bucket_count] = {};
+        for(RandomAccessIterator it = first; it != last; ++it)
+        {
+          const radix_key key = to_radix_key(keyExtractor(*it));
+          for(card32 pass = 0; pass < num_passes; ++pass)
+          {
+            ++counts[pass][(key >> (pass * 8)) & 0xFF];
+          }
+        }
+
+        // the elements move from the range to the buffer and back every pass
+        bool in_buffer = false;
+        for(card32 pass = 0; pass < num_passes; ++pass)
+        {
+          // if all elements have the same byte, this pass wouldn't change anything.
+          // this is common for the top bytes of small integers
+          const radix_key first_key  = to_radix_key(keyExtractor(in_buffer ? buffer[0] : *first));
+          const radix_key first_byte = (first_key >> (pass * 8)) & 0xFF;
+          if(counts[pass][first_byte] == size)
+          {
+            continue;
+          }
+
+          if(in_buffer)
+          {
+            lsd_radix_sort_pass(buffer, first, size, counts[pass], pass, keyExtractor);
+          }
+          else
+          {
+            lsd_radix_sort_pass(first, buffer, size, counts[pass], pass, keyExtractor);
+          }
+          in_buffer = !in_buffer;
+        }
+
+        // an odd number of passes leaves the sorted elements in the buffer
+        if(in_buffer)
+        {
+          for(card64 i = 0; i < size; ++i)
+          {
+            first[static_cast<ptrdiff>(i)] = rsl::move(buffer[i]);
+          }
+        }
+      }
+
+      // returns the byte of the string at the given depth, shifted up by 1.
+      // 0 is reserved for strings that end before depth, as they come first.
+      // code units wider than a byte are split up in bytes, most significant byte first
+      template <typename String>
+      card32 string_radix_byte(const String& str, card64 depth)
+      {
+        using char_type            = typename String::value_type;
+        constexpr card64 char_size = sizeof(char_type);
+
+        const card64 index = depth / char_size;
+        if(index >= static_cast<card64>(str.size()))
+        {
+          return 0;
+        }
+
+        // char_traits compares single byte characters as unsigned and wider ones by their value,
+        // so signed wide characters need their sign bit flipped to sort negative values first
+        auto code_unit = static_cast<rsl::make_unsigned_t<char_type>>(str[index]);
+        if constexpr(char_size > 1 && rsl::is_signed_v<char_type>)
+        {
+          code_unit ^= static_cast<rsl::make_unsigned_t<char_type>>(1) << (char_size * 8 - 1);
+        }
+
+        const card64 shift = (char_size - 1 - depth % char_size) * 8;
+        return static_cast<card32>((code_unit >> shift) & 0xFF) + 1;
+      }
+
+      // american flag sort, an in place msd radix sort.
+      // the elements are permuted into buckets of the byte at depth,
+      // after which every bucket is sorted on the next byte.
+      // only the smaller buckets are sorted recursively, the biggest one is sorted by the loop itself.
+      // this keeps the recursion depth at log2 of the number of elements,
+      // no matter how long the prefixes the strings share are.
+      template <typename RandomAccessIterator>
+      void american_flag_sort(RandomAccessIterator first, RandomAccessIterator last, card64 depth) // NOLINT(misc-no-recursion)
+      {
+        constexpr card32 num_buckets = g_radix_sort_bucket_count + 1;
+
+        for(;;)
+        {
+          const card64 size = static_cast<card64>(last - first);
+          if(size < g_string_radix_sort_insertion_threshold)
+          {
+            // all strings share the first depth bytes, so comparing the whole string gives the same result
+            rsl::insertion_sort(first, last);
+            return;
+          }
+
+          card64 counts[num_buckets] = {};
+          for(RandomAccessIterator it = first; it != last; ++it)
+          {
+            ++counts[string_radix_byte(*it, depth)];
+          }
+
+          // next is where the next element of a bucket goes, end is where the bucket ends
+          card64 next[num_buckets];
+          card64 end[num_buckets];
+          card64 offset = 0;
+          for(card32 bucket = 0; bucket < num_buckets; ++bucket)
+          {
+            next[bucket] = offset;
+            offset += counts[bucket];
+            end[bucket] = offset;
+          }
+
+          // swap every element into its bucket, the element swapped back in is handled next
+          for(card32 bucket = 0; bucket < num_buckets; ++bucket)
+          {
+            while(next[bucket] < end[bucket])
+            {
+              RandomAccessIterator current = first + static_cast<ptrdiff>(next[bucket]);
+              const card32 target          = string_radix_byte(*current, depth);
+              if(target == bucket)
+              {
+                ++next[bucket];
+              }
+              else
+              {
+                rsl::iter_swap(current, first + static_cast<ptrdiff>(next[target]++));
+              }
+            }
+          }
+
+          // the strings in bucket 0 ended and are all equal, the other buckets continue on the next byte
+          card32 biggest_bucket = 1;
+          for(card32 bucket = 2; bucket < num_buckets; ++bucket)
+          {
+            if(counts[bucket] > counts[biggest_bucket])
+            {
+              biggest_bucket = bucket;
+            }
+          }
+
+          for(card32 bucket = 1; bucket < num_buckets; ++bucket)
+          {
+            if(bucket != biggest_bucket && counts[bucket] > 1)
+            {
+              american_flag_sort(first + static_cast<ptrdiff>(end[bucket] - counts[bucket]), first + static_cast<ptrdiff>(end[bucket]), depth + 1);
+            }
+          }
+          if(counts[biggest_bucket] < 2)
+          {
+            return;
+          }
+
+          last  = first + static_cast<ptrdiff>(end[biggest_bucket]);
+          first = first + static_cast<ptrdiff>(end[biggest_bucket] - counts[biggest_bucket]);
+          ++depth;
+        }
+      }
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // sorts integers and floats in O(n) with an lsd radix sort.
+    // the sort is stable and needs a buffer of last - first elements.
+    // negative zero is sorted before positive zero and nans are sorted at the very end or front, depending on their sign
+    template <typename RandomAccessIterator>
+    void radix_sort(RandomAccessIterator first, RandomAccessIterator last, typename rsl::iterator_traits<RandomAccessIterator>::value_type* buffer)
+    {
+      using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+      static_assert(rsl::is_arithmetic_v<value_type>, "radix sort without a key extractor can only sort arithmetic types");
+
+      internal::lsd_radix_sort(first, last, buffer, [](value_type value) { return value; });
+    }
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // sorts the elements on the integer or float returned by the key extractor, eg. a member of a struct.
+    // the sort is stable and needs a buffer of last - first elements.
+    // elements are moved into the buffer with move assignment, so it needs to hold constructed objects
+    // unless the elements are trivially copyable.
+    template <typename RandomAccessIterator, typename KeyExtractor>
+    void radix_sort(RandomAccessIterator first, RandomAccessIterator last, typename rsl::iterator_traits<RandomAccessIterator>::value_type* buffer, KeyExtractor keyExtractor)
+    {
+      internal::lsd_radix_sort(first, last, buffer, keyExtractor);
+    }
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // integers and floats are sorted with an lsd radix sort, the buffer gets allocated with rsl::allocator.
+    // strings and string views of any character type are sorted in place with an msd radix sort (american flag sort), which isn't stable.
+    template <typename RandomAccessIterator>
+    void radix_sort(RandomAccessIterator first, RandomAccessIterator last)
+    {
+      using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+      if constexpr(rsl::is_arithmetic_v<value_type>)
+      {
+        static_assert(rsl::is_trivially_copyable_v<value_type>, "arithmetic types are expected to be trivially copyable");
+
+        const card64 buffer_size = static_cast<card64>(last - first) * sizeof(value_type);
+        if(buffer_size == 0)
+        {
+          return;
+        }
+
+        rsl::allocator alloc;
+        value_type* buffer = static_cast<value_type*>(alloc.allocate(buffer_size));
+        rsl::radix_sort(first, last, buffer);
+        alloc.deallocate(buffer, buffer_size);
+      }
+      else
+      {
+        internal::american_flag_sort(first, last, 0);
+      }
+    }
+  } // namespace v1
+} // namespace rsl
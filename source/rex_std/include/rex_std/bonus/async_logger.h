@@ -0,0 +1,188 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: async_logger.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// A logger that moves writing the log off the calling thread
+//
+// Producers format their message into a buffer owned by their thread and push
+// it as a record onto a bounded lock free queue. A background thread pops the
+// records in batches, gathers them in a single buffer and writes that to the
+// log handle in one go, so the producers never wait on a syscall.
+//
+// With deferred logging, producers don't even format. They copy the arguments
+// into the record and the background thread formats them. This only works for
+// arguments that are trivially copyable and don't point to memory of the caller.
+//
+// When the queue is full, the overflow policy decides whether the producer
+// blocks, drops its own record or drops the oldest one in the queue.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/attributes.h"
+#include "rex_std/bonus/iostream/console_buf.h"
+#include "rex_std/bonus/mpmc_queue.h"
+#include "rex_std/bonus/type_traits/is_character.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/format.h"
+#include "rex_std/internal/atomic/atomic.h"
+#include "rex_std/internal/memory/construct_at.h"
+#include "rex_std/internal/string_view/basic_string_view.h"
+#include "rex_std/internal/thread/thread.h"
+#include "rex_std/internal/type_traits/decay.h"
+#include "rex_std/internal/type_traits/is_pointer.h"
+#include "rex_std/internal/type_traits/is_same.h"
+#include "rex_std/internal/type_traits/is_trivially_copyable.h"
+#include "rex_std/internal/type_traits/remove_cv.h"
+#include "rex_std/internal/type_traits/remove_pointer.h"
+#include "rex_std/internal/utility/forward.h"
+#include "rex_std/tuple.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // what a producer does when the queue of an async logger is full
+    enum class log_overflow_policy
+    {
+      block,    // wait until the writer made room, nothing gets lost
+      drop,     // drop the new record, the producer never waits
+      overwrite // drop the oldest record in the queue, the producer never waits on the writer
+    };
+
+    namespace internal
+    {
+      // every record is this big, messages that don't fit are copied to the heap
+      inline constexpr card32 g_log_record_size         = 256;
+      inline constexpr card32 g_log_record_payload_size = g_log_record_size - 16;
+      // the default number of records the queue holds
+      inline constexpr card64 g_default_log_queue_capacity = 8 * 1024;
+
+      enum class log_record_kind : uint8
+      {
+        text,      // the formatted message is stored in the record
+        heap_text, // the formatted message is stored on the heap, the record holds a pointer to it
+        deferred,  // the arguments are stored in the record, the writer formats them
+        flush,     // the writer signals the atomic the record points to when everything before it is written
+        stop       // the writer writes everything before it and exits
+      };
+
+      struct log_record
+      {
+        using format_func = void (*)(const void* /*args*/, rsl::memory_buffer& /*out*/);
+
+        log_record_kind kind;
+        card32 size;
+        format_func format;
+        alignas(8) char8 payload[g_log_record_payload_size]; // NOLINT(modernize-avoid-c-arrays)
+      };
+      static_assert(sizeof(log_record) == g_log_record_size, "a log record should be exactly g_log_record_size bytes");
+
+      // the buffer producers on the calling thread format their message into
+      rsl::memory_buffer& log_format_buffer();
+
+      // deferred arguments are copied byte by byte through the queue and formatted on another thread.
+      // anything that refers to memory of the caller would be dangling by then
+      template <typename T>
+      inline constexpr bool is_deferrable_log_arg_v = rsl::is_trivially_copyable_v<T> && !(rsl::is_pointer_v<T> && rsl::is_character_v<rsl::remove_cv_t<rsl::remove_pointer_t<T>>>) && !rsl::is_same_v<T, rsl::string_view>;
+
+      template <typename... Args>
+      struct deferred_log_args
+      {
+        rsl::string_view fmt;
+        rsl::tuple<Args...> args;
+
+        static void format(const void* self, rsl::memory_buffer& out)
+        {
+          const deferred_log_args* deferred = static_cast<const deferred_log_args*>(self);
+          rsl::apply([&](const Args&... values) { rsl::detail::vformat_to(out, deferred->fmt, rsl::make_format_args(values...)); }, deferred->args);
+        }
+      };
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // writes log messages to a handle on a background thread.
+    // every message is written as a line of its own, in the order the records got in the queue.
+    // all functions can be called by any number of threads at the same time
+    class async_logger
+    {
+    public:
+      // the capacity of the queue is rounded up to a power of 2
+      explicit async_logger(internal::console_handle handle, log_overflow_policy policy = log_overflow_policy::block, card64 capacity = internal::g_default_log_queue_capacity);
+      async_logger(const async_logger&) = delete;
+      async_logger(async_logger&&)      = delete;
+      // writes everything that's logged and stops the background thread
+      ~async_logger();
+
+      async_logger& operator=(const async_logger&) = delete;
+      async_logger& operator=(async_logger&&)      = delete;
+
+      // formats the message on the calling thread, the background thread only has to copy it.
+      // returns false if the message got dropped
+      template <typename... Args>
+      bool log(format_string<Args...> fmt, Args&&... args)
+      {
+        rsl::memory_buffer& buffer = internal::log_format_buffer();
+        buffer.clear();
+        rsl::detail::vformat_to(buffer, rsl::string_view(fmt), rsl::make_format_args(args...));
+        return push_text(buffer.data(), buffer.size());
+      }
+
+      // copies the arguments, the background thread formats the message.
+      // the format string has to outlive the logger, which is the case for string literals.
+      // returns false if the message got dropped
+      template <typename... Args>
+      bool log_deferred(format_string<Args...> fmt, Args&&... args)
+      {
+        using deferred_args = internal::deferred_log_args<rsl::decay_t<Args>...>;
+        static_assert((internal::is_deferrable_log_arg_v<rsl::decay_t<Args>> && ...), "deferred log arguments have to be trivially copyable and can't be strings, use log instead");
+        static_assert(sizeof(deferred_args) <= internal::g_log_record_payload_size, "deferred log arguments don't fit in a log record, use log instead");
+        static_assert(alignof(deferred_args) <= 8, "deferred log arguments are over aligned, use log instead");
+
+        internal::log_record record; // NOLINT(cppcoreguidelines-pro-type-member-init), the payload is only partially used
+        record.kind   = internal::log_record_kind::deferred;
+        record.size   = 0;
+        record.format = &deferred_args::format;
+        rsl::construct_at(reinterpret_cast<deferred_args*>(record.payload), deferred_args {rsl::string_view(fmt), rsl::tuple<rsl::decay_t<Args>...>(rsl::forward<Args>(args)...)}); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        return push(record);
+      }
+
+      // blocks until every message logged before the call is written
+      void flush();
+
+      // the number of messages dropped because the queue was full
+      RSL_NO_DISCARD card64 num_dropped() const
+      {
+        return m_num_dropped.load(rsl::memory_order_relaxed);
+      }
+
+    private:
+      bool push_text(const char8* text, count_t size);
+      // pushes the record following the overflow policy, returns false if it got dropped
+      bool push(const internal::log_record& record);
+      // pushes a record that can't be dropped, whatever the policy
+      void push_control(const internal::log_record& record);
+
+      // the loop of the background thread
+      void run();
+      void write(rsl::memory_buffer& buffer);
+
+    private:
+      internal::console_handle m_handle;
+      log_overflow_policy m_policy;
+      rsl::mpmc_queue<internal::log_record> m_queue;
+      rsl::atomic<card64> m_num_dropped;
+      rsl::thread m_writer;
+    };
+  } // namespace v1
+} // namespace rsl
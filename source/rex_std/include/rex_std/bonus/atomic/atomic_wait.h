@@ -0,0 +1,43 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: atomic_wait.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Blocking on an atomic value, like std::atomic::wait and notify_all.
+//
+// Waiting threads sleep on one of a fixed number of condition variables,
+// picked by the address they wait on. Objects that are waited on only need
+// room for the atomic itself, instead of a mutex and a condition variable each.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/atomic/atomic.h"
+#include "rex_std/internal/chrono/duration.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // blocks the calling thread as long as value equals expected.
+      // the value is checked again after every wake up, spurious wake ups never return early
+      void atomic_wait(const rsl::atomic<uint32>& value, uint32 expected);
+      // blocks the calling thread as long as value equals expected, but no longer than timeout.
+      // returns false if the timeout expired before the value changed
+      bool atomic_wait_for(const rsl::atomic<uint32>& value, uint32 expected, rsl::chrono::nanoseconds timeout);
+      // wakes up all threads waiting on value, the value has to be changed before calling this
+      void atomic_notify_all(const rsl::atomic<uint32>& value);
+    } // namespace internal
+  }   // namespace v1
+} // namespace rsl
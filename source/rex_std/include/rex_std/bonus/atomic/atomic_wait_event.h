@@ -0,0 +1,101 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: atomic_wait_event.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Lets threads block until a condition on a lock free structure becomes true
+//
+// The structure calls notify after every change that could make a condition true.
+// notify costs a single load as long as nobody is waiting, so it can sit on the fast path.
+// Waiters spin for a while before going to sleep on the atomic wait API.
+//
+// The structure doesn't put a full barrier between its change and the load in notify,
+// so a waiter can go to sleep right after a change it didn't see yet.
+// Sleeping waiters check their condition every so often to catch such a lost wake up,
+// like the workers of the thread pool do.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/atomic/atomic_cpu_pause.h"
+#include "rex_std/bonus/atomic/atomic_wait.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/atomic/atomic.h"
+#include "rex_std/internal/chrono/duration.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // spinning is much cheaper than sleeping if the other side is only a few instructions away
+      inline constexpr card32 g_atomic_wait_event_spin_rounds = 64;
+      inline constexpr card32 g_atomic_wait_event_timeout_ms  = 1;
+
+      class atomic_wait_event
+      {
+      public:
+        atomic_wait_event()
+            : m_epoch(0)
+            , m_num_waiters(0)
+        {
+        }
+
+        // blocks until ready returns true
+        template <typename Predicate>
+        void wait_until(const Predicate& ready)
+        {
+          for(card32 i = 0; i < g_atomic_wait_event_spin_rounds; ++i)
+          {
+            if(ready())
+            {
+              return;
+            }
+            rsl::cpu_pause();
+          }
+
+          for(;;)
+          {
+            // read the epoch before checking, a notify after the check changes it and the wait returns immediately
+            const uint32 epoch = m_epoch.load(rsl::memory_order_acquire);
+            m_num_waiters.fetch_add(1, rsl::memory_order_seq_cst);
+            const bool is_ready = ready();
+            if(!is_ready)
+            {
+              internal::atomic_wait_for(m_epoch, epoch, rsl::chrono::milliseconds(g_atomic_wait_event_timeout_ms));
+            }
+            m_num_waiters.fetch_sub(1, rsl::memory_order_relaxed);
+
+            if(is_ready || ready())
+            {
+              return;
+            }
+          }
+        }
+
+        // wakes up the waiting threads so they check their condition again
+        void notify()
+        {
+          if(m_num_waiters.load(rsl::memory_order_seq_cst) != 0)
+          {
+            m_epoch.fetch_add(1, rsl::memory_order_release);
+            internal::atomic_notify_all(m_epoch);
+          }
+        }
+
+      private:
+        rsl::atomic<uint32> m_epoch;
+        rsl::atomic<card32> m_num_waiters;
+      };
+    } // namespace internal
+  }   // namespace v1
+} // namespace rsl
@@ -277,7 +277,18 @@ namespace rsl
           , m_cp_size_and_allocator(other.size(), alloc)
       {
         reset();
-        swap(other);
+        if(get_allocator() == other.get_allocator())
+        {
+          swap(other);
+        }
+        else
+        {
+          // we can't adopt nodes that belong to another allocator, every element gets a new node
+          for(value_type& value : other)
+          {
+            emplace(rsl::move(value));
+          }
+        }
       }
 
       template <typename InputIt>
@@ -301,7 +312,6 @@ namespace rsl
       RedBlackTree& operator=(const this_type& other)
       {
         RSL_ASSERT_X(this != &other, "Can't copy to yourself");
-        RSL_ASSERT_X(get_allocator() == other.get_allocator(), "Different allocators in copy assignment, this is not allowed");
 
         clear();
         base_type::get_compare() = other.get_compare();
@@ -319,8 +329,8 @@ namespace rsl
       RedBlackTree& operator=(this_type&& other)
       {
         RSL_ASSERT_X(this != &other, "Can't copy to yourself");
-        RSL_ASSERT_X(get_allocator() == other.get_allocator(), "Different allocators in move assignment, this is not allowed");
 
+        // swap moves the allocators along with the nodes, so the allocators don't need to be equal
         clear();
         swap(other);
 
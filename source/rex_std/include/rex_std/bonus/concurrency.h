@@ -13,4 +13,8 @@
 #pragma once
 
 #include "rex_std/bonus/atomic//atomic_decrement.h"
-#include "rex_std/bonus/atomic//atomic_increment.h"
\ No newline at end of file
+#include "rex_std/bonus/atomic//atomic_increment.h"
+#include "rex_std/bonus/intrusive_mpsc_queue.h"
+#include "rex_std/bonus/intrusive_stack.h"
+#include "rex_std/bonus/mpmc_queue.h"
+#include "rex_std/bonus/spsc_queue.h"
@@ -0,0 +1,17 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: coroutine.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/coroutine/awaitables.h"
+#include "rex_std/bonus/coroutine/sync_wait.h"
+#include "rex_std/bonus/coroutine/task.h"
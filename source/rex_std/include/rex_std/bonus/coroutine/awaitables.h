@@ -0,0 +1,171 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: awaitables.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Awaitables moving a coroutine to a thread pool or suspending it on a timer
+//
+// co_await rsl::schedule_on(pool) resumes the coroutine on a worker of the pool.
+// co_await rsl::sleep_for(duration) resumes the coroutine on the timer thread once
+// the duration passed, or on a worker of a pool if one is given.
+//
+// The awaiters embed the pool task and the timer they schedule. An awaiter lives
+// in the frame of the suspended coroutine, so none of this allocates.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/thread/thread_pool.h"
+#include "rex_std/bonus/thread/timer_queue.h"
+#include "rex_std/coroutine.h"
+#include "rex_std/internal/chrono/clock.h"
+#include "rex_std/internal/chrono/duration.h"
+#include "rex_std/internal/chrono/duration_cast.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // resumes a coroutine on a worker of a pool
+      class pool_awaiter : public pool_task
+      {
+      public:
+        explicit pool_awaiter(thread_pool& pool)
+            : pool_task(&pool_awaiter::execute_impl)
+            , m_pool(&pool)
+            , m_handle(nullptr)
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+          return false;
+        }
+        void await_suspend(coroutine_handle<> handle)
+        {
+          m_handle = handle;
+          // a worker can resume the coroutine before schedule returns, don't touch the awaiter afterwards
+          m_pool->schedule(this);
+        }
+        void await_resume() const noexcept {}
+
+      private:
+        static void execute_impl(pool_task* task)
+        {
+          static_cast<pool_awaiter*>(task)->m_handle.resume();
+        }
+
+      private:
+        thread_pool* m_pool;
+        coroutine_handle<> m_handle;
+      };
+
+      // resumes a coroutine once its deadline passed, on the timer thread or on a worker of a pool
+      class timer_awaiter : public timer_entry, public pool_task
+      {
+      public:
+        timer_awaiter(timer_queue& timers, chrono::steady_clock::time_point deadline, thread_pool* pool)
+            : timer_entry(&timer_awaiter::fire_impl)
+            , pool_task(&timer_awaiter::execute_impl)
+            , m_timers(&timers)
+            , m_deadline(deadline)
+            , m_pool(pool)
+            , m_handle(nullptr)
+        {
+        }
+
+        // a deadline that already passed doesn't suspend the coroutine
+        bool await_ready() const
+        {
+          return !(chrono::steady_clock::now() < m_deadline);
+        }
+        void await_suspend(coroutine_handle<> handle)
+        {
+          m_handle = handle;
+          // the timer can fire before schedule returns, don't touch the awaiter afterwards
+          m_timers->schedule(this, m_deadline);
+        }
+        void await_resume() const noexcept {}
+
+      private:
+        static void fire_impl(timer_entry* timer)
+        {
+          timer_awaiter* self = static_cast<timer_awaiter*>(timer);
+          if(self->m_pool != nullptr)
+          {
+            self->m_pool->schedule(self);
+          }
+          else
+          {
+            self->m_handle.resume();
+          }
+        }
+
+        static void execute_impl(pool_task* task)
+        {
+          static_cast<timer_awaiter*>(task)->m_handle.resume();
+        }
+
+      private:
+        timer_queue* m_timers;
+        chrono::steady_clock::time_point m_deadline;
+        thread_pool* m_pool;
+        coroutine_handle<> m_handle;
+      };
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // resumes the awaiting coroutine on a worker of the pool
+    inline internal::pool_awaiter schedule_on(thread_pool& pool)
+    {
+      return internal::pool_awaiter(pool);
+    }
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // resumes the awaiting coroutine on the timer thread of the queue once the deadline passed
+    inline internal::timer_awaiter sleep_until(timer_queue& timers, chrono::steady_clock::time_point deadline)
+    {
+      return internal::timer_awaiter(timers, deadline, nullptr);
+    }
+    // resumes the awaiting coroutine on a worker of the pool once the deadline passed
+    inline internal::timer_awaiter sleep_until(timer_queue& timers, chrono::steady_clock::time_point deadline, thread_pool& pool)
+    {
+      return internal::timer_awaiter(timers, deadline, &pool);
+    }
+    // sleeps on the default timer queue
+    inline internal::timer_awaiter sleep_until(chrono::steady_clock::time_point deadline)
+    {
+      return sleep_until(timer_queue::default_queue(), deadline);
+    }
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // resumes the awaiting coroutine on the timer thread of the queue once the duration passed
+    template <typename Rep, typename Period>
+    internal::timer_awaiter sleep_for(timer_queue& timers, const chrono::duration<Rep, Period>& duration)
+    {
+      return sleep_until(timers, chrono::steady_clock::now() + chrono::duration_cast<chrono::steady_clock::duration>(duration));
+    }
+    // resumes the awaiting coroutine on a worker of the pool once the duration passed
+    template <typename Rep, typename Period>
+    internal::timer_awaiter sleep_for(timer_queue& timers, const chrono::duration<Rep, Period>& duration, thread_pool& pool)
+    {
+      return sleep_until(timers, chrono::steady_clock::now() + chrono::duration_cast<chrono::steady_clock::duration>(duration), pool);
+    }
+    // sleeps on the default timer queue
+    template <typename Rep, typename Period>
+    internal::timer_awaiter sleep_for(const chrono::duration<Rep, Period>& duration)
+    {
+      return sleep_for(timer_queue::default_queue(), duration);
+    }
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,118 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: sync_wait.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Blocks the calling thread until an awaitable is finished and returns its result
+//
+// The awaitable is awaited from a small coroutine that starts immediately and
+// hands its result over through a rsl::promise, so the calling thread waits
+// like it would on any other future: a worker of a thread pool keeps
+// running other tasks of its pool while it waits.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/coroutine.h"
+#include "rex_std/internal/coroutine/coroutine_frame_allocator.h"
+#include "rex_std/internal/exception/teminate.h"
+#include "rex_std/internal/future/future.h"
+#include "rex_std/internal/future/promise.h"
+#include "rex_std/internal/type_traits/is_void.h"
+#include "rex_std/internal/type_traits/remove_cvref.h"
+#include "rex_std/internal/utility/declval.h"
+#include "rex_std/internal/utility/forward.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // an awaitable either is its own awaiter or returns one from its member operator co_await
+      template <typename Awaitable>
+      auto get_awaiter(Awaitable&& awaitable, int /*preferred*/) -> decltype(rsl::forward<Awaitable>(awaitable).operator co_await())
+      {
+        return rsl::forward<Awaitable>(awaitable).operator co_await();
+      }
+      template <typename Awaitable>
+      Awaitable&& get_awaiter(Awaitable&& awaitable, long /*fallback*/) // NOLINT(google-runtime-int)
+      {
+        return rsl::forward<Awaitable>(awaitable);
+      }
+
+      template <typename Awaitable>
+      using await_result_t = decltype(get_awaiter(rsl::declval<Awaitable>(), 0).await_resume());
+
+      // starts running as soon as it's called and frees itself once it's done, nobody holds on to it
+      class sync_wait_driver
+      {
+      public:
+        class promise_type : public coroutine_promise_allocation
+        {
+        public:
+          sync_wait_driver get_return_object() const
+          {
+            return sync_wait_driver();
+          }
+
+          suspend_never initial_suspend() const noexcept
+          {
+            return {};
+          }
+          suspend_never final_suspend() const noexcept
+          {
+            return {};
+          }
+
+          void return_void() const {}
+
+          // rsl doesn't use exceptions, an awaitable that throws terminates the program
+          void unhandled_exception() const
+          {
+            rsl::terminate();
+          }
+        };
+      };
+
+      // the promise lives in the frame of the driver, so it's destroyed by the thread setting its value
+      // and never while that thread is still inside set_value
+      template <typename R, typename Awaitable>
+      sync_wait_driver drive_sync_wait(Awaitable&& awaitable, future<R>& result)
+      {
+        rsl::promise<R> promise;
+        result = promise.get_future();
+
+        if constexpr(rsl::is_void_v<R>)
+        {
+          co_await rsl::forward<Awaitable>(awaitable);
+          promise.set_value();
+        }
+        else
+        {
+          promise.set_value(co_await rsl::forward<Awaitable>(awaitable));
+        }
+      }
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // the result is returned by value, even if awaiting the awaitable returns a reference
+    template <typename Awaitable>
+    rsl::remove_cvref_t<internal::await_result_t<Awaitable>> sync_wait(Awaitable&& awaitable)
+    {
+      using result_type = rsl::remove_cvref_t<internal::await_result_t<Awaitable>>;
+
+      future<result_type> result;
+      internal::drive_sync_wait<result_type>(rsl::forward<Awaitable>(awaitable), result);
+      return result.get();
+    }
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,322 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: task.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// A lazy coroutine returning a single value
+//
+// A task doesn't start until it's awaited. Awaiting it suspends the awaiting
+// coroutine and jumps straight into the task, once the task finishes it jumps
+// straight back into the coroutine awaiting it.
+// Both jumps use symmetric transfer: await_suspend returns the handle to resume,
+// so a long chain of tasks finishing synchronously doesn't grow the stack.
+//
+// Use sync_wait to wait for a task from code that isn't a coroutine.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/coroutine.h"
+#include "rex_std/internal/assert/assert_fwd.h"
+#include "rex_std/internal/coroutine/coroutine_frame_allocator.h"
+#include "rex_std/internal/exception/teminate.h"
+#include "rex_std/internal/memory/addressof.h"
+#include "rex_std/internal/type_traits/aligned_storage.h"
+#include "rex_std/internal/type_traits/is_reference.h"
+#include "rex_std/internal/type_traits/is_void.h"
+#include "rex_std/internal/utility/exchange.h"
+#include "rex_std/internal/utility/forward.h"
+#include "rex_std/internal/utility/move.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    template <typename T = void>
+    class task;
+
+    namespace internal
+    {
+      class task_promise_base : public coroutine_promise_allocation
+      {
+      public:
+        // resumes whoever awaited the task, nobody awaiting the task just suspends it
+        class final_awaiter
+        {
+        public:
+          bool await_ready() const noexcept
+          {
+            return false;
+          }
+          template <typename Promise>
+          coroutine_handle<> await_suspend(coroutine_handle<Promise> handle) noexcept
+          {
+            return handle.promise().m_continuation;
+          }
+          void await_resume() const noexcept {}
+        };
+
+        task_promise_base()
+            : m_continuation(rsl::noop_coroutine())
+        {
+        }
+
+        suspend_always initial_suspend() const noexcept
+        {
+          return {};
+        }
+        final_awaiter final_suspend() const noexcept
+        {
+          return {};
+        }
+
+        // rsl doesn't use exceptions, a task that throws terminates the program
+        void unhandled_exception() const
+        {
+          rsl::terminate();
+        }
+
+        void set_continuation(coroutine_handle<> continuation)
+        {
+          m_continuation = continuation;
+        }
+
+      private:
+        coroutine_handle<> m_continuation;
+      };
+
+      template <typename T>
+      class task_promise : public task_promise_base
+      {
+      public:
+        task_promise()
+            : m_has_value(false)
+        {
+        }
+        task_promise(const task_promise&) = delete;
+        task_promise(task_promise&&)      = delete;
+        ~task_promise()
+        {
+          if(m_has_value)
+          {
+            m_storage.template get<T>()->~T();
+          }
+        }
+
+        task_promise& operator=(const task_promise&) = delete;
+        task_promise& operator=(task_promise&&)      = delete;
+
+        task<T> get_return_object();
+
+        template <typename U>
+        void return_value(U&& value)
+        {
+          m_storage.template set<T>(rsl::forward<U>(value));
+          m_has_value = true;
+        }
+
+        T& result()
+        {
+          RSL_ASSERT_X(m_has_value, "getting the result of a task that didn't return a value");
+          return *m_storage.template get<T>();
+        }
+
+      private:
+        rsl::aligned_storage_t<T> m_storage;
+        bool m_has_value;
+      };
+
+      // a task returning a reference holds on to the address of the referenced object
+      template <typename T>
+      class task_promise<T&> : public task_promise_base
+      {
+      public:
+        task_promise()
+            : m_value(nullptr)
+        {
+        }
+
+        task<T&> get_return_object();
+
+        void return_value(T& value)
+        {
+          m_value = rsl::addressof(value);
+        }
+
+        T& result()
+        {
+          RSL_ASSERT_X(m_value != nullptr, "getting the result of a task that didn't return a value");
+          return *m_value;
+        }
+
+      private:
+        T* m_value;
+      };
+
+      template <>
+      class task_promise<void> : public task_promise_base
+      {
+      public:
+        task<void> get_return_object();
+
+        void return_void() const {}
+
+        void result() const {}
+      };
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    template <typename T>
+    class task
+    {
+    public:
+      using promise_type = internal::task_promise<T>;
+      using handle_type  = coroutine_handle<promise_type>;
+
+      task()
+          : m_handle(nullptr)
+      {
+      }
+      explicit task(handle_type handle)
+          : m_handle(handle)
+      {
+      }
+      task(const task&) = delete;
+      task(task&& other)
+          : m_handle(rsl::exchange(other.m_handle, nullptr))
+      {
+      }
+      ~task()
+      {
+        if(m_handle)
+        {
+          m_handle.destroy();
+        }
+      }
+
+      task& operator=(const task&) = delete;
+      task& operator=(task&& other)
+      {
+        if(this != &other)
+        {
+          if(m_handle)
+          {
+            m_handle.destroy();
+          }
+          m_handle = rsl::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+      }
+
+      bool valid() const
+      {
+        return static_cast<bool>(m_handle);
+      }
+      // a task is ready once it ran to completion, awaiting it returns its result immediately
+      bool is_ready() const
+      {
+        return !m_handle || m_handle.done();
+      }
+
+      // awaiting an lvalue task returns a reference to its result, which lives as long as the task
+      auto operator co_await() & noexcept
+      {
+        class lvalue_awaiter : public awaiter_base
+        {
+        public:
+          using awaiter_base::awaiter_base;
+
+          decltype(auto) await_resume()
+          {
+            return this->handle().promise().result();
+          }
+        };
+
+        return lvalue_awaiter(m_handle);
+      }
+      // awaiting an rvalue task moves its result out
+      auto operator co_await() && noexcept
+      {
+        class rvalue_awaiter : public awaiter_base
+        {
+        public:
+          using awaiter_base::awaiter_base;
+
+          decltype(auto) await_resume()
+          {
+            if constexpr(rsl::is_reference_v<T> || rsl::is_void_v<T>)
+            {
+              return this->handle().promise().result();
+            }
+            else
+            {
+              return T(rsl::move(this->handle().promise().result()));
+            }
+          }
+        };
+
+        return rvalue_awaiter(m_handle);
+      }
+
+    private:
+      class awaiter_base
+      {
+      public:
+        explicit awaiter_base(handle_type handle)
+            : m_handle(handle)
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+          return !m_handle || m_handle.done();
+        }
+        // starts the task and tells it to resume the awaiting coroutine when it's done
+        coroutine_handle<> await_suspend(coroutine_handle<> awaiting) noexcept
+        {
+          m_handle.promise().set_continuation(awaiting);
+          return m_handle;
+        }
+
+      protected:
+        handle_type handle() const
+        {
+          RSL_ASSERT_X(m_handle, "awaiting an invalid task");
+          return m_handle;
+        }
+
+      private:
+        handle_type m_handle;
+      };
+
+    private:
+      handle_type m_handle;
+    };
+
+    namespace internal
+    {
+      template <typename T>
+      task<T> task_promise<T>::get_return_object()
+      {
+        return task<T>(coroutine_handle<task_promise>::from_promise(*this));
+      }
+      template <typename T>
+      task<T&> task_promise<T&>::get_return_object()
+      {
+        return task<T&>(coroutine_handle<task_promise>::from_promise(*this));
+      }
+      inline task<void> task_promise<void>::get_return_object()
+      {
+        return task<void>(coroutine_handle<task_promise>::from_promise(*this));
+      }
+    } // namespace internal
+  } // namespace v1
+} // namespace rsl
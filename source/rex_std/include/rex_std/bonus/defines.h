@@ -41,7 +41,11 @@
 #define RSL_MERGE1(a, b) RSL_MERGE2(a, b)
 #define RSL_MERGE2(a, b) a##b
 
-#define RSL_FUNC_SIGNATURE __FUNCSIG__
+#if defined RSL_COMPILER_MSVC
+  #define RSL_FUNC_SIGNATURE __FUNCSIG__
+#else
+  #define RSL_FUNC_SIGNATURE __PRETTY_FUNCTION__
+#endif
 
 #ifdef __COUNTER__
   #define RSL_ANONYMOUS_VARIABLE(str) RSL_MERGE(str, __COUNTER__)
@@ -64,7 +68,7 @@
   #define RSL_STATIC_TODO(msg)
 #endif
 
-#if defined RSL_COMPILER_CLANG
+#if defined RSL_COMPILER_CLANG || defined RSL_COMPILER_GCC
   #define RSL_DEBUG_BREAK() __builtin_trap()
 #elif defined RSL_COMPILER_MSVC
   #define RSL_DEBUG_BREAK() __debugbreak()
@@ -72,4 +76,8 @@
   #error RSL_DEBUG_BREAK unsupported machine instruction ...
 #endif
 
-#define RSL_FORCE_INLINE __forceinline
\ No newline at end of file
+#if defined RSL_COMPILER_MSVC
+  #define RSL_FORCE_INLINE __forceinline
+#else
+  #define RSL_FORCE_INLINE inline __attribute__((always_inline))
+#endif
\ No newline at end of file
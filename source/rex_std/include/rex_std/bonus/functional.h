@@ -12,5 +12,7 @@
 
 #pragma once
 
+#include "rex_std/bonus/functional/fast_hash.h"
+#include "rex_std/bonus/functional/hash_lower.h"
 #include "rex_std/bonus/functional/hash_result.h"
-#include "rex_std/bonus/functional/hash_lower.h"
\ No newline at end of file
+#include "rex_std/bonus/functional/wyhash.h"
\ No newline at end of file
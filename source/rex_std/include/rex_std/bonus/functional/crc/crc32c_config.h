@@ -22,7 +22,12 @@
 
   // Define to 1 if targeting ARM and the compiler has the __crc32c{b,h,w,d} and
   // the vmull_p64 intrinsics.
-  #define HAVE_ARM64_CRC32C 0
+  // These are only available when the target enables the crc and crypto extensions.
+  #if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32) && defined(__ARM_FEATURE_CRYPTO)
+    #define HAVE_ARM64_CRC32C 1
+  #else
+    #define HAVE_ARM64_CRC32C 0
+  #endif
 
   // Define to 1 if the system libraries have the getauxval function in the
   // <sys/auxv.h> header. Should be true on Linux and Android API level 20+.
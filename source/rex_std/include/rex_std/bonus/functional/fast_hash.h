@@ -0,0 +1,105 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: fast_hash.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/functional/hash_result.h"
+#include "rex_std/bonus/functional/wyhash.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/bit/bit_cast.h"
+#include "rex_std/internal/string/string_forward_declare.h"
+#include "rex_std/internal/type_traits/is_enum.h"
+#include "rex_std/internal/type_traits/is_integral.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (14/Oct/2023)
+    // Spreads every bit of the input over every bit of the output.
+    // This is the splitmix64 finalizer ("mix13" by David Stafford), it's a bijection
+    // so different integers never collide before the result is reduced to a bucket index.
+    constexpr uint64 hash_mix(uint64 x)
+    {
+      x ^= x >> 30;
+      x *= 0xBF58476D1CE4E5B9ull;
+      x ^= x >> 27;
+      x *= 0x94D049BB133111EBull;
+      x ^= x >> 31;
+      return x;
+    }
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (14/Oct/2023)
+    // An alternative to rsl::hash, meant to be passed as the hash type of hash containers.
+    // rsl::hash returns integers as is and hashes strings with crc32c, which is fine for small tables
+    // using prime bucket counts. fast_hash mixes integers, so they work well with power of 2 tables,
+    // and hashes strings with wyhash, which is faster and gives 64 bits when hash_result is 64 bit.
+    //
+    // eg. rsl::hash_map<rsl::string, int, rsl::fast_hash<rsl::string>>
+    template <typename T>
+    struct fast_hash
+    {
+      static_assert(rsl::is_integral_v<T> || rsl::is_enum_v<T>, "No rsl::fast_hash implementation for type T");
+
+      constexpr hash_result operator()(T val) const
+      {
+        return static_cast<hash_result>(hash_mix(static_cast<uint64>(val)));
+      }
+    };
+
+    template <typename T>
+    struct fast_hash<T*>
+    {
+      hash_result operator()(T* p) const
+      {
+        return static_cast<hash_result>(hash_mix(reinterpret_cast<uintptr>(p))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      }
+    };
+
+    template <>
+    struct fast_hash<float32>
+    {
+      constexpr hash_result operator()(float32 val) const
+      {
+        // 0.0f and -0.0f compare equal, so they need to have the same hash
+        return static_cast<hash_result>(hash_mix(val == 0.0f ? 0 : rsl::bit_cast<uint32>(val)));
+      }
+    };
+    template <>
+    struct fast_hash<float64>
+    {
+      constexpr hash_result operator()(float64 val) const
+      {
+        // 0.0 and -0.0 compare equal, so they need to have the same hash
+        return static_cast<hash_result>(hash_mix(val == 0.0 ? 0 : rsl::bit_cast<uint64>(val)));
+      }
+    };
+
+    template <typename Traits>
+    struct fast_hash<basic_string_view<char8, Traits>>
+    {
+      constexpr hash_result operator()(const basic_string_view<char8, Traits>& str) const
+      {
+        return static_cast<hash_result>(wyhash::compute(str.data(), str.length()));
+      }
+    };
+    template <typename Traits, typename Alloc>
+    struct fast_hash<basic_string<char8, Traits, Alloc>>
+    {
+      constexpr hash_result operator()(const basic_string<char8, Traits, Alloc>& str) const
+      {
+        return static_cast<hash_result>(wyhash::compute(str.data(), str.length()));
+      }
+    };
+
+  } // namespace v1
+} // namespace rsl
@@ -13,7 +13,7 @@
 #pragma once
 
 #include "rex_std/bonus/functional/hash_result.h"
-#include "rex_std/bonus/functional/crc/crc32c.h"
+#include "rex_std/internal/functional/hash.h"
 
 namespace rsl
 {
@@ -24,7 +24,7 @@ namespace rsl
     {
       constexpr rsl::hash_result operator()(const StringType& str) const
       {
-        return rsl::crc32::compute_as_lower(str.data(), str.length());
+        return rsl::internal::hash_as_lower(str.data(), str.length());
       }
     };
   } // namespace v1
@@ -19,7 +19,14 @@ namespace rsl
   inline namespace v1
   {
 
+    // Define RSL_ENABLE_64BIT_HASH to use 64 bit hashes throughout the library.
+    // 32 bits is plenty for most tables, but collisions become common after a few million keys.
+    // With 64 bit hashes, strings are hashed with wyhash instead of crc32c, as crc32c only gives 32 bits.
+#if defined(RSL_ENABLE_64BIT_HASH)
+    using hash_result = uint64;
+#else
     using hash_result = uint32;
+#endif
 
   } // namespace v1
 } // namespace rsl
@@ -0,0 +1,198 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: wyhash.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// wyhash (final version 4) by Wang Yi, released in the public domain.
+// https://github.com/wangyi-fudan/wyhash
+//
+// A 64 bit hash that consumes 48 bytes per loop iteration with 3 independent
+// 64x64 -> 128 bit multiplies, which makes it a lot faster than crc32c
+// on anything longer than a few bytes, while giving a full 64 bit result.
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/ctype.h"
+#include "rex_std/internal/type_traits/is_constant_evaluated.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace wyhash
+    {
+      namespace internal
+      {
+        inline constexpr uint64 g_secret[4] = {0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+
+        // 64x64 -> 128 bit multiply using 32 bit halves, so it can run at compile time.
+        // a receives the low half of the result, b the high half.
+        constexpr void mum_portable(uint64& a, uint64& b)
+        {
+          const uint64 ha = a >> 32;
+          const uint64 hb = b >> 32;
+          const uint64 la = static_cast<uint32>(a);
+          const uint64 lb = static_cast<uint32>(b);
+
+          const uint64 rh  = ha * hb;
+          const uint64 rm0 = ha * lb;
+          const uint64 rm1 = hb * la;
+          const uint64 rl  = la * lb;
+
+          const uint64 t  = rl + (rm0 << 32);
+          uint64 carry    = t < rl ? 1 : 0;
+          const uint64 lo = t + (rm1 << 32);
+          carry += lo < t ? 1 : 0;
+
+          a = lo;
+          b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+        }
+
+        // reads the input a byte at a time, passing every byte through ByteTransform first.
+        // this is the only reader that can run at compile time.
+        template <typename ByteTransform>
+        struct bytewise_reader
+        {
+          constexpr uint64 read(const char8* p, card32 count) const
+          {
+            uint64 res = 0;
+            for(card32 i = 0; i < count; ++i)
+            {
+              res |= static_cast<uint64>(ByteTransform {}(p[i])) << (8 * i);
+            }
+            return res;
+          }
+          constexpr uint64 read8(const char8* p) const
+          {
+            return read(p, 8);
+          }
+          constexpr uint64 read4(const char8* p) const
+          {
+            return read(p, 4);
+          }
+          // reads 1 to 3 bytes, without branching on the length
+          constexpr uint64 read3(const char8* p, card64 k) const
+          {
+            return (static_cast<uint64>(ByteTransform {}(p[0])) << 16) | (static_cast<uint64>(ByteTransform {}(p[k >> 1])) << 8) | static_cast<uint64>(ByteTransform {}(p[k - 1]));
+          }
+          constexpr void mum(uint64& a, uint64& b) const
+          {
+            mum_portable(a, b);
+          }
+        };
+
+        struct identity_byte
+        {
+          constexpr uint8 operator()(char8 c) const
+          {
+            return static_cast<uint8>(c);
+          }
+        };
+        struct lower_byte
+        {
+          constexpr uint8 operator()(char8 c) const
+          {
+            return static_cast<uint8>(rsl::to_lower(c));
+          }
+        };
+
+        // the hash itself, Reader decides how the input is loaded and how the 128 bit multiply is performed.
+        template <typename Reader>
+        constexpr uint64 compute_impl(const char8* p, card64 len, uint64 seed, const Reader& reader)
+        {
+          auto mix = [&reader](uint64 a, uint64 b)
+          {
+            reader.mum(a, b);
+            return a ^ b;
+          };
+
+          seed ^= mix(seed ^ g_secret[0], g_secret[1]);
+          uint64 a = 0;
+          uint64 b = 0;
+
+          if(len <= 16)
+          {
+            if(len >= 4)
+            {
+              const card64 offset = (len >> 3) << 2;
+              a                   = (reader.read4(p) << 32) | reader.read4(p + offset);
+              b                   = (reader.read4(p + len - 4) << 32) | reader.read4(p + len - 4 - offset);
+            }
+            else if(len > 0)
+            {
+              a = reader.read3(p, len);
+            }
+          }
+          else
+          {
+            card64 i = len;
+            if(i > 48)
+            {
+              uint64 see1 = seed;
+              uint64 see2 = seed;
+              do
+              {
+                seed = mix(reader.read8(p) ^ g_secret[1], reader.read8(p + 8) ^ seed);
+                see1 = mix(reader.read8(p + 16) ^ g_secret[2], reader.read8(p + 24) ^ see1);
+                see2 = mix(reader.read8(p + 32) ^ g_secret[3], reader.read8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+              } while(i > 48);
+              seed ^= see1 ^ see2;
+            }
+            while(i > 16)
+            {
+              seed = mix(reader.read8(p) ^ g_secret[1], reader.read8(p + 8) ^ seed);
+              i -= 16;
+              p += 16;
+            }
+            a = reader.read8(p + i - 16);
+            b = reader.read8(p + i - 8);
+          }
+
+          a ^= g_secret[1];
+          b ^= seed;
+          reader.mum(a, b);
+          return mix(a ^ g_secret[0] ^ static_cast<uint64>(len), b ^ g_secret[1]);
+        }
+
+        // the byte at a time version, this is the only version that can run at compile time
+        constexpr uint64 compute_bytewise(const char8* data, card64 len, uint64 seed)
+        {
+          return compute_impl(data, len, seed, bytewise_reader<identity_byte> {});
+        }
+
+        // uses word loads and the native 128 bit multiply of the cpu.
+        uint64 compute_runtime(const void* data, card64 len, uint64 seed);
+      } // namespace internal
+
+      constexpr uint64 compute(const char8* data, card64 len, uint64 seed = 0)
+      {
+        if(rsl::is_constant_evaluated())
+        {
+          return internal::compute_bytewise(data, len, seed);
+        }
+
+        return internal::compute_runtime(data, len, seed);
+      }
+      // hashes len bytes of any data, like wide strings. this can only run at runtime
+      inline uint64 compute(const void* data, card64 len, uint64 seed = 0)
+      {
+        return internal::compute_runtime(data, len, seed);
+      }
+      // computes a hash of a string as if all characters in the string were lower case
+      constexpr uint64 compute_as_lower(const char8* data, card64 len, uint64 seed = 0)
+      {
+        return internal::compute_impl(data, len, seed, internal::bytewise_reader<internal::lower_byte> {});
+      }
+    } // namespace wyhash
+  }   // namespace v1
+} // namespace rsl
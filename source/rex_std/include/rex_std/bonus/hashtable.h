@@ -12,12 +12,20 @@
 
 #pragma once
 
+#include "rex_std/bonus/hashtable/flat_hash_map.h"
+#include "rex_std/bonus/hashtable/flat_hash_set.h"
+#include "rex_std/bonus/hashtable/flat_hashtable.h"
+#include "rex_std/bonus/hashtable/flat_hashtable_group.h"
+#include "rex_std/bonus/hashtable/flat_hashtable_iterator.h"
 #include "rex_std/bonus/hashtable/hash_map.h"
 #include "rex_std/bonus/hashtable/hash_node.h"
+#include "rex_std/bonus/hashtable/hash_required_result.h"
 #include "rex_std/bonus/hashtable/hashtable.h"
 #include "rex_std/bonus/hashtable/hashtable_iterator.h"
+#include "rex_std/bonus/hashtable/mask_range_hashing.h"
 #include "rex_std/bonus/hashtable/mod_range_hashing.h"
 #include "rex_std/bonus/hashtable/node_iterator.h"
 #include "rex_std/bonus/hashtable/node_iterator_base.h"
+#include "rex_std/bonus/hashtable/power_of_two_rehash_policy.h"
 #include "rex_std/bonus/hashtable/prime_rehash_policy.h"
 #include "rex_std/bonus/hashtable/rehash_base.h"
\ No newline at end of file
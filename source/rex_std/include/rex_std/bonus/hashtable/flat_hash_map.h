@@ -0,0 +1,223 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: flat_hash_map.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/defines.h"
+#include "rex_std/bonus/hashtable/flat_hashtable.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/bonus/utility/key_value.h"
+#include "rex_std/bonus/utility/use_first.h"
+#include "rex_std/internal/functional/equal_to.h"
+#include "rex_std/internal/functional/hash.h"
+#include "rex_std/internal/memory/allocator.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (14/Oct/2023)
+    // A hash map storing its elements inline, in a single allocation, instead of in nodes.
+    // This is a lot faster than hash_map for both lookups and insertions,
+    // at the cost of elements moving when the map grows (which invalidates iterators and references).
+    template <typename Key, typename Value, typename Hash = rsl::hash<Key>, typename Equal = rsl::equal_to<Key>, typename Alloc = allocator>
+    class flat_hash_map : public flat_hashtable<Key, key_value<const Key, Value>, Alloc, use_first<key_value<const Key, Value>>, Equal, Hash>
+    {
+    public:
+      using base_type          = flat_hashtable<Key, key_value<const Key, Value>, Alloc, use_first<key_value<const Key, Value>>, Equal, Hash>;
+      using this_type          = flat_hash_map<Key, Value, Hash, Equal, Alloc>;
+      using size_type          = typename base_type::size_type;
+      using key_type           = typename base_type::key_type;
+      using mapped_type        = Value;
+      using value_type         = typename base_type::value_type;
+      using allocator_type     = typename base_type::allocator_type;
+      using insert_return_type = typename base_type::insert_return_type;
+      using iterator           = typename base_type::iterator;
+      using const_iterator     = typename base_type::const_iterator;
+
+      using base_type::insert;
+
+      explicit flat_hash_map(const allocator_type& allocator = allocator_type())
+          : base_type(0_size, Hash(), Equal(), use_first<value_type>(), allocator)
+      {
+      }
+
+      explicit flat_hash_map(Size capacity, const Hash& hashFunction = Hash(), const Equal& keyEqual = Equal(), const allocator_type& allocator = allocator_type())
+          : base_type(capacity, hashFunction, keyEqual, use_first<value_type>(), allocator)
+      {
+      }
+
+      flat_hash_map(const this_type& other)
+          : base_type(other)
+      {
+      }
+
+      flat_hash_map(this_type&& other)
+          : base_type(rsl::move(other))
+      {
+      }
+
+      ~flat_hash_map() = default;
+
+      flat_hash_map(initializer_list<value_type> ilist, Size capacity = 0_size, const Hash& hashFunction = Hash(), const Equal& keyEqual = Equal(), const allocator_type& allocator = allocator_type())
+          : base_type(ilist.begin(), ilist.end(), capacity, hashFunction, keyEqual, use_first<value_type>(), allocator)
+      {
+      }
+
+      template <typename ForwardIterator>
+      flat_hash_map(ForwardIterator first, ForwardIterator last, Size capacity = 0_size, const Hash& hashFunction = Hash(), const Equal& keyEqual = Equal(), const allocator_type& allocator = allocator_type())
+          : base_type(first, last, capacity, hashFunction, keyEqual, use_first<value_type>(), allocator)
+      {
+      }
+
+      this_type& operator=(const this_type& other)
+      {
+        return static_cast<this_type&>(base_type::operator=(other));
+      }
+      this_type& operator=(this_type&& other)
+      {
+        return static_cast<this_type&>(base_type::operator=(rsl::move(other)));
+      }
+      this_type& operator=(initializer_list<value_type> ilist)
+      {
+        return static_cast<this_type&>(base_type::operator=(ilist));
+      }
+
+      template <typename M>
+      insert_return_type insert_or_assign(const key_type& k, M&& obj)
+      {
+        insert_return_type res = base_type::try_emplace(k, rsl::forward<M>(obj));
+        if(!res.emplace_successful)
+        {
+          res.inserted_element->value = rsl::forward<M>(obj);
+        }
+        return res;
+      }
+      template <typename M>
+      insert_return_type insert_or_assign(key_type&& k, M&& obj)
+      {
+        insert_return_type res = base_type::try_emplace(rsl::move(k), rsl::forward<M>(obj));
+        if(!res.emplace_successful)
+        {
+          res.inserted_element->value = rsl::forward<M>(obj);
+        }
+        return res;
+      }
+
+      Value& at(const key_type& k)
+      {
+        iterator it = base_type::find(k);
+
+        if(it == base_type::end())
+        {
+          RSL_ASSERT("Key k not found in flat_hash_map");
+        }
+
+        return it->value;
+      }
+      const Value& at(const key_type& k) const
+      {
+        const_iterator it = base_type::find(k);
+
+        if(it == base_type::end())
+        {
+          RSL_ASSERT("Key k not found in flat_hash_map");
+        }
+
+        return it->value;
+      }
+      template <typename K>
+      Value& at(const K& k)
+      {
+        iterator it = base_type::find(k);
+
+        if(it == base_type::end())
+        {
+          RSL_ASSERT("Key k not found in flat_hash_map");
+        }
+
+        return it->value;
+      }
+      template <typename K>
+      const Value& at(const K& k) const
+      {
+        const_iterator it = base_type::find(k);
+
+        if(it == base_type::end())
+        {
+          RSL_ASSERT("Key k not found in flat_hash_map");
+        }
+
+        return it->value;
+      }
+
+      mapped_type& operator[](const key_type& key)
+      {
+        return base_type::try_emplace_keylike(key).inserted_element->value;
+      }
+      mapped_type& operator[](key_type&& key)
+      {
+        return base_type::try_emplace_keylike(rsl::move(key)).inserted_element->value;
+      }
+      // the key is only constructed from k if it's not in the map yet
+      template <typename K>
+      mapped_type& operator[](K&& k)
+      {
+        return base_type::try_emplace_keylike(rsl::forward<K>(k)).inserted_element->value;
+      }
+    };
+
+    template <typename Key, typename Value, typename Hash, typename Equal, typename Alloc>
+    bool operator==(const flat_hash_map<Key, Value, Hash, Equal, Alloc>& lhs, const flat_hash_map<Key, Value, Hash, Equal, Alloc>& rhs)
+    {
+      if(lhs.size() != rhs.size())
+      {
+        return false;
+      }
+
+      for(const auto& kv : lhs)
+      {
+        auto it = rhs.find(kv.key);
+        if(it == rhs.end() || !(it->value == kv.value))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+    template <typename Key, typename Value, typename Hash, typename Equal, typename Alloc>
+    bool operator!=(const flat_hash_map<Key, Value, Hash, Equal, Alloc>& lhs, const flat_hash_map<Key, Value, Hash, Equal, Alloc>& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    template <typename Key, typename Value, typename Hash, typename Equal, typename Alloc, typename Predicate>
+    typename flat_hash_map<Key, Value, Hash, Equal, Alloc>::size_type erase_if(flat_hash_map<Key, Value, Hash, Equal, Alloc>& map, Predicate pred)
+    {
+      const auto old_size = map.size();
+      for(auto it = map.begin(); it != map.end();)
+      {
+        if(pred(*it))
+        {
+          it = map.erase(it);
+        }
+        else
+        {
+          ++it;
+        }
+      }
+      return old_size - map.size();
+    }
+
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,133 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: flat_hash_set.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/hashtable/flat_hashtable.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/bonus/utility/use_self.h"
+#include "rex_std/internal/functional/equal_to.h"
+#include "rex_std/internal/functional/hash.h"
+#include "rex_std/internal/memory/allocator.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (14/Oct/2023)
+    // A hash set storing its elements inline, in a single allocation, instead of in nodes.
+    // Elements move when the set grows, which invalidates iterators and references.
+    template <typename Value, typename Hash = rsl::hash<Value>, typename Equal = rsl::equal_to<Value>, typename Alloc = allocator>
+    class flat_hash_set : public flat_hashtable<Value, Value, Alloc, use_self<Value>, Equal, Hash>
+    {
+    public:
+      using base_type          = flat_hashtable<Value, Value, Alloc, use_self<Value>, Equal, Hash>;
+      using this_type          = flat_hash_set<Value, Hash, Equal, Alloc>;
+      using size_type          = typename base_type::size_type;
+      using key_type           = typename base_type::key_type;
+      using value_type         = typename base_type::value_type;
+      using allocator_type     = typename base_type::allocator_type;
+      using insert_return_type = typename base_type::insert_return_type;
+      using iterator           = typename base_type::iterator;
+      using const_iterator     = typename base_type::const_iterator;
+
+      explicit flat_hash_set(const allocator_type& allocator = allocator_type())
+          : base_type(0_size, Hash(), Equal(), use_self<Value>(), allocator)
+      {
+      }
+
+      explicit flat_hash_set(Size capacity, const Hash& hashFunction = Hash(), const Equal& keyEqual = Equal(), const allocator_type& allocator = allocator_type())
+          : base_type(capacity, hashFunction, keyEqual, use_self<Value>(), allocator)
+      {
+      }
+
+      flat_hash_set(const this_type& other)
+          : base_type(other)
+      {
+      }
+
+      flat_hash_set(this_type&& other)
+          : base_type(rsl::move(other))
+      {
+      }
+
+      ~flat_hash_set() = default;
+
+      flat_hash_set(initializer_list<value_type> ilist, Size capacity = 0_size, const Hash& hashFunction = Hash(), const Equal& keyEqual = Equal(), const allocator_type& allocator = allocator_type())
+          : base_type(ilist.begin(), ilist.end(), capacity, hashFunction, keyEqual, use_self<Value>(), allocator)
+      {
+      }
+
+      template <typename ForwardIterator>
+      flat_hash_set(ForwardIterator first, ForwardIterator last, Size capacity = 0_size, const Hash& hashFunction = Hash(), const Equal& keyEqual = Equal(), const allocator_type& allocator = allocator_type())
+          : base_type(first, last, capacity, hashFunction, keyEqual, use_self<Value>(), allocator)
+      {
+      }
+
+      this_type& operator=(const this_type& other)
+      {
+        return static_cast<this_type&>(base_type::operator=(other));
+      }
+      this_type& operator=(this_type&& other)
+      {
+        return static_cast<this_type&>(base_type::operator=(rsl::move(other)));
+      }
+      this_type& operator=(initializer_list<value_type> ilist)
+      {
+        return static_cast<this_type&>(base_type::operator=(ilist));
+      }
+    };
+
+    template <typename Value, typename Hash, typename Equal, typename Alloc>
+    bool operator==(const flat_hash_set<Value, Hash, Equal, Alloc>& lhs, const flat_hash_set<Value, Hash, Equal, Alloc>& rhs)
+    {
+      if(lhs.size() != rhs.size())
+      {
+        return false;
+      }
+
+      for(const auto& value : lhs)
+      {
+        if(!rhs.contains(value))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+    template <typename Value, typename Hash, typename Equal, typename Alloc>
+    bool operator!=(const flat_hash_set<Value, Hash, Equal, Alloc>& lhs, const flat_hash_set<Value, Hash, Equal, Alloc>& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    template <typename Value, typename Hash, typename Equal, typename Alloc, typename Predicate>
+    typename flat_hash_set<Value, Hash, Equal, Alloc>::size_type erase_if(flat_hash_set<Value, Hash, Equal, Alloc>& set, Predicate pred)
+    {
+      const auto old_size = set.size();
+      for(auto it = set.begin(); it != set.end();)
+      {
+        if(pred(*it))
+        {
+          it = set.erase(it);
+        }
+        else
+        {
+          ++it;
+        }
+      }
+      return old_size - set.size();
+    }
+
+  } // namespace v1
+} // namespace rsl
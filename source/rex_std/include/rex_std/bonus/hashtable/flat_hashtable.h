@@ -0,0 +1,709 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: flat_hashtable.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/functional/hash_result.h"
+#include "rex_std/bonus/hashtable/flat_hashtable_group.h"
+#include "rex_std/bonus/hashtable/flat_hashtable_iterator.h"
+#include "rex_std/bonus/type_traits/strip_template.h"
+#include "rex_std/bonus/utility/compressed_pair.h"
+#include "rex_std/bonus/utility/emplace_result.h"
+#include "rex_std/initializer_list.h"
+#include "rex_std/internal/assert/assert_fwd.h"
+#include "rex_std/internal/bit/countl_zero.h"
+#include "rex_std/internal/memory/addressof.h"
+#include "rex_std/internal/memory/memset.h"
+#include "rex_std/internal/type_traits/is_constructible.h"
+#include "rex_std/internal/type_traits/is_same.h"
+#include "rex_std/internal/type_traits/is_trivially_destructible.h"
+#include "rex_std/internal/utility/forward.h"
+#include "rex_std/internal/utility/move.h"
+#include "rex_std/internal/utility/swap.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    // An open addressing hashtable storing its elements inline, in a single allocation.
+    // The allocation starts with 1 control byte per slot, followed by the slots.
+    // Lookups scan the control bytes a group at a time and only compare keys when the
+    // 7 hash bits stored in the control byte match, which is almost always the correct element.
+    //
+    // Unlike the node based hashtable, elements move on rehash.
+    // so iterators, pointers and references are invalidated by any insertion that grows the table.
+    template <typename Key, typename Value, typename Alloc, typename ExtractKey, typename Equal, typename KeyHash>
+    class flat_hashtable
+    {
+    public:
+      using key_type           = Key;
+      using value_type         = Value;
+      using allocator_type     = Alloc;
+      using key_equal          = Equal;
+      using difference_type    = ptrdiff;
+      using size_type          = count_t;
+      using reference          = value_type&;
+      using const_reference    = const value_type&;
+      using iterator           = flat_hashtable_iterator<value_type, false>;
+      using const_iterator     = flat_hashtable_iterator<value_type, true>;
+      using insert_return_type = insert_result<iterator>;
+      using this_type          = flat_hashtable<Key, Value, Alloc, ExtractKey, Equal, KeyHash>;
+      using extract_key_type   = ExtractKey;
+      using key_hash_type      = KeyHash;
+
+      flat_hashtable()
+          : m_cp_key_equal_and_ctrl(empty_ctrl())
+          , m_cp_key_hash_and_slots(nullptr)
+          , m_cp_extract_key_and_size(0)
+          , m_capacity(0)
+          , m_growth_left(0)
+          , m_allocator()
+      {
+      }
+      flat_hashtable(Size capacity, const KeyHash& keyHash, const Equal& equal, const ExtractKey& extractKey, const allocator_type& allocator)
+          : m_cp_key_equal_and_ctrl(equal, empty_ctrl())
+          , m_cp_key_hash_and_slots(keyHash, nullptr)
+          , m_cp_extract_key_and_size(extractKey, 0)
+          , m_capacity(0)
+          , m_growth_left(0)
+          , m_allocator(allocator)
+      {
+        if(capacity.get() > 0)
+        {
+          resize(normalize_capacity(capacity.get()));
+        }
+      }
+
+      template <typename ForwardIterator>
+      flat_hashtable(ForwardIterator first, ForwardIterator last, Size capacity, const KeyHash& keyHash, const Equal& equal, const ExtractKey& extractKey, const allocator_type& allocator)
+          : flat_hashtable(capacity, keyHash, equal, extractKey, allocator)
+      {
+        insert(first, last);
+      }
+
+      flat_hashtable(const flat_hashtable& other)
+          : m_cp_key_equal_and_ctrl(other.m_cp_key_equal_and_ctrl.first(), empty_ctrl())
+          , m_cp_key_hash_and_slots(other.m_cp_key_hash_and_slots.first(), nullptr)
+          , m_cp_extract_key_and_size(other.m_cp_extract_key_and_size.first(), 0)
+          , m_capacity(0)
+          , m_growth_left(0)
+          , m_allocator(other.m_allocator)
+      {
+        reserve(other.size());
+
+        // all keys of other are unique, so we can skip the lookups
+        for(const value_type& value : other)
+        {
+          const uint64 hash = hash_of(extract_key()(value));
+          const card32 idx  = find_first_non_full(hash);
+          set_ctrl(idx, internal::flat_h2(hash));
+          new(slots() + idx) value_type(value);
+        }
+        m_cp_extract_key_and_size.second() = other.size();
+        m_growth_left                      = capacity_to_growth(capacity()) - size();
+      }
+
+      flat_hashtable(this_type&& other)
+          : flat_hashtable()
+      {
+        swap(other);
+      }
+
+      /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Sep/2022)
+      // We're not implementing an overload taking it's own allocator, as allocators
+      // need to be equivalent when moving in Rex Standard Library
+
+      ~flat_hashtable()
+      {
+        destroy_slots();
+        free_storage();
+      }
+
+      /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Sep/2022)
+      // This returns a copy of the allocator in the C++ Standard.
+      const allocator_type& get_allocator() const
+      {
+        return m_allocator;
+      }
+
+      this_type& operator=(const this_type& other)
+      {
+        RSL_ASSERT_X(this != addressof(other), "Can't copy to yourself");
+
+        clear();
+        insert(other.begin(), other.end());
+
+        return *this;
+      }
+      this_type& operator=(initializer_list<value_type> ilist)
+      {
+        clear();
+        insert(ilist.begin(), ilist.end());
+        return *this;
+      }
+      this_type& operator=(this_type&& other)
+      {
+        RSL_ASSERT_X(this != rsl::addressof(other), "Can't move to yourself");
+
+        clear();
+        swap(other);
+        return *this;
+      }
+
+      void swap(this_type& other)
+      {
+        rsl::swap(m_cp_key_equal_and_ctrl, other.m_cp_key_equal_and_ctrl);
+        rsl::swap(m_cp_key_hash_and_slots, other.m_cp_key_hash_and_slots);
+        rsl::swap(m_cp_extract_key_and_size, other.m_cp_extract_key_and_size);
+        rsl::swap(m_capacity, other.m_capacity);
+        rsl::swap(m_growth_left, other.m_growth_left);
+        rsl::swap(m_allocator, other.m_allocator);
+      }
+
+      iterator begin()
+      {
+        iterator it(ctrl(), slots());
+        it.skip_empty_or_deleted();
+        return it;
+      }
+      const_iterator begin() const
+      {
+        iterator it(ctrl(), slots());
+        it.skip_empty_or_deleted();
+        return it;
+      }
+      const_iterator cbegin() const
+      {
+        return begin();
+      }
+      iterator end()
+      {
+        return iterator(ctrl() + capacity(), slots() + capacity());
+      }
+      const_iterator end() const
+      {
+        return const_iterator(ctrl() + capacity(), slots() + capacity());
+      }
+      const_iterator cend() const
+      {
+        return end();
+      }
+
+      bool empty() const
+      {
+        return size() == 0;
+      }
+      size_type size() const
+      {
+        return m_cp_extract_key_and_size.second();
+      }
+      // the number of slots, this is always 0 or a power of 2 minus 1
+      size_type capacity() const
+      {
+        return m_capacity;
+      }
+
+      float32 load_factor() const
+      {
+        return capacity() == 0 ? 0.0f : static_cast<float32>(size()) / static_cast<float32>(capacity());
+      }
+      // the table grows when it'd become more than 7/8 full
+      float32 max_load_factor() const
+      {
+        return 0.875f;
+      }
+
+      template <typename... Args>
+      insert_return_type emplace(Args&&... args)
+      {
+        // we need the key to find the slot, so the element is built on the stack first
+        // it gets moved in its slot if its key is not in the table yet.
+        value_type new_val(rsl::forward<Args>(args)...);
+        return insert_unique(rsl::move(new_val));
+      }
+
+      template <typename... Args>
+      insert_return_type try_emplace(const key_type& k, Args&&... args)
+      {
+        return try_emplace_keylike(k, rsl::forward<Args>(args)...);
+      }
+      template <typename... Args>
+      insert_return_type try_emplace(key_type&& k, Args&&... args)
+      {
+        return try_emplace_keylike(rsl::move(k), rsl::forward<Args>(args)...);
+      }
+
+      insert_return_type insert(const value_type& value)
+      {
+        return insert_unique(value);
+      }
+      insert_return_type insert(value_type&& value)
+      {
+        return insert_unique(rsl::move(value));
+      }
+      void insert(initializer_list<value_type> ilist)
+      {
+        insert(ilist.begin(), ilist.end());
+      }
+      template <typename InputIterator>
+      void insert(InputIterator first, InputIterator last)
+      {
+        for(; first != last; ++first)
+        {
+          insert_unique(*first);
+        }
+      }
+
+      iterator erase(const_iterator position)
+      {
+        const card32 idx = static_cast<card32>(position.ctrl() - ctrl());
+        RSL_ASSERT_X(idx >= 0 && idx < capacity() && internal::is_flat_ctrl_full(ctrl()[idx]), "Invalid iterator passed to flat_hashtable::erase");
+
+        erase_at(idx);
+
+        iterator it_next(ctrl() + idx, slots() + idx);
+        it_next.skip_empty_or_deleted();
+        return it_next;
+      }
+      // without this, erasing with a mutable iterator would pick the key like overload below
+      iterator erase(iterator position)
+      {
+        return erase(const_iterator(position));
+      }
+      iterator erase(const_iterator first, const_iterator last)
+      {
+        // erasing never moves elements, so last stays valid
+        while(first != last)
+        {
+          first = erase(first);
+        }
+
+        return iterator(first.ctrl(), first.slot());
+      }
+      size_type erase(const key_type& k)
+      {
+        return erase_keylike(k);
+      }
+      template <typename K>
+      size_type erase(const K& k)
+      {
+        return erase_keylike(k);
+      }
+
+      void clear()
+      {
+        if(capacity() == 0)
+        {
+          return;
+        }
+
+        destroy_slots();
+        reset_ctrl();
+        m_cp_extract_key_and_size.second() = 0;
+        m_growth_left                      = capacity_to_growth(capacity());
+      }
+      // sets the capacity to at least count slots, or to the smallest capacity holding the current elements if that's bigger.
+      // rehash(0) shrinks the table to fit and gets rid of all deleted slots.
+      void rehash(size_type count)
+      {
+        if(count == 0 && capacity() == 0)
+        {
+          return;
+        }
+
+        const card32 new_capacity = normalize_capacity(count | growth_to_lower_bound_capacity(size()));
+        if(count == 0 || new_capacity > capacity())
+        {
+          resize(new_capacity);
+        }
+      }
+      void reserve(size_type elementCount)
+      {
+        if(elementCount > size() + m_growth_left)
+        {
+          resize(normalize_capacity(growth_to_lower_bound_capacity(elementCount)));
+        }
+      }
+
+      iterator find(const key_type& key)
+      {
+        const card32 idx = find_index(key);
+        return idx == capacity() ? end() : iterator(ctrl() + idx, slots() + idx);
+      }
+      const_iterator find(const key_type& key) const
+      {
+        const card32 idx = find_index(key);
+        return idx == capacity() ? end() : const_iterator(ctrl() + idx, slots() + idx);
+      }
+      template <typename K>
+      iterator find(const K& x)
+      {
+        const card32 idx = find_index(x);
+        return idx == capacity() ? end() : iterator(ctrl() + idx, slots() + idx);
+      }
+      template <typename K>
+      const_iterator find(const K& x) const
+      {
+        const card32 idx = find_index(x);
+        return idx == capacity() ? end() : const_iterator(ctrl() + idx, slots() + idx);
+      }
+      size_type count(const key_type& key) const
+      {
+        return find_index(key) == capacity() ? 0 : 1;
+      }
+      template <typename K>
+      size_type count(const K& x) const
+      {
+        return find_index(x) == capacity() ? 0 : 1;
+      }
+
+      bool contains(const Key& key) const
+      {
+        return find_index(key) != capacity();
+      }
+      template <typename K>
+      bool contains(const K& x) const
+      {
+        return find_index(x) != capacity();
+      }
+
+    protected:
+      template <typename K, typename... Args>
+      insert_return_type try_emplace_keylike(K&& k, Args&&... args)
+      {
+        const find_or_insert_result res = find_or_prepare_insert(k);
+        if(res.inserted)
+        {
+          new(slots() + res.idx) value_type(rsl::forward<K>(k), rsl::forward<Args>(args)...);
+        }
+        return insert_return_type {iterator(ctrl() + res.idx, slots() + res.idx), res.inserted};
+      }
+
+    private:
+      struct find_or_insert_result
+      {
+        card32 idx;
+        bool inserted;
+      };
+
+      static int8* empty_ctrl()
+      {
+        return const_cast<int8*>(internal::flat_empty_group()); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+      }
+
+      int8* ctrl() const
+      {
+        return m_cp_key_equal_and_ctrl.second();
+      }
+      value_type* slots() const
+      {
+        return m_cp_key_hash_and_slots.second();
+      }
+      const extract_key_type& extract_key() const
+      {
+        return m_cp_extract_key_and_size.first();
+      }
+
+      // capacities are always a power of 2 minus 1, so they can be used as a mask.
+      static constexpr card32 normalize_capacity(card32 n)
+      {
+        return n > 0 ? static_cast<card32>(~0u >> rsl::countl_zero(static_cast<uint32>(n))) : 1;
+      }
+      // we keep at least 1/8th of the slots empty so probing always ends on an empty slot
+      // a table of 7 slots with 8 wide groups would have no empty slot left, so it's 1 less there.
+      static constexpr card32 capacity_to_growth(card32 capacity)
+      {
+        return (internal::flat_group::width == 8 && capacity == 7) ? 6 : capacity - capacity / 8;
+      }
+      // the inverse of capacity_to_growth, this doesn't return a valid capacity yet.
+      static constexpr card32 growth_to_lower_bound_capacity(card32 growth)
+      {
+        return (internal::flat_group::width == 8 && growth == 7) ? 8 : growth + static_cast<card32>((static_cast<card64>(growth) - 1) / 7);
+      }
+
+      static constexpr card32 num_ctrl_bytes(card32 capacity)
+      {
+        // the sentinel, followed by a copy of the first group so groups can be loaded from any slot
+        return capacity + static_cast<card32>(internal::flat_group::width);
+      }
+      static constexpr card64 slot_offset(card32 capacity)
+      {
+        constexpr card64 align = alignof(value_type);
+        return (num_ctrl_bytes(capacity) + align - 1) & ~(align - 1);
+      }
+      static constexpr card64 alloc_size(card32 capacity)
+      {
+        return slot_offset(capacity) + static_cast<card64>(capacity) * static_cast<card64>(sizeof(value_type));
+      }
+
+      template <typename K>
+      hash_result hash_keylike_type(const K& type) const
+      {
+        // it's possible the type we pass in to look for something is different than the key type.
+        // eg. it's possible you pass in a string view while the hashtable itself is storing strings as keys
+        // so we use the same hash functor, instantiated for the key like type. see hashtable for more info.
+        using new_hash_type = rsl::change_template_t<key_hash_type, K>;
+        if constexpr(rsl::is_same_v<new_hash_type, key_hash_type>)
+        {
+          return m_cp_key_hash_and_slots.first()(type);
+        }
+        else
+        {
+          static_assert(rsl::is_constructible_v<key_type, K>, "key_type is not constructible from 'K'");
+
+          const new_hash_type hasher {};
+          return hasher(type);
+        }
+      }
+      template <typename K>
+      uint64 hash_of(const K& key) const
+      {
+        return internal::flat_hash_mix(hash_keylike_type(key));
+      }
+
+      // stores the control byte for a slot, and its copy after the sentinel if it's part of the first group
+      void set_ctrl(card32 idx, int8 h)
+      {
+        constexpr card32 num_cloned_bytes = static_cast<card32>(internal::flat_group::width) - 1;
+
+        ctrl()[idx]                                                                     = h;
+        ctrl()[((idx - num_cloned_bytes) & capacity()) + (num_cloned_bytes & capacity())] = h;
+      }
+
+      // returns the index of the slot holding the key, or the capacity if it's not in the table.
+      template <typename K>
+      card32 find_index(const K& key) const
+      {
+        const uint64 hash = hash_of(key);
+        const int8 h2     = internal::flat_h2(hash);
+
+        internal::flat_probe_seq seq(internal::flat_h1(hash), capacity());
+        while(true)
+        {
+          const internal::flat_group group(ctrl() + seq.offset());
+          for(const card32 i : group.match(h2))
+          {
+            const card32 idx = static_cast<card32>(seq.offset(i));
+            if(m_cp_key_equal_and_ctrl.first()(key, extract_key()(slots()[idx])))
+            {
+              return idx;
+            }
+          }
+          if(group.mask_empty())
+          {
+            return capacity();
+          }
+          seq.next();
+          RSL_ASSERT_X(seq.index() <= capacity(), "full flat hashtable, this should never happen");
+        }
+      }
+
+      // returns the index of the first empty or deleted slot in the probe sequence of hash
+      card32 find_first_non_full(uint64 hash) const
+      {
+        internal::flat_probe_seq seq(internal::flat_h1(hash), capacity());
+        while(true)
+        {
+          const auto mask = internal::flat_group(ctrl() + seq.offset()).mask_empty_or_deleted();
+          if(mask)
+          {
+            return static_cast<card32>(seq.offset(mask.lowest_bit_set()));
+          }
+          seq.next();
+          RSL_ASSERT_X(seq.index() <= capacity(), "full flat hashtable, this should never happen");
+        }
+      }
+
+      // returns the slot of the key if it's already in the table,
+      // otherwise marks a slot as full for the key and returns that instead.
+      // the caller is responsible for constructing the element in the returned slot.
+      template <typename K>
+      find_or_insert_result find_or_prepare_insert(const K& key)
+      {
+        const uint64 hash = hash_of(key);
+        const int8 h2     = internal::flat_h2(hash);
+
+        internal::flat_probe_seq seq(internal::flat_h1(hash), capacity());
+        while(true)
+        {
+          const internal::flat_group group(ctrl() + seq.offset());
+          for(const card32 i : group.match(h2))
+          {
+            const card32 idx = static_cast<card32>(seq.offset(i));
+            if(m_cp_key_equal_and_ctrl.first()(key, extract_key()(slots()[idx])))
+            {
+              return {idx, false};
+            }
+          }
+          if(group.mask_empty())
+          {
+            break;
+          }
+          seq.next();
+          RSL_ASSERT_X(seq.index() <= capacity(), "full flat hashtable, this should never happen");
+        }
+
+        return {prepare_insert(hash), true};
+      }
+
+      card32 prepare_insert(uint64 hash)
+      {
+        card32 idx = find_first_non_full(hash);
+
+        // a deleted slot can always be reused, an empty one only if we have growth left
+        if(m_growth_left == 0 && !internal::is_flat_ctrl_deleted(ctrl()[idx]))
+        {
+          rehash_and_grow_if_necessary();
+          idx = find_first_non_full(hash);
+        }
+
+        ++m_cp_extract_key_and_size.second();
+        m_growth_left -= internal::is_flat_ctrl_empty(ctrl()[idx]) ? 1 : 0;
+        set_ctrl(idx, internal::flat_h2(hash));
+        return idx;
+      }
+
+      void rehash_and_grow_if_necessary()
+      {
+        if(capacity() == 0)
+        {
+          resize(1);
+        }
+        else if(capacity() > static_cast<card32>(internal::flat_group::width) && static_cast<card64>(size()) * 32 <= static_cast<card64>(capacity()) * 25)
+        {
+          // most of the growth got used up by deleted slots, rehashing in a table
+          // of the same size gets rid of them, without using more memory.
+          resize(capacity());
+        }
+        else
+        {
+          resize(capacity() * 2 + 1);
+        }
+      }
+
+      template <typename V>
+      insert_return_type insert_unique(V&& value)
+      {
+        const find_or_insert_result res = find_or_prepare_insert(extract_key()(value));
+        if(res.inserted)
+        {
+          new(slots() + res.idx) value_type(rsl::forward<V>(value));
+        }
+        return insert_return_type {iterator(ctrl() + res.idx, slots() + res.idx), res.inserted};
+      }
+
+      template <typename K>
+      size_type erase_keylike(const K& k)
+      {
+        const card32 idx = find_index(k);
+        if(idx == capacity())
+        {
+          return 0;
+        }
+
+        erase_at(idx);
+        return 1;
+      }
+
+      void erase_at(card32 idx)
+      {
+        slots()[idx].~value_type();
+        --m_cp_extract_key_and_size.second();
+
+        // If the group around the slot had an empty slot on both sides of it, without a full group of slots between them,
+        // no probe sequence has ever gone past this slot looking for a key. we can mark it as empty instead of deleted then,
+        // which means lookups can stop here and the slot counts towards the growth again.
+        const card32 width        = static_cast<card32>(internal::flat_group::width);
+        const card32 idx_before   = (idx - width) & capacity();
+        const auto empty_after    = internal::flat_group(ctrl() + idx).mask_empty();
+        const auto empty_before   = internal::flat_group(ctrl() + idx_before).mask_empty();
+        const bool was_never_full = empty_before && empty_after && empty_after.trailing_zeros() + empty_before.leading_zeros() < width;
+
+        set_ctrl(idx, static_cast<int8>(was_never_full ? internal::flat_ctrl::empty : internal::flat_ctrl::deleted));
+        m_growth_left += was_never_full ? 1 : 0;
+      }
+
+      void resize(card32 newCapacity)
+      {
+        int8* old_ctrl           = ctrl();
+        value_type* old_slots    = slots();
+        const card32 old_capacity = capacity();
+
+        void* storage                      = m_allocator.allocate(alloc_size(newCapacity));
+        m_cp_key_equal_and_ctrl.second()   = static_cast<int8*>(storage);
+        m_cp_key_hash_and_slots.second()   = reinterpret_cast<value_type*>(static_cast<int8*>(storage) + slot_offset(newCapacity)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        m_capacity                         = newCapacity;
+        reset_ctrl();
+
+        for(card32 i = 0; i < old_capacity; ++i)
+        {
+          if(internal::is_flat_ctrl_full(old_ctrl[i]))
+          {
+            const uint64 hash = hash_of(extract_key()(old_slots[i]));
+            const card32 idx  = find_first_non_full(hash);
+            set_ctrl(idx, internal::flat_h2(hash));
+            new(slots() + idx) value_type(rsl::move(old_slots[i]));
+            old_slots[i].~value_type();
+          }
+        }
+
+        m_growth_left = capacity_to_growth(newCapacity) - size();
+
+        if(old_capacity > 0)
+        {
+          m_allocator.deallocate(old_ctrl, alloc_size(old_capacity));
+        }
+      }
+
+      void reset_ctrl()
+      {
+        rsl::memset(ctrl(), static_cast<int8>(internal::flat_ctrl::empty), static_cast<card32>(num_ctrl_bytes(capacity())));
+        ctrl()[capacity()] = static_cast<int8>(internal::flat_ctrl::sentinel);
+      }
+
+      void destroy_slots()
+      {
+        if constexpr(!rsl::is_trivially_destructible_v<value_type>)
+        {
+          for(card32 i = 0; i < capacity(); ++i)
+          {
+            if(internal::is_flat_ctrl_full(ctrl()[i]))
+            {
+              slots()[i].~value_type();
+            }
+          }
+        }
+      }
+
+      void free_storage()
+      {
+        if(capacity() > 0)
+        {
+          m_allocator.deallocate(ctrl(), alloc_size(capacity()));
+        }
+        m_cp_key_equal_and_ctrl.second() = empty_ctrl();
+        m_cp_key_hash_and_slots.second() = nullptr;
+        m_capacity                       = 0;
+        m_growth_left                    = 0;
+      }
+
+    private:
+      compressed_pair<key_equal, int8*> m_cp_key_equal_and_ctrl;
+      compressed_pair<key_hash_type, value_type*> m_cp_key_hash_and_slots;
+      compressed_pair<extract_key_type, size_type> m_cp_extract_key_and_size;
+      card32 m_capacity;
+      card32 m_growth_left;
+      allocator_type m_allocator;
+    };
+
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,276 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: flat_hashtable_group.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/bit/countl_zero.h"
+#include "rex_std/internal/bit/countr_zero.h"
+#include "rex_std/internal/memory/memcpy.h"
+
+#if defined(RSL_PLATFORM_X64)
+  #include <emmintrin.h>
+  #define RSL_FLAT_HASHTABLE_SSE2
+#endif
+
+// The flat hashtable keeps 1 control byte per slot, next to the slots themselves.
+// A control byte is either one of the special values below, or the lower 7 bits of the hash
+// of the element stored in the slot, so most non matching slots get rejected without touching them.
+// Control bytes are probed a group at a time, 16 with SSE2 or 8 packed in a word otherwise.
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // A full slot has its top bit cleared, all special values have it set
+      enum class flat_ctrl : int8
+      {
+        empty    = -128, // 0b10000000
+        deleted  = -2,   // 0b11111110
+        sentinel = -1    // 0b11111111
+      };
+
+      constexpr bool is_flat_ctrl_empty(int8 ctrl)
+      {
+        return ctrl == static_cast<int8>(flat_ctrl::empty);
+      }
+      constexpr bool is_flat_ctrl_full(int8 ctrl)
+      {
+        return ctrl >= 0;
+      }
+      constexpr bool is_flat_ctrl_deleted(int8 ctrl)
+      {
+        return ctrl == static_cast<int8>(flat_ctrl::deleted);
+      }
+      constexpr bool is_flat_ctrl_empty_or_deleted(int8 ctrl)
+      {
+        return ctrl < static_cast<int8>(flat_ctrl::sentinel);
+      }
+
+      // A bitmask with 1 bit set per matching control byte of a group.
+      // Shift is log2 of the number of bits used per control byte.
+      template <typename T, card32 Width, card32 Shift>
+      class flat_group_mask
+      {
+      public:
+        explicit flat_group_mask(T mask)
+            : m_mask(mask)
+        {
+        }
+
+        explicit operator bool() const
+        {
+          return m_mask != 0;
+        }
+
+        // index of the first matching control byte
+        card32 lowest_bit_set() const
+        {
+          return static_cast<card32>(rsl::countr_zero(m_mask)) >> Shift;
+        }
+        // number of non matching control bytes at the start of the group
+        card32 trailing_zeros() const
+        {
+          return static_cast<card32>(rsl::countr_zero(m_mask)) >> Shift;
+        }
+        // number of non matching control bytes at the end of the group
+        card32 leading_zeros() const
+        {
+          constexpr card32 total_significant_bits = Width << Shift;
+          constexpr card32 extra_bits             = sizeof(T) * 8 - total_significant_bits;
+          return (rsl::countl_zero(static_cast<T>(m_mask << extra_bits))) >> Shift;
+        }
+
+        // iterating the mask returns the index of every matching control byte
+        flat_group_mask begin() const
+        {
+          return *this;
+        }
+        flat_group_mask end() const
+        {
+          return flat_group_mask(0);
+        }
+        card32 operator*() const
+        {
+          return lowest_bit_set();
+        }
+        flat_group_mask& operator++()
+        {
+          m_mask &= (m_mask - 1);
+          return *this;
+        }
+        bool operator!=(const flat_group_mask& other) const
+        {
+          return m_mask != other.m_mask;
+        }
+
+      private:
+        T m_mask;
+      };
+
+#if defined(RSL_FLAT_HASHTABLE_SSE2)
+      class flat_group
+      {
+      public:
+        static constexpr card32 width = 16;
+        using mask_type               = flat_group_mask<uint32, width, 0>;
+
+        // the control bytes don't need to be aligned
+        explicit flat_group(const int8* ctrl)
+            : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        {
+        }
+
+        // returns a bitmask of the slots that could hold an element with this hash
+        mask_type match(int8 h2) const
+        {
+          return mask_type(static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl))));
+        }
+        mask_type mask_empty() const
+        {
+          return mask_type(static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<int8>(flat_ctrl::empty)), m_ctrl))));
+        }
+        mask_type mask_empty_or_deleted() const
+        {
+          return mask_type(static_cast<uint32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(static_cast<int8>(flat_ctrl::sentinel)), m_ctrl))));
+        }
+        // returns the number of empty or deleted slots before the first full slot or the sentinel
+        card32 count_leading_empty_or_deleted() const
+        {
+          const uint32 full_or_sentinel = static_cast<uint32>(_mm_movemask_epi8(_mm_cmpgt_epi8(m_ctrl, _mm_set1_epi8(static_cast<int8>(flat_ctrl::deleted)))));
+          return static_cast<card32>(rsl::countr_zero(full_or_sentinel | (1u << width)));
+        }
+
+      private:
+        __m128i m_ctrl;
+      };
+#else
+      class flat_group
+      {
+      public:
+        static constexpr card32 width = 8;
+        using mask_type               = flat_group_mask<uint64, width, 3>;
+
+        // the control bytes don't need to be aligned
+        explicit flat_group(const int8* ctrl)
+            : m_ctrl()
+        {
+          rsl::memcpy(&m_ctrl, ctrl, sizeof(m_ctrl));
+        }
+
+        // returns a bitmask of the slots that could hold an element with this hash
+        // this can return false positives, which get filtered out when comparing the keys
+        mask_type match(int8 h2) const
+        {
+          const uint64 x = m_ctrl ^ (g_lsbs * static_cast<uint8>(h2));
+          return mask_type((x - g_lsbs) & ~x & g_msbs);
+        }
+        // empty has its top bit set and its second bit cleared
+        mask_type mask_empty() const
+        {
+          return mask_type((m_ctrl & ~(m_ctrl << 6)) & g_msbs);
+        }
+        // empty and deleted have their top bit set and their lowest bit cleared
+        mask_type mask_empty_or_deleted() const
+        {
+          return mask_type((m_ctrl & ~(m_ctrl << 7)) & g_msbs);
+        }
+        // returns the number of empty or deleted slots before the first full slot or the sentinel
+        card32 count_leading_empty_or_deleted() const
+        {
+          constexpr uint64 gaps = 0x00FEFEFEFEFEFEFEull;
+          return (static_cast<card32>(rsl::countr_zero(((~m_ctrl & (m_ctrl >> 7)) | gaps) + 1)) + 7) >> 3;
+        }
+
+      private:
+        static constexpr uint64 g_lsbs = 0x0101010101010101ull;
+        static constexpr uint64 g_msbs = 0x8080808080808080ull;
+
+        uint64 m_ctrl;
+      };
+#endif
+
+      // the probe sequence visits the groups in triangular order: offset, offset + 1 * width, offset + 3 * width, ...
+      // with a power of 2 number of groups this visits every group exactly once.
+      class flat_probe_seq
+      {
+      public:
+        flat_probe_seq(uint64 hash, card64 mask)
+            : m_mask(mask)
+            , m_offset(hash & mask)
+            , m_index(0)
+        {
+        }
+
+        card64 offset() const
+        {
+          return m_offset;
+        }
+        card64 offset(card32 i) const
+        {
+          return (m_offset + i) & m_mask;
+        }
+
+        void next()
+        {
+          m_index += flat_group::width;
+          m_offset += m_index;
+          m_offset &= m_mask;
+        }
+
+        // number of slots probed so far
+        card64 index() const
+        {
+          return m_index;
+        }
+
+      private:
+        card64 m_mask;
+        card64 m_offset;
+        card64 m_index;
+      };
+
+      // The hash results of rsl::hash are often the value itself (eg. for integers)
+      // Multiplying spreads every input bit over the upper half of the word,
+      // folding that back in makes sure the lower bits depend on the whole input as well.
+      // The lower 7 bits end up in the control byte, the rest picks the start of the probe sequence.
+      constexpr uint64 flat_hash_mix(uint64 hash)
+      {
+        const uint64 mixed = hash * 0x9E3779B97F4A7C15ull;
+        return mixed ^ (mixed >> 32);
+      }
+
+      constexpr int8 flat_h2(uint64 hash)
+      {
+        return static_cast<int8>(hash & 0x7F);
+      }
+      constexpr uint64 flat_h1(uint64 hash)
+      {
+        return hash >> 7;
+      }
+
+      // returns a group of control bytes where every slot is empty
+      // this is used by tables without any slots so we don't need to allocate for them.
+      inline const int8* flat_empty_group()
+      {
+        alignas(16) static constexpr int8 empty_group[16] = {
+            static_cast<int8>(flat_ctrl::sentinel), static_cast<int8>(flat_ctrl::empty), static_cast<int8>(flat_ctrl::empty), static_cast<int8>(flat_ctrl::empty),
+            static_cast<int8>(flat_ctrl::empty),    static_cast<int8>(flat_ctrl::empty), static_cast<int8>(flat_ctrl::empty), static_cast<int8>(flat_ctrl::empty),
+            static_cast<int8>(flat_ctrl::empty),    static_cast<int8>(flat_ctrl::empty), static_cast<int8>(flat_ctrl::empty), static_cast<int8>(flat_ctrl::empty),
+            static_cast<int8>(flat_ctrl::empty),    static_cast<int8>(flat_ctrl::empty), static_cast<int8>(flat_ctrl::empty), static_cast<int8>(flat_ctrl::empty)};
+        return empty_group;
+      }
+    } // namespace internal
+  }   // namespace v1
+} // namespace rsl
@@ -0,0 +1,117 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: flat_hashtable_iterator.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/hashtable/flat_hashtable_group.h"
+#include "rex_std/bonus/type_traits/type_select.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/iterator/iterator_tags.h"
+#include "rex_std/internal/type_traits/enable_if.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    // Points to a control byte and its slot at the same time.
+    // The control bytes always end with a sentinel, which stops the iteration
+    // so the end iterator is the iterator pointing to the sentinel.
+    template <typename Value, bool IsConst>
+    class flat_hashtable_iterator
+    {
+    public:
+      using this_type         = flat_hashtable_iterator<Value, IsConst>;
+      using value_type        = Value;
+      using pointer           = typename type_select<IsConst, const Value*, Value*>::type;
+      using reference         = typename type_select<IsConst, const Value&, Value&>::type;
+      using difference_type   = ptrdiff;
+      using iterator_category = forward_iterator_tag;
+
+      flat_hashtable_iterator()
+          : m_ctrl(nullptr)
+          , m_slot(nullptr)
+      {
+      }
+      flat_hashtable_iterator(const int8* ctrl, Value* slot)
+          : m_ctrl(ctrl)
+          , m_slot(slot)
+      {
+      }
+
+      // a mutable iterator converts to a const iterator
+      template <bool IsOtherConst, enable_if_t<IsConst && !IsOtherConst, bool> = true>
+      flat_hashtable_iterator(const flat_hashtable_iterator<Value, IsOtherConst>& other) // NOLINT(google-explicit-constructor)
+          : m_ctrl(other.ctrl())
+          , m_slot(other.slot())
+      {
+      }
+
+      reference operator*() const
+      {
+        return *m_slot;
+      }
+      pointer operator->() const
+      {
+        return m_slot;
+      }
+      flat_hashtable_iterator& operator++()
+      {
+        ++m_ctrl;
+        ++m_slot;
+        skip_empty_or_deleted();
+        return *this;
+      }
+      flat_hashtable_iterator operator++(int)
+      {
+        flat_hashtable_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const int8* ctrl() const
+      {
+        return m_ctrl;
+      }
+      Value* slot() const
+      {
+        return m_slot;
+      }
+
+      // moves forward to the first full slot or the sentinel, whichever comes first
+      void skip_empty_or_deleted()
+      {
+        while(internal::is_flat_ctrl_empty_or_deleted(*m_ctrl))
+        {
+          const card32 shift = internal::flat_group(m_ctrl).count_leading_empty_or_deleted();
+          m_ctrl += shift;
+          m_slot += shift;
+        }
+      }
+
+    private:
+      const int8* m_ctrl;
+      Value* m_slot;
+    };
+
+    template <typename Value, bool IsLhsConst, bool IsRhsConst>
+    bool operator==(const flat_hashtable_iterator<Value, IsLhsConst>& lhs, const flat_hashtable_iterator<Value, IsRhsConst>& rhs)
+    {
+      return lhs.ctrl() == rhs.ctrl();
+    }
+    template <typename Value, bool IsLhsConst, bool IsRhsConst>
+    bool operator!=(const flat_hashtable_iterator<Value, IsLhsConst>& lhs, const flat_hashtable_iterator<Value, IsRhsConst>& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  } // namespace v1
+} // namespace rsl
@@ -15,6 +15,8 @@
 #include "rex_std/bonus/defines.h"
 #include "rex_std/bonus/hashtable/hashtable.h"
 #include "rex_std/bonus/hashtable/mod_range_hashing.h"
+#include "rex_std/bonus/hashtable/power_of_two_rehash_policy.h"
+#include "rex_std/bonus/hashtable/prime_rehash_policy.h"
 #include "rex_std/bonus/types.h"
 #include "rex_std/bonus/utility/key_value.h"
 #include "rex_std/bonus/utility/use_first.h"
@@ -27,31 +29,35 @@ namespace rsl
   inline namespace v1
   {
 
-    template <typename Key, typename Value, typename Hash = rsl::hash<Key>, typename Equal = rsl::equal_to<Key>, typename Alloc = allocator>
-    class hash_map : public hashtable<Key, key_value<const Key, Value>, Alloc, use_first<key_value<const Key, Value>>, Equal, Hash, mod_range_hashing, prime_rehash_policy, true, true>
+    // RehashPolicy decides the bucket counts of the table and how a hash is mapped to a bucket.
+    // prime_rehash_policy uses a modulo, power_of_two_rehash_policy uses a mask, which is a lot cheaper
+    // but needs a hash that spreads its input over all bits, like rsl::fast_hash.
+    template <typename Key, typename Value, typename Hash = rsl::hash<Key>, typename Equal = rsl::equal_to<Key>, typename Alloc = allocator, typename RehashPolicy = prime_rehash_policy>
+    class hash_map : public hashtable<Key, key_value<const Key, Value>, Alloc, use_first<key_value<const Key, Value>>, Equal, Hash, typename RehashPolicy::bucket_index_finder_type, RehashPolicy, true, true>
     {
     public:
-      using base_type          = hashtable<Key, key_value<const Key, Value>, Alloc, use_first<key_value<const Key, Value>>, Equal, Hash, mod_range_hashing, prime_rehash_policy, true, true>;
-      using this_type          = hash_map<Key, Value, Hash, Equal, Alloc>;
-      using size_type          = typename base_type::size_type;
-      using key_type           = typename base_type::key_type;
-      using mapped_type        = Value;
-      using value_type         = typename base_type::value_type;
-      using allocator_type     = typename base_type::allocator_type;
-      using node_type          = typename base_type::node_type;
-      using insert_return_type = typename base_type::insert_return_type;
-      using iterator           = typename base_type::iterator;
-      using const_iterator     = typename base_type::const_iterator;
+      using base_type                = hashtable<Key, key_value<const Key, Value>, Alloc, use_first<key_value<const Key, Value>>, Equal, Hash, typename RehashPolicy::bucket_index_finder_type, RehashPolicy, true, true>;
+      using this_type                = hash_map<Key, Value, Hash, Equal, Alloc, RehashPolicy>;
+      using size_type                = typename base_type::size_type;
+      using key_type                 = typename base_type::key_type;
+      using mapped_type              = Value;
+      using value_type               = typename base_type::value_type;
+      using allocator_type           = typename base_type::allocator_type;
+      using node_type                = typename base_type::node_type;
+      using insert_return_type       = typename base_type::insert_return_type;
+      using iterator                 = typename base_type::iterator;
+      using const_iterator           = typename base_type::const_iterator;
+      using bucket_index_finder_type = typename base_type::bucket_index_finder_type;
 
       using base_type::insert;
 
       explicit hash_map(const allocator_type& allocator = allocator_type())
-          : base_type(0_size, Hash(), mod_range_hashing(), Equal(), use_first<value_type>(), allocator)
+          : base_type(0_size, Hash(), bucket_index_finder_type(), Equal(), use_first<value_type>(), allocator)
       {
       }
 
       explicit hash_map(Size bucketCount, const Hash& hashFunction = Hash(), const Equal& keyEqual = Equal(), const allocator_type& allocator = allocator_type())
-          : base_type(bucketCount, hashFunction, mod_range_hashing(), keyEqual, use_first<value_type>(), allocator)
+          : base_type(bucketCount, hashFunction, bucket_index_finder_type(), keyEqual, use_first<value_type>(), allocator)
       {
       }
 
@@ -68,13 +74,13 @@ namespace rsl
       ~hash_map() = default;
 
       hash_map(initializer_list<value_type> ilist, Size bucketCount = 0_size, const Hash& hashFunction = Hash(), const Equal& keyEqual = Equal(), const allocator_type& allocator = allocator_type())
-          : base_type(ilist.begin(), ilist.end(), bucketCount, hashFunction, mod_range_hashing(), keyEqual, use_first<value_type>(), allocator)
+          : base_type(ilist.begin(), ilist.end(), bucketCount, hashFunction, bucket_index_finder_type(), keyEqual, use_first<value_type>(), allocator)
       {
       }
 
       template <typename ForwardIterator>
       hash_map(ForwardIterator first, ForwardIterator last, size_type bucketCount = 0, const Hash& hashFunction = Hash(), const Equal& keyEqual = Equal(), const allocator_type& allocator = allocator_type())
-          : base_type(first, last, bucketCount, hashFunction, mod_range_hashing(), keyEqual, use_first<value_type>(), allocator)
+          : base_type(first, last, bucketCount, hashFunction, bucket_index_finder_type(), keyEqual, use_first<value_type>(), allocator)
       {
       }
 
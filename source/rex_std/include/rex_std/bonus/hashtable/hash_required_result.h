@@ -0,0 +1,28 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: hash_required_result.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    struct hash_required_result
+    {
+      count_t new_bucket_count;
+      bool is_hash_required;
+    };
+
+  } // namespace v1
+} // namespace rsl
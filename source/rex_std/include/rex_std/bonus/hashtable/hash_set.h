@@ -18,19 +18,27 @@
 #include "rex_std/bonus/hashtable/hashtable.h"
 #include "rex_std/bonus/utility/use_self.h"
 #include "rex_std/bonus/hashtable/mod_range_hashing.h"
+#include "rex_std/bonus/hashtable/power_of_two_rehash_policy.h"
+#include "rex_std/bonus/hashtable/prime_rehash_policy.h"
 #include "rex_std/internal/utility/pair.h"
 
 namespace rsl
 {
   inline namespace v1
   {
+		/// hash_set
+		///
+		/// RehashPolicy decides the bucket counts of the table and how a hash is mapped to a bucket.
+		/// See hash_map for the available policies.
+		///
 		template <typename Value, typename Hash = rsl::hash<Value>, typename Predicate = rsl::equal_to<Value>,
-			typename Alloc = rsl::allocator>
-			class hash_set : public hashtable<Value, Value, Alloc, rsl::use_self<Value>, Predicate, Hash, mod_range_hashing, prime_rehash_policy, false, true>
+			typename Alloc = rsl::allocator, typename RehashPolicy = prime_rehash_policy>
+			class hash_set : public hashtable<Value, Value, Alloc, rsl::use_self<Value>, Predicate, Hash, typename RehashPolicy::bucket_index_finder_type, RehashPolicy, false, true>
 		{
 		public:
-			using base_type = hashtable<Value, Value, Alloc, rsl::use_self<Value>, Predicate, Hash, mod_range_hashing, prime_rehash_policy, false, true>;
-			using this_type = hash_set<Value, Hash, Predicate, Alloc>;
+			using base_type = hashtable<Value, Value, Alloc, rsl::use_self<Value>, Predicate, Hash, typename RehashPolicy::bucket_index_finder_type, RehashPolicy, false, true>;
+			using this_type = hash_set<Value, Hash, Predicate, Alloc, RehashPolicy>;
+			using bucket_index_finder_type = typename base_type::bucket_index_finder_type;
 			using size_type = typename base_type::size_type;
 			using value_type = typename base_type::value_type;
 			using allocator_type = typename base_type::allocator_type;
@@ -42,7 +50,7 @@ namespace rsl
 			/// Default constructor.
 			/// 
 			explicit hash_set(const allocator_type& allocator = allocator_type())
-				: base_type(0_size, Hash(), mod_range_hashing(), Predicate(), rsl::use_self<Value>(), allocator)
+				: base_type(0_size, Hash(), bucket_index_finder_type(), Predicate(), rsl::use_self<Value>(), allocator)
 			{
 				// Empty
 			}
@@ -56,7 +64,7 @@ namespace rsl
 			///
 			explicit hash_set(size_type nBucketCount, const Hash& hashFunction = Hash(), const Predicate& predicate = Predicate(),
 				const allocator_type& allocator = allocator_type())
-				: base_type(nBucketCount, hashFunction, mod_range_hashing(), predicate, rsl::use_self<Value>(), allocator)
+				: base_type(nBucketCount, hashFunction, bucket_index_finder_type(), predicate, rsl::use_self<Value>(), allocator)
 			{
 				// Empty
 			}
@@ -87,7 +95,7 @@ namespace rsl
 			///     
 			hash_set(std::initializer_list<value_type> ilist, size_type nBucketCount = 0, const Hash& hashFunction = Hash(),
 				const Predicate& predicate = Predicate(), const allocator_type& allocator = allocator_type())
-				: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, mod_range_hashing(), predicate, rsl::use_self<Value>(), allocator)
+				: base_type(ilist.begin(), ilist.end(), nBucketCount, hashFunction, bucket_index_finder_type(), predicate, rsl::use_self<Value>(), allocator)
 			{
 				// Empty
 			}
@@ -101,7 +109,7 @@ namespace rsl
 			template <typename FowardIterator>
 			hash_set(FowardIterator first, FowardIterator last, size_type nBucketCount = 0, const Hash& hashFunction = Hash(),
 				const Predicate& predicate = Predicate(), const allocator_type& allocator = allocator_type())
-				: base_type(first, last, nBucketCount, hashFunction, mod_range_hashing(), predicate, rsl::use_self<Value>(), allocator)
+				: base_type(first, last, nBucketCount, hashFunction, bucket_index_finder_type(), predicate, rsl::use_self<Value>(), allocator)
 			{
 				// Empty
 			}
@@ -129,8 +137,8 @@ namespace rsl
 		/// hash_set erase_if
 		///
 		/// https://en.cppreference.com/w/cpp/container/unordered_set/erase_if
-		template <typename Value, typename Hash, typename Predicate, typename Alloc, typename UserPredicate>
-		void erase_if(rsl::hash_set<Value, Hash, Predicate, Alloc>& c, UserPredicate predicate)
+		template <typename Value, typename Hash, typename Predicate, typename Alloc, typename RehashPolicy, typename UserPredicate>
+		void erase_if(rsl::hash_set<Value, Hash, Predicate, Alloc, RehashPolicy>& c, UserPredicate predicate)
 		{
 			// Erases all elements that satisfy the predicate pred from the container.
 			for (auto i = c.begin(), last = c.end(); i != last;)
@@ -281,11 +289,11 @@ namespace rsl
 		// global operators
 		///////////////////////////////////////////////////////////////////////
 
-		template <typename Value, typename Hash, typename Predicate, typename Alloc>
-		inline bool operator==(const hash_set<Value, Hash, Predicate, Alloc>& a,
-			const hash_set<Value, Hash, Predicate, Alloc>& b)
+		template <typename Value, typename Hash, typename Predicate, typename Alloc, typename RehashPolicy>
+		inline bool operator==(const hash_set<Value, Hash, Predicate, Alloc, RehashPolicy>& a,
+			const hash_set<Value, Hash, Predicate, Alloc, RehashPolicy>& b)
 		{
-			using const_iterator = typename hash_set<Value, Hash, Predicate, Alloc>::const_iterator ;
+			using const_iterator = typename hash_set<Value, Hash, Predicate, Alloc, RehashPolicy>::const_iterator ;
 
 			// We implement branching with the assumption that the return value is usually false.
 			if (a.size() != b.size())
@@ -304,9 +312,9 @@ namespace rsl
 			return true;
 		}
 
-		template <typename Value, typename Hash, typename Predicate, typename Alloc>
-		inline bool operator!=(const hash_set<Value, Hash, Predicate, Alloc>& a,
-			const hash_set<Value, Hash, Predicate, Alloc>& b)
+		template <typename Value, typename Hash, typename Predicate, typename Alloc, typename RehashPolicy>
+		inline bool operator!=(const hash_set<Value, Hash, Predicate, Alloc, RehashPolicy>& a,
+			const hash_set<Value, Hash, Predicate, Alloc, RehashPolicy>& b)
 		{
 			return !(a == b);
 		}
@@ -67,12 +67,12 @@ namespace rsl
       hashtable()
           : rehash_base<RehashPolicy, hashtable>()
           , m_cp_key_equal_and_bucket_array(nullptr)
-          , m_cp_key_hash_and_bucket_count(0)
+          , m_cp_key_hash_and_bucket_count(1)
           , m_cp_bucket_idx_finder_and_element_count(0)
           , m_cp_extract_key_and_rehash_policy()
           , m_allocator()
       {
-        allocate_buckets(1); // always have at least 1 bucket allocated
+        m_cp_key_equal_and_bucket_array.second() = allocate_buckets(1); // always have at least 1 bucket allocated
       }
       hashtable(Size bucketCount, const KeyHash& keyHash, const BucketIndexFinder& bucketIndexFinder, const Equal& equal, const ExtractKey& extractKey, const allocator_type& allocator)
           : m_cp_key_equal_and_bucket_array(equal)
@@ -83,6 +83,8 @@ namespace rsl
       {
         if(bucket_count() > 0)
         {
+          // the rehash policy decides which bucket counts are valid, eg. prime or a power of 2
+          m_cp_key_hash_and_bucket_count.second()  = static_cast<size_type>(m_cp_extract_key_and_rehash_policy.second().get_next_bucket_count(static_cast<uint32>(bucket_count())));
           m_cp_key_equal_and_bucket_array.second() = allocate_buckets(bucket_count());
         }
         else
@@ -96,6 +98,9 @@ namespace rsl
       hashtable(ForwardIterator first, ForwardIterator last, Size bucketCount, const KeyHash& keyHash, const BucketIndexFinder& bucketIndexFinder, const Equal& equal, const ExtractKey& extractKey, const allocator_type& allocator)
           : hashtable(bucketCount, keyHash, bucketIndexFinder, equal, extractKey, allocator)
       {
+        // the bucket count gets recalculated below, so drop the buckets the delegated constructor allocated
+        free_buckets(bucket_array());
+
         if(bucketCount.get() < 2)
         {
           const size_type element_count           = static_cast<size_type>(internal::ht_distance(first, last));
@@ -104,7 +109,7 @@ namespace rsl
         else
         {
           RSL_ASSERT_X(bucketCount.get() < 10'000'000, "Bucket count too big for hashtable. bucketcount: {}", bucketCount.get());
-          m_cp_key_hash_and_bucket_count.second() = bucketCount.get();
+          m_cp_key_hash_and_bucket_count.second() = static_cast<size_type>(m_cp_extract_key_and_rehash_policy.second().get_next_bucket_count(static_cast<uint32>(bucketCount.get())));
         }
 
         m_cp_key_hash_and_bucket_count.second()  = (rsl::max)(1, bucket_count());
@@ -482,6 +487,8 @@ namespace rsl
       }
       void rehash(size_type bucketCount)
       {
+        bucketCount = static_cast<size_type>(m_cp_extract_key_and_rehash_policy.second().get_next_bucket_count(static_cast<uint32>(bucketCount)));
+
         node_type** const new_bucket_array = allocate_buckets(bucketCount);
 
         node_type* node = nullptr;
@@ -747,8 +754,7 @@ namespace rsl
 
       size_type bucket_index(hash_result hr, size_type bucketCount) const
       {
-        const hash_result res = hr % bucketCount;
-        return static_cast<size_type>(res);
+        return static_cast<size_type>(m_cp_bucket_idx_finder_and_element_count.first()(hr, static_cast<uint32>(bucketCount)));
       }
 
       size_type bucket_index(node_type* node, size_type bucketCount) const
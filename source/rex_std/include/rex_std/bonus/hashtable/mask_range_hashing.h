@@ -0,0 +1,37 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: mask_range_hashing.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/functional/hash_result.h"
+#include "rex_std/bonus/types.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // Maps a hash to a bucket by keeping its lower bits, which is a single AND instead of a division.
+    // This only works when the bucket count is a power of 2, use it together with power_of_two_rehash_policy.
+    // As only the lower bits are used, the hash needs to spread its input over all of its bits,
+    // which rsl::fast_hash does.
+    struct mask_range_hashing
+    {
+      uint32 operator()(hash_result r, uint32 n) const
+      {
+        return static_cast<uint32>(r) & (n - 1);
+      }
+    };
+
+  } // namespace v1
+} // namespace rsl
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include "rex_std/bonus/functional/hash_result.h"
 #include "rex_std/bonus/types.h"
 
 namespace rsl
@@ -21,9 +22,9 @@ namespace rsl
 
     struct mod_range_hashing
     {
-      uint32 operator()(count_t r, uint32 n) const
+      uint32 operator()(hash_result r, uint32 n) const
       {
-        return r % n;
+        return static_cast<uint32>(r % n);
       }
     };
 
@@ -0,0 +1,53 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: power_of_two_rehash_policy.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/hashtable/hash_required_result.h"
+#include "rex_std/bonus/hashtable/mask_range_hashing.h"
+#include "rex_std/bonus/types.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // A rehash policy that keeps the bucket count a power of 2.
+    // This means the bucket of a hash can be found with a mask instead of a modulo,
+    // which avoids an integer division on every lookup.
+    // The table doubles in size every time it grows.
+    //
+    // eg. rsl::hash_map<uint64, int, rsl::fast_hash<uint64>, rsl::equal_to<uint64>, rsl::allocator, rsl::power_of_two_rehash_policy>
+    struct power_of_two_rehash_policy
+    {
+    public:
+      using bucket_index_finder_type = mask_range_hashing;
+
+      explicit power_of_two_rehash_policy(float32 maxLoadFactor = 1.0f);
+
+      float32 get_max_load_factor() const;
+      void set_max_load_factor(float32 maxLoadFactor);
+
+      static uint32 get_prev_bucket_count_only(uint32 bucketCountHint);
+      uint32 get_prev_bucket_count(uint32 bucketCountHint) const;
+      uint32 get_next_bucket_count(uint32 bucketCountHint) const;
+      uint32 get_bucket_count(uint32 elementCount) const;
+
+      hash_required_result is_rehash_required(uint32 bucketCount, uint32 elementCount, uint32 elementAdd) const;
+
+    private:
+      float32 m_max_load_factor;
+      mutable uint32 m_next_resize;
+    };
+
+  } // namespace v1
+} // namespace rsl
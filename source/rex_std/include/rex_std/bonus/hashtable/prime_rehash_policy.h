@@ -12,21 +12,20 @@
 
 #pragma once
 
+#include "rex_std/bonus/hashtable/hash_required_result.h"
+#include "rex_std/bonus/hashtable/mod_range_hashing.h"
 #include "rex_std/bonus/types.h"
 
 namespace rsl
 {
   inline namespace v1
   {
-    struct hash_required_result
-    {
-      count_t new_bucket_count;
-      bool is_hash_required;
-    };
-
     struct prime_rehash_policy
     {
     public:
+      // bucket counts are prime, so a hash is mapped to a bucket with a modulo
+      using bucket_index_finder_type = mod_range_hashing;
+
       explicit prime_rehash_policy(float32 maxLoadFactor = 1.0f);
 
       float32 get_max_load_factor() const;
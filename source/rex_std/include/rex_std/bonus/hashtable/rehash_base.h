@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include "rex_std/bonus/hashtable/power_of_two_rehash_policy.h"
 #include "rex_std/bonus/hashtable/prime_rehash_policy.h"
 
 namespace rsl
@@ -40,5 +41,21 @@ namespace rsl
       }
     };
 
+    template <typename HashTable>
+    struct rehash_base<power_of_two_rehash_policy, HashTable>
+    {
+      float32 get_max_load_factor() const
+      {
+        const HashTable* p_this = static_cast<const HashTable*>(this);
+        return p_this->rehash_policy().get_max_load_factor();
+      }
+
+      void set_max_load_factor(float32 maxLoadFactor)
+      {
+        HashTable* p_this = static_cast<HashTable*>(this);
+        return p_this->rehash_policy(power_of_two_rehash_policy(maxLoadFactor));
+      }
+    };
+
   } // namespace v1
 } // namespace rsl
\ No newline at end of file
@@ -0,0 +1,173 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: intrusive_mpsc_queue.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// An unbounded lock free queue for any number of producers and a single consumer
+// "Intrusive MPSC node-based queue" - Dmitry Vyukov
+//
+// The queue is a singly linked list of nodes owned by the caller, so pushing
+// and popping never allocates.
+// A producer swaps itself in as the new head with a single exchange and links
+// the previous head to it afterwards. The consumer walks the list from the tail.
+// A stub node owned by the queue keeps the list from ever being empty.
+//
+// Between the exchange and the link, the nodes pushed after the previous head
+// can't be reached by the consumer yet. try_pop returns nullptr in that window,
+// even though the queue isn't empty.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/attributes.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/atomic/atomic.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // the head is written by the producers and the tail by the consumer, keep them on their own cache line
+      inline constexpr card32 g_intrusive_mpsc_queue_padding = 64;
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // the base class of anything that can be pushed on an intrusive_mpsc_queue.
+    // a node can only be in one queue at a time
+    class intrusive_mpsc_node
+    {
+    public:
+      intrusive_mpsc_node()
+          : m_next(nullptr)
+      {
+      }
+      // the link belongs to the queue, copying a node doesn't copy it
+      intrusive_mpsc_node(const intrusive_mpsc_node& /*unused*/)
+          : m_next(nullptr)
+      {
+      }
+      ~intrusive_mpsc_node() = default;
+
+      intrusive_mpsc_node& operator=(const intrusive_mpsc_node& /*unused*/)
+      {
+        return *this;
+      }
+
+    private:
+      template <typename T>
+      friend class intrusive_mpsc_queue;
+
+      rsl::atomic<intrusive_mpsc_node*> m_next;
+    };
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // T has to derive from intrusive_mpsc_node.
+    // push can be called by any number of threads at the same time, try_pop by one thread at a time.
+    // the queue doesn't own its nodes, a node has to stay alive until it's popped again
+    template <typename T>
+    class intrusive_mpsc_queue
+    {
+    public:
+      using value_type = T;
+
+      intrusive_mpsc_queue()
+          : m_head(&m_stub)
+          , m_tail(&m_stub)
+          , m_stub()
+      {
+      }
+      intrusive_mpsc_queue(const intrusive_mpsc_queue&) = delete;
+      intrusive_mpsc_queue(intrusive_mpsc_queue&&)      = delete;
+      ~intrusive_mpsc_queue()                           = default;
+
+      intrusive_mpsc_queue& operator=(const intrusive_mpsc_queue&) = delete;
+      intrusive_mpsc_queue& operator=(intrusive_mpsc_queue&&)      = delete;
+
+      // links node at the back of the queue, never fails or blocks
+      void push(T* node)
+      {
+        push_node(static_cast<intrusive_mpsc_node*>(node));
+      }
+
+      // unlinks the node at the front of the queue.
+      // returns nullptr if the queue is empty, or if the front node is still being pushed
+      T* try_pop()
+      {
+        intrusive_mpsc_node* tail = m_tail;
+        intrusive_mpsc_node* next = tail->m_next.load(rsl::memory_order_acquire);
+
+        // the stub is never handed out, skip over it
+        if(tail == &m_stub)
+        {
+          if(next == nullptr)
+          {
+            return nullptr;
+          }
+          m_tail = next;
+          tail   = next;
+          next   = next->m_next.load(rsl::memory_order_acquire);
+        }
+
+        if(next != nullptr)
+        {
+          m_tail = next;
+          return static_cast<T*>(tail);
+        }
+
+        // tail is the last node we can reach. if it's not the head, a producer
+        // swapped in a new head but hasn't linked it to tail yet
+        if(tail != m_head.load(rsl::memory_order_acquire))
+        {
+          return nullptr;
+        }
+
+        // tail is the only node left, push the stub behind it so tail can be unlinked
+        push_node(&m_stub);
+        next = tail->m_next.load(rsl::memory_order_acquire);
+        if(next != nullptr)
+        {
+          m_tail = next;
+          return static_cast<T*>(tail);
+        }
+
+        // another producer got in between the check of the head and pushing the stub
+        return nullptr;
+      }
+
+      // returns true if nothing is pushed, or the only pushed nodes are still being linked.
+      // can only be called by the consumer
+      RSL_NO_DISCARD bool empty_approx() const
+      {
+        return m_tail == &m_stub && m_stub.m_next.load(rsl::memory_order_acquire) == nullptr;
+      }
+
+    private:
+      void push_node(intrusive_mpsc_node* node)
+      {
+        node->m_next.store(nullptr, rsl::memory_order_relaxed);
+        // acq_rel, the release publishes node to the consumer, the acquire orders
+        // the link below after the producer that pushed prev
+        intrusive_mpsc_node* prev = m_head.exchange(node, rsl::memory_order_acq_rel);
+        prev->m_next.store(node, rsl::memory_order_release);
+      }
+
+    private:
+      // written by the producers
+      alignas(internal::g_intrusive_mpsc_queue_padding) rsl::atomic<intrusive_mpsc_node*> m_head;
+
+      // only touched by the consumer, the stub's link is written by producers when it's the head
+      alignas(internal::g_intrusive_mpsc_queue_padding) intrusive_mpsc_node* m_tail;
+      intrusive_mpsc_node m_stub;
+    };
+  } // namespace v1
+} // namespace rsl
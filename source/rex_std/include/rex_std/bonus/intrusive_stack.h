@@ -0,0 +1,173 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: intrusive_stack.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// An unbounded lock free stack for any number of threads
+// "Systems Programming: Coping with Parallelism" - R. Kent Treiber
+//
+// The stack is a singly linked list of nodes owned by the caller, so pushing
+// and popping never allocates. The top is swapped in and out with a CAS.
+//
+// A plain pointer CAS suffers from ABA: a thread reads top A and its next B,
+// other threads pop A and B and push A back, and the CAS still succeeds,
+// making B the top again while it's no longer on the stack.
+// The top therefore is a tagged pointer, the upper bits of the word hold a
+// counter that changes on every update, so the CAS fails in that case.
+// User space addresses only use the lower 48 bits on 64 bit platforms,
+// leaving 16 bits for the tag. A thread would have to be preempted for
+// exactly a multiple of 65536 updates for the tag to wrap around.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/attributes.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/assert/assert_fwd.h"
+#include "rex_std/internal/atomic/atomic.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // the number of bits of the top word used to store the pointer, the rest is the tag
+      inline constexpr card32 g_intrusive_stack_ptr_bits = sizeof(void*) == 8 ? 48 : 32;
+      inline constexpr uint64 g_intrusive_stack_ptr_mask = (uint64(1) << g_intrusive_stack_ptr_bits) - 1;
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // the base class of anything that can be pushed on an intrusive_stack.
+    // a node can only be on one stack at a time
+    class intrusive_stack_node
+    {
+    public:
+      intrusive_stack_node()
+          : m_next(nullptr)
+      {
+      }
+      // the link belongs to the stack, copying a node doesn't copy it
+      intrusive_stack_node(const intrusive_stack_node& /*unused*/)
+          : m_next(nullptr)
+      {
+      }
+      ~intrusive_stack_node() = default;
+
+      intrusive_stack_node& operator=(const intrusive_stack_node& /*unused*/)
+      {
+        return *this;
+      }
+
+    private:
+      template <typename T>
+      friend class intrusive_stack;
+
+      // atomic as a thread popping can read the link of a node another thread is pushing again
+      rsl::atomic<intrusive_stack_node*> m_next;
+    };
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // T has to derive from intrusive_stack_node.
+    // all functions can be called by any number of threads at the same time.
+    // the stack doesn't own its nodes. try_pop reads the link of the top node while other threads
+    // can pop it, so a popped node has to stay alive as long as the stack is used, eg. by reusing it through a free list
+    template <typename T>
+    class intrusive_stack
+    {
+    public:
+      using value_type = T;
+
+      intrusive_stack()
+          : m_top(0)
+      {
+      }
+      intrusive_stack(const intrusive_stack&) = delete;
+      intrusive_stack(intrusive_stack&&)      = delete;
+      ~intrusive_stack()                      = default;
+
+      intrusive_stack& operator=(const intrusive_stack&) = delete;
+      intrusive_stack& operator=(intrusive_stack&&)      = delete;
+
+      // puts node on top of the stack, never fails or blocks
+      void push(T* node)
+      {
+        intrusive_stack_node* new_top = static_cast<intrusive_stack_node*>(node);
+        uint64 top                    = m_top.load(rsl::memory_order_relaxed);
+        do
+        {
+          new_top->m_next.store(ptr(top), rsl::memory_order_relaxed);
+        } while(!m_top.compare_exchange_weak(top, pack(new_top, top), rsl::memory_order_release, rsl::memory_order_relaxed));
+      }
+
+      // takes the node on top of the stack, returns nullptr if the stack is empty
+      T* try_pop()
+      {
+        uint64 top = m_top.load(rsl::memory_order_acquire);
+        for(;;)
+        {
+          intrusive_stack_node* node = ptr(top);
+          if(node == nullptr)
+          {
+            return nullptr;
+          }
+
+          // node can already be popped and pushed again by now, the tag makes the CAS fail if so
+          intrusive_stack_node* next = node->m_next.load(rsl::memory_order_relaxed);
+          if(m_top.compare_exchange_weak(top, pack(next, top), rsl::memory_order_acquire, rsl::memory_order_acquire))
+          {
+            return static_cast<T*>(node);
+          }
+        }
+      }
+
+      // takes all nodes at once, returns the one that was on top or nullptr if the stack is empty.
+      // the others are reached through next, in the order they'd be popped in
+      T* pop_all()
+      {
+        uint64 top = m_top.load(rsl::memory_order_relaxed);
+        while(ptr(top) != nullptr && !m_top.compare_exchange_weak(top, pack(nullptr, top), rsl::memory_order_acquire, rsl::memory_order_relaxed))
+        {
+        }
+        return static_cast<T*>(ptr(top));
+      }
+
+      // the node below node on a list returned by pop_all, nullptr at the end of the list
+      static T* next(T* node)
+      {
+        return static_cast<T*>(static_cast<intrusive_stack_node*>(node)->m_next.load(rsl::memory_order_relaxed));
+      }
+
+      // the stack can already be different by the time this returns
+      RSL_NO_DISCARD bool empty_approx() const
+      {
+        return ptr(m_top.load(rsl::memory_order_acquire)) == nullptr;
+      }
+
+    private:
+      static intrusive_stack_node* ptr(uint64 top)
+      {
+        return reinterpret_cast<intrusive_stack_node*>(static_cast<uintptr>(top & internal::g_intrusive_stack_ptr_mask)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+      }
+      // packs node with the tag of the old top plus one
+      static uint64 pack(intrusive_stack_node* node, uint64 oldTop)
+      {
+        const uint64 address = static_cast<uint64>(reinterpret_cast<uintptr>(node)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        RSL_ASSERT_X((address & ~internal::g_intrusive_stack_ptr_mask) == 0, "node address doesn't fit in the pointer bits of the intrusive stack");
+        const uint64 tag = (oldTop & ~internal::g_intrusive_stack_ptr_mask) + (internal::g_intrusive_stack_ptr_mask + 1);
+        return tag | address;
+      }
+
+    private:
+      rsl::atomic<uint64> m_top;
+    };
+  } // namespace v1
+} // namespace rsl
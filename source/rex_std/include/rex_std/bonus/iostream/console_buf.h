@@ -12,12 +12,20 @@
 
 //-----------------------------------------------------------------------------
 // This is a streambuf derived object used for streams that output to the console.
+//
+// Output is gathered in a put area, so writing a line doesn't result in a
+// syscall for every character or every << fragment.
+// When the console is a terminal, the put area is flushed at every newline,
+// so the user sees every line as soon as it's written.
+// When the output is redirected to a file or a pipe, the put area is only
+// flushed when it's full, when the stream is flushed or when it's destroyed.
+// A write that doesn't fit in the put area is handed to the OS in a single
+// call together with what's still pending in it.
 //-----------------------------------------------------------------------------
 
 #pragma once
 
 #include "rex_std/bonus/iostream/get_area.h"
-#include "rex_std/bonus/platform/windows/handle.h"
 #include "rex_std/bonus/types.h"
 #include "rex_std/cstring.h"
 #include "rex_std/internal/algorithm/min.h"
@@ -26,6 +34,10 @@
 #include "rex_std/internal/streambuf/basic_streambuf.h"
 #include "rex_std/internal/string/char_traits.h"
 
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include "rex_std/bonus/platform/windows/handle.h"
+#endif
+
 namespace rsl
 {
   inline namespace v1
@@ -33,10 +45,23 @@ namespace rsl
 
     namespace internal
     {
+#if defined(RSL_PLATFORM_WINDOWS)
+      using console_handle = win::handle_t;
+#else
+      using console_handle = int32;
+#endif
+
+      // console output is gathered in a put area of this size before it's written,
+      // big enough for a few lines of output
+      inline constexpr streamsize g_default_console_buffer_size = 4096;
+
+      // writes all size bytes to the console without buffering them, returns false if an error occurred
+      bool write_console(console_handle handle, const char8* data, streamsize size);
+
       class console_buf_impl
       {
       public:
-        explicit console_buf_impl(win::handle_t handle);
+        explicit console_buf_impl(console_handle handle);
         console_buf_impl(const console_buf_impl&) = delete;
         console_buf_impl(console_buf_impl&&)      = delete;
         ~console_buf_impl();
@@ -44,13 +69,24 @@ namespace rsl
         console_buf_impl& operator=(const console_buf_impl&) = delete;
         console_buf_impl& operator=(console_buf_impl&&)      = delete;
 
+        // returns true if the output is flushed at every newline, which is the case if the console is a terminal.
+        // otherwise the output is only flushed when the put area is full
+        bool is_line_buffered() const;
+
+        // uses the given buffer as put area, instead of allocating one internally.
+        // if s is nullptr, a put area of size bytes gets allocated on the next write.
+        // a size of 0 makes every write go straight to the console
+        void setbuf(char8* s, streamsize size);
+        // writes everything that's pending in the put area to the console
+        int32 sync();
+
         streamsize xsgetn(char8* s, size_t elemSize, streamsize count);
         streamsize xsputn(const char8* s, size_t elemSize, streamsize count);
 
         template <typename CharT, typename Traits>
         typename Traits::int_type overflow(CharT ch)
         {
-          return (xsputn(&ch, sizeof(CharT), 1) / sizeof(CharT)) == 0 ? Traits::eof() : ch;
+          return (xsputn(&ch, sizeof(CharT), 1) / sizeof(CharT)) == 0 ? Traits::eof() : Traits::to_int_type(ch);
         }
         template <typename CharT, typename Traits>
         typename Traits::int_type overflown(const CharT* s, count_t count)
@@ -77,8 +113,9 @@ namespace rsl
             m_get_area.reset();
           }
 
-          const streamsize count_read = xsgetn(m_get_area.current(), sizeof(CharT), 1) / sizeof(CharT);
-          m_get_area.inc_end();
+          // load as much as is available in a single read, instead of a single character
+          const streamsize count_read = xsgetn(m_get_area.end(), sizeof(CharT), m_get_area.num_available_to_load() / static_cast<streamsize>(sizeof(CharT))) / static_cast<streamsize>(sizeof(CharT));
+          m_get_area.inc_end(static_cast<count_t>(count_read));
 
           underflow_result<CharT> res {};
           res.get_area = &m_get_area;
@@ -99,15 +136,18 @@ namespace rsl
             m_get_area.reset();
           }
 
-          const streamsize count_read = xsgetn(m_get_area.current(), sizeof(CharT), 1) / sizeof(CharT);
-
-          m_get_area.inc_current();
-          m_get_area.inc_end();
+          // load as much as is available in a single read, instead of a single character
+          const streamsize count_read = xsgetn(m_get_area.end(), sizeof(CharT), m_get_area.num_available_to_load() / static_cast<streamsize>(sizeof(CharT))) / static_cast<streamsize>(sizeof(CharT));
+          m_get_area.inc_end(static_cast<count_t>(count_read));
 
           underflow_result<CharT> res {};
-
           res.get_area = &m_get_area;
-          res.ch       = count_read == 0 ? Traits::to_char_type(Traits::eof()) : *res.get_area->current();
+          res.ch       = Traits::to_char_type(Traits::eof());
+          if(count_read != 0)
+          {
+            res.ch = *res.get_area->current();
+            m_get_area.inc_current();
+          }
 
           return res;
         }
@@ -147,9 +187,38 @@ namespace rsl
           return m_get_area;
         }
 
+        // the put area, a fully buffered console buf shares these with its streambuf
+        // so single characters are written to the put area without a virtual call
+        char8*& put_begin()
+        {
+          return m_put_begin;
+        }
+        char8*& put_current()
+        {
+          return m_put_current;
+        }
+        char8*& put_end()
+        {
+          return m_put_end;
+        }
+
+      private:
+        void allocate_buffer();
+        void free_buffer();
+        // writes the pending bytes in the put area to the console
+        bool flush_writes();
+
       private:
         get_area m_get_area;
-        win::handle_t m_handle;
+        console_handle m_handle;
+
+        // the bytes in [m_put_begin, m_put_current) still need to be written to the console
+        char8* m_put_begin;
+        char8* m_put_current;
+        char8* m_put_end;
+        streamsize m_buffer_size;
+        bool m_owns_buffer;
+        bool m_is_line_buffered;
       };
     } // namespace internal
 
@@ -166,12 +235,32 @@ namespace rsl
       using pos_type    = typename base::pos_type;
       using off_type    = typename base::off_type;
 
-      explicit console_buf(win::handle_t handle)
+      explicit console_buf(internal::console_handle handle)
           : m_impl(handle)
       {
+        // a terminal needs to see every newline, so every character goes through overflow.
+        // otherwise the streambuf writes straight into the put area of the impl
+        if(!m_impl.is_line_buffered())
+        {
+          base::setp(&m_impl.put_begin(), &m_impl.put_current(), &m_impl.put_end());
+        }
       }
 
     protected:
+      // s is used as put area, as long as the console buffer is alive.
+      // if s is nullptr, the console buffer allocates a put area of count characters itself.
+      // passing nullptr and 0 makes the console buffer unbuffered
+      basic_streambuf<CharT, Traits>* setbuf(char_type* s, streamsize count) final
+      {
+        m_impl.setbuf(s, count * static_cast<streamsize>(sizeof(CharT)));
+        return this;
+      }
+      // writes all pending characters to the console
+      int32 sync() final
+      {
+        return m_impl.sync();
+      }
+
       streamsize xsgetn(char_type* s, streamsize count) final
       {
         streamsize num_chars_read              = 0;
@@ -199,13 +288,12 @@ namespace rsl
       }
       streamsize xsputn(const char_type* s, streamsize count) final
       {
-        // we don't need to create temporary buffers, just pass them directly to the OS.
-        return m_impl.xsputn(s, sizeof(char_type), count);
+        return m_impl.xsputn(s, sizeof(char_type), count) / static_cast<streamsize>(sizeof(char_type));
       }
 
       int_type overflow(int_type ch) final
       {
-        // pass it directly to the OS.
+        // the put area is full or we're line buffered, let the impl decide when to flush
         return m_impl.overflow<char_type, traits_type>(traits_type::to_char_type(ch));
       }
       streamsize overflown(const char_type* s, streamsize count) final
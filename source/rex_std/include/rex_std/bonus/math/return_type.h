@@ -15,6 +15,7 @@
 #include "rex_std/internal/type_traits/common_type.h"
 #include "rex_std/internal/type_traits/conditional.h"
 #include "rex_std/internal/type_traits/is_integral.h"
+#include "rex_std/internal/type_traits/is_same.h"
 
 namespace rsl
 {
@@ -30,5 +31,13 @@ namespace rsl
     template <typename... T>
     using common_return_t = return_t<common_t<T...>>;
 
+    namespace internal
+    {
+      // float32 and float64 have runtime kernels for the math functions,
+      // other types always go through the constexpr implementations
+      template <typename T>
+      inline constexpr bool has_runtime_math_v = rsl::is_same_v<T, float32> || rsl::is_same_v<T, float64>;
+    } // namespace internal
+
   } // namespace v1
 } // namespace rsl
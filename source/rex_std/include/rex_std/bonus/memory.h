@@ -13,6 +13,8 @@
 #pragma once
 
 #include "rex_std/bonus/memory/memory_size.h"
+#include "rex_std/bonus/memory/node_pool.h"
+#include "rex_std/bonus/memory/node_pool_allocator.h"
 #include "rex_std/bonus/memory/shared_allocator.h"
 #include "rex_std/bonus/memory/typed_allocator.h"
 #include "rex_std/bonus/memory/uninitialized_default_construct.h"
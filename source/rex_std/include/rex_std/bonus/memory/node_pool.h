@@ -0,0 +1,118 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: node_pool.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/attributes.h"
+#include "rex_std/bonus/types.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    // blocks are handed out in multiples of this, which is also the alignment of every block
+    inline constexpr card32 g_node_pool_granularity = 16;
+    // allocations bigger than this don't go through the pool but straight to operator new
+    inline constexpr card32 g_node_pool_max_block_size = 256;
+    // the biggest slab the pool allocates, slabs start small and double until they reach this
+    inline constexpr card32 g_node_pool_max_slab_size = 64 * 1024;
+
+    struct node_pool_stats
+    {
+      // number of blocks currently handed out by the pool
+      card64 live_nodes;
+      // number of slabs the pool allocated to carve blocks from
+      card64 slab_count;
+      // total size of all slabs, in bytes
+      card64 slab_bytes;
+      // number of allocations currently alive that were too big for the pool
+      card64 live_large_allocations;
+    };
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // A small object allocator meant for the nodes of node based containers.
+    // Memory is taken from the system in big slabs, which are cut up in fixed size blocks.
+    // Every block size has its own free list, so freeing and allocating a node is a pointer swap
+    // and nodes that get freed are reused by the next allocation of the same size
+    // instead of fragmenting the heap.
+    // Slabs are only given back to the system when the pool gets destroyed.
+    //
+    // A pool is not thread safe, it's meant to be owned by a single container
+    // or to be shared by the containers of a single thread. See node_pool_allocator.
+    class node_pool
+    {
+    public:
+      node_pool();
+      node_pool(const node_pool&) = delete;
+      node_pool(node_pool&&)      = delete;
+      ~node_pool();
+
+      node_pool& operator=(const node_pool&) = delete;
+      node_pool& operator=(node_pool&&)      = delete;
+
+      // allocates a block of at least size bytes
+      RSL_NO_DISCARD void* allocate(card64 size);
+      // gives a block back to the pool, size has to be the size passed in to allocate
+      void deallocate(void* ptr, card64 size);
+
+      // frees all slabs and large allocations of the pool.
+      // all blocks allocated from this pool are invalid after this call
+      void release();
+
+      const node_pool_stats& stats() const;
+
+      // the pool shared by all thread local node pool allocators of the calling thread
+      static node_pool& thread_local_pool();
+
+    private:
+      struct free_block
+      {
+        free_block* next;
+      };
+
+      struct slab_header
+      {
+        slab_header* next;
+        card64 size;
+      };
+
+      // allocations too big for the size classes are linked together, so release frees them as well
+      struct large_header
+      {
+        large_header* prev;
+        large_header* next;
+        card64 size;
+      };
+
+      struct size_class
+      {
+        free_block* free_list;
+        // blocks of the newest slab that haven't been handed out yet
+        char8* unused_begin;
+        char8* unused_end;
+        // the number of blocks the next slab of this size class holds
+        card32 next_slab_block_count;
+      };
+
+      static constexpr card32 s_num_size_classes = g_node_pool_max_block_size / g_node_pool_granularity;
+
+      void* allocate_from_new_slab(size_class& sizeClass, card32 blockSize);
+
+    private:
+      size_class m_size_classes[s_num_size_classes];
+      slab_header* m_slabs;
+      large_header* m_large_allocations;
+      node_pool_stats m_stats;
+    };
+
+  } // namespace v1
+} // namespace rsl
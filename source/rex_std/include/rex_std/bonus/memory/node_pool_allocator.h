@@ -0,0 +1,222 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: node_pool_allocator.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/attributes.h"
+#include "rex_std/bonus/memory/node_pool.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/utility/forward.h"
+#include "rex_std/limits.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // An allocator that owns its own node_pool, meant to be used as the allocator of a single node container.
+    // eg. rsl::list<int, rsl::node_pool_allocator>
+    //
+    // The pool is created on the first allocation and freed when the allocator gets destroyed.
+    // Copying the allocator doesn't share the pool, the copy creates its own,
+    // so a copied container doesn't share memory with the container it's copied from.
+    // Moving the allocator moves the pool, which is what happens when a container gets moved or swapped.
+    // 2 of these allocators are only equal if they share the same pool.
+    class node_pool_allocator
+    {
+    public:
+      using size_type       = size_t;
+      using difference_type = ptrdiff;
+
+      node_pool_allocator()
+          : m_pool(nullptr)
+      {
+      }
+      // the copy gets its own pool, nodes are never shared between containers
+      node_pool_allocator(const node_pool_allocator& /*unused*/)
+          : m_pool(nullptr)
+      {
+      }
+      node_pool_allocator(node_pool_allocator&& other)
+          : m_pool(other.m_pool)
+      {
+        other.m_pool = nullptr;
+      }
+
+      ~node_pool_allocator()
+      {
+        delete m_pool; // NOLINT(cppcoreguidelines-owning-memory)
+      }
+
+      // the pool isn't copied, the allocator keeps its own pool
+      node_pool_allocator& operator=(const node_pool_allocator& /*unused*/) // NOLINT(bugprone-unhandled-self-assignment)
+      {
+        return *this;
+      }
+      node_pool_allocator& operator=(node_pool_allocator&& other)
+      {
+        if(this != &other)
+        {
+          delete m_pool; // NOLINT(cppcoreguidelines-owning-memory)
+          m_pool       = other.m_pool;
+          other.m_pool = nullptr;
+        }
+        return *this;
+      }
+
+      // allocates count bytes of uninitialized storage
+      RSL_NO_DISCARD void* allocate(const size_type count)
+      {
+        if(m_pool == nullptr)
+        {
+          m_pool = new node_pool(); // NOLINT(cppcoreguidelines-owning-memory)
+        }
+        return m_pool->allocate(count);
+      }
+      // deallocates the storage reference by the pointer p.
+      // the pointer must be obtained by an earlier call to allocate
+      // performed by this allocator or an allocator that's equal to this.
+      void deallocate(void* const ptr, size_type count)
+      {
+        // like operator delete, freeing a nullptr does nothing
+        if(ptr == nullptr)
+        {
+          return;
+        }
+        m_pool->deallocate(ptr, count);
+      }
+
+      // returns the maximum theoretically possible value of n for,
+      // for which all calls to allocate(n) could succeed.
+      size_type max_size() const // NOLINT(readability-convert-member-functions-to-static)
+      {
+        return (rsl::numeric_limits<size_type>::max)();
+      }
+
+      // construct an object of type T in allocated uninitialized storage pointer to by p
+      template <typename U, typename... Args>
+      void construct(U* p, Args&&... args)
+      {
+        new(static_cast<void*>(p)) U(rsl::forward<Args>(args)...);
+      }
+      // calls the destructor of the object pointed to by p
+      template <typename U>
+      void destroy(U* p)
+      {
+        p->~U();
+      }
+
+      // returns the statistics of the pool, all zero if nothing got allocated yet
+      node_pool_stats stats() const
+      {
+        return m_pool ? m_pool->stats() : node_pool_stats {};
+      }
+
+      bool operator==(const node_pool_allocator& other) const
+      {
+        // an allocator without a pool will create its own, so it's only equal to itself
+        return this == &other || (m_pool != nullptr && m_pool == other.m_pool);
+      }
+      bool operator!=(const node_pool_allocator& other) const
+      {
+        return !(*this == other);
+      }
+
+    private:
+      node_pool* m_pool;
+    };
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // An allocator that allocates from the node pool of the thread it got created on.
+    // All containers of a thread using this allocator share the same pool,
+    // so a node freed by 1 container can be reused by another, without any locking.
+    // eg. rsl::map<int, int, rsl::less<int>, rsl::thread_local_node_pool_allocator>
+    //
+    // A container using this allocator must be destroyed before the thread it got created on exits
+    // and may only allocate and free nodes on that thread, as the pool is not thread safe.
+    class thread_local_node_pool_allocator
+    {
+    public:
+      using size_type       = size_t;
+      using difference_type = ptrdiff;
+
+      thread_local_node_pool_allocator()
+          : m_pool(&node_pool::thread_local_pool())
+      {
+      }
+      thread_local_node_pool_allocator(const thread_local_node_pool_allocator&) = default;
+      thread_local_node_pool_allocator(thread_local_node_pool_allocator&&)      = default;
+
+      ~thread_local_node_pool_allocator() = default;
+
+      thread_local_node_pool_allocator& operator=(const thread_local_node_pool_allocator&) = default;
+      thread_local_node_pool_allocator& operator=(thread_local_node_pool_allocator&&)      = default;
+
+      // allocates count bytes of uninitialized storage
+      RSL_NO_DISCARD void* allocate(const size_type count)
+      {
+        return m_pool->allocate(count);
+      }
+      // deallocates the storage reference by the pointer p.
+      // the pointer must be obtained by an earlier call to allocate
+      // performed by this allocator or an allocator that's equal to this.
+      void deallocate(void* const ptr, size_type count)
+      {
+        // like operator delete, freeing a nullptr does nothing
+        if(ptr == nullptr)
+        {
+          return;
+        }
+        m_pool->deallocate(ptr, count);
+      }
+
+      // returns the maximum theoretically possible value of n for,
+      // for which all calls to allocate(n) could succeed.
+      size_type max_size() const // NOLINT(readability-convert-member-functions-to-static)
+      {
+        return (rsl::numeric_limits<size_type>::max)();
+      }
+
+      // construct an object of type T in allocated uninitialized storage pointer to by p
+      template <typename U, typename... Args>
+      void construct(U* p, Args&&... args)
+      {
+        new(static_cast<void*>(p)) U(rsl::forward<Args>(args)...);
+      }
+      // calls the destructor of the object pointed to by p
+      template <typename U>
+      void destroy(U* p)
+      {
+        p->~U();
+      }
+
+      // returns the statistics of the pool shared by all containers of the thread
+      node_pool_stats stats() const
+      {
+        return m_pool->stats();
+      }
+
+      bool operator==(const thread_local_node_pool_allocator& other) const
+      {
+        return m_pool == other.m_pool;
+      }
+      bool operator!=(const thread_local_node_pool_allocator& other) const
+      {
+        return !(*this == other);
+      }
+
+    private:
+      node_pool* m_pool;
+    };
+
+  } // namespace v1
+} // namespace rsl
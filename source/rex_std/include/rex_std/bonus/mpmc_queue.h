@@ -0,0 +1,302 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: mpmc_queue.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// A bounded lock free queue for any number of producers and consumers
+// "Bounded MPMC queue" - Dmitry Vyukov
+//
+// Every slot has a sequence number telling whose turn it is.
+// A slot at position pos is free for the producer claiming pos when its sequence is pos,
+// and holds an item for the consumer claiming pos when its sequence is pos + 1.
+// Producers and consumers claim a position by moving the enqueue or dequeue position
+// with a CAS. They only wait for each other when they end up on the same slot.
+// The capacity is a power of 2, a position is turned into a slot with a mask.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/atomic/atomic_wait_event.h"
+#include "rex_std/bonus/attributes.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/algorithm/max.h"
+#include "rex_std/internal/atomic/atomic.h"
+#include "rex_std/internal/bit/bit_ceil.h"
+#include "rex_std/internal/memory/allocator.h"
+#include "rex_std/internal/memory/construct_at.h"
+#include "rex_std/internal/type_traits/aligned_storage.h"
+#include "rex_std/internal/utility/forward.h"
+#include "rex_std/internal/utility/move.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // the enqueue and dequeue positions are kept on their own cache line
+      inline constexpr card32 g_mpmc_queue_padding = 64;
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // all functions can be called by any number of threads at the same time.
+    // the queue never grows, pushing to a full queue fails or blocks until a consumer made room
+    template <typename T, typename Alloc = rsl::allocator>
+    class mpmc_queue
+    {
+    private:
+      struct slot
+      {
+        rsl::atomic<card64> sequence;
+        rsl::aligned_storage_t<T> storage;
+      };
+
+    public:
+      using value_type = T;
+
+      // the capacity is rounded up to a power of 2
+      explicit mpmc_queue(card64 capacity, const Alloc& alloc = Alloc())
+          : m_enqueue_pos(0)
+          , m_dequeue_pos(0)
+          , m_capacity(static_cast<card64>(rsl::bit_ceil(static_cast<uint64>((rsl::max)(capacity, card64(1))))))
+          , m_mask(m_capacity - 1)
+          , m_alloc(alloc)
+          , m_slots(static_cast<slot*>(m_alloc.allocate(m_capacity * sizeof(slot))))
+          , m_not_empty()
+          , m_not_full()
+      {
+        for(card64 i = 0; i < m_capacity; ++i)
+        {
+          rsl::construct_at(&m_slots[i].sequence, i);
+        }
+      }
+      mpmc_queue(const mpmc_queue&) = delete;
+      mpmc_queue(mpmc_queue&&)      = delete;
+      ~mpmc_queue()
+      {
+        // nobody is using the queue anymore, every claimed position is finished
+        const card64 enqueue_pos = m_enqueue_pos.load(rsl::memory_order_relaxed);
+        for(card64 pos = m_dequeue_pos.load(rsl::memory_order_relaxed); pos != enqueue_pos; ++pos)
+        {
+          item(pos)->~T();
+        }
+        for(card64 i = 0; i < m_capacity; ++i)
+        {
+          m_slots[i].sequence.~atomic();
+        }
+        m_alloc.deallocate(m_slots, m_capacity * sizeof(slot));
+      }
+
+      mpmc_queue& operator=(const mpmc_queue&) = delete;
+      mpmc_queue& operator=(mpmc_queue&&)      = delete;
+
+      // constructs an item at the back of the queue, returns false if the queue is full
+      template <typename... Args>
+      bool try_emplace(Args&&... args)
+      {
+        card64 pos = 0;
+        if(claim(m_enqueue_pos, 0, 1, pos) == 0)
+        {
+          return false;
+        }
+
+        rsl::construct_at(item(pos), rsl::forward<Args>(args)...);
+        publish_item(pos);
+        m_not_empty.notify();
+        return true;
+      }
+      bool try_push(const T& value)
+      {
+        return try_emplace(value);
+      }
+      bool try_push(T&& value)
+      {
+        return try_emplace(rsl::move(value));
+      }
+
+      // pushes up to count items, constructed from *first, *++first, ...
+      // the positions of the whole batch are claimed with a single CAS.
+      // returns the number of items pushed, less than count if the queue got full
+      template <typename InputIterator>
+      card64 try_push_n(InputIterator first, card64 count)
+      {
+        card64 pos           = 0;
+        const card64 to_push = claim(m_enqueue_pos, 0, count, pos);
+        for(card64 i = 0; i < to_push; ++i, ++first)
+        {
+          rsl::construct_at(item(pos + i), *first);
+          publish_item(pos + i);
+        }
+
+        if(to_push != 0)
+        {
+          m_not_empty.notify();
+        }
+        return to_push;
+      }
+
+      // moves the item at the front of the queue into value, returns false if the queue is empty
+      bool try_pop(T& value)
+      {
+        card64 pos = 0;
+        if(claim(m_dequeue_pos, 1, 1, pos) == 0)
+        {
+          return false;
+        }
+
+        take_item(pos, value);
+        m_not_full.notify();
+        return true;
+      }
+
+      // moves up to maxCount items to *out, *++out, ...
+      // the positions of the whole batch are claimed with a single CAS.
+      // returns the number of items popped, less than maxCount if the queue got empty
+      template <typename OutputIterator>
+      card64 try_pop_n(OutputIterator out, card64 maxCount)
+      {
+        card64 pos          = 0;
+        const card64 to_pop = claim(m_dequeue_pos, 1, maxCount, pos);
+        for(card64 i = 0; i < to_pop; ++i, ++out)
+        {
+          take_item(pos + i, *out);
+        }
+
+        if(to_pop != 0)
+        {
+          m_not_full.notify();
+        }
+        return to_pop;
+      }
+
+      // pushes an item, blocks while the queue is full
+      void push(const T& value)
+      {
+        while(!try_push(value))
+        {
+          m_not_full.wait_until([this]() { return is_turn(m_enqueue_pos, 0); });
+        }
+      }
+      void push(T&& value)
+      {
+        while(!try_push(rsl::move(value)))
+        {
+          m_not_full.wait_until([this]() { return is_turn(m_enqueue_pos, 0); });
+        }
+      }
+
+      // pops an item, blocks while the queue is empty
+      void pop(T& value)
+      {
+        while(!try_pop(value))
+        {
+          m_not_empty.wait_until([this]() { return is_turn(m_dequeue_pos, 1); });
+        }
+      }
+
+      // the number of items in the queue, it can already be different by the time this returns
+      RSL_NO_DISCARD card64 size_approx() const
+      {
+        const card64 dequeue_pos = m_dequeue_pos.load(rsl::memory_order_acquire);
+        const card64 enqueue_pos = m_enqueue_pos.load(rsl::memory_order_acquire);
+        return enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+      }
+      RSL_NO_DISCARD bool empty_approx() const
+      {
+        return size_approx() == 0;
+      }
+      RSL_NO_DISCARD card64 capacity() const
+      {
+        return m_capacity;
+      }
+
+    private:
+      T* item(card64 pos)
+      {
+        return m_slots[pos & m_mask].storage.template get<T>();
+      }
+
+      // a slot is ready for whoever claims pos when its sequence is pos + offset,
+      // 0 for a producer and 1 for a consumer
+      bool is_turn(rsl::atomic<card64>& position, card64 offset)
+      {
+        const card64 pos = position.load(rsl::memory_order_relaxed);
+        return m_slots[pos & m_mask].sequence.load(rsl::memory_order_acquire) == pos + offset;
+      }
+
+      // claims up to maxCount consecutive positions whose slots are ready, returns how many got claimed
+      card64 claim(rsl::atomic<card64>& position, card64 offset, card64 maxCount, card64& pos)
+      {
+        pos = position.load(rsl::memory_order_relaxed);
+        for(;;)
+        {
+          // slots aren't necessarily finished in order, count the ready ones up to the first that isn't
+          card64 count = 0;
+          while(count < maxCount && count < m_capacity && m_slots[(pos + count) & m_mask].sequence.load(rsl::memory_order_acquire) == pos + count + offset)
+          {
+            ++count;
+          }
+
+          if(count == 0)
+          {
+            // the first slot isn't ready, either the queue is full or empty, or another thread moved the position already
+            const card64 current = position.load(rsl::memory_order_relaxed);
+            if(current == pos)
+            {
+              return 0;
+            }
+            pos = current;
+            continue;
+          }
+
+          // a slot can only change its sequence after its position got claimed,
+          // so if nobody moved the position in the meantime, all counted slots are still ready
+          if(position.compare_exchange_weak(pos, pos + count, rsl::memory_order_relaxed, rsl::memory_order_relaxed))
+          {
+            return count;
+          }
+        }
+      }
+
+      void publish_item(card64 pos)
+      {
+        // hands the slot to the consumer claiming pos
+        m_slots[pos & m_mask].sequence.store(pos + 1, rsl::memory_order_release);
+      }
+
+      template <typename Out>
+      void take_item(card64 pos, Out& out)
+      {
+        T* front = item(pos);
+        out      = rsl::move(*front);
+        front->~T();
+        // hands the slot to the producer claiming the same slot on the next lap
+        m_slots[pos & m_mask].sequence.store(pos + m_capacity, rsl::memory_order_release);
+      }
+
+    private:
+      // claimed by the producers
+      alignas(internal::g_mpmc_queue_padding) rsl::atomic<card64> m_enqueue_pos;
+      // claimed by the consumers
+      alignas(internal::g_mpmc_queue_padding) rsl::atomic<card64> m_dequeue_pos;
+
+      // never written after construction
+      alignas(internal::g_mpmc_queue_padding) card64 m_capacity;
+      card64 m_mask;
+      Alloc m_alloc;
+      slot* m_slots;
+
+      // only written by threads that are about to block
+      alignas(internal::g_mpmc_queue_padding) internal::atomic_wait_event m_not_empty;
+      internal::atomic_wait_event m_not_full;
+    };
+  } // namespace v1
+} // namespace rsl
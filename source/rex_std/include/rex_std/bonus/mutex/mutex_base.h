@@ -21,7 +21,7 @@ namespace rsl
   {
     namespace internal
     {
-#if defined(RSL_PLATFORM_X64)
+#if defined(RSL_PLATFORM_X64) || defined(RSL_PLATFORM_ARM64)
       inline constexpr card32 g_mutex_size      = 16;
       inline constexpr card32 g_mutex_alignment = 8;
 #elif defined(RSL_PLATFORM_X86)
@@ -65,6 +65,10 @@ namespace rsl
       void mtx_clear_owner(mutex_base::internal* mtx);
       void mtx_reset_owner(mutex_base::internal* mtx);
       void* mtx_os_handle(mutex_base::internal* mtx);
+      // locks and unlocks the mutex without going through the owning mutex_base,
+      // used by the condition variable to release the mutex while it's waiting
+      void mtx_lock(mutex_base::internal* mtx);
+      void mtx_unlock(mutex_base::internal* mtx);
 
     } // namespace internal
   }   // namespace v1
@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include "rex_std/bonus/platform/cpu_features.h"
+
 #ifdef RSL_PLATFORM_WINDOWS
   #include "rex_std/bonus/platform/windows/handle.h"
 #endif
@@ -0,0 +1,95 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: cpu_features.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+
+// Functions marked with these can use the instruction set in their body
+// even if the translation unit itself isn't compiled with it.
+// MSVC allows any intrinsic to be used without extra flags.
+#if defined(RSL_COMPILER_MSVC)
+  #define RSL_TARGET_SSE42
+  #define RSL_TARGET_AVX2
+#else
+  #define RSL_TARGET_SSE42 __attribute__((target("sse4.2")))
+  #define RSL_TARGET_AVX2  __attribute__((target("avx2")))
+#endif
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    // The instruction sets we can dispatch to at runtime.
+    // These are queried once and cached, so querying them is cheap.
+    struct cpu_feature_set
+    {
+      bool sse2;
+      bool sse42;
+      bool avx2;
+      bool arm64_crc32;
+      bool arm64_pmull;
+    };
+
+    // returns the features supported by the cpu we're running on
+    const cpu_feature_set& cpu_features();
+
+    inline bool cpu_has_sse2()
+    {
+      return cpu_features().sse2;
+    }
+    inline bool cpu_has_sse42()
+    {
+      return cpu_features().sse42;
+    }
+    inline bool cpu_has_avx2()
+    {
+      return cpu_features().avx2;
+    }
+
+    // A kernel of a runtime dispatched function and the check if the cpu can run it.
+    // Kernels are put in a table, ordered from fastest to slowest.
+    // The last kernel of the table has no check as it has to run on any cpu.
+    template <typename Func>
+    struct cpu_kernel
+    {
+      bool (*is_supported)();
+      Func func;
+    };
+
+    namespace internal
+    {
+      template <typename Func, card32 Size>
+      Func select_cpu_kernel(const cpu_kernel<Func> (&kernels)[Size])
+      {
+        for(const cpu_kernel<Func>& kernel : kernels)
+        {
+          if(kernel.is_supported == nullptr || kernel.is_supported())
+          {
+            return kernel.func;
+          }
+        }
+        return kernels[Size - 1].func;
+      }
+    } // namespace internal
+
+    // returns the fastest kernel of the table the cpu supports.
+    // The kernel is picked on the first call.
+    // The initialization of a local static is thread safe, so it's also safe to call this from other static initializers.
+    template <const auto& Kernels>
+    auto best_cpu_kernel()
+    {
+      static const auto func = internal::select_cpu_kernel(Kernels);
+      return func;
+    }
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,43 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: futex.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+//-----------------------------------------------------------------------------
+// Thin wrappers around the Linux futex syscall.
+// These are the building blocks of the mutex and condition variable on Linux.
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // passing this as timeout waits until the thread gets woken up
+      inline constexpr int32 g_futex_infinite = -1;
+
+      // puts the calling thread to sleep as long as *addr equals expected.
+      // returns false if the timeout expired, true if the thread got woken up, possibly spuriously
+      bool futex_wait(uint32* addr, uint32 expected, int32 timeoutMs = g_futex_infinite);
+      // wakes up 1 thread waiting on addr
+      void futex_wake_one(uint32* addr);
+      // wakes up all threads waiting on addr
+      void futex_wake_all(uint32* addr);
+
+      // returns the kernel thread id of the calling thread
+      uint32 current_thread_id();
+    } // namespace internal
+  }   // namespace v1
+} // namespace rsl
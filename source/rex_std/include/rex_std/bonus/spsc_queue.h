@@ -0,0 +1,270 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: spsc_queue.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// A bounded lock free queue for a single producer and a single consumer
+//
+// The producer only writes the tail, the consumer only writes the head.
+// Each side keeps a copy of the other side's index on its own cache line and
+// only reads the shared index when its copy says the queue is full or empty,
+// so the two threads rarely touch the same cache line.
+// The capacity is a power of 2, an index is turned into a slot with a mask.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/atomic/atomic_wait_event.h"
+#include "rex_std/bonus/attributes.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/algorithm/max.h"
+#include "rex_std/internal/algorithm/min.h"
+#include "rex_std/internal/atomic/atomic.h"
+#include "rex_std/internal/bit/bit_ceil.h"
+#include "rex_std/internal/memory/allocator.h"
+#include "rex_std/internal/memory/construct_at.h"
+#include "rex_std/internal/utility/forward.h"
+#include "rex_std/internal/utility/move.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // the indices of the producer and the consumer are kept on their own cache line
+      inline constexpr card32 g_spsc_queue_padding = 64;
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // the push functions can only be called by one thread at a time, the pop functions by one other thread at a time.
+    // the queue never grows, pushing to a full queue fails or blocks until the consumer made room
+    template <typename T, typename Alloc = rsl::allocator>
+    class spsc_queue
+    {
+    public:
+      using value_type = T;
+
+      // the capacity is rounded up to a power of 2
+      explicit spsc_queue(card64 capacity, const Alloc& alloc = Alloc())
+          : m_tail(0)
+          , m_cached_head(0)
+          , m_head(0)
+          , m_cached_tail(0)
+          , m_capacity(static_cast<card64>(rsl::bit_ceil(static_cast<uint64>((rsl::max)(capacity, card64(1))))))
+          , m_mask(m_capacity - 1)
+          , m_alloc(alloc)
+          , m_slots(static_cast<T*>(m_alloc.allocate(m_capacity * sizeof(T))))
+          , m_not_empty()
+          , m_not_full()
+      {
+      }
+      spsc_queue(const spsc_queue&) = delete;
+      spsc_queue(spsc_queue&&)      = delete;
+      ~spsc_queue()
+      {
+        const card64 tail = m_tail.load(rsl::memory_order_relaxed);
+        for(card64 i = m_head.load(rsl::memory_order_relaxed); i != tail; ++i)
+        {
+          slot(i)->~T();
+        }
+        m_alloc.deallocate(m_slots, m_capacity * sizeof(T));
+      }
+
+      spsc_queue& operator=(const spsc_queue&) = delete;
+      spsc_queue& operator=(spsc_queue&&)      = delete;
+
+      // constructs an item at the back of the queue, returns false if the queue is full
+      template <typename... Args>
+      bool try_emplace(Args&&... args)
+      {
+        const card64 tail = m_tail.load(rsl::memory_order_relaxed);
+        if(free_slots(tail) == 0)
+        {
+          return false;
+        }
+
+        rsl::construct_at(slot(tail), rsl::forward<Args>(args)...);
+        publish_tail(tail + 1);
+        return true;
+      }
+      bool try_push(const T& item)
+      {
+        return try_emplace(item);
+      }
+      bool try_push(T&& item)
+      {
+        return try_emplace(rsl::move(item));
+      }
+
+      // pushes up to count items, constructed from *first, *++first, ...
+      // returns the number of items pushed, less than count if the queue got full
+      template <typename InputIterator>
+      card64 try_push_n(InputIterator first, card64 count)
+      {
+        const card64 tail    = m_tail.load(rsl::memory_order_relaxed);
+        const card64 to_push = (rsl::min)(count, free_slots(tail, count));
+        for(card64 i = 0; i < to_push; ++i, ++first)
+        {
+          rsl::construct_at(slot(tail + i), *first);
+        }
+
+        // the whole batch is published at once
+        if(to_push != 0)
+        {
+          publish_tail(tail + to_push);
+        }
+        return to_push;
+      }
+
+      // moves the item at the front of the queue into item, returns false if the queue is empty
+      bool try_pop(T& item)
+      {
+        const card64 head = m_head.load(rsl::memory_order_relaxed);
+        if(used_slots(head) == 0)
+        {
+          return false;
+        }
+
+        T* front = slot(head);
+        item     = rsl::move(*front);
+        front->~T();
+        publish_head(head + 1);
+        return true;
+      }
+
+      // moves up to maxCount items to *out, *++out, ...
+      // returns the number of items popped, less than maxCount if the queue got empty
+      template <typename OutputIterator>
+      card64 try_pop_n(OutputIterator out, card64 maxCount)
+      {
+        const card64 head   = m_head.load(rsl::memory_order_relaxed);
+        const card64 to_pop = (rsl::min)(maxCount, used_slots(head, maxCount));
+        for(card64 i = 0; i < to_pop; ++i, ++out)
+        {
+          T* front = slot(head + i);
+          *out     = rsl::move(*front);
+          front->~T();
+        }
+
+        if(to_pop != 0)
+        {
+          publish_head(head + to_pop);
+        }
+        return to_pop;
+      }
+
+      // pushes an item, blocks while the queue is full
+      void push(const T& item)
+      {
+        while(!try_push(item))
+        {
+          m_not_full.wait_until([this]() { return free_slots(m_tail.load(rsl::memory_order_relaxed)) != 0; });
+        }
+      }
+      void push(T&& item)
+      {
+        while(!try_push(rsl::move(item)))
+        {
+          m_not_full.wait_until([this]() { return free_slots(m_tail.load(rsl::memory_order_relaxed)) != 0; });
+        }
+      }
+
+      // pops an item, blocks while the queue is empty
+      void pop(T& item)
+      {
+        while(!try_pop(item))
+        {
+          m_not_empty.wait_until([this]() { return used_slots(m_head.load(rsl::memory_order_relaxed)) != 0; });
+        }
+      }
+
+      // the number of items in the queue, it can already be different by the time this returns
+      RSL_NO_DISCARD card64 size_approx() const
+      {
+        const card64 head = m_head.load(rsl::memory_order_acquire);
+        const card64 tail = m_tail.load(rsl::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+      }
+      RSL_NO_DISCARD bool empty_approx() const
+      {
+        return size_approx() == 0;
+      }
+      RSL_NO_DISCARD card64 capacity() const
+      {
+        return m_capacity;
+      }
+
+    private:
+      T* slot(card64 index)
+      {
+        return m_slots + (index & m_mask);
+      }
+
+      // only called by the producer.
+      // the head is only loaded when the cached copy says there's not enough room
+      card64 free_slots(card64 tail, card64 wanted = 1)
+      {
+        card64 free = m_capacity - (tail - m_cached_head);
+        if(free < wanted)
+        {
+          m_cached_head = m_head.load(rsl::memory_order_acquire);
+          free          = m_capacity - (tail - m_cached_head);
+        }
+        return free;
+      }
+      // only called by the consumer.
+      // the tail is only loaded when the cached copy says there aren't enough items
+      card64 used_slots(card64 head, card64 wanted = 1)
+      {
+        card64 used = m_cached_tail - head;
+        if(used < wanted)
+        {
+          m_cached_tail = m_tail.load(rsl::memory_order_acquire);
+          used          = m_cached_tail - head;
+        }
+        return used;
+      }
+
+      void publish_tail(card64 tail)
+      {
+        // publishes the constructed items to the consumer
+        m_tail.store(tail, rsl::memory_order_release);
+        m_not_empty.notify();
+      }
+      void publish_head(card64 head)
+      {
+        // hands the freed slots back to the producer
+        m_head.store(head, rsl::memory_order_release);
+        m_not_full.notify();
+      }
+
+    private:
+      // written by the producer
+      alignas(internal::g_spsc_queue_padding) rsl::atomic<card64> m_tail;
+      card64 m_cached_head;
+
+      // written by the consumer
+      alignas(internal::g_spsc_queue_padding) rsl::atomic<card64> m_head;
+      card64 m_cached_tail;
+
+      // never written after construction
+      alignas(internal::g_spsc_queue_padding) card64 m_capacity;
+      card64 m_mask;
+      Alloc m_alloc;
+      T* m_slots;
+
+      // only written by threads that are about to block
+      alignas(internal::g_spsc_queue_padding) internal::atomic_wait_event m_not_empty;
+      internal::atomic_wait_event m_not_full;
+    };
+  } // namespace v1
+} // namespace rsl
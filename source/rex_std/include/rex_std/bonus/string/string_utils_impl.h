@@ -15,17 +15,25 @@
 #include "rex_std/bonus/string/character_lookup.h"
 #include "rex_std/bonus/string/string_utils.h"
 #include "rex_std/bonus/types.h"
+#include "rex_std/charconv.h"
+#include "rex_std/cstring.h"
 #include "rex_std/internal/algorithm/reverse.h"
 #include "rex_std/internal/string/big_int.h"
+#include "rex_std/internal/iterator/begin.h"
 #include "rex_std/internal/iterator/distance.h"
 #include "rex_std/internal/iterator/end.h"
 #include "rex_std/internal/iterator/random_access_iterator.h"
 #include "rex_std/internal/iterator/reverse_iterator.h"
 #include "rex_std/internal/optional/optional.h"
+#include "rex_std/internal/type_traits/conditional.h"
 #include "rex_std/internal/type_traits/enable_if.h"
 #include "rex_std/internal/type_traits/is_integral.h"
+#include "rex_std/internal/type_traits/is_pointer.h"
+#include "rex_std/internal/type_traits/is_same.h"
 #include "rex_std/internal/type_traits/is_unsigned.h"
 #include "rex_std/internal/type_traits/make_unsigned.h"
+#include "rex_std/internal/type_traits/remove_cv.h"
+#include "rex_std/internal/type_traits/remove_pointer.h"
 #include "rex_std/iterator.h"
 #include "rex_std/limits.h"
 
@@ -65,6 +73,56 @@ namespace rsl
         bool is_negative;
       };
 
+      // a sign, the 309 integer digits of the largest double and the radix point
+      constexpr card32 max_float_buffer = 311;
+      // a double is exact after 17 significant digits, anything beyond this is just zeros or binary noise
+      constexpr card32 max_float_precision = 64;
+
+      // parses the whole string with rsl::from_chars, a leading plus sign is allowed.
+      // wide strings are narrowed to char8 first
+      template <typename T, typename Iterator>
+      constexpr optional<T> chars_to_arithmetic(const Iterator* str, card32 length)
+      {
+        if constexpr(rsl::is_same_v<Iterator, char8>)
+        {
+          // from_chars doesn't accept a leading plus sign
+          if(length != 0 && str[0] == '+')
+          {
+            ++str;
+            --length;
+          }
+
+          T value {};
+          const from_chars_result res = rsl::from_chars(str, str + length, value);
+          if(res.ec != errc {} || res.ptr != str + length)
+          {
+            return nullopt;
+          }
+          return value;
+        }
+        else
+        {
+          // longer than anything to_string writes, so not worth accepting
+          constexpr card32 max_chars = max_float_buffer + max_float_precision;
+          if(length > max_chars)
+          {
+            return nullopt;
+          }
+
+          char8 buff[max_chars]; // NOLINT(modernize-avoid-c-arrays)
+          for(card32 i = 0; i < length; ++i)
+          {
+            // anything outside of ascii can't be part of a number
+            if(static_cast<card32>(str[i]) > 0x7F) // NOLINT(readability-magic-numbers)
+            {
+              return nullopt;
+            }
+            buff[i] = static_cast<char8>(str[i]);
+          }
+          return chars_to_arithmetic<T>(static_cast<const char8*>(buff), length);
+        }
+      }
+
       template <typename FloatingType>
       struct floating_type_traits;
 
@@ -1342,13 +1400,7 @@ namespace rsl
     {
       static_assert(is_character_v<Iterator>, "argument is not of character type");
 
-      card32 length = 0;
-      while(*str)
-      {
-        str++;
-        ++length;
-      }
-      return length;
+      return rsl::strlen(str);
     }
 
     template <typename Iterator>
@@ -1566,89 +1618,17 @@ namespace rsl
     template <typename Iterator>
     RSL_NO_DISCARD constexpr optional<float32> stof(const Iterator* str, card32 length)
     {
-      float32 before_radix_value = 0.0f;
-      float32 after_radix_value  = 0.0f;
-
-      int32 sign                  = 1;
-      card32 i                    = 0;
-      card32 digits_after_radix   = 0;
-      bool assigning_before_radix = true;
-
-      if(str[0] == '-')
-      {
-        sign = -1;
-        ++i;
-      }
-      else if(str[0] == '+')
-      {
-        ++i;
-      }
-
-      for(; i < length; ++i)
-      {
-        if(!is_digitf(str[i]))
-          return nullopt;
-
-        if(str[i] == '.')
-        {
-          assigning_before_radix = false;
-          continue;
-        }
-
-        if(assigning_before_radix)
-        {
-          before_radix_value = ctoi(str[i]) + before_radix_value * 10.0f; // NOLINT(readability-magic-numbers)
-        }
-        else
-        {
-          after_radix_value = ctoi(str[i]) + after_radix_value * 10.0f; // NOLINT(readability-magic-numbers)
-          ++digits_after_radix;
-        }
-      }
-
-      return sign * before_radix_value + (after_radix_value / (max(1.0f, pow(10.0f, digits_after_radix)))); // NOLINT(readability-magic-numbers, bugprone-narrowing-conversions, cppcoreguidelines-narrowing-conversions)
+      return internal::chars_to_arithmetic<float32>(str, length);
     }
     template <typename Iterator>
     RSL_NO_DISCARD constexpr optional<int32> stoi(const Iterator* str, card32 length)
     {
-      int32 value = 0;
-      int32 sign  = 1;
-      int32 i     = 0;
-
-      if(str[0] == '-')
-      {
-        sign = -1;
-        ++i;
-      }
-      else if(str[0] == '+')
-      {
-        ++i;
-      }
-
-      for(; i < length; ++i)
-      {
-        if(!is_digit(str[i]))
-          return nullopt;
-
-        value = ctoi(str[i]) + value * 10; // NOLINT(readability-magic-numbers)
-      }
-
-      return sign * value;
+      return internal::chars_to_arithmetic<int32>(str, length);
     }
     template <typename Iterator>
     RSL_NO_DISCARD constexpr optional<uint32> stoui(const Iterator* str, card32 length)
     {
-      uint32 value = 0;
-
-      for(card32 i = 0; i < length; ++i)
-      {
-        if(!is_digit(str[i]))
-          return nullopt;
-
-        value = ctoi(str[i]) + value * 10; // NOLINT(readability-magic-numbers)
-      }
-
-      return value;
+      return internal::chars_to_arithmetic<uint32>(str, length);
     }
     template <typename Iterator>
     RSL_NO_DISCARD constexpr optional<bool> stob(const Iterator* str, card32 length)
@@ -1677,14 +1657,7 @@ namespace rsl
       {
         static_assert(rsl::is_unsigned_v<T>, "T must be unsigned");
 
-        auto value_trunc = value;
-
-        do
-        {
-          *--rnext = static_cast<T>(static_cast<CharType>('0') + value_trunc % 10);
-          value_trunc /= 10;
-        } while(value_trunc != 0);
-        return rnext;
+        return internal::write_decimal_backwards(rnext, value);
       }
 
       template <typename StringType, typename T>
@@ -1728,6 +1701,34 @@ namespace rsl
         const size_t size = buff_end - rnext;
         return StringType(rnext, static_cast<count_t>(size));
       }
+
+      // writes the value in fixed notation with the given number of digits after the radix point, correctly rounded.
+      // precisions above max_float_precision are clamped
+      template <typename StringType, typename T>
+      StringType float_to_string(T value, card32 precision)
+      {
+        using char_type = typename StringType::value_type;
+
+        char8 buff[max_float_buffer + max_float_precision]; // NOLINT(modernize-avoid-c-arrays)
+        const int32 clamped_precision = static_cast<int32>((rsl::min)(precision, max_float_precision));
+        // the buffer fits any value, so this can't fail
+        const to_chars_result res = rsl::to_chars(rsl::begin(buff), rsl::end(buff), value, chars_format::fixed, clamped_precision);
+        const count_t size        = static_cast<count_t>(res.ptr - buff);
+
+        if constexpr(rsl::is_same_v<char_type, char8>)
+        {
+          return StringType(buff, size);
+        }
+        else
+        {
+          char_type wide_buff[max_float_buffer + max_float_precision]; // NOLINT(modernize-avoid-c-arrays)
+          for(count_t i = 0; i < size; ++i)
+          {
+            wide_buff[i] = static_cast<char_type>(buff[i]);
+          }
+          return StringType(wide_buff, size);
+        }
+      }
     } // namespace internal
 
     template <typename SizeType, typename Iterator, rsl::enable_if_t<rsl::is_integral_v<SizeType>, bool>>
@@ -1880,24 +1881,12 @@ namespace rsl
       template <typename StringType>
       constexpr StringType to_string(const float32 value, card32 precision)
       {
-        const card32 int_value = static_cast<card32>(value);
-
-        const float32 radix_value        = value - int_value;                     // NOLINT(cppcoreguidelines-narrowing-conversions)
-        const float32 radix_value_to_int = radix_value * rsl::pow(10, precision); // NOLINT(cppcoreguidelines-narrowing-conversions)
-        const card32 radix_value_as_int  = static_cast<card32>(radix_value_to_int);
-
-        return to_string<StringType>(int_value) + static_cast<typename StringType::value_type>('.') + to_string<StringType>(radix_value_as_int);
+        return internal::float_to_string<StringType>(value, precision);
       }
       template <typename StringType>
       constexpr StringType to_string(const float64 value, card32 precision)
       {
-        const card64 int_value = static_cast<card64>(value);
-
-        const float64 radix_value        = value - int_value; // NOLINT(cppcoreguidelines-narrowing-conversions)
-        const float64 radix_value_to_int = radix_value * rsl::pow(10, precision);
-        const card64 radix_value_as_int  = static_cast<card64>(radix_value_to_int);
-
-        return to_string<StringType>(int_value) + static_cast<typename StringType::value_type>('.') + to_string<StringType>(radix_value_as_int);
+        return internal::float_to_string<StringType>(value, precision);
       }
       template <typename StringType>
       constexpr StringType to_string(const lfloat64 value, card32 precision)
@@ -1930,6 +1919,47 @@ namespace rsl
         return str;
       }
 
+      // converts the null terminated digits with rsl::from_chars.
+      // the leading white space and the base prefix are already skipped
+      template <typename T, typename IteratorPointer>
+      constexpr optional<T> chars_to_integral(const char8* str, IteratorPointer strEnd, int32 base)
+      {
+        // from_chars doesn't accept a leading plus sign, nor a minus sign for unsigned types.
+        // like the C functions, a negative unsigned value is the negation of its digits
+        const bool negative = *str == '-';
+        if(*str == '+' || (negative && rsl::is_unsigned_v<T>))
+        {
+          ++str;
+        }
+
+        // the number ends at the first char that isn't a digit, so there's no need to measure the whole string
+        const char8* last = negative && rsl::is_signed_v<T> ? str + 1 : str;
+        while(internal::digit_value(*last) < base)
+        {
+          ++last;
+        }
+
+        T value {};
+        const from_chars_result res = rsl::from_chars(str, last, value, base);
+        if(res.ec != errc {})
+        {
+          return nullopt;
+        }
+        if constexpr(rsl::is_unsigned_v<T>)
+        {
+          if(negative)
+          {
+            value = static_cast<T>(0 - value);
+          }
+        }
+
+        if(strEnd)
+        {
+          *strEnd = const_cast<char8*>(res.ptr); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+        }
+        return value;
+      }
+
       // iterator can be of type:
       // - char8*
       // - tchar*
@@ -1950,13 +1980,19 @@ namespace rsl
         if((base == 0 || base == 16) && *str == '0' && (*(str + 1) == 'x' || *(str + 1) == 'X')) // NOLINT(readability-magic-numbers)
         {
           str += 2;
-          return 16; // NOLINT(readability-magic-numbers)
+          base = 16; // NOLINT(readability-magic-numbers)
         }
         if(base == 0)
         {
           base = *str == '0' ? 8 : 10; // NOLINT(readability-magic-numbers)
         }
 
+        // pointers to chars go through rsl::from_chars
+        if constexpr(rsl::is_pointer_v<Iterator> && rsl::is_same_v<rsl::remove_cv_t<rsl::remove_pointer_t<Iterator>>, char8>)
+        {
+          return internal::chars_to_integral<T>(str, strEnd, base);
+        }
+
         // determine sign
         int32 sign = 1;
         if(*str == '-')
@@ -2042,14 +2078,20 @@ namespace rsl
         }
 
         // determine base
-        if((base == 0 || base == 16) && *str == '0' && (*(str + 1) == 'x' || *(str + 1) == 'X'))
+        if((base == 0 || base == 16) && *str == '0' && (*(str + 1) == 'x' || *(str + 1) == 'X')) // NOLINT(readability-magic-numbers)
         {
           str += 2;
-          return 16;
+          base = 16; // NOLINT(readability-magic-numbers)
         }
         if(base == 0)
         {
-          base = *str == '0' ? 8 : 10;
+          base = *str == '0' ? 8 : 10; // NOLINT(readability-magic-numbers)
+        }
+
+        // pointers to chars go through rsl::from_chars
+        if constexpr(rsl::is_pointer_v<Iterator> && rsl::is_same_v<rsl::remove_cv_t<rsl::remove_pointer_t<Iterator>>, char8>)
+        {
+          return internal::chars_to_integral<T>(str, strEnd, base);
         }
 
         // process string
@@ -2106,6 +2148,35 @@ namespace rsl
       {
         return str_to_unsigned<T>(str, static_cast<Iterator*>(nullptr), base);
       }
+      // the first 19 digits go through the Eisel-Lemire fast path of rsl::from_chars.
+      // only if that can't decide the rounding, the big integer conversion is used
+      template <typename T>
+      T decimal_digits_to_float(const floating_point_string& fpString)
+      {
+        // lfloat64 has the same representation as float64
+        using fast_path_type = rsl::conditional_t<rsl::is_same_v<T, float32>, float32, float64>;
+
+        constexpr uint32 max_fast_path_digits = 19;
+        const uint32 num_digits               = (rsl::min)(fpString.mantissa_count, max_fast_path_digits);
+        uint64 mantissa                       = 0;
+        for(uint32 i = 0; i < num_digits; ++i)
+        {
+          mantissa = mantissa * 10 + fpString.mantissa[i]; // NOLINT(readability-magic-numbers)
+        }
+
+        // the string holds 0.ddd x 10^exponent, the fast path expects ddd x 10^exponent.
+        // trailing zeros are already removed, so any digit that doesn't fit is non zero
+        const int64 exponent    = static_cast<int64>(fpString.exponent) - num_digits;
+        const bool is_truncated = fpString.mantissa_count > num_digits;
+
+        fast_path_type result {};
+        if(internal::fast_decimal_to_float(mantissa, exponent, is_truncated, fpString.is_negative, result))
+        {
+          return static_cast<T>(result);
+        }
+        return internal::convert_decimal_to_float<T>(fpString);
+      }
+
       // iterator can be of type:
       // - char8*
       // - tchar*
@@ -2120,7 +2191,7 @@ namespace rsl
 
         switch (res.metadata)
         {
-        case internal::floating_point_parse_result_metadata::decimal_digits: return internal::convert_decimal_to_float<T>(res.fp_string); 
+        case internal::floating_point_parse_result_metadata::decimal_digits: return internal::decimal_digits_to_float<T>(res.fp_string);
         case internal::floating_point_parse_result_metadata::hexadecimal_digits: return internal::convert_hexadecimal_to_float<T>(res.fp_string);
 
         case internal::floating_point_parse_result_metadata::zero:          return internal::assemble_floating_point_zero<T>(res.fp_string.is_negative);
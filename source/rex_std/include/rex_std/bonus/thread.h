@@ -0,0 +1,18 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: thread.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/thread/task_allocator.h"
+#include "rex_std/bonus/thread/thread_pool.h"
+#include "rex_std/bonus/thread/timer_queue.h"
+#include "rex_std/bonus/thread/work_stealing_deque.h"
@@ -0,0 +1,90 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: task_allocator.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Allocator for the tasks of a thread pool
+//
+// Tasks are small, short lived and often freed on another thread than the one
+// that allocated them. Every worker gets its own cache of fixed size blocks
+// that only it allocates from, so allocating never needs any synchronization.
+// A block freed by another thread is pushed on a lock free list of its owner,
+// the owner takes the whole list at once when its own blocks run out.
+// Threads that aren't workers share a single cache behind a lock.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/atomic/atomic.h"
+#include "rex_std/internal/memory/unique_ptr.h"
+#include "rex_std/internal/mutex/mutex.h"
+#include "rex_std/vector.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // blocks come in 64, 128, 256 and 512 bytes, bigger tasks are allocated from the global heap
+      inline constexpr card32 g_task_allocator_num_size_classes = 4;
+      inline constexpr card64 g_task_allocator_min_block_size   = 64;
+      // blocks are carved out of slabs of this size
+      inline constexpr card64 g_task_allocator_slab_size = 64 * 1024;
+      // the caches are written by different threads, keep them on their own cache line
+      inline constexpr card32 g_task_allocator_padding = 64;
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // memory of freed blocks is reused for other tasks, but only given back to the system
+    // when the allocator is destroyed. All blocks have to be freed before that.
+    class task_allocator
+    {
+    public:
+      // passing this as cache index means the calling thread doesn't own a cache
+      static constexpr card32 no_cache = -1;
+      // alignment of all returned memory
+      static constexpr card64 alignment = 16;
+
+      // creates numCaches caches owned by a single thread each, plus one shared cache
+      explicit task_allocator(card32 numCaches);
+      task_allocator(const task_allocator&) = delete;
+      task_allocator(task_allocator&&)      = delete;
+      ~task_allocator();
+
+      task_allocator& operator=(const task_allocator&) = delete;
+      task_allocator& operator=(task_allocator&&)      = delete;
+
+      // allocates size bytes from the given cache, only the thread owning the cache can call this
+      void* allocate(card64 size, card32 cacheIndex);
+      // allocates size bytes from the shared cache, any thread can call this
+      void* allocate_shared(card64 size);
+      // frees memory returned by either allocate function.
+      // cacheIndex is the cache owned by the calling thread, or no_cache if it doesn't own one
+      void deallocate(void* ptr, card32 cacheIndex);
+
+    private:
+      struct block_header;
+      struct free_block;
+      struct slab;
+      struct cache;
+
+      void* allocate_from(cache& cache, card32 cacheIndex, card64 size);
+      free_block* carve_slab(cache& cache, card32 cacheIndex, card32 sizeClass);
+
+    private:
+      rsl::vector<rsl::unique_ptr<cache>> m_caches;
+      // protects the local free lists of the shared cache, the last one in m_caches
+      rsl::mutex m_shared_mtx;
+    };
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,474 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: thread_pool.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// A work stealing thread pool
+//
+// Every worker owns a work stealing deque. Tasks spawned on a worker are pushed
+// to its own deque, idle workers steal from the deques of the other workers.
+// Tasks scheduled from outside the pool go to a shared injection queue.
+// Workers that can't find any work go to sleep until new work gets scheduled.
+//
+// Tasks that outlive the call scheduling them, like the ones of submit and then,
+// are allocated from a task allocator owned by the pool.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/attributes.h"
+#include "rex_std/bonus/thread/task_allocator.h"
+#include "rex_std/bonus/thread/work_stealing_deque.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/algorithm/max.h"
+#include "rex_std/internal/assert/assert_fwd.h"
+#include "rex_std/internal/atomic/atomic.h"
+#include "rex_std/internal/condition_variable/condition_variable.h"
+#include "rex_std/internal/future/future.h"
+#include "rex_std/internal/future/future_shared_state.h"
+#include "rex_std/internal/memory/construct_at.h"
+#include "rex_std/internal/memory/unique_ptr.h"
+#include "rex_std/internal/mutex/mutex.h"
+#include "rex_std/internal/thread/thread.h"
+#include "rex_std/internal/type_traits/decay.h"
+#include "rex_std/internal/type_traits/is_void.h"
+#include "rex_std/internal/utility/forward.h"
+#include "rex_std/internal/utility/move.h"
+#include "rex_std/vector.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    class thread_pool;
+
+    namespace internal
+    {
+      // the automatic grain size splits a range in this many chunks per worker,
+      // so a worker that finishes early can steal from a slower one
+      inline constexpr card32 g_thread_pool_chunks_per_worker = 8;
+
+      // a unit of work executed by the pool, the pool doesn't own its tasks.
+      // a function pointer is used instead of a virtual function so tasks can live on the stack
+      // of the thread spawning them without any heap allocation
+      class pool_task
+      {
+      public:
+        using execute_func = void (*)(pool_task*);
+
+        explicit pool_task(execute_func func)
+            : m_execute(func)
+            , m_next(nullptr)
+        {
+        }
+
+        void execute()
+        {
+          m_execute(this);
+        }
+
+        // used by the injection queue to link tasks together
+        pool_task* next() const
+        {
+          return m_next;
+        }
+        void set_next(pool_task* next)
+        {
+          m_next = next;
+        }
+
+      private:
+        execute_func m_execute;
+        pool_task* m_next;
+      };
+
+      // a task that's waited on by the thread spawning it, the function is owned by the spawning thread
+      template <typename Func>
+      class join_task : public pool_task
+      {
+      public:
+        explicit join_task(Func& func)
+            : pool_task(&join_task::execute_impl)
+            , m_func(func)
+            , m_done(false)
+        {
+        }
+
+        bool is_done() const
+        {
+          return m_done.load(rsl::memory_order_acquire);
+        }
+
+      private:
+        static void execute_impl(pool_task* task)
+        {
+          join_task* self = static_cast<join_task*>(task);
+          self->m_func();
+          // the spawning thread can destroy the task as soon as this is set, don't touch it afterwards
+          self->m_done.store(true, rsl::memory_order_release);
+        }
+
+      private:
+        Func& m_func;
+        rsl::atomic<bool> m_done;
+      };
+
+      struct pool_worker
+      {
+        thread_pool* pool;
+        card32 index;
+        // state of the random number generator used to pick a victim to steal from
+        uint32 steal_seed;
+        work_stealing_deque<pool_task> deque;
+      };
+
+      // tasks owned by the pool, defined after the pool
+      template <typename Func, typename R>
+      class submitted_task;
+      template <typename Func, typename Antecedent, typename R>
+      class continuation_task;
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    class thread_pool
+    {
+    public:
+      // creates a pool with a worker for every hardware thread
+      thread_pool();
+      // creates a pool with the given number of workers, 0 creates a worker for every hardware thread
+      explicit thread_pool(card32 numWorkers);
+      thread_pool(const thread_pool&) = delete;
+      thread_pool(thread_pool&&)      = delete;
+      // waits for the workers to finish the tasks that are already scheduled and joins them
+      ~thread_pool();
+
+      thread_pool& operator=(const thread_pool&) = delete;
+      thread_pool& operator=(thread_pool&&)      = delete;
+
+      // the pool used by the parallel algorithms when they're not given a pool explicitly
+      static thread_pool& default_pool();
+
+      RSL_NO_DISCARD card32 num_workers() const;
+
+      // returns a grain size that splits count elements in enough chunks to keep all workers busy,
+      // but never smaller than minGrain
+      RSL_NO_DISCARD card64 grain_size(card64 count, card64 minGrain = 1) const
+      {
+        const card64 num_chunks = static_cast<card64>(num_workers()) * internal::g_thread_pool_chunks_per_worker;
+        return (rsl::max)((count + num_chunks - 1) / num_chunks, (rsl::max)(minGrain, card64(1)));
+      }
+
+      // runs func on a worker of the pool and blocks until it's finished.
+      // if the calling thread is a worker of the pool, func is called immediately
+      template <typename Func>
+      void run(Func&& func)
+      {
+        if(current_worker() != nullptr)
+        {
+          func();
+          return;
+        }
+
+        internal::join_task<Func> task(func);
+        run_external(&task);
+      }
+
+      // calls both functions, possibly in parallel, and returns when both are finished.
+      // right is made available for stealing while the calling thread runs left
+      template <typename Left, typename Right>
+      void invoke(Left&& left, Right&& right)
+      {
+        internal::pool_worker* worker = current_worker();
+        if(worker == nullptr)
+        {
+          run([&]() { invoke(left, right); });
+          return;
+        }
+
+        internal::join_task<Right> right_task(right);
+        push(worker, &right_task);
+
+        left();
+
+        // if nobody stole right, we run it ourselves, otherwise we help out until the thief is done with it
+        if(pop_if_top(worker, &right_task))
+        {
+          right();
+        }
+        else
+        {
+          wait_until(worker, [&]() { return right_task.is_done(); });
+        }
+      }
+
+      // splits [first, last) in chunks of at least grain elements and calls func(chunkFirst, chunkLast) for every chunk.
+      // a grain of 0 picks the grain size automatically
+      template <typename Func>
+      void parallel_for(card64 first, card64 last, card64 grain, const Func& func)
+      {
+        if(first >= last)
+        {
+          return;
+        }
+
+        if(grain == 0)
+        {
+          grain = grain_size(last - first);
+        }
+
+        // no need to go through the pool if it all fits in a single chunk
+        if(last - first <= grain)
+        {
+          func(first, last);
+          return;
+        }
+
+        run([&]() { parallel_for_impl(first, last, grain, func); });
+      }
+
+      // runs func on a worker of the pool and returns a future to its result.
+      // the returned future has to be destroyed before the pool
+      template <typename Func>
+      future<internal::task_result_t<Func>> submit(Func&& func)
+      {
+        using result_type = internal::task_result_t<Func>;
+        using task_type   = internal::submitted_task<rsl::decay_t<Func>, result_type>;
+
+        task_type* task = new_task<task_type>(rsl::forward<Func>(func));
+        future<result_type> result(task);
+        schedule(task);
+        return result;
+      }
+
+      // runs func(antecedent) on a worker of the pool once antecedent is ready and returns a future to its result.
+      // no thread is blocked while the antecedent isn't ready yet.
+      // the returned future has to be destroyed before the pool
+      template <typename T, typename Func>
+      future<internal::task_result_t<Func, future<T>>> then(future<T>&& antecedent, Func&& func)
+      {
+        RSL_ASSERT_X(antecedent.valid(), "calling then on an invalid future");
+        return then_impl(rsl::move(antecedent), rsl::forward<Func>(func));
+      }
+      template <typename T, typename Func>
+      future<internal::task_result_t<Func, shared_future<T>>> then(const shared_future<T>& antecedent, Func&& func)
+      {
+        RSL_ASSERT_X(antecedent.valid(), "calling then on an invalid shared future");
+        return then_impl(shared_future<T>(antecedent), rsl::forward<Func>(func));
+      }
+
+      // schedules a task owned by the caller, the task has to stay alive until it's executed.
+      // used by objects embedding their own task, like a coroutine awaiting the pool, so scheduling doesn't allocate.
+      // the task is pushed on the deque of the calling worker, or on the injection queue if it's not a worker of this pool
+      void schedule(internal::pool_task* task);
+
+    private:
+      template <typename Func, typename R>
+      friend class internal::submitted_task;
+      template <typename Func, typename Antecedent, typename R>
+      friend class internal::continuation_task;
+      friend bool internal::help_pool_until_ready(const internal::future_shared_state_base& state);
+
+      template <typename Task, typename... Args>
+      Task* new_task(Args&&... args)
+      {
+        static_assert(alignof(Task) <= task_allocator::alignment, "task is aligned stricter than the task allocator supports");
+        return rsl::construct_at(static_cast<Task*>(allocate_task(sizeof(Task))), this, rsl::forward<Args>(args)...);
+      }
+
+      template <typename Antecedent, typename Func>
+      future<internal::task_result_t<Func, Antecedent>> then_impl(Antecedent&& antecedent, Func&& func)
+      {
+        using result_type = internal::task_result_t<Func, Antecedent>;
+        using task_type   = internal::continuation_task<rsl::decay_t<Func>, Antecedent, result_type>;
+
+        auto* antecedent_state = internal::future_access::state(antecedent);
+        task_type* task        = new_task<task_type>(rsl::move(antecedent), rsl::forward<Func>(func));
+        future<result_type> result(task);
+        // the task holds on to the antecedent, so its state stays alive.
+        // if the antecedent is already ready, this schedules the task immediately
+        antecedent_state->add_continuation(task);
+        return result;
+      }
+
+      // runs other tasks until done returns true
+      template <typename Predicate>
+      void wait_until(internal::pool_worker* worker, const Predicate& done)
+      {
+        card32 idle_rounds = 0;
+        while(!done())
+        {
+          help(worker, idle_rounds);
+        }
+      }
+
+      template <typename Func>
+      void parallel_for_impl(card64 first, card64 last, card64 grain, const Func& func) // NOLINT(misc-no-recursion)
+      {
+        // split in halves until the chunks are small enough, the halves that aren't run
+        // immediately are left for other workers to steal
+        if(last - first > grain)
+        {
+          const card64 mid = first + (last - first) / 2;
+          invoke([&]() { parallel_for_impl(first, mid, grain, func); }, [&]() { parallel_for_impl(mid, last, grain, func); });
+        }
+        else
+        {
+          func(first, last);
+        }
+      }
+
+      // returns the worker of this pool running on the calling thread, nullptr if it's not a worker of this pool
+      internal::pool_worker* current_worker() const;
+      // pushes a task on the deque of a worker and wakes up a sleeping worker to steal it
+      void push(internal::pool_worker* worker, internal::pool_task* task);
+      // pops the top task of the worker's deque if it's the given task
+      bool pop_if_top(internal::pool_worker* worker, internal::pool_task* task);
+      // runs a single task if the worker can find one, backs off otherwise
+      void help(internal::pool_worker* worker, card32& idleRounds);
+      // allocates from the cache of the calling worker, or the shared cache if it's not a worker of this pool
+      void* allocate_task(card64 size);
+      void deallocate_task(void* ptr);
+      // schedules a task from outside the pool and blocks until it's finished
+      void run_external(internal::pool_task* task);
+
+      void worker_main(internal::pool_worker* worker);
+      // looks for a task in the worker's own deque, the injection queue and the deques of the other workers
+      internal::pool_task* find_task(internal::pool_worker* worker);
+      internal::pool_task* steal_task(internal::pool_worker* worker);
+      internal::pool_task* pop_injected_task();
+      void inject(internal::pool_task* task);
+      bool has_work() const;
+      void park();
+      void wake_one();
+      void wake_all();
+
+    private:
+      rsl::vector<rsl::unique_ptr<internal::pool_worker>> m_workers;
+      rsl::vector<rsl::thread> m_threads;
+      task_allocator m_task_allocator;
+
+      // tasks scheduled by threads outside of the pool
+      rsl::mutex m_injection_mtx;
+      internal::pool_task* m_injection_head;
+      internal::pool_task* m_injection_tail;
+      rsl::atomic<card64> m_num_injected;
+
+      // workers go to sleep on this when they can't find any work
+      rsl::mutex m_sleep_mtx;
+      rsl::condition_variable m_sleep_cv;
+      card64 m_wake_epoch;
+      rsl::atomic<card32> m_num_sleeping;
+      rsl::atomic<bool> m_stop;
+    };
+
+    namespace internal
+    {
+      // a task scheduled with submit, it's also the shared state of the future returned to the caller
+      template <typename Func, typename R>
+      class submitted_task : public future_shared_state<R>, public pool_task
+      {
+      public:
+        template <typename F>
+        submitted_task(thread_pool* pool, F&& func)
+            : future_shared_state<R>(&submitted_task::destroy_impl)
+            , pool_task(&submitted_task::execute_impl)
+            , m_pool(pool)
+            , m_func(rsl::forward<F>(func))
+        {
+          // one reference for the returned future, one for the task until it's finished
+          this->add_ref();
+        }
+
+      private:
+        static void execute_impl(pool_task* task)
+        {
+          submitted_task* self = static_cast<submitted_task*>(task);
+          if constexpr(rsl::is_void_v<R>)
+          {
+            self->m_func();
+            self->set_value();
+          }
+          else
+          {
+            self->set_value(self->m_func());
+          }
+          self->release();
+        }
+
+        static void destroy_impl(future_shared_state_base* state)
+        {
+          submitted_task* self = static_cast<submitted_task*>(state);
+          thread_pool* pool    = self->m_pool;
+          self->~submitted_task();
+          pool->deallocate_task(self);
+        }
+
+      private:
+        thread_pool* m_pool;
+        Func m_func;
+      };
+
+      // a task scheduled with then, it gets scheduled by the thread making its antecedent ready
+      template <typename Func, typename Antecedent, typename R>
+      class continuation_task : public future_shared_state<R>, public pool_task, public future_continuation
+      {
+      public:
+        template <typename F>
+        continuation_task(thread_pool* pool, Antecedent&& antecedent, F&& func)
+            : future_shared_state<R>(&continuation_task::destroy_impl)
+            , pool_task(&continuation_task::execute_impl)
+            , future_continuation(&continuation_task::schedule_impl)
+            , m_pool(pool)
+            , m_antecedent(rsl::move(antecedent))
+            , m_func(rsl::forward<F>(func))
+        {
+          // one reference for the returned future, one for the task until it's finished
+          this->add_ref();
+        }
+
+      private:
+        static void schedule_impl(future_continuation* continuation)
+        {
+          continuation_task* self = static_cast<continuation_task*>(continuation);
+          self->m_pool->schedule(self);
+        }
+
+        static void execute_impl(pool_task* task)
+        {
+          continuation_task* self = static_cast<continuation_task*>(task);
+          if constexpr(rsl::is_void_v<R>)
+          {
+            self->m_func(rsl::move(self->m_antecedent));
+            self->set_value();
+          }
+          else
+          {
+            self->set_value(self->m_func(rsl::move(self->m_antecedent)));
+          }
+          self->release();
+        }
+
+        static void destroy_impl(future_shared_state_base* state)
+        {
+          continuation_task* self = static_cast<continuation_task*>(state);
+          thread_pool* pool       = self->m_pool;
+          self->~continuation_task();
+          pool->deallocate_task(self);
+        }
+
+      private:
+        thread_pool* m_pool;
+        Antecedent m_antecedent;
+        Func m_func;
+      };
+    } // namespace internal
+  } // namespace v1
+} // namespace rsl
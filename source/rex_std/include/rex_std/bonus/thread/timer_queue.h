@@ -0,0 +1,105 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: timer_queue.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Fires timers on a single background thread
+//
+// The queue doesn't own its timers, a timer is embedded in whatever object is
+// waiting for it, like a suspended coroutine, so scheduling a timer doesn't allocate.
+// Timers fire on the timer thread, a timer that has more than a little
+// work to do should hand it over to a thread pool.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/chrono/clock.h"
+#include "rex_std/internal/condition_variable/condition_variable.h"
+#include "rex_std/internal/mutex/mutex.h"
+#include "rex_std/internal/thread/thread.h"
+#include "rex_std/vector.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // a timer waiting in a timer queue.
+      // a function pointer is used instead of a virtual function, like the tasks of the thread pool
+      class timer_entry
+      {
+      public:
+        using fire_func = void (*)(timer_entry*);
+
+        explicit timer_entry(fire_func func)
+            : m_fire(func)
+            , m_deadline()
+        {
+        }
+
+        void fire()
+        {
+          m_fire(this);
+        }
+
+        chrono::steady_clock::time_point deadline() const
+        {
+          return m_deadline;
+        }
+        void set_deadline(chrono::steady_clock::time_point deadline)
+        {
+          m_deadline = deadline;
+        }
+
+      private:
+        fire_func m_fire;
+        chrono::steady_clock::time_point m_deadline;
+      };
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    class timer_queue
+    {
+    public:
+      // starts the timer thread
+      timer_queue();
+      timer_queue(const timer_queue&) = delete;
+      timer_queue(timer_queue&&)      = delete;
+      // fires the timers that are still waiting immediately, so nothing waits on a timer forever, and joins the timer thread
+      ~timer_queue();
+
+      timer_queue& operator=(const timer_queue&) = delete;
+      timer_queue& operator=(timer_queue&&)      = delete;
+
+      // the queue used by the timer awaitables when they're not given a queue explicitly
+      static timer_queue& default_queue();
+
+      // fires the timer on the timer thread once the deadline is reached.
+      // the timer has to stay alive until it's fired
+      void schedule(internal::timer_entry* timer, chrono::steady_clock::time_point deadline);
+
+    private:
+      void timer_main();
+      // the timers are kept in a binary min heap on their deadline
+      void push_timer(internal::timer_entry* timer);
+      internal::timer_entry* pop_timer();
+
+    private:
+      rsl::mutex m_mtx;
+      rsl::condition_variable m_cv;
+      rsl::vector<internal::timer_entry*> m_timers;
+      bool m_stop;
+      rsl::thread m_thread;
+    };
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,260 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: work_stealing_deque.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Chase-Lev work stealing deque
+// "Dynamic Circular Work-Stealing Deque" - David Chase, Yossi Lev
+// "Correct and Efficient Work-Stealing for Weak Memory Models" - Le, Pop, Cohen, Zappa Nardelli
+//
+// The owning thread pushes and pops at the bottom, like a stack.
+// Any other thread can steal from the top, so the oldest (and usually biggest)
+// items get stolen. Only the last item is ever contended.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/assert/assert_fwd.h"
+#include "rex_std/internal/atomic/atomic.h"
+#include "rex_std/internal/memory/allocator.h"
+#include "rex_std/internal/memory/construct_at.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // bottom and top are written by different threads, keep them on their own cache line
+      inline constexpr card32 g_work_stealing_deque_padding = 64;
+      inline constexpr card64 g_work_stealing_deque_default_capacity = 256;
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // a lock free deque of pointers, the deque doesn't own the items.
+    // push and pop can only be called by the thread owning the deque, steal can be called by any thread.
+    // the deque grows when it's full, old buffers are kept alive until the deque gets destroyed
+    // as a thief could still be reading from them.
+    template <typename T>
+    class work_stealing_deque
+    {
+    private:
+      class ring_buffer
+      {
+      public:
+        explicit ring_buffer(card64 capacity)
+            : m_capacity(capacity)
+            , m_mask(capacity - 1)
+            , m_previous(nullptr)
+        {
+          for(card64 i = 0; i < m_capacity; ++i)
+          {
+            rsl::construct_at(slots() + i, nullptr);
+          }
+        }
+
+        card64 capacity() const
+        {
+          return m_capacity;
+        }
+
+        T* get(int64 index)
+        {
+          return slots()[static_cast<card64>(index) & m_mask].load(rsl::memory_order_relaxed);
+        }
+        void put(int64 index, T* item)
+        {
+          slots()[static_cast<card64>(index) & m_mask].store(item, rsl::memory_order_relaxed);
+        }
+
+        ring_buffer* previous()
+        {
+          return m_previous;
+        }
+        void set_previous(ring_buffer* previous)
+        {
+          m_previous = previous;
+        }
+
+        static card64 alloc_size(card64 capacity)
+        {
+          return sizeof(ring_buffer) + capacity * sizeof(rsl::atomic<T*>);
+        }
+
+      private:
+        // the slots are allocated right after the ring buffer
+        rsl::atomic<T*>* slots()
+        {
+          return reinterpret_cast<rsl::atomic<T*>*>(this + 1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+
+      private:
+        card64 m_capacity;
+        card64 m_mask;
+        ring_buffer* m_previous;
+      };
+
+    public:
+      // the capacity has to be a power of 2
+      explicit work_stealing_deque(card64 capacity = internal::g_work_stealing_deque_default_capacity)
+          : m_top(0)
+          , m_bottom(0)
+          , m_buffer(create_buffer(capacity))
+      {
+        RSL_ASSERT_X(capacity != 0 && (capacity & (capacity - 1)) == 0, "capacity of a work stealing deque has to be a power of 2");
+      }
+
+      work_stealing_deque(const work_stealing_deque&) = delete;
+      work_stealing_deque(work_stealing_deque&&)      = delete;
+
+      ~work_stealing_deque()
+      {
+        ring_buffer* buffer = m_buffer.load(rsl::memory_order_relaxed);
+        while(buffer != nullptr)
+        {
+          ring_buffer* previous = buffer->previous();
+          destroy_buffer(buffer);
+          buffer = previous;
+        }
+      }
+
+      work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+      work_stealing_deque& operator=(work_stealing_deque&&)      = delete;
+
+      // adds an item to the bottom of the deque, can only be called by the owning thread
+      void push(T* item)
+      {
+        const int64 bottom  = m_bottom.load(rsl::memory_order_relaxed);
+        const int64 top     = m_top.load(rsl::memory_order_acquire);
+        ring_buffer* buffer = m_buffer.load(rsl::memory_order_relaxed);
+
+        if(bottom - top >= static_cast<int64>(buffer->capacity()))
+        {
+          buffer = grow(buffer, top, bottom);
+        }
+
+        buffer->put(bottom, item);
+        // publishes the item to the thieves
+        m_bottom.store(bottom + 1, rsl::memory_order_release);
+      }
+
+      // removes the item at the bottom of the deque, the last one that got pushed.
+      // returns nullptr if the deque is empty. can only be called by the owning thread
+      T* pop()
+      {
+        // bottom is signed, on an empty deque this goes to top - 1 which has to compare less than top
+        const int64 bottom  = m_bottom.load(rsl::memory_order_relaxed) - 1;
+        ring_buffer* buffer = m_buffer.load(rsl::memory_order_relaxed);
+
+        // reserve the bottom item before looking at top.
+        // this needs to be a full barrier, an exchange is one on every platform,
+        // a store followed by a fence isn't on all our compilers
+        m_bottom.exchange(bottom, rsl::memory_order_seq_cst);
+        int64 top = m_top.load(rsl::memory_order_seq_cst);
+
+        if(top > bottom)
+        {
+          // the deque was already empty
+          m_bottom.store(bottom + 1, rsl::memory_order_relaxed);
+          return nullptr;
+        }
+
+        T* item = buffer->get(bottom);
+        if(top == bottom)
+        {
+          // this is the last item, a thief might be trying to take it as well.
+          // whoever moves top first gets it.
+          if(!m_top.compare_exchange_strong(top, top + 1, rsl::memory_order_seq_cst, rsl::memory_order_relaxed))
+          {
+            item = nullptr;
+          }
+          m_bottom.store(bottom + 1, rsl::memory_order_relaxed);
+        }
+
+        return item;
+      }
+
+      // removes the item at the top of the deque, the oldest one that got pushed.
+      // returns nullptr if the deque is empty or another thread took the item first.
+      // can be called by any thread
+      T* steal()
+      {
+        int64 top          = m_top.load(rsl::memory_order_seq_cst);
+        const int64 bottom = m_bottom.load(rsl::memory_order_seq_cst);
+
+        if(top >= bottom)
+        {
+          return nullptr;
+        }
+
+        ring_buffer* buffer = m_buffer.load(rsl::memory_order_acquire);
+        T* item             = buffer->get(top);
+        if(!m_top.compare_exchange_strong(top, top + 1, rsl::memory_order_seq_cst, rsl::memory_order_relaxed))
+        {
+          // lost the race against the owner or another thief
+          return nullptr;
+        }
+
+        return item;
+      }
+
+      // returns true if the deque looks empty, the result can be out of date by the time it's used
+      bool empty() const
+      {
+        const int64 top    = m_top.load(rsl::memory_order_relaxed);
+        const int64 bottom = m_bottom.load(rsl::memory_order_relaxed);
+        return top >= bottom;
+      }
+
+      // returns the number of items in the deque, the result can be out of date by the time it's used
+      card64 size() const
+      {
+        const int64 top    = m_top.load(rsl::memory_order_relaxed);
+        const int64 bottom = m_bottom.load(rsl::memory_order_relaxed);
+        return bottom > top ? static_cast<card64>(bottom - top) : 0;
+      }
+
+    private:
+      static ring_buffer* create_buffer(card64 capacity)
+      {
+        rsl::allocator alloc;
+        void* mem = alloc.allocate(ring_buffer::alloc_size(capacity));
+        return rsl::construct_at(static_cast<ring_buffer*>(mem), capacity);
+      }
+      static void destroy_buffer(ring_buffer* buffer)
+      {
+        // ring buffer and the atomic pointers are all trivially destructible
+        rsl::allocator alloc;
+        alloc.deallocate(buffer, ring_buffer::alloc_size(buffer->capacity()));
+      }
+
+      ring_buffer* grow(ring_buffer* buffer, int64 top, int64 bottom)
+      {
+        ring_buffer* new_buffer = create_buffer(buffer->capacity() * 2);
+        for(int64 i = top; i < bottom; ++i)
+        {
+          new_buffer->put(i, buffer->get(i));
+        }
+
+        // thieves that already loaded the old buffer can still read from it
+        new_buffer->set_previous(buffer);
+        m_buffer.store(new_buffer, rsl::memory_order_release);
+        return new_buffer;
+      }
+
+    private:
+      alignas(internal::g_work_stealing_deque_padding) rsl::atomic<int64> m_top;
+      alignas(internal::g_work_stealing_deque_padding) rsl::atomic<int64> m_bottom;
+      alignas(internal::g_work_stealing_deque_padding) rsl::atomic<ring_buffer*> m_buffer;
+    };
+  } // namespace v1
+} // namespace rsl
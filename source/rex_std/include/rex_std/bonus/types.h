@@ -47,8 +47,13 @@ namespace rsl
     // long is 64 bits on Linux and macOS
     // use case of long is highly discouraged
     // due to their inconsistent size on different platforms
+#if defined(RSL_PLATFORM_WINDOWS)
     static_assert(sizeof(long) == sizeof(int32), "long should be the same size as int32");
     static_assert(sizeof(ulong) == sizeof(uint32), "ulong should be the same size as uint32");
+#else
+    static_assert(sizeof(long) == sizeof(int64), "long should be the same size as int64");
+    static_assert(sizeof(ulong) == sizeof(uint64), "ulong should be the same size as uint64");
+#endif
 
     // Yes, cardinals are meant to always be positive,
     // so it makes sense for them to be unsigned.
@@ -70,8 +75,12 @@ namespace rsl
     static_assert(sizeof(char16) == 2, "char16 must be 2 byte big"); // NOLINT
     static_assert(sizeof(char32) == 4, "char32 must be 4 byte big"); // NOLINT
 
-    // with MSVC, wchar_t is 2 bytes big, while with clang and gcc, it's 4 bytes big
+    // wchar_t is 2 bytes big on Windows, while it's 4 bytes big on Linux and macOS
+#if defined(RSL_PLATFORM_WINDOWS)
     static_assert(sizeof(tchar) == 2, "tchar must be 2 bytes big");
+#else
+    static_assert(sizeof(tchar) == 4, "tchar must be 4 bytes big");
+#endif
 
     // floating-point
     using float32 = float;
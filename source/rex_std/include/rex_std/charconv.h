@@ -13,21 +13,364 @@
 #pragma once
 
 #include "rex_std/bonus/defines.h"
-#include "rex_std/disable_std_checking.h"
-#include "rex_std/std_alias_defines.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/bit/countl_zero.h"
+#include "rex_std/internal/type_traits/conditional.h"
+#include "rex_std/internal/type_traits/enable_if.h"
+#include "rex_std/internal/type_traits/is_constant_evaluated.h"
+#include "rex_std/internal/type_traits/is_integral.h"
+#include "rex_std/internal/type_traits/is_same.h"
+#include "rex_std/internal/type_traits/is_signed.h"
+#include "rex_std/internal/type_traits/make_unsigned.h"
+#include "rex_std/limits.h"
+#include "rex_std/system_error.h"
 
-#include <charconv>
+#include "rex_std/disable_std_checking.h"
 
 namespace rsl
 {
   inline namespace v1
   {
+    enum class chars_format
+    {
+      scientific = 1 << 0,
+      fixed      = 1 << 1,
+      hex        = 1 << 2,
+      general    = fixed | scientific
+    };
+
+    constexpr chars_format operator&(chars_format lhs, chars_format rhs)
+    {
+      return static_cast<chars_format>(static_cast<int32>(lhs) & static_cast<int32>(rhs));
+    }
+    constexpr chars_format operator|(chars_format lhs, chars_format rhs)
+    {
+      return static_cast<chars_format>(static_cast<int32>(lhs) | static_cast<int32>(rhs));
+    }
+    constexpr chars_format operator^(chars_format lhs, chars_format rhs)
+    {
+      return static_cast<chars_format>(static_cast<int32>(lhs) ^ static_cast<int32>(rhs));
+    }
+    constexpr chars_format operator~(chars_format fmt)
+    {
+      return static_cast<chars_format>(~static_cast<int32>(fmt));
+    }
+
+    struct to_chars_result
+    {
+      char8* ptr;
+      errc ec;
+    };
+
+    struct from_chars_result
+    {
+      const char8* ptr;
+      errc ec;
+    };
+
+    // writes the shortest representation that reads back to the same value.
+    // fixed or scientific notation is picked, whichever is shorter
+    to_chars_result to_chars(char8* first, char8* last, float32 value);
+    to_chars_result to_chars(char8* first, char8* last, float64 value);
+    /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Oct/2023)
+    // long double has the same representation as double on all supported platforms
+    to_chars_result to_chars(char8* first, char8* last, lfloat64 value);
+
+    // writes the shortest representation in the given format that reads back to the same value
+    to_chars_result to_chars(char8* first, char8* last, float32 value, chars_format fmt);
+    to_chars_result to_chars(char8* first, char8* last, float64 value, chars_format fmt);
+    to_chars_result to_chars(char8* first, char8* last, lfloat64 value, chars_format fmt);
+
+    // writes the value with the given precision, like printf does
+    to_chars_result to_chars(char8* first, char8* last, float32 value, chars_format fmt, int32 precision);
+    to_chars_result to_chars(char8* first, char8* last, float64 value, chars_format fmt, int32 precision);
+    to_chars_result to_chars(char8* first, char8* last, lfloat64 value, chars_format fmt, int32 precision);
+
+    // parses the value, rounded to nearest.
+    // the value is left untouched if the text isn't a number or the number is out of range
+    from_chars_result from_chars(const char8* first, const char8* last, float32& value, chars_format fmt = chars_format::general);
+    from_chars_result from_chars(const char8* first, const char8* last, float64& value, chars_format fmt = chars_format::general);
+    from_chars_result from_chars(const char8* first, const char8* last, lfloat64& value, chars_format fmt = chars_format::general);
+
+    namespace internal
+    {
+      // "00", "01", .. "99", so 2 digits are written with a single lookup
+      inline constexpr char8 g_digit_pairs[] = // NOLINT(modernize-avoid-c-arrays)
+          "0001020304050607080910111213141516171819"
+          "2021222324252627282930313233343536373839"
+          "4041424344454647484950515253545556575859"
+          "6061626364656667686970717273747576777879"
+          "8081828384858687888990919293949596979899";
+
+      inline constexpr uint64 g_powers_of_ten[] = // NOLINT(modernize-avoid-c-arrays)
+          {1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull};
+
+      constexpr const char8* digit_pair(card32 value)
+      {
+        return &g_digit_pairs[value * 2];
+      }
+
+      // the number of decimal digits of value, 1 for 0
+      template <typename UInt>
+      constexpr card32 count_decimal_digits(UInt value)
+      {
+        if(rsl::is_constant_evaluated())
+        {
+          card32 num_digits = 1;
+          while(value >= 10) // NOLINT(readability-magic-numbers)
+          {
+            value /= 10; // NOLINT(readability-magic-numbers)
+            ++num_digits;
+          }
+          return num_digits;
+        }
+
+        // log10(2) is about 1233 / 4096. this gives the digits of the largest number with the same bit width,
+        // which is at most 1 too many. 10^n is even for n > 0, so or'ing in the lowest bit doesn't change the comparison
+        const UInt non_zero      = value | 1;
+        const card32 bit_width   = rsl::numeric_limits<UInt>::digits - rsl::countl_zero(non_zero);
+        const card32 upper_bound = (bit_width * 1233) >> 12; // NOLINT(readability-magic-numbers)
+        return upper_bound + 1 - (static_cast<uint64>(non_zero) < g_powers_of_ten[upper_bound] ? 1 : 0);
+      }
+
+      // writes the decimal digits of value so they end at last, 2 digits per division.
+      // returns the first digit written
+      template <typename CharType, typename UInt>
+      constexpr CharType* write_decimal_backwards(CharType* last, UInt value)
+      {
+        while(value >= 100) // NOLINT(readability-magic-numbers)
+        {
+          const char8* pair = digit_pair(static_cast<card32>(value % 100)); // NOLINT(readability-magic-numbers)
+          value /= 100;                                                      // NOLINT(readability-magic-numbers)
+          *--last = static_cast<CharType>(pair[1]);
+          *--last = static_cast<CharType>(pair[0]);
+        }
+        if(value >= 10) // NOLINT(readability-magic-numbers)
+        {
+          const char8* pair = digit_pair(static_cast<card32>(value));
+          *--last           = static_cast<CharType>(pair[1]);
+          *--last           = static_cast<CharType>(pair[0]);
+          return last;
+        }
+        *--last = static_cast<CharType>('0' + value);
+        return last;
+      }
+
+      template <typename UInt>
+      constexpr to_chars_result unsigned_to_chars(char8* first, char8* last, UInt value, int32 base)
+      {
+        constexpr const char8* digits = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+        if(base == 10) // NOLINT(readability-magic-numbers)
+        {
+          const card32 num_digits = count_decimal_digits(value);
+          if(last - first < num_digits)
+          {
+            return {last, errc::value_too_large};
+          }
+          write_decimal_backwards(first + num_digits, value);
+          return {first + num_digits, errc {}};
+        }
+
+        if((base & (base - 1)) == 0 && !rsl::is_constant_evaluated())
+        {
+          // every digit is a fixed number of bits, so the length follows from the bit width
+          const card32 bits_per_digit = rsl::numeric_limits<uint32>::digits - 1 - rsl::countl_zero(static_cast<uint32>(base));
+          const card32 bit_width      = rsl::numeric_limits<UInt>::digits - rsl::countl_zero(static_cast<UInt>(value | 1));
+          const card32 num_digits     = (bit_width + bits_per_digit - 1) / bits_per_digit;
+          if(last - first < num_digits)
+          {
+            return {last, errc::value_too_large};
+          }
+          const UInt mask = static_cast<UInt>(base - 1);
+          for(char8* it = first + num_digits; it != first; value >>= bits_per_digit)
+          {
+            *--it = digits[value & mask];
+          }
+          return {first + num_digits, errc {}};
+        }
+
+        card32 num_digits = 1;
+        for(UInt rest = value / static_cast<UInt>(base); rest != 0; rest /= static_cast<UInt>(base))
+        {
+          ++num_digits;
+        }
+        if(last - first < num_digits)
+        {
+          return {last, errc::value_too_large};
+        }
+        for(char8* it = first + num_digits; it != first; value /= static_cast<UInt>(base))
+        {
+          *--it = digits[value % static_cast<UInt>(base)];
+        }
+        return {first + num_digits, errc {}};
+      }
+
+      // the value of a digit in any base up to 36, or 255 if it's not a digit
+      constexpr uint8 digit_value(char8 c)
+      {
+        if(c >= '0' && c <= '9')
+        {
+          return static_cast<uint8>(c - '0');
+        }
+        // setting the 0x20 bit turns upper case letters into lower case ones
+        const char8 lower = static_cast<char8>(c | 0x20); // NOLINT(readability-magic-numbers)
+        if(lower >= 'a' && lower <= 'z')
+        {
+          return static_cast<uint8>(lower - 'a' + 10); // NOLINT(readability-magic-numbers)
+        }
+        return 0xFF; // NOLINT(readability-magic-numbers)
+      }
+
+      // reads 8 chars as a little endian word, the compiler turns this into a single load
+      constexpr uint64 read_8_chars(const char8* str)
+      {
+        uint64 chunk = 0;
+        for(card32 i = 0; i < 8; ++i)
+        {
+          chunk |= static_cast<uint64>(static_cast<uint8>(str[i])) << (i * 8);
+        }
+        return chunk;
+      }
+
+      // checks all 8 chars of the word are between '0' and '9' at once
+      constexpr bool is_8_digits(uint64 chunk)
+      {
+        return (((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333); // NOLINT(readability-magic-numbers)
+      }
+
+      // converts 8 digits at once, by combining neighbouring digits, then pairs, then quads
+      constexpr uint32 parse_8_digits(uint64 chunk)
+      {
+        constexpr uint64 mask = 0x000000FF000000FF;
+        constexpr uint64 mul1 = 0x000F424000000064; // 100 + (1000000 << 32)
+        constexpr uint64 mul2 = 0x0000271000000001; // 1 + (10000 << 32)
+        chunk -= 0x3030303030303030;                 // NOLINT(readability-magic-numbers)
+        chunk = (chunk * 10) + (chunk >> 8);         // NOLINT(readability-magic-numbers)
+        return static_cast<uint32>((((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32); // NOLINT(readability-magic-numbers)
+      }
+
+      // parses the digits into value, as long as it doesn't get bigger than maxValue.
+      // returns the first char that isn't a digit and sets hasOverflow if the digits didn't fit
+      template <typename UInt>
+      constexpr const char8* parse_unsigned(const char8* first, const char8* last, UInt& value, UInt maxValue, int32 base, bool& hasOverflow)
+      {
+        const char8* it = first;
+        UInt result     = 0;
+
+        if(base == 10) // NOLINT(readability-magic-numbers)
+        {
+          // leading zeros don't count towards the digits that are known to fit
+          while(it != last && *it == '0')
+          {
+            ++it;
+          }
+
+          // 8 digits at a time, as long as the result can't overflow a 64 bit integer
+          const char8* fast_last = it + (last - it < 16 ? last - it : 16); // NOLINT(readability-magic-numbers)
+          uint64 fast_result     = 0;
+          while(fast_last - it >= 8 && is_8_digits(read_8_chars(it)))
+          {
+            fast_result = fast_result * 100000000 + parse_8_digits(read_8_chars(it)); // NOLINT(readability-magic-numbers)
+            it += 8;
+          }
+          if(fast_result > maxValue)
+          {
+            hasOverflow = true;
+          }
+          result = static_cast<UInt>(fast_result);
+        }
+
+        const UInt max_before_multiply = maxValue / static_cast<UInt>(base);
+        for(; it != last; ++it)
+        {
+          const uint8 digit = digit_value(*it);
+          if(digit >= base)
+          {
+            break;
+          }
+          if(hasOverflow || result > max_before_multiply || static_cast<UInt>(result * static_cast<UInt>(base)) > maxValue - digit)
+          {
+            // keep going, the result points past all the digits
+            hasOverflow = true;
+            continue;
+          }
+          result = static_cast<UInt>(result * static_cast<UInt>(base) + digit);
+        }
+
+        value = result;
+        return it;
+      }
+    } // namespace internal
+
+    /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Oct/2023)
+    // bases other than 10 are supported for all integer types, but decimal is the fast path
+    template <typename T, rsl::enable_if_t<rsl::is_integral_v<T> && !rsl::is_same_v<T, bool>, bool> = true>
+    constexpr to_chars_result to_chars(char8* first, char8* last, T value, int32 base = 10)
+    {
+      using unsigned_type = rsl::conditional_t<sizeof(T) <= sizeof(uint32), uint32, uint64>;
+
+      unsigned_type magnitude = static_cast<unsigned_type>(value);
+      if constexpr(rsl::is_signed_v<T>)
+      {
+        if(value < 0)
+        {
+          if(first == last)
+          {
+            return {last, errc::value_too_large};
+          }
+          *first++  = '-';
+          magnitude = static_cast<unsigned_type>(0 - magnitude);
+        }
+      }
+
+      return internal::unsigned_to_chars(first, last, magnitude, base);
+    }
+    to_chars_result to_chars(char8* first, char8* last, bool value, int32 base = 10) = delete;
+
+    // the value is left untouched if the text isn't a number or the number doesn't fit in T
+    template <typename T, rsl::enable_if_t<rsl::is_integral_v<T> && !rsl::is_same_v<T, bool>, bool> = true>
+    constexpr from_chars_result from_chars(const char8* first, const char8* last, T& value, int32 base = 10)
+    {
+      using unsigned_type = rsl::conditional_t<sizeof(T) <= sizeof(uint32), uint32, uint64>;
+
+      const char8* it        = first;
+      bool is_negative       = false;
+      unsigned_type max_value = static_cast<unsigned_type>(rsl::numeric_limits<T>::max());
+      if constexpr(rsl::is_signed_v<T>)
+      {
+        if(it != last && *it == '-')
+        {
+          is_negative = true;
+          ++max_value; // the magnitude of the smallest value
+          ++it;
+        }
+      }
 
-    RSL_CLASS_ALIAS(chars_format);
+      bool has_overflow      = false;
+      unsigned_type result   = 0;
+      const char8* digit_end = internal::parse_unsigned(it, last, result, max_value, base, has_overflow);
+      if(digit_end == it)
+      {
+        return {first, errc::invalid_argument};
+      }
+      if(has_overflow)
+      {
+        return {digit_end, errc::result_out_of_range};
+      }
 
-    RSL_FUNC_ALIAS(from_chars);
-    RSL_FUNC_ALIAS(to_chars);
+      value = is_negative ? static_cast<T>(0 - result) : static_cast<T>(result);
+      return {digit_end, errc {}};
+    }
 
+    namespace internal
+    {
+      // converts mantissa * 10^exponent to the nearest float without big integer arithmetic.
+      // if the mantissa is truncated, the digits that got cut off are non zero.
+      // returns false if the fast paths can't decide the rounding, in which case out is untouched
+      bool fast_decimal_to_float(uint64 mantissa, int64 exponent, bool isTruncated, bool isNegative, float32& out);
+      bool fast_decimal_to_float(uint64 mantissa, int64 exponent, bool isTruncated, bool isNegative, float64& out);
+    } // namespace internal
   } // namespace v1
 } // namespace rsl
 
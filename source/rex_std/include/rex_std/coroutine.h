@@ -12,6 +12,34 @@
 
 #pragma once
 
-#include "rex_std/enable_std_checking.h"
+//-----------------------------------------------------------------------------
+// https://en.cppreference.com/w/cpp/header/coroutine
+//
+// The compiler looks up the coroutine machinery in namespace std,
+// so rsl can't provide its own and aliases the std types instead.
+// These aliases are always available, the coroutine types of rsl are built on them.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/disable_std_checking.h"
 
 #include <coroutine>
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    template <typename R, typename... Args>
+    using coroutine_traits = std::coroutine_traits<R, Args...>;
+    template <typename Promise = void>
+    using coroutine_handle = std::coroutine_handle<Promise>;
+
+    using noop_coroutine_promise = std::noop_coroutine_promise;
+    using noop_coroutine_handle  = std::noop_coroutine_handle;
+    using std::noop_coroutine;
+
+    using suspend_never  = std::suspend_never;
+    using suspend_always = std::suspend_always;
+  } // namespace v1
+} // namespace rsl
+
+#include "rex_std/enable_std_checking.h"
@@ -17,6 +17,8 @@
 #include "rex_std/ctype.h"
 #include "rex_std/wctype.h"
 #include "rex_std/internal/type_traits/enable_if.h"
+#include "rex_std/internal/type_traits/is_constant_evaluated.h"
+#include "rex_std/internal/type_traits/is_same.h"
 
 namespace rsl
 {
@@ -123,10 +125,26 @@ namespace rsl
     // with strcmp gives the same result as you'd compare the original strings with strcoll
     template <typename Char, typename rsl::v1::enable_if_t<is_character_v<Char>, int> = 0>
     count_t strxfrm(Char* dest, const Char* src, count_t count);
+
+    namespace internal
+    {
+      // scans 16 or 32 bytes at a time, depending on what the cpu supports.
+      // the implementation is chosen the first time it's called.
+      card64 strlen_runtime(const char8* str);
+    } // namespace internal
+
     // returns the lengths of a string
     template <typename Char, typename rsl::v1::enable_if_t<is_character_v<Char>, int> = 0>
     constexpr count_t strlen(const Char* str)
     {
+      if constexpr(rsl::is_same_v<Char, char8>)
+      {
+        if(!rsl::is_constant_evaluated())
+        {
+          return static_cast<count_t>(internal::strlen_runtime(str));
+        }
+      }
+
       count_t len = 0;
       while(*str) // NOLINT
       {
@@ -12,25 +12,10 @@
 
 #pragma once
 
-#include "rex_std/bonus/defines.h"
-#include "rex_std/disable_std_checking.h"
-#include "rex_std/std_alias_defines.h"
-
-#include <execution>
-
-namespace rsl
-{
-  inline namespace v1
-  {
-
-    RSL_TEMPLATED_CLASS_ALIAS(template <typename T>, is_execution_policy, T);
-
-    namespace execution
-    {
-      using namespace std::execution;
-    }
-
-  } // namespace v1
-} // namespace rsl
-
-#include "rex_std/enable_std_checking.h"
+#include "rex_std/internal/execution/copy.h"
+#include "rex_std/internal/execution/execution_policy.h"
+#include "rex_std/internal/execution/fill.h"
+#include "rex_std/internal/execution/for_each.h"
+#include "rex_std/internal/execution/reduce.h"
+#include "rex_std/internal/execution/sort.h"
+#include "rex_std/internal/execution/transform.h"
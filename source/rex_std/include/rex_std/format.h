@@ -45,6 +45,7 @@
   #include "rex_std/bonus/iterator/iter_val.h"
   #include "rex_std/bonus/memory/typed_allocator.h"
   #include "rex_std/bonus/string.h"
+  #include "rex_std/charconv.h"
   #include "rex_std/internal/algorithm/copy.h"
   #include "rex_std/internal/iterator/begin.h"
   #include "rex_std/internal/iterator/end.h"
@@ -1217,12 +1218,8 @@ namespace rsl
       // Converts value in the range [0, 100) to a string.
       constexpr const char* digits2(count_t value)
       {
-        // GCC generates slightly better code when value is pointer-size.
-        return &"0001020304050607080910111213141516171819"
-                "2021222324252627282930313233343536373839"
-                "4041424344454647484950515253545556575859"
-                "6061626364656667686970717273747576777879"
-                "8081828384858687888990919293949596979899"[static_cast<ptrdiff>(value * 2)];
+        // the same table rsl::to_chars uses
+        return &rsl::internal::g_digit_pairs[static_cast<ptrdiff>(value * 2)];
       }
 
       // Sign is a template parameter to workaround a bug in gcc 4.8.
@@ -1451,23 +1448,31 @@ namespace rsl
         FMT_ASSERT(size >= count_digits(value), "invalid digit count");
         out += size;
         Char* end = out;
-        while(value >= 100)
+        if constexpr(num_bits<UInt>() <= 64)
         {
-          // Integer division is slow so do it for a group of two digits instead
-          // of for every digit. The idea comes from the talk by Alexandrescu
-          // "Three Optimization Tips for C++". See speed-test for a comparison.
-          out -= 2;
-          copy2(out, digits2(static_cast<count_t>(value % 100)));
-          value /= 100;
+          // rsl::to_chars has the same 2 digits per division writer
+          return {rsl::internal::write_decimal_backwards(out, value), end};
         }
-        if(value < 10)
+        else
         {
-          *--out = static_cast<Char>('0' + value);
+          while(value >= 100)
+          {
+            // Integer division is slow so do it for a group of two digits instead
+            // of for every digit. The idea comes from the talk by Alexandrescu
+            // "Three Optimization Tips for C++". See speed-test for a comparison.
+            out -= 2;
+            copy2(out, digits2(static_cast<count_t>(value % 100)));
+            value /= 100;
+          }
+          if(value < 10)
+          {
+            *--out = static_cast<Char>('0' + value);
+            return {out, end};
+          }
+          out -= 2;
+          copy2(out, digits2(static_cast<count_t>(value)));
           return {out, end};
         }
-        out -= 2;
-        copy2(out, digits2(static_cast<count_t>(value)));
-        return {out, end};
       }
 
       template <typename Char, typename UInt, typename Iterator, FMT_ENABLE_IF(!rsl::is_pointer<remove_cvref_t<Iterator>>::value)>
@@ -257,7 +257,8 @@ namespace rsl
           , m_size(0)
 #endif
       {
-        swap(other);
+        // the allocator of other got moved in, so the nodes can be taken over as is
+        swap_nodes(other);
       }
       forward_list(forward_list&& other, const allocator_type& alloc)
           : m_cp_pre_head_node_and_allocator(alloc)
@@ -265,7 +266,19 @@ namespace rsl
           , m_size(0)
 #endif
       {
-        swap(other);
+        if(get_allocator() == other.get_allocator())
+        {
+          swap_nodes(other);
+        }
+        else
+        {
+          // other's allocator frees its nodes, so they're rebuilt in ours, keeping the order
+          iterator last = before_begin();
+          for(value_type& value : other)
+          {
+            last = emplace_after_impl(last, rsl::move(value));
+          }
+        }
       }
       forward_list(rsl::initializer_list<value_type> ilist, const allocator_type& alloc = allocator_type())
           : m_cp_pre_head_node_and_allocator(alloc)
@@ -543,15 +556,8 @@ namespace rsl
       {
         if(get_allocator() == other.get_allocator())
         {
-          internal::forward_list_node_base*& my_head    = pre_head_node().next;
-          internal::forward_list_node_base*& other_head = other.pre_head_node().next;
-
-          rsl::swap(my_head, other_head);
+          swap_nodes(other);
           rsl::swap(get_allocator(), other.get_allocator());
-
-#ifdef RSL_ENABLE_SIZE_IN_LISTS
-          rsl::swap(m_size, other.m_size);
-#endif
         }
         else
         {
@@ -753,6 +759,19 @@ namespace rsl
         return m_cp_pre_head_node_and_allocator.second();
       }
 
+      // exchanges the nodes of both lists, leaving the allocators untouched.
+      void swap_nodes(this_type& other)
+      {
+        internal::forward_list_node_base*& my_head    = pre_head_node().next;
+        internal::forward_list_node_base*& other_head = other.pre_head_node().next;
+
+        rsl::swap(my_head, other_head);
+
+#ifdef RSL_ENABLE_SIZE_IN_LISTS
+        rsl::swap(m_size, other.m_size);
+#endif
+      }
+
     private:
       // losing const here
       const internal::forward_list_node_base& pre_head_node() const
@@ -14,6 +14,10 @@
 
 #include "rex_std/bonus/defines.h"
 #include "rex_std/disable_std_checking.h"
+#include "rex_std/internal/future/future.h"
+#include "rex_std/internal/future/promise.h"
+#include "rex_std/internal/future/when_all.h"
+#include "rex_std/internal/future/when_any.h"
 #include "rex_std/internal/memory/uses_allocator.h"
 #include "rex_std/std_alias_defines.h"
 
@@ -24,16 +28,9 @@ namespace rsl
   inline namespace v1
   {
 
-    RSL_TEMPLATED_CLASS_ALIAS(template <typename R>, promise, R);
-
     RSL_TEMPLATED_CLASS_ALIAS(template <typename R>, packaged_task, R);
 
-    RSL_TEMPLATED_CLASS_ALIAS(template <typename T>, future, T);
-
-    RSL_TEMPLATED_CLASS_ALIAS(template <typename T>, shared_future, T);
-
     RSL_CLASS_ALIAS(launch);
-    RSL_CLASS_ALIAS(future_status);
     RSL_CLASS_ALIAS(future_errc);
 
     RSL_FUNC_ALIAS(async);
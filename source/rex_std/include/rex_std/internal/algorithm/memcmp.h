@@ -13,27 +13,46 @@
 #pragma once
 
 #include "rex_std/bonus/types.h"
+#include "rex_std/internal/type_traits/is_constant_evaluated.h"
 
 namespace rsl
 {
   inline namespace v1
   {
-
-    constexpr int32 memcmp(const void* first1, const void* first2, count_t count)
+    namespace internal
     {
-      const char* first_1byte = static_cast<const char*>(first1);
-      const char* first2_byte = static_cast<const char*>(first2);
-      while(count > 0)
+      // the byte at a time comparison, this is the only version that can run at compile time
+      constexpr int32 memcmp_bytewise(const void* first1, const void* first2, count_t count)
       {
-        if(*first_1byte != *first2_byte)
+        const uint8* first1_byte = static_cast<const uint8*>(first1);
+        const uint8* first2_byte = static_cast<const uint8*>(first2);
+        while(count > 0)
         {
-          return *first_1byte - *first2_byte;
+          if(*first1_byte != *first2_byte)
+          {
+            return *first1_byte - *first2_byte;
+          }
+          ++first1_byte, ++first2_byte;
+          --count;
         }
-        ++first_1byte, ++first2_byte;
-        --count;
+
+        return 0;
+      }
+
+      // compares using words or SIMD registers, depending on what the cpu supports.
+      // the implementation is chosen the first time it's called.
+      int32 memcmp_runtime(const void* first1, const void* first2, card64 count);
+    } // namespace internal
+
+    // bytes are compared as unsigned chars, as required by the standard
+    constexpr int32 memcmp(const void* first1, const void* first2, count_t count)
+    {
+      if(rsl::is_constant_evaluated())
+      {
+        return internal::memcmp_bytewise(first1, first2, count);
       }
 
-      return 0;
+      return internal::memcmp_runtime(first1, first2, count);
     }
 
   } // namespace v1
@@ -12,22 +12,24 @@
 
 #pragma once
 
-#include "rex_std/bonus/algorithm/quick_sort.h"
+#include "rex_std/bonus/algorithm/pdq_sort.h"
 
 namespace rsl
 {
   inline namespace v1
   {
+    // the standard doesn't specify the algorithm, we use pattern-defeating quicksort.
+    // sorted, reversed and partially sorted input is sorted in linear time
     template <typename RandomAccessIterator>
     inline void sort(RandomAccessIterator first, RandomAccessIterator last)
     {
-      rsl::quick_sort<RandomAccessIterator>(first, last);
+      rsl::pdq_sort(first, last);
     }
 
     template <typename RandomAccessIterator, typename Compare>
     inline void sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
     {
-      rsl::quick_sort<RandomAccessIterator, Compare>(first, last, compare);
+      rsl::pdq_sort(first, last, compare);
     }
   } // namespace v1
 } // namespace rsl
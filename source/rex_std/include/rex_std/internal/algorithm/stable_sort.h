@@ -12,19 +12,526 @@
 
 #pragma once
 
-#include "rex_std/disable_std_checking.h"
-#include "rex_std/std_alias_defines.h"
-
-#include <algorithm>
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/algorithm/iter_swap.h"
+#include "rex_std/internal/algorithm/lower_bound.h"
+#include "rex_std/internal/algorithm/min.h"
+#include "rex_std/internal/algorithm/move.h"
+#include "rex_std/internal/algorithm/move_backward.h"
+#include "rex_std/internal/algorithm/reverse.h"
+#include "rex_std/internal/algorithm/rotate.h"
+#include "rex_std/internal/algorithm/upper_bound.h"
+#include "rex_std/internal/functional/less.h"
+#include "rex_std/internal/iterator/iterator_traits.h"
+#include "rex_std/internal/memory/allocator.h"
+#include "rex_std/internal/memory/destroy.h"
+#include "rex_std/internal/memory/uninitialized_move.h"
+#include "rex_std/internal/utility/move.h"
 
 namespace rsl
 {
   inline namespace v1
   {
+    namespace internal
+    {
+      // ranges smaller than this are sorted with a binary insertion sort, without looking for runs
+      inline constexpr card32 g_stable_sort_min_merge = 64;
+      // the number of times in a row an element of the same run needs to be picked before switching to galloping
+      inline constexpr card32 g_stable_sort_min_gallop = 7;
+      // the run stack only holds runs of increasing power, which is at most 1 per bit of the size
+      inline constexpr card32 g_stable_sort_max_runs = 66;
+
+      // returns the minimum length of a run, so that the number of runs is a power of 2 or slightly below.
+      // that's the number of runs that merges best
+      template <typename Size>
+      Size stable_sort_min_run(Size size)
+      {
+        Size remainder = 0;
+        while(size >= static_cast<Size>(g_stable_sort_min_merge))
+        {
+          remainder |= size & 1;
+          size >>= 1;
+        }
+        return size + remainder;
+      }
+
+      // sorts [first, last), [first, sortedEnd) is expected to be sorted already
+      template <typename RandomAccessIterator, typename Compare>
+      void stable_sort_binary_insertion(RandomAccessIterator first, RandomAccessIterator sortedEnd, RandomAccessIterator last, Compare compare)
+      {
+        using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+        for(RandomAccessIterator current = sortedEnd; current != last; ++current)
+        {
+          // upper bound so equal elements stay in the order they came in
+          RandomAccessIterator pos = rsl::upper_bound(first, current, *current, compare);
+          if(pos != current)
+          {
+            value_type tmp(rsl::move(*current));
+            rsl::move_backward(pos, current, current + 1);
+            *pos = rsl::move(tmp);
+          }
+        }
+      }
+
+      // returns the end of the run starting at first.
+      // a strictly descending run gets reversed, it has to be strictly descending
+      // as reversing equal elements would break the stability
+      template <typename RandomAccessIterator, typename Compare>
+      RandomAccessIterator stable_sort_find_run(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+      {
+        RandomAccessIterator run_end = first + 1;
+        if(run_end == last)
+        {
+          return last;
+        }
+
+        if(compare(*run_end, *first))
+        {
+          ++run_end;
+          while(run_end != last && compare(*run_end, *(run_end - 1)))
+          {
+            ++run_end;
+          }
+          rsl::reverse(first, run_end);
+        }
+        else
+        {
+          ++run_end;
+          while(run_end != last && !compare(*run_end, *(run_end - 1)))
+          {
+            ++run_end;
+          }
+        }
+
+        return run_end;
+      }
+
+      // galloping searches, they check positions 1, 3, 7, 15, .. away from the start of the range first
+      // and perform a binary search in the last interval afterwards.
+      // this finds the result in O(log(d)), where d is the distance of the result to the start of the search,
+      // which is a lot faster than a binary search over the whole range if the runs are clustered.
+
+      // returns the first element in [first, last) that's greater than value, searching from first
+      template <typename Iterator, typename T, typename Compare>
+      Iterator stable_sort_gallop_upper(Iterator first, Iterator last, const T& value, Compare compare)
+      {
+        using difference_type = typename rsl::iterator_traits<Iterator>::difference_type;
+
+        const difference_type size = last - first;
+        difference_type prev_offset = 0;
+        difference_type offset      = 1;
+        while(offset <= size && !compare(value, *(first + (offset - 1))))
+        {
+          prev_offset = offset;
+          offset      = offset * 2 + 1;
+        }
+
+        return rsl::upper_bound(first + prev_offset, offset > size ? last : first + (offset - 1), value, compare);
+      }
+      // returns the first element in [first, last) that's not less than value, searching from first
+      template <typename Iterator, typename T, typename Compare>
+      Iterator stable_sort_gallop_lower(Iterator first, Iterator last, const T& value, Compare compare)
+      {
+        using difference_type = typename rsl::iterator_traits<Iterator>::difference_type;
+
+        const difference_type size = last - first;
+        difference_type prev_offset = 0;
+        difference_type offset      = 1;
+        while(offset <= size && compare(*(first + (offset - 1)), value))
+        {
+          prev_offset = offset;
+          offset      = offset * 2 + 1;
+        }
+
+        return rsl::lower_bound(first + prev_offset, offset > size ? last : first + (offset - 1), value, compare);
+      }
+      // returns the first element in [first, last) that's greater than value, searching from last
+      template <typename Iterator, typename T, typename Compare>
+      Iterator stable_sort_gallop_upper_from_back(Iterator first, Iterator last, const T& value, Compare compare)
+      {
+        using difference_type = typename rsl::iterator_traits<Iterator>::difference_type;
+
+        const difference_type size = last - first;
+        difference_type prev_offset = 0;
+        difference_type offset      = 1;
+        while(offset <= size && compare(value, *(last - offset)))
+        {
+          prev_offset = offset;
+          offset      = offset * 2 + 1;
+        }
+
+        return rsl::upper_bound(offset > size ? first : last - (offset - 1), last - prev_offset, value, compare);
+      }
+      // returns the first element in [first, last) that's not less than value, searching from last
+      template <typename Iterator, typename T, typename Compare>
+      Iterator stable_sort_gallop_lower_from_back(Iterator first, Iterator last, const T& value, Compare compare)
+      {
+        using difference_type = typename rsl::iterator_traits<Iterator>::difference_type;
+
+        const difference_type size = last - first;
+        difference_type prev_offset = 0;
+        difference_type offset      = 1;
+        while(offset <= size && !compare(*(last - offset), value))
+        {
+          prev_offset = offset;
+          offset      = offset * 2 + 1;
+        }
+
+        return rsl::lower_bound(offset > size ? first : last - (offset - 1), last - prev_offset, value, compare);
+      }
+
+      // merges [first, mid) and [mid, last) by moving [first, mid) into the buffer and merging from the front.
+      // the buffer needs to be big enough to hold [first, mid)
+      template <typename RandomAccessIterator, typename T, typename Compare>
+      void stable_sort_merge_lo(RandomAccessIterator first, RandomAccessIterator mid, RandomAccessIterator last, T* buffer, Compare compare)
+      {
+        T* left                    = buffer;
+        T* left_end                = rsl::uninitialized_move(first, mid, buffer);
+        RandomAccessIterator right = mid;
+        RandomAccessIterator dest  = first;
+        card32 min_gallop          = g_stable_sort_min_gallop;
+
+        while(left != left_end && right != last)
+        {
+          // merge 1 element at a time, until 1 run keeps winning
+          card32 left_wins  = 0;
+          card32 right_wins = 0;
+          while(left != left_end && right != last && left_wins < min_gallop && right_wins < min_gallop)
+          {
+            if(compare(*right, *left))
+            {
+              *dest++ = rsl::move(*right++);
+              ++right_wins;
+              left_wins = 0;
+            }
+            else
+            {
+              *dest++ = rsl::move(*left++);
+              ++left_wins;
+              right_wins = 0;
+            }
+          }
+
+          // 1 run keeps winning, so its elements are likely clustered.
+          // look for the whole cluster at once and move it in bulk
+          while(left != left_end && right != last)
+          {
+            T* left_stop = stable_sort_gallop_upper(left, left_end, *right, compare);
+            left_wins    = static_cast<card32>(left_stop - left);
+            dest         = rsl::move(left, left_stop, dest);
+            left         = left_stop;
+            if(left == left_end)
+            {
+              break;
+            }
+
+            RandomAccessIterator right_stop = stable_sort_gallop_lower(right, last, *left, compare);
+            right_wins                      = static_cast<card32>(right_stop - right);
+            dest                            = rsl::move(right, right_stop, dest);
+            right                           = right_stop;
+
+            // galloping pays off, make it easier to start galloping again
+            if(min_gallop > 1)
+            {
+              --min_gallop;
+            }
+
+            if(left_wins < g_stable_sort_min_gallop && right_wins < g_stable_sort_min_gallop)
+            {
+              // galloping doesn't pay off anymore, make it harder to start galloping again
+              min_gallop += 2;
+              break;
+            }
+          }
+        }
+
+        // what's left of the right run is already in place
+        rsl::move(left, left_end, dest);
+        rsl::destroy(buffer, left_end);
+      }
+
+      // merges [first, mid) and [mid, last) by moving [mid, last) into the buffer and merging from the back.
+      // the buffer needs to be big enough to hold [mid, last)
+      template <typename RandomAccessIterator, typename T, typename Compare>
+      void stable_sort_merge_hi(RandomAccessIterator first, RandomAccessIterator mid, RandomAccessIterator last, T* buffer, Compare compare)
+      {
+        RandomAccessIterator left_end = mid;
+        T* right_end                  = rsl::uninitialized_move(mid, last, buffer);
+        T* const right_buffer_end     = right_end;
+        RandomAccessIterator dest     = last;
+        card32 min_gallop             = g_stable_sort_min_gallop;
+
+        while(left_end != first && right_end != buffer)
+        {
+          // merge 1 element at a time, until 1 run keeps winning
+          card32 left_wins  = 0;
+          card32 right_wins = 0;
+          while(left_end != first && right_end != buffer && left_wins < min_gallop && right_wins < min_gallop)
+          {
+            if(compare(*(right_end - 1), *(left_end - 1)))
+            {
+              *--dest = rsl::move(*--left_end);
+              ++left_wins;
+              right_wins = 0;
+            }
+            else
+            {
+              *--dest = rsl::move(*--right_end);
+              ++right_wins;
+              left_wins = 0;
+            }
+          }
+
+          // 1 run keeps winning, so its elements are likely clustered.
+          // look for the whole cluster at once and move it in bulk
+          while(left_end != first && right_end != buffer)
+          {
+            RandomAccessIterator left_stop = stable_sort_gallop_upper_from_back(first, left_end, *(right_end - 1), compare);
+            left_wins                      = static_cast<card32>(left_end - left_stop);
+            dest                           = rsl::move_backward(left_stop, left_end, dest);
+            left_end                       = left_stop;
+            if(left_end == first)
+            {
+              break;
+            }
+
+            T* right_stop = stable_sort_gallop_lower_from_back(buffer, right_end, *(left_end - 1), compare);
+            right_wins    = static_cast<card32>(right_end - right_stop);
+            dest          = rsl::move_backward(right_stop, right_end, dest);
+            right_end     = right_stop;
+
+            // galloping pays off, make it easier to start galloping again
+            if(min_gallop > 1)
+            {
+              --min_gallop;
+            }
 
-    RSL_FUNC_ALIAS(stable_sort);
+            if(left_wins < g_stable_sort_min_gallop && right_wins < g_stable_sort_min_gallop)
+            {
+              // galloping doesn't pay off anymore, make it harder to start galloping again
+              min_gallop += 2;
+              break;
+            }
+          }
+        }
 
+        // what's left of the left run is already in place
+        rsl::move_backward(buffer, right_end, dest);
+        rsl::destroy(buffer, right_buffer_end);
+      }
+
+      // merges the sorted ranges [first, mid) and [mid, last).
+      // if the smallest of both doesn't fit in the buffer, the ranges are split up with rotations until they do.
+      // without a buffer, this is a merge in place in O(n log(n)) time.
+      template <typename RandomAccessIterator, typename T, typename Compare>
+      void stable_sort_merge(RandomAccessIterator first, RandomAccessIterator mid, RandomAccessIterator last, T* buffer, typename rsl::iterator_traits<RandomAccessIterator>::difference_type bufferCount, Compare compare) // NOLINT(misc-no-recursion)
+      {
+        using difference_type = typename rsl::iterator_traits<RandomAccessIterator>::difference_type;
+
+        if(first == mid || mid == last)
+        {
+          return;
+        }
+
+        // elements of the left run that are smaller than or equal to the first of the right run are already in place
+        first = stable_sort_gallop_upper(first, mid, *mid, compare);
+        if(first == mid)
+        {
+          return;
+        }
+
+        // elements of the right run that are greater than or equal to the last of the left run are already in place
+        last = stable_sort_gallop_lower_from_back(mid, last, *(mid - 1), compare);
+
+        const difference_type left_count  = mid - first;
+        const difference_type right_count = last - mid;
+
+        if(left_count <= right_count && left_count <= bufferCount)
+        {
+          stable_sort_merge_lo(first, mid, last, buffer, compare);
+        }
+        else if(right_count <= bufferCount)
+        {
+          stable_sort_merge_hi(first, mid, last, buffer, compare);
+        }
+        else if(left_count + right_count == 2)
+        {
+          // the first element of the left run is greater than the first of the right, otherwise it'd be trimmed off
+          rsl::iter_swap(first, mid);
+        }
+        else
+        {
+          // split the bigger run in half and find where its middle element goes in the other run.
+          // rotating the part in between puts both halves next to their counterpart, which are merged separately
+          RandomAccessIterator left_cut;
+          RandomAccessIterator right_cut;
+          if(left_count > right_count)
+          {
+            left_cut  = first + left_count / 2;
+            right_cut = rsl::lower_bound(mid, last, *left_cut, compare);
+          }
+          else
+          {
+            right_cut = mid + right_count / 2;
+            left_cut  = rsl::upper_bound(first, mid, *right_cut, compare);
+          }
+
+          RandomAccessIterator new_mid = rsl::rotate(left_cut, mid, right_cut);
+          stable_sort_merge(first, left_cut, new_mid, buffer, bufferCount, compare);
+          stable_sort_merge(new_mid, right_cut, last, buffer, bufferCount, compare);
+        }
+      }
+
+      // the power of the node between 2 adjacent runs in the merge tree of powersort.
+      // this is the first bit where the midpoints of both runs differ, relative to the size of the whole range.
+      template <typename Size>
+      card32 stable_sort_node_power(Size size, Size leftBegin, Size rightBegin, Size rightEnd)
+      {
+        // use twice the midpoints, so the math stays in integers
+        card64 left        = static_cast<card64>(leftBegin) + static_cast<card64>(rightBegin);
+        card64 right       = static_cast<card64>(rightBegin) + static_cast<card64>(rightEnd);
+        const card64 total = static_cast<card64>(size) * 2;
+
+        card32 power = 1;
+        while(true)
+        {
+          left *= 2;
+          right *= 2;
+          if(left >= total && right >= total)
+          {
+            left -= total;
+            right -= total;
+          }
+          else if(left >= total || right >= total)
+          {
+            return power;
+          }
+          ++power;
+        }
+      }
+
+      template <typename RandomAccessIterator, typename T, typename Compare>
+      void stable_sort_impl(RandomAccessIterator first, RandomAccessIterator last, Compare compare, T* buffer, typename rsl::iterator_traits<RandomAccessIterator>::difference_type bufferCount)
+      {
+        using difference_type = typename rsl::iterator_traits<RandomAccessIterator>::difference_type;
+
+        const difference_type size = last - first;
+        if(size < 2)
+        {
+          return;
+        }
+
+        const difference_type min_run = stable_sort_min_run(size);
+
+        // finds the run starting at begin and extends it to the minimum run length if it's shorter
+        auto next_run = [&](difference_type begin)
+        {
+          const RandomAccessIterator run_begin = first + begin;
+          const RandomAccessIterator run_end   = stable_sort_find_run(run_begin, last, compare);
+          difference_type end                  = run_end - first;
+          if(end - begin < min_run)
+          {
+            end = (rsl::min)(begin + min_run, size);
+            stable_sort_binary_insertion(run_begin, run_end, first + end, compare);
+          }
+          return end;
+        };
+
+        // powersort, runs are merged as soon as the merge tree says they should be.
+        // unlike timsort's merge rules this results in merges of close to optimal balance
+        struct pending_run
+        {
+          difference_type begin;
+          card32 power;
+        };
+        pending_run run_stack[g_stable_sort_max_runs];
+        card32 num_pending_runs = 0;
+
+        difference_type left_begin = 0;
+        difference_type left_end   = next_run(0);
+        while(left_end < size)
+        {
+          const difference_type right_end = next_run(left_end);
+          const card32 power              = stable_sort_node_power(size, left_begin, left_end, right_end);
+
+          while(num_pending_runs > 0 && run_stack[num_pending_runs - 1].power > power)
+          {
+            --num_pending_runs;
+            const difference_type begin = run_stack[num_pending_runs].begin;
+            stable_sort_merge(first + begin, first + left_begin, first + left_end, buffer, bufferCount, compare);
+            left_begin = begin;
+          }
+
+          run_stack[num_pending_runs++] = pending_run {left_begin, power};
+          left_begin                    = left_end;
+          left_end                      = right_end;
+        }
+
+        while(num_pending_runs > 0)
+        {
+          --num_pending_runs;
+          const difference_type begin = run_stack[num_pending_runs].begin;
+          stable_sort_merge(first + begin, first + left_begin, last, buffer, bufferCount, compare);
+          left_begin = begin;
+        }
+      }
+    } // namespace internal
+
+    /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Oct/2023)
+    // the standard doesn't have an overload taking a scratch buffer.
+    // buffer points to uninitialized storage for bufferCount elements, which is used to merge runs.
+    // the buffer doesn't need to be bigger than half the range.
+    // with a smaller buffer, or no buffer at all, runs are merged in place, which never allocates
+    template <typename RandomAccessIterator, typename Compare>
+    void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare, typename rsl::iterator_traits<RandomAccessIterator>::value_type* buffer,
+                     typename rsl::iterator_traits<RandomAccessIterator>::difference_type bufferCount)
+    {
+      internal::stable_sort_impl(first, last, compare, buffer, buffer != nullptr ? bufferCount : 0);
+    }
+
+    /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Oct/2023)
+    // the standard doesn't have an overload taking an allocator.
+    // the scratch buffer is allocated with the given allocator
+    template <typename RandomAccessIterator, typename Compare, typename Allocator>
+    void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare, Allocator& alloc)
+    {
+      using value_type      = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+      using difference_type = typename rsl::iterator_traits<RandomAccessIterator>::difference_type;
+
+      const difference_type size = last - first;
+
+      // small ranges are a single run, they never merge
+      if(size < static_cast<difference_type>(internal::g_stable_sort_min_merge))
+      {
+        internal::stable_sort_impl<RandomAccessIterator, value_type>(first, last, compare, nullptr, 0);
+        return;
+      }
+
+      // a merge never needs to buffer more than half the range
+      const difference_type buffer_count = size / 2;
+      const card64 buffer_size           = static_cast<card64>(buffer_count) * sizeof(value_type);
+      value_type* buffer                 = static_cast<value_type*>(alloc.allocate(buffer_size));
+
+      // if the allocation failed we can still sort in place
+      internal::stable_sort_impl(first, last, compare, buffer, buffer != nullptr ? buffer_count : 0);
+
+      alloc.deallocate(buffer, buffer_size);
+    }
+
+    template <typename RandomAccessIterator, typename Compare>
+    void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+    {
+      rsl::allocator alloc;
+      rsl::stable_sort(first, last, compare, alloc);
+    }
+
+    template <typename RandomAccessIterator>
+    void stable_sort(RandomAccessIterator first, RandomAccessIterator last)
+    {
+      using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+      rsl::stable_sort(first, last, rsl::less<value_type>());
+    }
   } // namespace v1
 } // namespace rsl
-
-#include "rex_std/enable_std_checking.h"
\ No newline at end of file
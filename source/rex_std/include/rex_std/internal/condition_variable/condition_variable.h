@@ -23,7 +23,7 @@ namespace rsl
   {
     namespace internal
     {
-#if defined(RSL_PLATFORM_X64)
+#if defined(RSL_PLATFORM_X64) || defined(RSL_PLATFORM_ARM64)
       inline constexpr card32 g_condition_variable_size      = 72;
       inline constexpr card32 g_condition_variable_alignment = 8;
 #endif
@@ -0,0 +1,144 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: coroutine_frame_allocator.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Allocation of coroutine frames
+//
+// The promise types of rsl derive from coroutine_promise_allocation, which decides
+// where the frame of a coroutine lives.
+// A coroutine taking (rsl::allocator_arg, alloc, ...) as its first parameters,
+// or right after the object for a member function, gets its frame from alloc.
+// This is how a frame is put in an arena, eg. a pmr::monotonic_buffer_resource.
+// All other frames come from a per thread cache of recycled frames,
+// so a steady stream of coroutines doesn't hit the global heap for every frame.
+//
+// The function freeing the frame, and the allocator if one was given,
+// are stored right after the frame, as operator delete only gets the frame size.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/assert/assert_fwd.h"
+#include "rex_std/internal/memory/allocator_arg_t.h"
+#include "rex_std/internal/memory/construct_at.h"
+#include "rex_std/internal/utility/move.h"
+
+#include <cstddef>
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // the alignment operator new has to provide for a coroutine frame
+      inline constexpr card64 g_coroutine_frame_alignment = 16;
+
+      // allocate from and return to the frame cache of the calling thread.
+      // a frame can be freed on another thread than the one allocating it, it moves to that thread's cache
+      void* allocate_coroutine_frame(card64 size);
+      void deallocate_coroutine_frame(void* frame, card64 size);
+
+      class coroutine_promise_allocation
+      {
+      public:
+        // the compiler calls these with std::size_t, which isn't always the same type as rsl::size_t
+        static void* operator new(std::size_t size)
+        {
+          void* frame = allocate_coroutine_frame(cached_frame_size(size));
+          store_deallocate_func(frame, size, &coroutine_promise_allocation::deallocate_cached);
+          return frame;
+        }
+        template <typename Alloc, typename... Args>
+        static void* operator new(std::size_t size, allocator_arg_t /*unused*/, const Alloc& alloc, const Args&... /*unused*/)
+        {
+          return allocate_with(size, alloc);
+        }
+        // member function coroutines get the object as their first argument
+        template <typename This, typename Alloc, typename... Args>
+        static void* operator new(std::size_t size, const This& /*unused*/, allocator_arg_t /*unused*/, const Alloc& alloc, const Args&... /*unused*/)
+        {
+          return allocate_with(size, alloc);
+        }
+
+        static void operator delete(void* frame, std::size_t size)
+        {
+          deallocate_func func = *static_cast<deallocate_func*>(tail(frame, size));
+          func(frame, size);
+        }
+
+      private:
+        using deallocate_func = void (*)(void*, card64);
+
+        static constexpr card64 align_up(card64 value, card64 alignment)
+        {
+          return (value + alignment - 1) & ~(alignment - 1);
+        }
+        static constexpr card64 tail_offset(card64 size)
+        {
+          return align_up(size, alignof(deallocate_func));
+        }
+        template <typename Alloc>
+        static constexpr card64 allocator_offset(card64 size)
+        {
+          return align_up(tail_offset(size) + sizeof(deallocate_func), alignof(Alloc));
+        }
+        template <typename Alloc>
+        static constexpr card64 allocated_frame_size(card64 size)
+        {
+          return allocator_offset<Alloc>(size) + sizeof(Alloc);
+        }
+        static constexpr card64 cached_frame_size(card64 size)
+        {
+          return tail_offset(size) + sizeof(deallocate_func);
+        }
+
+        static void* tail(void* frame, card64 size)
+        {
+          return static_cast<char8*>(frame) + tail_offset(size);
+        }
+        static void store_deallocate_func(void* frame, card64 size, deallocate_func func)
+        {
+          rsl::construct_at(static_cast<deallocate_func*>(tail(frame, size)), func);
+        }
+
+        template <typename Alloc>
+        static void* allocate_with(card64 size, const Alloc& alloc)
+        {
+          Alloc frame_alloc(alloc);
+          void* frame = frame_alloc.allocate(allocated_frame_size<Alloc>(size));
+          RSL_ASSERT_X(reinterpret_cast<uintptr>(frame) % g_coroutine_frame_alignment == 0, "coroutine frame allocator returned misaligned memory"); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+          store_deallocate_func(frame, size, &coroutine_promise_allocation::deallocate_with<Alloc>);
+          rsl::construct_at(reinterpret_cast<Alloc*>(static_cast<char8*>(frame) + allocator_offset<Alloc>(size)), rsl::move(frame_alloc)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          return frame;
+        }
+
+        template <typename Alloc>
+        static void deallocate_with(void* frame, card64 size)
+        {
+          // the allocator lives inside the memory it's about to free
+          Alloc* stored = reinterpret_cast<Alloc*>(static_cast<char8*>(frame) + allocator_offset<Alloc>(size)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          Alloc alloc(rsl::move(*stored));
+          stored->~Alloc();
+          alloc.deallocate(frame, allocated_frame_size<Alloc>(size));
+        }
+
+        static void deallocate_cached(void* frame, card64 size)
+        {
+          deallocate_coroutine_frame(frame, cached_frame_size(size));
+        }
+      };
+    } // namespace internal
+  } // namespace v1
+} // namespace rsl
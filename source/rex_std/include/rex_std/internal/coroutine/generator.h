@@ -0,0 +1,243 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: generator.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// https://en.cppreference.com/w/cpp/coroutine/generator
+//
+// A lazy range of values produced by a coroutine with co_yield.
+// The coroutine doesn't start until begin is called and runs until
+// the next co_yield every time the iterator is incremented.
+// Yielded values aren't copied, the iterator points into the suspended frame.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/coroutine.h"
+#include "rex_std/internal/assert/assert_fwd.h"
+#include "rex_std/internal/coroutine/coroutine_frame_allocator.h"
+#include "rex_std/internal/exception/teminate.h"
+#include "rex_std/internal/iterator/iterator_tags.h"
+#include "rex_std/internal/memory/addressof.h"
+#include "rex_std/internal/type_traits/add_pointer.h"
+#include "rex_std/internal/type_traits/conditional.h"
+#include "rex_std/internal/type_traits/enable_if.h"
+#include "rex_std/internal/type_traits/is_reference.h"
+#include "rex_std/internal/type_traits/remove_cvref.h"
+#include "rex_std/internal/utility/exchange.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Oct/2023)
+    // the allocator isn't a template argument, a frame gets its allocator from (allocator_arg, alloc) coroutine parameters.
+    // yielding a nested range with elements_of isn't supported
+    template <typename T>
+    class generator
+    {
+    public:
+      using value_type = rsl::remove_cvref_t<T>;
+      using reference  = rsl::conditional_t<rsl::is_reference_v<T>, T, T&&>;
+
+      class promise_type : public internal::coroutine_promise_allocation
+      {
+      public:
+        promise_type()
+            : m_value(nullptr)
+        {
+        }
+
+        generator get_return_object()
+        {
+          return generator(handle_type::from_promise(*this));
+        }
+
+        suspend_always initial_suspend() const noexcept
+        {
+          return {};
+        }
+        suspend_always final_suspend() const noexcept
+        {
+          return {};
+        }
+
+        suspend_always yield_value(reference value) noexcept
+        {
+          m_value = rsl::addressof(value);
+          return {};
+        }
+        // a generator of rvalues yielding an lvalue yields a copy of it.
+        // the copy lives in the awaiter, which stays alive in the frame while the generator is suspended
+        template <typename U = T, rsl::enable_if_t<!rsl::is_reference_v<U>, bool> = true>
+        auto yield_value(const value_type& value)
+        {
+          class copy_awaiter
+          {
+          public:
+            copy_awaiter(const value_type& value, promise_type* promise)
+                : m_copy(value)
+                , m_promise(promise)
+            {
+            }
+
+            bool await_ready() const noexcept
+            {
+              return false;
+            }
+            void await_suspend(coroutine_handle<> /*unused*/) noexcept
+            {
+              m_promise->m_value = rsl::addressof(m_copy);
+            }
+            void await_resume() const noexcept {}
+
+          private:
+            value_type m_copy;
+            promise_type* m_promise;
+          };
+
+          return copy_awaiter(value, this);
+        }
+
+        void return_void() const noexcept {}
+
+        // rsl doesn't use exceptions, a generator that throws terminates the program
+        void unhandled_exception() const
+        {
+          rsl::terminate();
+        }
+
+        // a generator produces values, it can't wait on anything
+        template <typename U>
+        void await_transform(U&&) = delete;
+
+        reference value() const
+        {
+          return static_cast<reference>(*m_value);
+        }
+
+      private:
+        rsl::add_pointer_t<reference> m_value;
+      };
+
+      using handle_type = coroutine_handle<promise_type>;
+
+      class iterator
+      {
+      public:
+        using iterator_category = rsl::input_iterator_tag;
+        using value_type        = typename generator::value_type;
+        using difference_type   = ptrdiff;
+        using reference         = typename generator::reference;
+
+        iterator()
+            : m_handle(nullptr)
+        {
+        }
+
+        reference operator*() const
+        {
+          return m_handle.promise().value();
+        }
+
+        iterator& operator++()
+        {
+          m_handle.resume();
+          return *this;
+        }
+        void operator++(int)
+        {
+          ++*this;
+        }
+
+        // an iterator is at the end once its generator ran to completion
+        friend bool operator==(const iterator& lhs, const iterator& rhs)
+        {
+          return lhs.at_end() == rhs.at_end();
+        }
+        friend bool operator!=(const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+        friend class generator;
+
+        explicit iterator(handle_type handle)
+            : m_handle(handle)
+        {
+        }
+
+        bool at_end() const
+        {
+          return !m_handle || m_handle.done();
+        }
+
+      private:
+        handle_type m_handle;
+      };
+
+      generator(const generator&) = delete;
+      generator(generator&& other)
+          : m_handle(rsl::exchange(other.m_handle, nullptr))
+          , m_started(rsl::exchange(other.m_started, false))
+      {
+      }
+      ~generator()
+      {
+        if(m_handle)
+        {
+          m_handle.destroy();
+        }
+      }
+
+      generator& operator=(const generator&) = delete;
+      generator& operator=(generator&& other)
+      {
+        if(this != &other)
+        {
+          if(m_handle)
+          {
+            m_handle.destroy();
+          }
+          m_handle  = rsl::exchange(other.m_handle, nullptr);
+          m_started = rsl::exchange(other.m_started, false);
+        }
+        return *this;
+      }
+
+      // runs the coroutine up to its first co_yield, can only be called once
+      iterator begin()
+      {
+        RSL_ASSERT_X(m_handle && !m_started, "begin can only be called once on a generator");
+        m_started = true;
+        m_handle.resume();
+        return iterator(m_handle);
+      }
+      iterator end() const
+      {
+        return iterator();
+      }
+
+    private:
+      explicit generator(handle_type handle)
+          : m_handle(handle)
+          , m_started(false)
+      {
+      }
+
+    private:
+      handle_type m_handle;
+      bool m_started;
+    };
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,51 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: copy.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/algorithm/copy.h"
+#include "rex_std/internal/execution/execution_policy.h"
+#include "rex_std/internal/iterator/iterator_traits.h"
+#include "rex_std/internal/type_traits/enable_if.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+
+    // copies [first, last) to the range starting at dstFirst, the parallel policies split the range over the threads of a pool.
+    // every chunk goes through the single threaded copy, so contiguous ranges of trivially copyable types are still memmoved
+    template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2>
+    enable_if_t<internal::is_execution_policy_arg_v<ExecutionPolicy>, ForwardIterator2> copy(ExecutionPolicy&& policy, ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 dstFirst)
+    {
+      if constexpr(internal::runs_parallel_v<ExecutionPolicy, ForwardIterator1> && internal::runs_parallel_v<ExecutionPolicy, ForwardIterator2>)
+      {
+        using src_difference_type = typename rsl::iterator_traits<ForwardIterator1>::difference_type;
+        using dst_difference_type = typename rsl::iterator_traits<ForwardIterator2>::difference_type;
+
+        const card64 count = static_cast<card64>(last - first);
+        thread_pool& pool  = policy.pool();
+        pool.parallel_for(0, count, pool.grain_size(count, internal::g_parallel_algorithm_min_grain),
+                          [&](card64 chunkFirst, card64 chunkLast)
+                          { rsl::copy(first + static_cast<src_difference_type>(chunkFirst), first + static_cast<src_difference_type>(chunkLast), dstFirst + static_cast<dst_difference_type>(chunkFirst)); });
+        return dstFirst + static_cast<dst_difference_type>(count);
+      }
+      else
+      {
+        (void)policy;
+        return rsl::copy(first, last, dstFirst);
+      }
+    }
+
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,149 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: execution_policy.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t
+//
+// Execution policies tell an algorithm if it's allowed to run in parallel.
+// The parallel policies run on a rsl::thread_pool, the default pool unless
+// another one is given with on(pool).
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/thread/thread_pool.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/iterator/iterator_tags.h"
+#include "rex_std/internal/iterator/iterator_traits.h"
+#include "rex_std/internal/type_traits/integral_constant.h"
+#include "rex_std/internal/type_traits/is_base_of.h"
+#include "rex_std/internal/type_traits/remove_cvref.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // base class of the parallel policies, holds the pool they run on
+      class pool_policy
+      {
+      public:
+        constexpr pool_policy()
+            : m_pool(nullptr)
+        {
+        }
+        constexpr explicit pool_policy(thread_pool* pool)
+            : m_pool(pool)
+        {
+        }
+
+        thread_pool& pool() const
+        {
+          return m_pool != nullptr ? *m_pool : thread_pool::default_pool();
+        }
+
+      private:
+        thread_pool* m_pool;
+      };
+    } // namespace internal
+
+    namespace execution
+    {
+      // the algorithm runs on the calling thread, one element after the other
+      class sequenced_policy
+      {
+      };
+
+      // the algorithm can run on multiple threads, elements on the same thread are processed in order
+      class parallel_policy : public rsl::internal::pool_policy
+      {
+      public:
+        using pool_policy::pool_policy;
+
+        /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+        // returns a policy running on the given pool instead of the default pool
+        parallel_policy on(thread_pool& pool) const
+        {
+          return parallel_policy(&pool);
+        }
+      };
+
+      // the algorithm can run on multiple threads and can be vectorized on each of them
+      class parallel_unsequenced_policy : public rsl::internal::pool_policy
+      {
+      public:
+        using pool_policy::pool_policy;
+
+        /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+        // returns a policy running on the given pool instead of the default pool
+        parallel_unsequenced_policy on(thread_pool& pool) const
+        {
+          return parallel_unsequenced_policy(&pool);
+        }
+      };
+
+      // the algorithm runs on the calling thread, but can be vectorized
+      class unsequenced_policy
+      {
+      };
+
+      inline constexpr sequenced_policy seq {};
+      inline constexpr parallel_policy par {};
+      inline constexpr parallel_unsequenced_policy par_unseq {};
+      inline constexpr unsequenced_policy unseq {};
+    } // namespace execution
+
+    template <typename T>
+    struct is_execution_policy : false_type
+    {
+    };
+    template <>
+    struct is_execution_policy<execution::sequenced_policy> : true_type
+    {
+    };
+    template <>
+    struct is_execution_policy<execution::parallel_policy> : true_type
+    {
+    };
+    template <>
+    struct is_execution_policy<execution::parallel_unsequenced_policy> : true_type
+    {
+    };
+    template <>
+    struct is_execution_policy<execution::unsequenced_policy> : true_type
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+    namespace internal
+    {
+      // the parallel algorithms take the policy by forwarding reference, this strips it down to the policy type
+      template <typename ExecutionPolicy>
+      inline constexpr bool is_execution_policy_arg_v = is_execution_policy_v<remove_cvref_t<ExecutionPolicy>>;
+
+      // only random access ranges get split over multiple threads,
+      // other ranges would have to be walked from the start to find where a chunk begins
+      template <typename ExecutionPolicy, typename Iterator>
+      inline constexpr bool runs_parallel_v = rsl::is_base_of_v<pool_policy, remove_cvref_t<ExecutionPolicy>> &&
+                                              rsl::is_base_of_v<rsl::random_access_iterator_tag, typename rsl::iterator_traits<Iterator>::iterator_category>;
+
+      // chunks smaller than this aren't worth sending to another thread for cheap per element work, like a copy
+      inline constexpr card64 g_parallel_algorithm_min_grain = 2048;
+      // the cost of a user provided callable is unknown, it could be very expensive per element,
+      // so the algorithms calling one are allowed to split in much smaller chunks
+      inline constexpr card64 g_parallel_callable_min_grain = 32;
+    } // namespace internal
+  } // namespace v1
+} // namespace rsl
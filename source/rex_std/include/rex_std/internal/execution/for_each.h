@@ -0,0 +1,48 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: for_each.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/algorithm/for_each.h"
+#include "rex_std/internal/execution/execution_policy.h"
+#include "rex_std/internal/iterator/iterator_traits.h"
+#include "rex_std/internal/type_traits/enable_if.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+
+    // applies func to every element in [first, last), the parallel policies split the range over the threads of a pool.
+    // func can be called on different elements at the same time, it's copied for every chunk
+    template <typename ExecutionPolicy, typename ForwardIterator, typename Func>
+    enable_if_t<internal::is_execution_policy_arg_v<ExecutionPolicy>> for_each(ExecutionPolicy&& policy, ForwardIterator first, ForwardIterator last, Func func)
+    {
+      if constexpr(internal::runs_parallel_v<ExecutionPolicy, ForwardIterator>)
+      {
+        using difference_type = typename rsl::iterator_traits<ForwardIterator>::difference_type;
+
+        const card64 count = static_cast<card64>(last - first);
+        thread_pool& pool  = policy.pool();
+        pool.parallel_for(0, count, pool.grain_size(count, internal::g_parallel_callable_min_grain),
+                          [&](card64 chunkFirst, card64 chunkLast) { rsl::for_each(first + static_cast<difference_type>(chunkFirst), first + static_cast<difference_type>(chunkLast), func); });
+      }
+      else
+      {
+        (void)policy;
+        rsl::for_each(first, last, func);
+      }
+    }
+
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,101 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: reduce.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/execution/execution_policy.h"
+#include "rex_std/internal/functional/plus.h"
+#include "rex_std/internal/iterator/iterator_traits.h"
+#include "rex_std/internal/optional/optional.h"
+#include "rex_std/internal/type_traits/enable_if.h"
+#include "rex_std/internal/utility/forward.h"
+#include "rex_std/internal/utility/move.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // reduces the count elements starting at first, which can't be 0.
+      // the range is split in halves which are reduced in parallel until they're smaller than the grain
+      template <typename T, typename RandomAccessIterator, typename BinaryOp>
+      T parallel_reduce(thread_pool& pool, RandomAccessIterator first, card64 count, card64 grain, BinaryOp& op) // NOLINT(misc-no-recursion)
+      {
+        using difference_type = typename rsl::iterator_traits<RandomAccessIterator>::difference_type;
+
+        if(count <= grain)
+        {
+          // start from the first element instead of an init value, the op doesn't need to have an identity value
+          T result = *first;
+          for(card64 i = 1; i < count; ++i)
+          {
+            result = op(rsl::move(result), first[static_cast<difference_type>(i)]);
+          }
+          return result;
+        }
+
+        const card64 left_count = count / 2;
+        rsl::optional<T> left;
+        rsl::optional<T> right;
+        pool.invoke([&]() { left.emplace(parallel_reduce<T>(pool, first, left_count, grain, op)); }, [&]() { right.emplace(parallel_reduce<T>(pool, first + static_cast<difference_type>(left_count), count - left_count, grain, op)); });
+        return op(rsl::move(*left), rsl::move(*right));
+      }
+    } // namespace internal
+
+    // reduces [first, last) with op, starting from init.
+    // the elements are reduced in an unspecified order, so op needs to be associative and commutative.
+    // the parallel policies reduce chunks of the range on the threads of a pool and combine their results
+    template <typename ExecutionPolicy, typename ForwardIterator, typename T, typename BinaryOp>
+    enable_if_t<internal::is_execution_policy_arg_v<ExecutionPolicy>, T> reduce(ExecutionPolicy&& policy, ForwardIterator first, ForwardIterator last, T init, BinaryOp op)
+    {
+      if constexpr(internal::runs_parallel_v<ExecutionPolicy, ForwardIterator>)
+      {
+        const card64 count = static_cast<card64>(last - first);
+        if(count == 0)
+        {
+          return init;
+        }
+
+        thread_pool& pool  = policy.pool();
+        const card64 grain = pool.grain_size(count, internal::g_parallel_algorithm_min_grain);
+        return op(rsl::move(init), internal::parallel_reduce<T>(pool, first, count, grain, op));
+      }
+      else
+      {
+        (void)policy;
+        for(; first != last; ++first)
+        {
+          init = op(rsl::move(init), *first);
+        }
+        return init;
+      }
+    }
+
+    // reduces [first, last) with operator+, starting from init.
+    template <typename ExecutionPolicy, typename ForwardIterator, typename T>
+    enable_if_t<internal::is_execution_policy_arg_v<ExecutionPolicy>, T> reduce(ExecutionPolicy&& policy, ForwardIterator first, ForwardIterator last, T init)
+    {
+      return rsl::reduce(rsl::forward<ExecutionPolicy>(policy), first, last, rsl::move(init), rsl::plus<T>());
+    }
+
+    // reduces [first, last) with operator+, starting from a value initialized element.
+    template <typename ExecutionPolicy, typename ForwardIterator>
+    enable_if_t<internal::is_execution_policy_arg_v<ExecutionPolicy>, typename rsl::iterator_traits<ForwardIterator>::value_type> reduce(ExecutionPolicy&& policy, ForwardIterator first, ForwardIterator last)
+    {
+      using value_type = typename rsl::iterator_traits<ForwardIterator>::value_type;
+      return rsl::reduce(rsl::forward<ExecutionPolicy>(policy), first, last, value_type {}, rsl::plus<value_type>());
+    }
+
+  } // namespace v1
+} // namespace rsl
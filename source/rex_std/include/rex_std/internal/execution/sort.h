@@ -0,0 +1,197 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: sort.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/algorithm/pdq_sort.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/algorithm/lower_bound.h"
+#include "rex_std/internal/execution/execution_policy.h"
+#include "rex_std/internal/functional/less.h"
+#include "rex_std/internal/iterator/iterator_traits.h"
+#include "rex_std/internal/memory/allocator.h"
+#include "rex_std/internal/memory/construct_at.h"
+#include "rex_std/internal/memory/destroy_at.h"
+#include "rex_std/internal/type_traits/enable_if.h"
+#include "rex_std/internal/type_traits/is_trivially_destructible.h"
+#include "rex_std/internal/utility/forward.h"
+#include "rex_std/internal/utility/move.h"
+#include "rex_std/internal/utility/swap.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // sorting is more expensive per element than a copy, but chunks still need to be big enough
+      // to make up for the merges needed to combine them
+      inline constexpr card64 g_parallel_sort_min_grain = 4096;
+
+      // merges the sorted ranges [first1, first1 + count1) and [first2, first2 + count2) into dst by moving the elements.
+      // big merges are split in 2 independent merges: the middle element of the biggest range is looked up
+      // in the other range, everything before it merges into the front of dst and everything after it into the back
+      template <typename InputIterator, typename OutputIterator, typename Compare>
+      void parallel_merge(thread_pool& pool, InputIterator first1, card64 count1, InputIterator first2, card64 count2, OutputIterator dst, card64 grain, Compare& compare) // NOLINT(misc-no-recursion)
+      {
+        using input_difference_type  = typename rsl::iterator_traits<InputIterator>::difference_type;
+        using output_difference_type = typename rsl::iterator_traits<OutputIterator>::difference_type;
+
+        if(count1 < count2)
+        {
+          // rsl::sort isn't stable, so it doesn't matter which range equal elements are taken from first
+          rsl::swap(first1, first2);
+          rsl::swap(count1, count2);
+        }
+
+        const card64 mid1 = count1 / 2;
+        if(count1 + count2 <= grain || mid1 == 0)
+        {
+          while(count1 != 0 && count2 != 0)
+          {
+            if(compare(*first2, *first1))
+            {
+              *dst = rsl::move(*first2);
+              ++first2;
+              --count2;
+            }
+            else
+            {
+              *dst = rsl::move(*first1);
+              ++first1;
+              --count1;
+            }
+            ++dst;
+          }
+          for(; count1 != 0; --count1, ++first1, ++dst)
+          {
+            *dst = rsl::move(*first1);
+          }
+          for(; count2 != 0; --count2, ++first2, ++dst)
+          {
+            *dst = rsl::move(*first2);
+          }
+          return;
+        }
+
+        const InputIterator pivot  = first1 + static_cast<input_difference_type>(mid1);
+        const InputIterator split2 = rsl::lower_bound(first2, first2 + static_cast<input_difference_type>(count2), *pivot, compare);
+        const card64 mid2          = static_cast<card64>(split2 - first2);
+
+        pool.invoke([&]() { parallel_merge(pool, first1, mid1, first2, mid2, dst, grain, compare); },
+                    [&]() { parallel_merge(pool, pivot, count1 - mid1, split2, count2 - mid2, dst + static_cast<output_difference_type>(mid1 + mid2), grain, compare); });
+      }
+
+      // merge sort where both halves are sorted in parallel and merged in parallel.
+      // data and other are 2 ranges of count elements, the elements ping pong between them on every level.
+      // the sorted elements end up in other if resultInOther is true, otherwise in data.
+      template <typename DataIterator, typename OtherIterator, typename Compare>
+      void parallel_merge_sort(thread_pool& pool, DataIterator data, OtherIterator other, card64 count, bool resultInOther, card64 grain, Compare& compare) // NOLINT(misc-no-recursion)
+      {
+        using data_difference_type  = typename rsl::iterator_traits<DataIterator>::difference_type;
+        using other_difference_type = typename rsl::iterator_traits<OtherIterator>::difference_type;
+
+        if(count <= grain)
+        {
+          rsl::pdq_sort(data, data + static_cast<data_difference_type>(count), compare);
+          if(resultInOther)
+          {
+            for(card64 i = 0; i < count; ++i)
+            {
+              other[static_cast<other_difference_type>(i)] = rsl::move(data[static_cast<data_difference_type>(i)]);
+            }
+          }
+          return;
+        }
+
+        // the halves need to end up in the range we're not merging into
+        const card64 half = count / 2;
+        pool.invoke([&]() { parallel_merge_sort(pool, data, other, half, !resultInOther, grain, compare); },
+                    [&]() { parallel_merge_sort(pool, data + static_cast<data_difference_type>(half), other + static_cast<other_difference_type>(half), count - half, !resultInOther, grain, compare); });
+
+        if(resultInOther)
+        {
+          parallel_merge(pool, data, half, data + static_cast<data_difference_type>(half), count - half, other, grain, compare);
+        }
+        else
+        {
+          parallel_merge(pool, other, half, other + static_cast<other_difference_type>(half), count - half, data, grain, compare);
+        }
+      }
+    } // namespace internal
+
+    // sorts [first, last) with compare, the sort isn't stable.
+    // the parallel policies run a parallel merge sort on the threads of a pool, with a pattern defeating quicksort
+    // for the chunks. This needs a buffer of last - first elements, which is allocated with rsl::allocator.
+    template <typename ExecutionPolicy, typename RandomAccessIterator, typename Compare>
+    enable_if_t<internal::is_execution_policy_arg_v<ExecutionPolicy>> sort(ExecutionPolicy&& policy, RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+    {
+      if constexpr(internal::runs_parallel_v<ExecutionPolicy, RandomAccessIterator>)
+      {
+        using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+
+        const card64 count = static_cast<card64>(last - first);
+        thread_pool& pool  = policy.pool();
+        const card64 grain = pool.grain_size(count, internal::g_parallel_sort_min_grain);
+        if(count <= grain)
+        {
+          rsl::pdq_sort(first, last, compare);
+          return;
+        }
+
+        rsl::allocator alloc;
+        const card64 buffer_size = count * sizeof(value_type);
+        value_type* buffer      = static_cast<value_type*>(alloc.allocate(buffer_size));
+
+        // move the elements into the buffer, which leaves both ranges with constructed elements.
+        // from here on the elements are only move assigned between them
+        pool.parallel_for(0, count, pool.grain_size(count, internal::g_parallel_algorithm_min_grain),
+                          [&](card64 chunkFirst, card64 chunkLast)
+                          {
+                            for(card64 i = chunkFirst; i < chunkLast; ++i)
+                            {
+                              rsl::construct_at(buffer + i, rsl::move(first[static_cast<ptrdiff>(i)]));
+                            }
+                          });
+
+        pool.run([&]() { internal::parallel_merge_sort(pool, buffer, first, count, true, grain, compare); });
+
+        if constexpr(!rsl::is_trivially_destructible_v<value_type>)
+        {
+          pool.parallel_for(0, count, pool.grain_size(count, internal::g_parallel_algorithm_min_grain),
+                            [&](card64 chunkFirst, card64 chunkLast)
+                            {
+                              for(card64 i = chunkFirst; i < chunkLast; ++i)
+                              {
+                                rsl::destroy_at(buffer + i);
+                              }
+                            });
+        }
+        alloc.deallocate(buffer, buffer_size);
+      }
+      else
+      {
+        (void)policy;
+        rsl::pdq_sort(first, last, compare);
+      }
+    }
+
+    // sorts [first, last) with operator<, the sort isn't stable.
+    template <typename ExecutionPolicy, typename RandomAccessIterator>
+    enable_if_t<internal::is_execution_policy_arg_v<ExecutionPolicy>> sort(ExecutionPolicy&& policy, RandomAccessIterator first, RandomAccessIterator last)
+    {
+      using value_type = typename rsl::iterator_traits<RandomAccessIterator>::value_type;
+      rsl::sort(rsl::forward<ExecutionPolicy>(policy), first, last, rsl::less<value_type>());
+    }
+
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,98 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: transform.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/execution/execution_policy.h"
+#include "rex_std/internal/iterator/iterator_traits.h"
+#include "rex_std/internal/type_traits/enable_if.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+
+    // stores the result of func for every element in [first, last) in the range starting at dstFirst.
+    // the parallel policies split the range over the threads of a pool.
+    template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2, typename Func>
+    enable_if_t<internal::is_execution_policy_arg_v<ExecutionPolicy>, ForwardIterator2> transform(ExecutionPolicy&& policy, ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 dstFirst, Func func)
+    {
+      if constexpr(internal::runs_parallel_v<ExecutionPolicy, ForwardIterator1> && internal::runs_parallel_v<ExecutionPolicy, ForwardIterator2>)
+      {
+        using src_difference_type = typename rsl::iterator_traits<ForwardIterator1>::difference_type;
+        using dst_difference_type = typename rsl::iterator_traits<ForwardIterator2>::difference_type;
+
+        const card64 count = static_cast<card64>(last - first);
+        thread_pool& pool  = policy.pool();
+        pool.parallel_for(0, count, pool.grain_size(count, internal::g_parallel_callable_min_grain),
+                          [&](card64 chunkFirst, card64 chunkLast)
+                          {
+                            ForwardIterator1 src = first + static_cast<src_difference_type>(chunkFirst);
+                            ForwardIterator2 dst = dstFirst + static_cast<dst_difference_type>(chunkFirst);
+                            for(card64 i = chunkFirst; i < chunkLast; ++i, ++src, ++dst)
+                            {
+                              *dst = func(*src);
+                            }
+                          });
+        return dstFirst + static_cast<dst_difference_type>(count);
+      }
+      else
+      {
+        (void)policy;
+        for(; first != last; ++first, ++dstFirst)
+        {
+          *dstFirst = func(*first);
+        }
+        return dstFirst;
+      }
+    }
+
+    // stores the result of func for every pair of elements in [first1, last1) and the range starting at first2
+    // in the range starting at dstFirst. the parallel policies split the ranges over the threads of a pool.
+    template <typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2, typename ForwardIterator3, typename Func>
+    enable_if_t<internal::is_execution_policy_arg_v<ExecutionPolicy>, ForwardIterator3> transform(ExecutionPolicy&& policy, ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, ForwardIterator3 dstFirst, Func func)
+    {
+      if constexpr(internal::runs_parallel_v<ExecutionPolicy, ForwardIterator1> && internal::runs_parallel_v<ExecutionPolicy, ForwardIterator2> && internal::runs_parallel_v<ExecutionPolicy, ForwardIterator3>)
+      {
+        using src1_difference_type = typename rsl::iterator_traits<ForwardIterator1>::difference_type;
+        using src2_difference_type = typename rsl::iterator_traits<ForwardIterator2>::difference_type;
+        using dst_difference_type  = typename rsl::iterator_traits<ForwardIterator3>::difference_type;
+
+        const card64 count = static_cast<card64>(last1 - first1);
+        thread_pool& pool  = policy.pool();
+        pool.parallel_for(0, count, pool.grain_size(count, internal::g_parallel_callable_min_grain),
+                          [&](card64 chunkFirst, card64 chunkLast)
+                          {
+                            ForwardIterator1 src1 = first1 + static_cast<src1_difference_type>(chunkFirst);
+                            ForwardIterator2 src2 = first2 + static_cast<src2_difference_type>(chunkFirst);
+                            ForwardIterator3 dst  = dstFirst + static_cast<dst_difference_type>(chunkFirst);
+                            for(card64 i = chunkFirst; i < chunkLast; ++i, ++src1, ++src2, ++dst)
+                            {
+                              *dst = func(*src1, *src2);
+                            }
+                          });
+        return dstFirst + static_cast<dst_difference_type>(count);
+      }
+      else
+      {
+        (void)policy;
+        for(; first1 != last1; ++first1, ++first2, ++dstFirst)
+        {
+          *dstFirst = func(*first1, *first2);
+        }
+        return dstFirst;
+      }
+    }
+
+  } // namespace v1
+} // namespace rsl
@@ -20,7 +20,6 @@
 #pragma once
 
 #include "rex_std/bonus/iostream/get_area.h"
-#include "rex_std/bonus/platform/windows/handle.h"
 #include "rex_std/bonus/types.h"
 #include "rex_std/cstring.h"
 #include "rex_std/internal/ios/io_types.h"
@@ -30,6 +29,10 @@
 #include "rex_std/internal/string/char_traits.h"
 #include "rex_std/internal/string_view/basic_string_view.h"
 
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include "rex_std/bonus/platform/windows/handle.h"
+#endif
+
 namespace rsl
 {
   inline namespace v1
@@ -39,6 +42,16 @@ namespace rsl
     {
       using handle = void*;
 
+#if defined(RSL_PLATFORM_WINDOWS)
+      using file_handle = win::handle_t;
+#else
+      using file_handle = int32;
+#endif
+
+      // reads and writes are gathered in a buffer of this size,
+      // so small reads and writes don't result in a syscall each
+      inline constexpr streamsize g_default_filebuf_buffer_size = 64 * 1024;
+
       class filebuf_impl
       {
       public:
@@ -56,6 +69,16 @@ namespace rsl
         // bool open(const rsl::filesystem::path::value_type* filename, io::openmode mode);
 
         bool close();
+        bool is_open() const;
+
+        // uses the given buffer for reads and writes, instead of allocating one internally.
+        // if s is nullptr, a buffer of size bytes gets allocated on the next read or write.
+        // a size of 0 makes every read and write go to the file directly.
+        // direct io can't use a buffer whose address or size isn't a multiple of 4096 bytes,
+        // so when the file is opened with openmode::direct, such a buffer is replaced by an internal one
+        void setbuf(char8* s, streamsize size);
+        // writes everything that's still in the buffer to the file, returns -1 on failure
+        int32 sync();
 
         streamsize xsgetn(char8* s, size_t elemSize, streamsize count);
         streamsize xsputn(const char8* s, size_t elemSize, streamsize count);
@@ -160,10 +183,37 @@ namespace rsl
           return m_get_area;
         }
 
+      private:
+        void allocate_buffer();
+        void free_buffer();
+        // stops using a buffer of the user that direct io can't read into or write from
+        void drop_unaligned_user_buffer();
+        // writes the pending bytes in the buffer to the file
+        bool flush_writes();
+        // throws away the bytes read into the buffer that haven't been handed out yet,
+        // so the next write happens at the position the user expects
+        void discard_reads();
+        // loops until all bytes are read or the end of the file is reached
+        streamsize read_all(char8* dst, streamsize size);
+        // loops until all bytes are written or an error occurs
+        streamsize write_all(const char8* src, streamsize size);
+
       private:
         get_area m_get_area;
-        win::handle_t m_handle;
+        file_handle m_handle;
         rsl::io::openmode m_openmode;
+
+        // the buffer is either used for reading or for writing, never both at the same time
+        char8* m_buffer;
+        streamsize m_buffer_size;
+        bool m_owns_buffer;
+        // the number of bytes at the start of the buffer that still need to be written to the file
+        streamsize m_num_pending_writes;
+        // the bytes of the buffer in [m_read_pos, m_read_end) are read from the file but not handed out yet
+        streamsize m_read_pos;
+        streamsize m_read_end;
+        // the offset in the file the next read or write syscall happens at
+        card64 m_file_pos;
       };
     } // namespace internal
 
@@ -195,7 +245,10 @@ namespace rsl
 
       void swap(basic_filebuf& other);
 
-      bool is_open() const;
+      bool is_open() const
+      {
+        return m_impl.is_open();
+      }
 
       basic_filebuf* open(const char8* filename, io::openmode mode)
       {
@@ -222,6 +275,20 @@ namespace rsl
       }
 
     protected:
+      // s is used as buffer for reads and writes, as long as the file buffer is alive.
+      // if s is nullptr, the file buffer allocates a buffer of count characters itself.
+      // passing nullptr and 0 makes the file buffer unbuffered
+      basic_streambuf<CharT, Traits>* setbuf(char_type* s, streamsize count) final
+      {
+        m_impl.setbuf(s, count * static_cast<streamsize>(sizeof(CharT)));
+        return this;
+      }
+      // writes all pending characters to the file
+      int32 sync() final
+      {
+        return m_impl.sync();
+      }
+
       streamsize xsgetn(char_type* s, streamsize count) final
       {
         return m_impl.xsgetn(s, sizeof(CharT), count);
@@ -14,6 +14,7 @@
 
 #include "rex_std/bonus/functional/crc/crc32c.h"
 #include "rex_std/bonus/functional/hash_result.h"
+#include "rex_std/bonus/functional/wyhash.h"
 #include "rex_std/bonus/types.h"
 #include "rex_std/bonus/utility/always_false.h"
 #include "rex_std/cstring.h"
@@ -29,13 +30,18 @@ namespace rsl
     // the standard uses size_t for the hash result.
     // we use uint32 for this, but define it outside of the type
     // which makes it easy to configure should we want to change it to be 64 bit.
+    // defining RSL_ENABLE_64BIT_HASH does exactly that, see hash_result.h
     namespace internal
     {
       template <typename CharType>
       constexpr hash_result hash(const CharType* key, count_t count)
       {
         count = count * sizeof(CharType);
+#if defined(RSL_ENABLE_64BIT_HASH)
+        return static_cast<hash_result>(wyhash::compute(key, count));
+#else
         return static_cast<hash_result>(crc32::compute(key, count));
+#endif
       }
 
       template <typename CharType>
@@ -50,7 +56,11 @@ namespace rsl
       constexpr hash_result hash_as_lower(const CharType* key, count_t count)
       {
         count = count * sizeof(CharType);
+#if defined(RSL_ENABLE_64BIT_HASH)
+        return static_cast<hash_result>(wyhash::compute_as_lower(key, count));
+#else
         return static_cast<hash_result>(crc32::compute_as_lower(key, count));
+#endif
       }
 
       template <typename CharType>
@@ -0,0 +1,436 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: future.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// https://en.cppreference.com/w/cpp/thread/future
+// https://en.cppreference.com/w/cpp/experimental/future/then
+//
+// rsl doesn't use exceptions, a future only ever holds a value.
+// Calling get on a future whose promise got destroyed without setting a value
+// is a programming error.
+//
+// then attaches a continuation to a future, without blocking any thread until
+// the future is ready. The continuation gets the ready future as argument.
+// Without an executor, the continuation runs on the thread making the future
+// ready, or immediately if it's ready already. An executor is any type with a
+// then(future, func) member function, like rsl::thread_pool.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/attributes.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/assert/assert_fwd.h"
+#include "rex_std/internal/chrono/duration.h"
+#include "rex_std/internal/chrono/time_point.h"
+#include "rex_std/internal/future/future_shared_state.h"
+#include "rex_std/internal/memory/allocator.h"
+#include "rex_std/internal/memory/construct_at.h"
+#include "rex_std/internal/type_traits/decay.h"
+#include "rex_std/internal/type_traits/invoke_result.h"
+#include "rex_std/internal/type_traits/is_void.h"
+#include "rex_std/internal/utility/forward.h"
+#include "rex_std/internal/utility/move.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Oct/2023)
+    // rsl futures are never deferred, deferred is only kept for compatibility
+    enum class future_status
+    {
+      ready,
+      timeout,
+      deferred
+    };
+
+    template <typename T>
+    class future;
+    template <typename T>
+    class shared_future;
+
+    namespace internal
+    {
+      // the value type of the future returned when a task or continuation calls func with args
+      template <typename Func, typename... Args>
+      using task_result_t = rsl::decay_t<rsl::invoke_result_t<rsl::decay_t<Func>&, Args...>>;
+
+      // gives the types building on top of futures access to their shared state
+      struct future_access
+      {
+        template <typename Future>
+        static auto* state(const Future& future)
+        {
+          return future.m_state;
+        }
+      };
+
+      // shared_future<void>::get returns void, the others return a reference to the value
+      template <typename T>
+      struct shared_future_get_result
+      {
+        using type = const T&;
+      };
+      template <>
+      struct shared_future_get_result<void>
+      {
+        using type = void;
+      };
+
+      template <typename Antecedent, typename Func>
+      future<task_result_t<Func, Antecedent>> attach_inline_continuation(Antecedent&& antecedent, Func&& func);
+    } // namespace internal
+
+    /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Oct/2023)
+    template <typename T>
+    class future
+    {
+    public:
+      future()
+          : m_state(nullptr)
+      {
+      }
+      // takes over a reference to the state, used by the types producing futures
+      explicit future(internal::future_shared_state<T>* state)
+          : m_state(state)
+      {
+      }
+      future(const future&) = delete;
+      future(future&& other)
+          : m_state(other.m_state)
+      {
+        other.m_state = nullptr;
+      }
+      ~future()
+      {
+        reset();
+      }
+
+      future& operator=(const future&) = delete;
+      future& operator=(future&& other)
+      {
+        if(this != &other)
+        {
+          reset();
+          m_state       = other.m_state;
+          other.m_state = nullptr;
+        }
+        return *this;
+      }
+
+      // returns a shared future referring to the same state, this future is invalid afterwards
+      shared_future<T> share()
+      {
+        return shared_future<T>(rsl::move(*this));
+      }
+
+      // returns true if the future refers to a shared state
+      RSL_NO_DISCARD bool valid() const
+      {
+        return m_state != nullptr;
+      }
+
+      /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+      // returns true if get won't block
+      RSL_NO_DISCARD bool is_ready() const
+      {
+        RSL_ASSERT_X(valid(), "calling is_ready on an invalid future");
+        return m_state->is_ready();
+      }
+
+      // blocks until the value is available.
+      // a worker of a thread pool keeps running tasks of its pool while it waits
+      void wait() const
+      {
+        RSL_ASSERT_X(valid(), "calling wait on an invalid future");
+        m_state->wait();
+      }
+
+      // blocks until the value is available or the timeout expired
+      template <typename Rep, typename Period>
+      future_status wait_for(const rsl::chrono::duration<Rep, Period>& relTime) const
+      {
+        RSL_ASSERT_X(valid(), "calling wait_for on an invalid future");
+        return m_state->wait_for(rsl::chrono::duration_cast<rsl::chrono::nanoseconds>(relTime)) ? future_status::ready : future_status::timeout;
+      }
+
+      // blocks until the value is available or the time point is reached
+      template <typename Clock, typename Duration>
+      future_status wait_until(const rsl::chrono::time_point<Clock, Duration>& absTime) const
+      {
+        return wait_for(absTime - Clock::now());
+      }
+
+      // waits for the value and moves it out of the future, the future is invalid afterwards
+      T get()
+      {
+        wait();
+        RSL_ASSERT_X(!m_state->is_broken(), "the promise of this future got destroyed without setting a value");
+
+        internal::future_shared_state<T>* state = m_state;
+        m_state                                 = nullptr;
+        if constexpr(rsl::is_void_v<T>)
+        {
+          state->release();
+        }
+        else
+        {
+          // moves the value out, unless it's a reference
+          T value = rsl::forward<T>(state->value());
+          state->release();
+          return value;
+        }
+      }
+
+      /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+      // calls func(future) once this future is ready, on the thread making it ready.
+      // if it's ready already, func is called immediately. this future is invalid afterwards
+      template <typename Func>
+      future<internal::task_result_t<Func, future>> then(Func&& func)
+      {
+        RSL_ASSERT_X(valid(), "calling then on an invalid future");
+        return internal::attach_inline_continuation(rsl::move(*this), rsl::forward<Func>(func));
+      }
+
+      /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+      // calls func(future) on the executor once this future is ready. this future is invalid afterwards
+      template <typename Executor, typename Func>
+      auto then(Executor& executor, Func&& func)
+      {
+        RSL_ASSERT_X(valid(), "calling then on an invalid future");
+        return executor.then(rsl::move(*this), rsl::forward<Func>(func));
+      }
+
+    private:
+      void reset()
+      {
+        if(m_state != nullptr)
+        {
+          m_state->release();
+          m_state = nullptr;
+        }
+      }
+
+      friend struct internal::future_access;
+
+    private:
+      internal::future_shared_state<T>* m_state;
+    };
+
+    /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Oct/2023)
+    // a future that can be copied, all copies refer to the same value
+    template <typename T>
+    class shared_future
+    {
+    public:
+      shared_future()
+          : m_state(nullptr)
+      {
+      }
+      shared_future(future<T>&& other) // NOLINT(google-explicit-constructor)
+          : m_state(internal::future_access::state(other))
+      {
+        // the reference of the future moves to us
+        if(m_state != nullptr)
+        {
+          m_state->add_ref();
+          other = future<T>();
+        }
+      }
+      shared_future(const shared_future& other)
+          : m_state(other.m_state)
+      {
+        if(m_state != nullptr)
+        {
+          m_state->add_ref();
+        }
+      }
+      shared_future(shared_future&& other)
+          : m_state(other.m_state)
+      {
+        other.m_state = nullptr;
+      }
+      ~shared_future()
+      {
+        reset();
+      }
+
+      shared_future& operator=(const shared_future& other)
+      {
+        if(this != &other)
+        {
+          if(other.m_state != nullptr)
+          {
+            other.m_state->add_ref();
+          }
+          reset();
+          m_state = other.m_state;
+        }
+        return *this;
+      }
+      shared_future& operator=(shared_future&& other)
+      {
+        if(this != &other)
+        {
+          reset();
+          m_state       = other.m_state;
+          other.m_state = nullptr;
+        }
+        return *this;
+      }
+
+      // returns true if the future refers to a shared state
+      RSL_NO_DISCARD bool valid() const
+      {
+        return m_state != nullptr;
+      }
+
+      /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+      // returns true if get won't block
+      RSL_NO_DISCARD bool is_ready() const
+      {
+        RSL_ASSERT_X(valid(), "calling is_ready on an invalid shared future");
+        return m_state->is_ready();
+      }
+
+      // blocks until the value is available.
+      // a worker of a thread pool keeps running tasks of its pool while it waits
+      void wait() const
+      {
+        RSL_ASSERT_X(valid(), "calling wait on an invalid shared future");
+        m_state->wait();
+      }
+
+      // blocks until the value is available or the timeout expired
+      template <typename Rep, typename Period>
+      future_status wait_for(const rsl::chrono::duration<Rep, Period>& relTime) const
+      {
+        RSL_ASSERT_X(valid(), "calling wait_for on an invalid shared future");
+        return m_state->wait_for(rsl::chrono::duration_cast<rsl::chrono::nanoseconds>(relTime)) ? future_status::ready : future_status::timeout;
+      }
+
+      // blocks until the value is available or the time point is reached
+      template <typename Clock, typename Duration>
+      future_status wait_until(const rsl::chrono::time_point<Clock, Duration>& absTime) const
+      {
+        return wait_for(absTime - Clock::now());
+      }
+
+      // waits for the value and returns a reference to it, the future stays valid
+      typename internal::shared_future_get_result<T>::type get() const
+      {
+        wait();
+        RSL_ASSERT_X(!m_state->is_broken(), "the promise of this future got destroyed without setting a value");
+        return m_state->value();
+      }
+
+      /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+      // calls func(shared_future) once this future is ready, on the thread making it ready.
+      // if it's ready already, func is called immediately
+      template <typename Func>
+      future<internal::task_result_t<Func, shared_future>> then(Func&& func) const
+      {
+        RSL_ASSERT_X(valid(), "calling then on an invalid shared future");
+        return internal::attach_inline_continuation(shared_future(*this), rsl::forward<Func>(func));
+      }
+
+      /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+      // calls func(shared_future) on the executor once this future is ready
+      template <typename Executor, typename Func>
+      auto then(Executor& executor, Func&& func) const
+      {
+        RSL_ASSERT_X(valid(), "calling then on an invalid shared future");
+        return executor.then(shared_future(*this), rsl::forward<Func>(func));
+      }
+
+    private:
+      void reset()
+      {
+        if(m_state != nullptr)
+        {
+          m_state->release();
+          m_state = nullptr;
+        }
+      }
+
+      friend struct internal::future_access;
+
+    private:
+      internal::future_shared_state<T>* m_state;
+    };
+
+    namespace internal
+    {
+      // calls a continuation on the thread making its antecedent ready.
+      // it's also the shared state of the future returned to the caller
+      template <typename Func, typename Antecedent, typename R>
+      class inline_continuation : public future_shared_state<R>, public future_continuation
+      {
+      public:
+        template <typename F>
+        inline_continuation(Antecedent&& antecedent, F&& func)
+            : future_shared_state<R>(&inline_continuation::destroy_impl)
+            , future_continuation(&inline_continuation::run_impl)
+            , m_antecedent(rsl::move(antecedent))
+            , m_func(rsl::forward<F>(func))
+        {
+          // one reference for the returned future, one until the continuation ran
+          this->add_ref();
+        }
+
+      private:
+        static void run_impl(future_continuation* continuation)
+        {
+          inline_continuation* self = static_cast<inline_continuation*>(continuation);
+          if constexpr(rsl::is_void_v<R>)
+          {
+            self->m_func(rsl::move(self->m_antecedent));
+            self->set_value();
+          }
+          else
+          {
+            self->set_value(self->m_func(rsl::move(self->m_antecedent)));
+          }
+          self->release();
+        }
+
+        static void destroy_impl(future_shared_state_base* state)
+        {
+          inline_continuation* self = static_cast<inline_continuation*>(state);
+          self->~inline_continuation();
+          rsl::allocator alloc;
+          alloc.deallocate(self, sizeof(inline_continuation));
+        }
+
+      private:
+        Antecedent m_antecedent;
+        Func m_func;
+      };
+
+      template <typename Antecedent, typename Func>
+      future<task_result_t<Func, Antecedent>> attach_inline_continuation(Antecedent&& antecedent, Func&& func)
+      {
+        using result_type       = task_result_t<Func, Antecedent>;
+        using continuation_type = inline_continuation<rsl::decay_t<Func>, Antecedent, result_type>;
+
+        auto* antecedent_state = future_access::state(antecedent);
+        rsl::allocator alloc;
+        continuation_type* continuation = rsl::construct_at(static_cast<continuation_type*>(alloc.allocate(sizeof(continuation_type))), rsl::move(antecedent), rsl::forward<Func>(func));
+        future<result_type> result(continuation);
+        // the continuation holds on to the antecedent, so its state stays alive
+        antecedent_state->add_continuation(continuation);
+        return result;
+      }
+    } // namespace internal
+  } // namespace v1
+} // namespace rsl
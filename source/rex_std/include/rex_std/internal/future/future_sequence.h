@@ -0,0 +1,188 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: future_sequence.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Helpers shared by when_all and when_any.
+//
+// Both hold a sequence of futures, either a vector or a tuple, and register a
+// continuation on every future in it.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/future/future.h"
+#include "rex_std/internal/future/future_shared_state.h"
+#include "rex_std/internal/memory/allocator.h"
+#include "rex_std/internal/memory/construct_at.h"
+#include "rex_std/internal/type_traits/integral_constant.h"
+#include "rex_std/internal/utility/integer_sequence.h"
+#include "rex_std/internal/utility/move.h"
+#include "rex_std/tuple.h"
+#include "rex_std/vector.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      template <typename T>
+      struct is_future : false_type
+      {
+      };
+      template <typename T>
+      struct is_future<future<T>> : true_type
+      {
+      };
+      template <typename T>
+      struct is_future<shared_future<T>> : true_type
+      {
+      };
+
+      template <typename T>
+      inline constexpr bool is_future_v = is_future<T>::value;
+
+      // futures are moved into the sequence, shared futures are copied so the caller's copy stays valid
+      template <typename T>
+      future<T> take_future(future<T>& fut)
+      {
+        return rsl::move(fut);
+      }
+      template <typename T>
+      shared_future<T> take_future(shared_future<T>& fut)
+      {
+        return fut;
+      }
+
+      template <typename Future, typename Func>
+      void for_each_future(rsl::vector<Future>& futures, Func& func)
+      {
+        for(card64 i = 0; i < static_cast<card64>(futures.size()); ++i)
+        {
+          func(futures[static_cast<count_t>(i)], i);
+        }
+      }
+      template <typename... Futures, typename Func, card32... Indices>
+      void for_each_future(rsl::tuple<Futures...>& futures, Func& func, rsl::integer_sequence<card32, Indices...> /*unused*/)
+      {
+        (func(rsl::get<Indices>(futures), static_cast<card64>(Indices)), ...);
+      }
+      template <typename... Futures, typename Func>
+      void for_each_future(rsl::tuple<Futures...>& futures, Func& func)
+      {
+        for_each_future(futures, func, rsl::index_sequence_for<Futures...> {});
+      }
+
+      template <typename Future>
+      card64 num_futures(const rsl::vector<Future>& futures)
+      {
+        return static_cast<card64>(futures.size());
+      }
+      template <typename... Futures>
+      card64 num_futures(const rsl::tuple<Futures...>& /*unused*/)
+      {
+        return sizeof...(Futures);
+      }
+
+      // the continuation registered by when_all and when_any on one of their futures, it tells its owner
+      // which future became ready
+      template <typename Owner>
+      class when_node : public future_continuation
+      {
+      public:
+        when_node(Owner* owner, future_shared_state_base* target, card64 index)
+            : future_continuation(&when_node::run_impl)
+            , m_owner(owner)
+            , m_target(target)
+            , m_index(index)
+        {
+        }
+
+        void attach()
+        {
+          m_target->add_continuation(this);
+        }
+
+      private:
+        static void run_impl(future_continuation* continuation)
+        {
+          when_node* self = static_cast<when_node*>(continuation);
+          self->m_owner->on_ready(self->m_index);
+        }
+
+      private:
+        Owner* m_owner;
+        future_shared_state_base* m_target;
+        card64 m_index;
+      };
+
+      // a state of when_all or when_any, it owns the futures until they're handed over to the result
+      template <typename Derived, typename Result, typename Sequence>
+      class when_state : public future_shared_state<Result>
+      {
+      public:
+        explicit when_state(Sequence&& futures)
+            : future_shared_state<Result>(&when_state::destroy_impl)
+            , m_futures(rsl::move(futures))
+            , m_nodes()
+        {
+          // the states are collected before any continuation gets attached,
+          // as the futures can be moved into the result as soon as the first one runs
+          m_nodes.reserve(static_cast<count_t>(num_futures(m_futures)));
+          auto add_node = [this](auto& fut, card64 index) { m_nodes.emplace_back(static_cast<Derived*>(this), future_access::state(fut), index); };
+          for_each_future(m_futures, add_node);
+        }
+
+        // allocates the state, the caller takes over the reference of the returned future
+        static Derived* create(Sequence&& futures)
+        {
+          rsl::allocator alloc;
+          return rsl::construct_at(static_cast<Derived*>(alloc.allocate(sizeof(Derived))), rsl::move(futures));
+        }
+
+      protected:
+        card64 num_nodes() const
+        {
+          return static_cast<card64>(m_nodes.size());
+        }
+
+        // attaching has to happen after construction, the continuations can run immediately
+        void attach_nodes()
+        {
+          for(when_node<Derived>& node : m_nodes)
+          {
+            node.attach();
+          }
+        }
+
+        Sequence take_futures()
+        {
+          return rsl::move(m_futures);
+        }
+
+      private:
+        static void destroy_impl(future_shared_state_base* state)
+        {
+          Derived* self = static_cast<Derived*>(state);
+          self->~Derived();
+          rsl::allocator alloc;
+          alloc.deallocate(self, sizeof(Derived));
+        }
+
+      private:
+        Sequence m_futures;
+        rsl::vector<when_node<Derived>> m_nodes;
+      };
+    } // namespace internal
+  }   // namespace v1
+} // namespace rsl
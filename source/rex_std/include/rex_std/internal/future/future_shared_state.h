@@ -0,0 +1,352 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: future_shared_state.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// The state shared between the producer of a value and the futures waiting on it.
+//
+// Completing a state is lock free. Threads blocking on a state only announce
+// themselves with a flag, so the producer only pays for a wake up if somebody
+// is actually sleeping. Continuations are kept in a lock free list that gets
+// closed when the state becomes ready, a continuation added afterwards runs
+// immediately.
+// rsl doesn't use exceptions, a producer that goes away without setting a
+// value makes the state ready without one. It's broken.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/atomic/atomic_wait.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/assert/assert_fwd.h"
+#include "rex_std/internal/atomic/atomic.h"
+#include "rex_std/internal/chrono/duration.h"
+#include "rex_std/internal/memory/addressof.h"
+#include "rex_std/internal/type_traits/aligned_storage.h"
+#include "rex_std/internal/utility/forward.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      class future_shared_state_base;
+
+      // a callback run once a shared state becomes ready, the state doesn't own its continuations.
+      // a function pointer is used instead of a virtual function, so a continuation can be part of
+      // another object without adding a vtable to it
+      class future_continuation
+      {
+      public:
+        using run_func = void (*)(future_continuation*);
+
+        constexpr explicit future_continuation(run_func func)
+            : m_run(func)
+            , m_next(nullptr)
+        {
+        }
+
+        void run()
+        {
+          m_run(this);
+        }
+
+        future_continuation* next() const
+        {
+          return m_next;
+        }
+        void set_next(future_continuation* next)
+        {
+          m_next = next;
+        }
+
+      private:
+        run_func m_run;
+        future_continuation* m_next;
+      };
+
+      // the continuation list of a ready state points to this, it's never run
+      inline future_continuation g_future_closed_continuation_list(nullptr); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+      // if the calling thread is a worker of a thread pool, it runs tasks of its pool until the state is ready.
+      // a worker blocking on a future whose task is queued behind it would otherwise never finish.
+      // returns false without waiting if the calling thread isn't a worker of any pool
+      bool help_pool_until_ready(const future_shared_state_base& state);
+
+      class future_shared_state_base
+      {
+      public:
+        // called when the last reference is released, destroys the state and frees its memory
+        using destroy_func = void (*)(future_shared_state_base*);
+
+        // the state starts with a single reference, owned by whoever created it
+        explicit future_shared_state_base(destroy_func destroy)
+            : m_status(g_status_pending)
+            , m_ref_count(1)
+            , m_continuations(nullptr)
+            , m_destroy(destroy)
+        {
+        }
+
+        future_shared_state_base(const future_shared_state_base&) = delete;
+        future_shared_state_base(future_shared_state_base&&)      = delete;
+
+        future_shared_state_base& operator=(const future_shared_state_base&) = delete;
+        future_shared_state_base& operator=(future_shared_state_base&&)      = delete;
+
+        void add_ref()
+        {
+          m_ref_count.fetch_add(1, rsl::memory_order_relaxed);
+        }
+        void release()
+        {
+          // the last owner needs to see everything the other owners did to the state before destroying it
+          if(m_ref_count.fetch_sub(1, rsl::memory_order_acq_rel) == 1)
+          {
+            m_destroy(this);
+          }
+        }
+
+        bool is_ready() const
+        {
+          return (m_status.load(rsl::memory_order_acquire) & g_status_ready) != 0;
+        }
+
+        // returns true if the state is ready because a value was set, false if it's not ready or broken
+        bool has_value() const
+        {
+          return m_status.load(rsl::memory_order_acquire) == g_status_ready;
+        }
+
+        // returns true if the producer went away without setting a value
+        bool is_broken() const
+        {
+          return (m_status.load(rsl::memory_order_acquire) & g_status_broken) != 0;
+        }
+
+        // blocks until the state is ready
+        void wait() const
+        {
+          if(is_ready() || help_pool_until_ready(*this))
+          {
+            return;
+          }
+
+          const uint32 status = announce_waiter();
+          if((status & g_status_ready) == 0)
+          {
+            internal::atomic_wait(m_status, status);
+          }
+        }
+
+        // blocks until the state is ready or the timeout expired, returns true if the state is ready
+        bool wait_for(rsl::chrono::nanoseconds timeout) const
+        {
+          if(is_ready())
+          {
+            return true;
+          }
+
+          const uint32 status = announce_waiter();
+          if((status & g_status_ready) == 0)
+          {
+            internal::atomic_wait_for(m_status, status, timeout);
+          }
+          return is_ready();
+        }
+
+        // makes the state ready without a value, used when the producer goes away without setting one
+        void mark_broken()
+        {
+          complete(g_status_ready | g_status_broken);
+        }
+
+        // runs continuation once the state is ready.
+        // if the state is already ready, the continuation runs immediately on the calling thread.
+        // otherwise it runs on the thread making the state ready
+        void add_continuation(future_continuation* continuation)
+        {
+          // continuations are only ever pushed and the whole list is only ever taken at once,
+          // so a pointer getting reused can't corrupt the list
+          future_continuation* head = m_continuations.load(rsl::memory_order_acquire);
+          do // NOLINT(cppcoreguidelines-avoid-do-while)
+          {
+            if(head == &g_future_closed_continuation_list)
+            {
+              continuation->run();
+              return;
+            }
+            continuation->set_next(head);
+          } while(!m_continuations.compare_exchange_strong(head, continuation, rsl::memory_order_acq_rel, rsl::memory_order_acquire));
+        }
+
+      protected:
+        // the state is destroyed through its destroy function, which knows its real type
+        ~future_shared_state_base() = default;
+
+        // publishes the value, wakes up the waiting threads and runs the continuations.
+        // the caller needs to hold a reference, the waiting threads can drop theirs as soon as they wake up
+        void mark_ready()
+        {
+          complete(g_status_ready);
+        }
+
+      private:
+        // sets the flag telling the producer somebody's sleeping on the state, unless it's ready already.
+        // returns the status the waiter has to sleep on
+        uint32 announce_waiter() const
+        {
+          uint32 status = m_status.load(rsl::memory_order_acquire);
+          while((status & (g_status_ready | g_status_has_waiters)) == 0)
+          {
+            if(m_status.compare_exchange_strong(status, status | g_status_has_waiters, rsl::memory_order_acquire, rsl::memory_order_acquire))
+            {
+              status |= g_status_has_waiters;
+            }
+          }
+
+          // once the flag is set, the status only changes when the state becomes ready
+          return status;
+        }
+
+        void complete(uint32 readyStatus)
+        {
+          const uint32 previous = m_status.exchange(readyStatus, rsl::memory_order_acq_rel);
+          RSL_ASSERT_X((previous & g_status_ready) == 0, "future shared state made ready twice");
+          if((previous & g_status_has_waiters) != 0)
+          {
+            internal::atomic_notify_all(m_status);
+          }
+
+          // continuations were pushed in front of each other, reverse them so they run in the order they got added
+          future_continuation* continuation = m_continuations.exchange(&g_future_closed_continuation_list, rsl::memory_order_acq_rel);
+          future_continuation* in_order     = nullptr;
+          while(continuation != nullptr)
+          {
+            future_continuation* next = continuation->next();
+            continuation->set_next(in_order);
+            in_order     = continuation;
+            continuation = next;
+          }
+
+          while(in_order != nullptr)
+          {
+            // a continuation can destroy itself while it runs
+            future_continuation* next = in_order->next();
+            in_order->run();
+            in_order = next;
+          }
+        }
+
+      private:
+        static constexpr uint32 g_status_pending     = 0;
+        static constexpr uint32 g_status_ready       = 1;
+        static constexpr uint32 g_status_has_waiters = 2;
+        static constexpr uint32 g_status_broken      = 4;
+
+        mutable rsl::atomic<uint32> m_status;
+        rsl::atomic<card32> m_ref_count;
+        rsl::atomic<future_continuation*> m_continuations;
+        destroy_func m_destroy;
+      };
+
+      template <typename T>
+      class future_shared_state : public future_shared_state_base
+      {
+      public:
+        using future_shared_state_base::future_shared_state_base;
+
+        future_shared_state(const future_shared_state&) = delete;
+        future_shared_state(future_shared_state&&)      = delete;
+
+        future_shared_state& operator=(const future_shared_state&) = delete;
+        future_shared_state& operator=(future_shared_state&&)      = delete;
+
+        template <typename... Args>
+        void set_value(Args&&... args)
+        {
+          m_storage.template set<T>(rsl::forward<Args>(args)...);
+          mark_ready();
+        }
+
+        // can only be called once the state has a value
+        T& value()
+        {
+          RSL_ASSERT_X(has_value(), "accessing the value of a future shared state without a value");
+          return *m_storage.template get<T>();
+        }
+
+      protected:
+        ~future_shared_state()
+        {
+          if(has_value())
+          {
+            m_storage.template get<T>()->~T();
+          }
+        }
+
+      private:
+        rsl::aligned_storage_t<T> m_storage;
+      };
+
+      // a future of a reference only refers to the value, which is owned by whoever set it
+      template <typename T>
+      class future_shared_state<T&> : public future_shared_state_base
+      {
+      public:
+        using future_shared_state_base::future_shared_state_base;
+
+        future_shared_state(const future_shared_state&) = delete;
+        future_shared_state(future_shared_state&&)      = delete;
+
+        future_shared_state& operator=(const future_shared_state&) = delete;
+        future_shared_state& operator=(future_shared_state&&)      = delete;
+
+        void set_value(T& value)
+        {
+          m_value = rsl::addressof(value);
+          mark_ready();
+        }
+
+        // can only be called once the state has a value
+        T& value()
+        {
+          RSL_ASSERT_X(has_value(), "accessing the value of a future shared state without a value");
+          return *m_value;
+        }
+
+      protected:
+        ~future_shared_state() = default;
+
+      private:
+        T* m_value = nullptr;
+      };
+
+      template <>
+      class future_shared_state<void> : public future_shared_state_base
+      {
+      public:
+        using future_shared_state_base::future_shared_state_base;
+
+        void set_value()
+        {
+          mark_ready();
+        }
+
+        void value()
+        {
+          RSL_ASSERT_X(has_value(), "accessing the value of a future shared state without a value");
+        }
+      };
+    } // namespace internal
+  }   // namespace v1
+} // namespace rsl
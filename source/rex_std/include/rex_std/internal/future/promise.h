@@ -0,0 +1,234 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: promise.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// https://en.cppreference.com/w/cpp/thread/promise
+//
+// The shared state is allocated with the allocator given to the promise and
+// freed by whoever drops the last reference to it, the promise or a future.
+// Destroying a promise without setting a value makes its state broken.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/attributes.h"
+#include "rex_std/internal/assert/assert_fwd.h"
+#include "rex_std/internal/future/future.h"
+#include "rex_std/internal/future/future_shared_state.h"
+#include "rex_std/internal/memory/allocator.h"
+#include "rex_std/internal/memory/allocator_arg_t.h"
+#include "rex_std/internal/memory/construct_at.h"
+#include "rex_std/internal/memory/uses_allocator.h"
+#include "rex_std/internal/type_traits/integral_constant.h"
+#include "rex_std/internal/utility/move.h"
+#include "rex_std/internal/utility/swap.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      template <typename T, typename Alloc>
+      class promise_shared_state : public future_shared_state<T>
+      {
+      public:
+        explicit promise_shared_state(const Alloc& alloc)
+            : future_shared_state<T>(&promise_shared_state::destroy_impl)
+            , m_alloc(alloc)
+        {
+        }
+
+      private:
+        static void destroy_impl(future_shared_state_base* state)
+        {
+          promise_shared_state* self = static_cast<promise_shared_state*>(state);
+          // the allocator lives inside the memory it's about to free
+          Alloc alloc(rsl::move(self->m_alloc));
+          self->~promise_shared_state();
+          alloc.deallocate(self, sizeof(promise_shared_state));
+        }
+
+      private:
+        Alloc m_alloc;
+      };
+
+      // everything a promise does, except for setting the value
+      template <typename R>
+      class promise_base
+      {
+      public:
+        template <typename Alloc>
+        promise_base(allocator_arg_t /*unused*/, const Alloc& alloc)
+            : m_state(create_state(alloc))
+            , m_future_retrieved(false)
+        {
+        }
+        promise_base(const promise_base&) = delete;
+        promise_base(promise_base&& other)
+            : m_state(other.m_state)
+            , m_future_retrieved(other.m_future_retrieved)
+        {
+          other.m_state            = nullptr;
+          other.m_future_retrieved = false;
+        }
+        ~promise_base()
+        {
+          abandon();
+        }
+
+        promise_base& operator=(const promise_base&) = delete;
+        promise_base& operator=(promise_base&& other)
+        {
+          if(this != &other)
+          {
+            abandon();
+            m_state                  = other.m_state;
+            m_future_retrieved       = other.m_future_retrieved;
+            other.m_state            = nullptr;
+            other.m_future_retrieved = false;
+          }
+          return *this;
+        }
+
+        void swap(promise_base& other)
+        {
+          rsl::swap(m_state, other.m_state);
+          rsl::swap(m_future_retrieved, other.m_future_retrieved);
+        }
+
+        // returns the future sharing the state of this promise, can only be called once
+        future<R> get_future()
+        {
+          RSL_ASSERT_X(m_state != nullptr, "calling get_future on a promise without a state");
+          RSL_ASSERT_X(!m_future_retrieved, "the future of a promise can only be retrieved once");
+          m_future_retrieved = true;
+          m_state->add_ref();
+          return future<R>(m_state);
+        }
+
+      protected:
+        future_shared_state<R>* state()
+        {
+          RSL_ASSERT_X(m_state != nullptr, "setting the value of a promise without a state");
+          return m_state;
+        }
+
+      private:
+        template <typename Alloc>
+        static future_shared_state<R>* create_state(const Alloc& alloc)
+        {
+          using state_type = promise_shared_state<R, Alloc>;
+          Alloc state_alloc(alloc);
+          return rsl::construct_at(static_cast<state_type*>(state_alloc.allocate(sizeof(state_type))), alloc);
+        }
+
+        void abandon()
+        {
+          if(m_state != nullptr)
+          {
+            // the promise is the only one making the state ready, so nobody can race us here
+            if(!m_state->is_ready())
+            {
+              m_state->mark_broken();
+            }
+            m_state->release();
+            m_state = nullptr;
+          }
+        }
+
+      private:
+        future_shared_state<R>* m_state;
+        bool m_future_retrieved;
+      };
+    } // namespace internal
+
+    /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Oct/2023)
+    // rsl doesn't use exceptions, there's no set_exception.
+    // setting a value makes the futures ready immediately, there's no set_value_at_thread_exit
+    template <typename R>
+    class promise : public internal::promise_base<R>
+    {
+    public:
+      promise()
+          : internal::promise_base<R>(rsl::allocator_arg, rsl::allocator())
+      {
+      }
+      template <typename Alloc>
+      promise(allocator_arg_t tag, const Alloc& alloc)
+          : internal::promise_base<R>(tag, alloc)
+      {
+      }
+
+      void set_value(const R& value)
+      {
+        this->state()->set_value(value);
+      }
+      void set_value(R&& value)
+      {
+        this->state()->set_value(rsl::move(value));
+      }
+    };
+
+    // the future refers to the value passed to set_value, which has to outlive it
+    template <typename R>
+    class promise<R&> : public internal::promise_base<R&>
+    {
+    public:
+      promise()
+          : internal::promise_base<R&>(rsl::allocator_arg, rsl::allocator())
+      {
+      }
+      template <typename Alloc>
+      promise(allocator_arg_t tag, const Alloc& alloc)
+          : internal::promise_base<R&>(tag, alloc)
+      {
+      }
+
+      void set_value(R& value)
+      {
+        this->state()->set_value(value);
+      }
+    };
+
+    template <>
+    class promise<void> : public internal::promise_base<void>
+    {
+    public:
+      promise()
+          : internal::promise_base<void>(rsl::allocator_arg, rsl::allocator())
+      {
+      }
+      template <typename Alloc>
+      promise(allocator_arg_t tag, const Alloc& alloc)
+          : internal::promise_base<void>(tag, alloc)
+      {
+      }
+
+      void set_value()
+      {
+        this->state()->set_value();
+      }
+    };
+
+    template <typename R>
+    void swap(promise<R>& lhs, promise<R>& rhs)
+    {
+      lhs.swap(rhs);
+    }
+
+    template <typename R, typename Alloc>
+    struct uses_allocator<promise<R>, Alloc> : true_type
+    {
+    };
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,106 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: when_all.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// https://en.cppreference.com/w/cpp/experimental/when_all
+//
+// Returns a future that becomes ready once all given futures are ready.
+// No thread blocks while waiting, the last future becoming ready completes it.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/atomic/atomic.h"
+#include "rex_std/internal/future/future.h"
+#include "rex_std/internal/future/future_sequence.h"
+#include "rex_std/internal/iterator/iterator_traits.h"
+#include "rex_std/internal/type_traits/conjunction.h"
+#include "rex_std/internal/type_traits/decay.h"
+#include "rex_std/internal/type_traits/enable_if.h"
+#include "rex_std/internal/utility/forward.h"
+#include "rex_std/internal/utility/move.h"
+#include "rex_std/tuple.h"
+#include "rex_std/vector.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      template <typename Sequence>
+      class when_all_state : public when_state<when_all_state<Sequence>, Sequence, Sequence>
+      {
+      public:
+        explicit when_all_state(Sequence&& futures)
+            : when_state<when_all_state<Sequence>, Sequence, Sequence>(rsl::move(futures))
+            , m_remaining(0)
+        {
+          // one reference for the returned future, one until all futures are ready
+          this->add_ref();
+          // attaching the nodes counts as one more future, so we can't complete while still attaching
+          m_remaining.store(this->num_nodes() + 1, rsl::memory_order_relaxed);
+        }
+
+        void start()
+        {
+          this->attach_nodes();
+          on_ready(0);
+        }
+
+        void on_ready(card64 /*index*/)
+        {
+          if(m_remaining.fetch_sub(1, rsl::memory_order_acq_rel) == 1)
+          {
+            this->set_value(this->take_futures());
+            this->release();
+          }
+        }
+
+      private:
+        rsl::atomic<card64> m_remaining;
+      };
+
+      template <typename Sequence>
+      future<Sequence> make_when_all(Sequence&& futures)
+      {
+        when_all_state<Sequence>* state = when_all_state<Sequence>::create(rsl::move(futures));
+        future<Sequence> result(state);
+        state->start();
+        return result;
+      }
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // returns a future to all futures in [first, last) once they're all ready.
+    // futures are moved out of the range, shared futures are copied
+    template <typename InputIterator>
+    future<rsl::vector<typename rsl::iterator_traits<InputIterator>::value_type>> when_all(InputIterator first, InputIterator last)
+    {
+      rsl::vector<typename rsl::iterator_traits<InputIterator>::value_type> futures;
+      for(; first != last; ++first)
+      {
+        futures.push_back(internal::take_future(*first));
+      }
+      return internal::make_when_all(rsl::move(futures));
+    }
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // returns a future to all given futures once they're all ready
+    template <typename... Futures, enable_if_t<conjunction_v<internal::is_future<rsl::decay_t<Futures>>...>, bool> = true>
+    future<rsl::tuple<rsl::decay_t<Futures>...>> when_all(Futures&&... futures)
+    {
+      return internal::make_when_all(rsl::tuple<rsl::decay_t<Futures>...>(rsl::forward<Futures>(futures)...));
+    }
+  } // namespace v1
+} // namespace rsl
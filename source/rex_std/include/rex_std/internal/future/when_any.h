@@ -0,0 +1,125 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: when_any.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// https://en.cppreference.com/w/cpp/experimental/when_any
+//
+// Returns a future that becomes ready once any of the given futures is ready.
+// No thread blocks while waiting, the first future becoming ready completes it.
+// The other futures keep a reference to the when_any state until they're ready.
+//-----------------------------------------------------------------------------
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/atomic/atomic.h"
+#include "rex_std/internal/future/future.h"
+#include "rex_std/internal/future/future_sequence.h"
+#include "rex_std/internal/iterator/iterator_traits.h"
+#include "rex_std/internal/type_traits/conjunction.h"
+#include "rex_std/internal/type_traits/decay.h"
+#include "rex_std/internal/type_traits/enable_if.h"
+#include "rex_std/internal/utility/forward.h"
+#include "rex_std/internal/utility/move.h"
+#include "rex_std/tuple.h"
+#include "rex_std/vector.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // index is the index of the future that became ready first, all futures are passed back
+    template <typename Sequence>
+    struct when_any_result
+    {
+      size_t index;
+      Sequence futures;
+    };
+
+    namespace internal
+    {
+      // the index of a when_any without any futures
+      inline constexpr size_t g_when_any_no_index = static_cast<size_t>(-1);
+
+      template <typename Sequence>
+      class when_any_state : public when_state<when_any_state<Sequence>, when_any_result<Sequence>, Sequence>
+      {
+      public:
+        explicit when_any_state(Sequence&& futures)
+            : when_state<when_any_state<Sequence>, when_any_result<Sequence>, Sequence>(rsl::move(futures))
+            , m_done(false)
+        {
+          // one reference for the returned future, one for every node until it ran
+          for(card64 i = 0; i < this->num_nodes(); ++i)
+          {
+            this->add_ref();
+          }
+        }
+
+        void start()
+        {
+          if(this->num_nodes() == 0)
+          {
+            this->set_value(when_any_result<Sequence> {g_when_any_no_index, this->take_futures()});
+            return;
+          }
+
+          this->attach_nodes();
+        }
+
+        void on_ready(card64 index)
+        {
+          if(!m_done.exchange(true, rsl::memory_order_acq_rel))
+          {
+            this->set_value(when_any_result<Sequence> {static_cast<size_t>(index), this->take_futures()});
+          }
+          this->release();
+        }
+
+      private:
+        rsl::atomic<bool> m_done;
+      };
+
+      template <typename Sequence>
+      future<when_any_result<Sequence>> make_when_any(Sequence&& futures)
+      {
+        when_any_state<Sequence>* state = when_any_state<Sequence>::create(rsl::move(futures));
+        future<when_any_result<Sequence>> result(state);
+        state->start();
+        return result;
+      }
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // returns a future to all futures in [first, last) once one of them is ready.
+    // futures are moved out of the range, shared futures are copied
+    template <typename InputIterator>
+    future<when_any_result<rsl::vector<typename rsl::iterator_traits<InputIterator>::value_type>>> when_any(InputIterator first, InputIterator last)
+    {
+      rsl::vector<typename rsl::iterator_traits<InputIterator>::value_type> futures;
+      for(; first != last; ++first)
+      {
+        futures.push_back(internal::take_future(*first));
+      }
+      return internal::make_when_any(rsl::move(futures));
+    }
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // returns a future to all given futures once one of them is ready
+    template <typename... Futures, enable_if_t<conjunction_v<internal::is_future<rsl::decay_t<Futures>>...>, bool> = true>
+    future<when_any_result<rsl::tuple<rsl::decay_t<Futures>...>>> when_any(Futures&&... futures)
+    {
+      return internal::make_when_any(rsl::tuple<rsl::decay_t<Futures>...>(rsl::forward<Futures>(futures)...));
+    }
+  } // namespace v1
+} // namespace rsl
@@ -47,7 +47,12 @@ namespace rsl
         in     = (1 << 2), // open for reading
         out    = (1 << 3), // open for writing
         trunc  = (1 << 4), // discard the contents of the stream when opening
-        ate    = (1 << 5)  // seek to the end of stream immediately after open
+        ate    = (1 << 5), // seek to the end of stream immediately after open
+
+        /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+        // bypass the page cache of the OS, only supported by file streams on Linux.
+        // useful for big files that are read or written once, as they'd otherwise evict everything else from the cache
+        direct = (1 << 6)
       };
 
       enum class iostate : uint32
@@ -59,6 +64,15 @@ namespace rsl
         noinitbit = (1 << 3)  // the stream is not yet initialized /// RSL Comment: Not in ISO C++ Standard at time of writing (09/Sep/2022)
       };
 
+      /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Oct/2023)
+      // Rex Standard Library doesn't format through stream flags, so only the flags
+      // that change the buffering of a stream are provided.
+      enum class fmtflags : uint32
+      {
+        none    = 0,
+        unitbuf = (1 << 0) // flush the output after every output operation
+      };
+
       enum class seekdir
       {
         beg, // the beginning of a stream
@@ -70,6 +84,7 @@ namespace rsl
       {
         using openmode_int = rsl::underlying_type_t<openmode>;
         using iostate_int  = rsl::underlying_type_t<iostate>;
+        using fmtflags_int = rsl::underlying_type_t<fmtflags>;
       } // namespace internal
 
       constexpr openmode operator&(openmode lhs, openmode rhs)
@@ -127,6 +142,26 @@ namespace rsl
         return static_cast<iostate>(~state_int);
       }
 
+      constexpr fmtflags operator&(fmtflags lhs, fmtflags rhs)
+      {
+        const internal::fmtflags_int lhs_int = static_cast<internal::fmtflags_int>(lhs);
+        const internal::fmtflags_int rhs_int = static_cast<internal::fmtflags_int>(rhs);
+
+        return static_cast<fmtflags>(lhs_int & rhs_int);
+      }
+      constexpr fmtflags operator|(fmtflags lhs, fmtflags rhs)
+      {
+        const internal::fmtflags_int lhs_int = static_cast<internal::fmtflags_int>(lhs);
+        const internal::fmtflags_int rhs_int = static_cast<internal::fmtflags_int>(rhs);
+
+        return static_cast<fmtflags>(lhs_int | rhs_int);
+      }
+      constexpr fmtflags operator~(fmtflags flags)
+      {
+        const internal::fmtflags_int flags_int = static_cast<internal::fmtflags_int>(flags);
+        return static_cast<fmtflags>(~flags_int);
+      }
+
     } // namespace io
 
     class ios_base
@@ -141,9 +176,35 @@ namespace rsl
       // you can't assign to an ios_base object
       ios_base& operator=(const ios_base&) = delete;
 
-      /// [09/Sep/2022] RSL Comment: Rex Standard Library ios_base provides no implemented member functions.
+      /// [09/Sep/2022] RSL Comment: Rex Standard Library ios_base provides almost no implemented member functions.
       // This is because Rex Standard Library doesn't provide locales, nor does it allow the user
       // to config global objects like rsl::cout with formatting rules.
+      // The only flags supported are the ones controlling when a stream is flushed.
+
+      // returns the current flags
+      io::fmtflags flags() const
+      {
+        return m_flags;
+      }
+      // replaces the current flags with the given ones, returns the flags before the call
+      io::fmtflags flags(io::fmtflags flags)
+      {
+        const io::fmtflags old = m_flags;
+        m_flags                = flags;
+        return old;
+      }
+      // sets the given flags, returns the flags before the call
+      io::fmtflags setf(io::fmtflags flags)
+      {
+        const io::fmtflags old = m_flags;
+        m_flags                = m_flags | flags;
+        return old;
+      }
+      // clears the given flags
+      void unsetf(io::fmtflags flags)
+      {
+        m_flags = m_flags & ~flags;
+      }
 
       /// [09/Sep/2022] RSL Comment: Because Rex Standard Library wants to break the dependency on C.
       // it makes little sense of having sync_with_stdio as a member function.
@@ -153,6 +214,9 @@ namespace rsl
       // the derived class must call basic_ios::init() to complete initialization
       // before first use and before destructor
       ios_base() = default;
+
+    private:
+      io::fmtflags m_flags = io::fmtflags::none;
     };
   } // namespace v1
 } // namespace rsl
@@ -642,8 +642,8 @@ namespace rsl
       }
 
       static constexpr bool is_modulo = true;
-      static constexpr int32 digits   = 16;
-      static constexpr int32 digits10 = 4;
+      static constexpr int32 digits   = sizeof(wchar_t) == 2 ? 16 : 32;
+      static constexpr int32 digits10 = sizeof(wchar_t) == 2 ? 4 : 9;
     };
 
     // CLASS numeric_limits<short>
@@ -763,12 +763,26 @@ namespace rsl
     public:
       RSL_NO_DISCARD static constexpr long(min)() noexcept
       {
-        return limits_32bit::signed_min;
+        if constexpr(sizeof(long) == 4)
+        {
+          return limits_32bit::signed_min;
+        }
+        else
+        {
+          return limits_64bit::signed_min;
+        }
       }
 
       RSL_NO_DISCARD static constexpr long(max)() noexcept
       {
-        return limits_32bit::signed_max;
+        if constexpr(sizeof(long) == 4)
+        {
+          return limits_32bit::signed_max;
+        }
+        else
+        {
+          return limits_64bit::signed_max;
+        }
       }
 
       RSL_NO_DISCARD static constexpr long lowest() noexcept
@@ -806,10 +820,10 @@ namespace rsl
         return 0;
       }
 
-      static_assert(sizeof(int32) == sizeof(long), "LongLP64 assumption");
+      // long is 4 bytes on Windows and 8 bytes on Linux and macOS
       static constexpr bool is_signed = true;
-      static constexpr int32 digits   = 31;
-      static constexpr int32 digits10 = 9;
+      static constexpr int32 digits   = sizeof(long) == 4 ? 31 : 63;
+      static constexpr int32 digits10 = sizeof(long) == 4 ? 9 : 18;
     };
 
     // CLASS numeric_limits<long long>
@@ -991,7 +1005,14 @@ namespace rsl
 
       RSL_NO_DISCARD static constexpr unsigned long(max)() noexcept
       {
-        return limits_32bit::unsigned_max;
+        if constexpr(sizeof(unsigned long) == 4)
+        {
+          return limits_32bit::unsigned_max;
+        }
+        else
+        {
+          return limits_64bit::unsigned_max;
+        }
       }
 
       RSL_NO_DISCARD static constexpr unsigned long lowest() noexcept
@@ -1029,10 +1050,9 @@ namespace rsl
         return 0;
       }
 
-      static_assert(sizeof(uint32) == sizeof(unsigned long), "LongLP64 assumption");
       static constexpr bool is_modulo = true;
-      static constexpr int32 digits   = 32;
-      static constexpr int32 digits10 = 9;
+      static constexpr int32 digits   = sizeof(unsigned long) == 4 ? 32 : 64;
+      static constexpr int32 digits10 = sizeof(unsigned long) == 4 ? 9 : 19;
     };
 
     // CLASS numeric_limits<unsigned long long>
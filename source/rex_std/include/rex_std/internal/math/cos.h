@@ -14,6 +14,7 @@
 
 #include "rex_std/bonus/math/return_type.h"
 #include "rex_std/internal/math/is_nan.h"
+#include "rex_std/internal/type_traits/is_constant_evaluated.h"
 #include "rex_std/limits.h"
 #include "rex_std/numbers.h"
 
@@ -49,18 +50,32 @@ namespace rsl
                 cos_compute(tan(x / T(2)))); // NOLINT(google-readability-casting)
       }
 
+      // Shares its range reduction and polynomials with sin_runtime.
+      // float64 is below 1 ulp, float32 below 0.51 ulp.
+      float32 cos_runtime(float32 x);
+      float64 cos_runtime(float64 x);
+
     } // namespace internal
 
     /**
-     * Compile-time cosine function
+     * Cosine function
      *
      * @param x a real-valued input.
-     * @return the cosine function using \f[ \cos(x) = \frac{1-\tan^2(x/2)}{1+\tan^2(x/2)} \f]
+     * @return the cosine function using \f[ \cos(x) = \frac{1-\tan^2(x/2)}{1+\tan^2(x/2)} \f] at compile time.
+     * At runtime, float32 and float64 use the polynomial kernels of cos_runtime instead.
      */
 
     template <typename T>
     constexpr return_t<T> cos(const T x)
     {
+      if constexpr(internal::has_runtime_math_v<return_t<T>>)
+      {
+        if(!rsl::is_constant_evaluated())
+        {
+          return internal::cos_runtime(static_cast<return_t<T>>(x));
+        }
+      }
+
       return internal::cos_check(static_cast<return_t<T>>(x));
     }
 
@@ -12,7 +12,11 @@
 
 #pragma once
 
-#include "rex_std/internal/math/pow.h"
+#include "rex_std/bonus/math/return_type.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/math/is_nan.h"
+#include "rex_std/internal/type_traits/is_constant_evaluated.h"
+#include "rex_std/limits.h"
 #include "rex_std/numbers.h"
 
 namespace rsl
@@ -20,10 +24,98 @@ namespace rsl
   inline namespace v1
   {
 
-    constexpr float32 exp(const card32 exp)
+    namespace internal
     {
-      return pow(e, exp);
+      // exp(r) for |r| <= ln(2) / 2, where 18 terms of the series are enough for float64.
+      // They're summed from the smallest term up, which loses the least precision
+      constexpr float64 exp_series(const float64 r)
+      {
+        float64 sum = 1.0;
+        for(card32 n = 18; n > 0; --n)
+        {
+          sum = 1.0 + sum * r / static_cast<float64>(n);
+        }
+        return sum;
+      }
+
+      // 2^k, calculated exactly as long as it's a normal float64
+      constexpr float64 exp2_int(const int64 k)
+      {
+        const float64 factor = k < 0 ? 0.5 : 2.0;
+        const int64 count    = k < 0 ? -k : k;
+        float64 res          = 1.0;
+        for(int64 i = 0; i < count; ++i)
+        {
+          res *= factor;
+        }
+        return res;
+      }
+
+      template <typename T>
+      constexpr T exp_check(const T x)
+      {
+        if(is_nan(x))
+        {
+          return numeric_limits<T>::quiet_nan();
+        }
+
+        // past these, the result is inf or 0 anyway and we'd loop for very long below.
+        // this also takes care of inf and -inf
+        const T scaled = x * static_cast<T>(rsl::log2e_v<lfloat64>);
+        if(scaled > static_cast<T>(numeric_limits<T>::max_exponent))
+        {
+          return numeric_limits<T>::infinity();
+        }
+        if(scaled < static_cast<T>(numeric_limits<T>::min_exponent - numeric_limits<T>::digits - 1))
+        {
+          return T(0);
+        }
+
+        // split x in k * ln(2) + r, so exp(x) = 2^k * exp(r).
+        // ln(2) is split up as well, so k * ln2_hi is exact and r doesn't lose precision
+        constexpr float64 ln2_hi = 6.93147180369123816490e-01;
+        constexpr float64 ln2_lo = 1.90821492927058770002e-10;
+        const int64 k            = static_cast<int64>(scaled + (scaled < T(0) ? T(-0.5) : T(0.5))); // NOLINT(google-readability-casting)
+        const float64 r          = (static_cast<float64>(x) - static_cast<float64>(k) * ln2_hi) - static_cast<float64>(k) * ln2_lo;
+
+        // 2^k is applied in 2 halves, as 2^k itself doesn't have to fit in a float64.
+        // the first multiplication is exact, so the result is only rounded once
+        const float64 half = exp2_int(k / 2);
+        return static_cast<T>(exp_series(r) * half * exp2_int(k - k / 2));
+      }
+
+      // Range reduction to [-ln(2)/2, ln(2)/2] followed by a polynomial.
+      // float64 is below 1 ulp, float32 below 0.54 ulp.
+      float32 exp_runtime(float32 x);
+      float64 exp_runtime(float64 x);
+    } // namespace internal
+
+    /**
+     * Exponential function
+     *
+     * @param x a real-valued input.
+     * @return \f$ e^x \f$, using a Taylor series after splitting off the powers of 2 at compile time.
+     * At runtime, float32 and float64 use the polynomial kernels of exp_runtime instead.
+     */
+
+    template <typename T>
+    constexpr return_t<T> exp(const T x)
+    {
+      if constexpr(internal::has_runtime_math_v<return_t<T>>)
+      {
+        if(!rsl::is_constant_evaluated())
+        {
+          return internal::exp_runtime(static_cast<return_t<T>>(x));
+        }
+      }
+
+      return internal::exp_check(static_cast<return_t<T>>(x));
     }
 
+    // Computes the exponential of count values from src into dst, which may point to the same buffer.
+    // The results are the same as calling rsl::exp on every value, but the common case is vectorized.
+    void exp_n(const float32* src, float32* dst, count_t count);
+    void exp_n(const float64* src, float64* dst, count_t count);
+
   } // namespace v1
 } // namespace rsl
@@ -0,0 +1,108 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: log.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/math/return_type.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/math/is_nan.h"
+#include "rex_std/internal/type_traits/is_constant_evaluated.h"
+#include "rex_std/limits.h"
+#include "rex_std/numbers.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+
+    namespace internal
+    {
+      // log(m) for m in [sqrt(2)/2, sqrt(2)], using log(m) = 2 * atanh(s) with s = (m - 1) / (m + 1).
+      // |s| is below 0.18 there so the series converges quickly
+      template <typename T>
+      constexpr T log_series(const T m)
+      {
+        const T s  = (m - T(1)) / (m + T(1));
+        const T s2 = s * s;
+        T sum      = T(0);
+        T power    = s;
+        for(card32 n = 1; power > numeric_limits<T>::epsilon() || power < -numeric_limits<T>::epsilon(); n += 2)
+        {
+          sum += power / static_cast<T>(n);
+          power *= s2;
+        }
+        return T(2) * sum;
+      }
+
+      template <typename T>
+      constexpr T log_check(const T x)
+      {
+        if(is_nan(x) || x < T(0))
+        {
+          return numeric_limits<T>::quiet_nan();
+        }
+        if(x == T(0))
+        {
+          return -numeric_limits<T>::infinity();
+        }
+        if(x == numeric_limits<T>::infinity())
+        {
+          return x;
+        }
+
+        // split x in 2^k * m, so log(x) = k * ln(2) + log(m)
+        T m     = x;
+        int32 k = 0;
+        while(m > static_cast<T>(rsl::sqrt2_v<lfloat64>))
+        {
+          m /= T(2);
+          ++k;
+        }
+        while(m < static_cast<T>(rsl::sqrt2_v<lfloat64>) / T(2))
+        {
+          m *= T(2);
+          --k;
+        }
+
+        return static_cast<T>(k) * static_cast<T>(rsl::ln2_v<lfloat64>) + log_series(m);
+      }
+
+      // Minimax polynomial in f / (2 + f), after splitting x in 2^k * (1 + f).
+      // float64 is below 1 ulp, float32 below 0.51 ulp.
+      float32 log_runtime(float32 x);
+      float64 log_runtime(float64 x);
+    } // namespace internal
+
+    /**
+     * Natural logarithm function
+     *
+     * @param x a real-valued input.
+     * @return \f$ \ln(x) \f$, using the series of atanh after splitting off the powers of 2 at compile time.
+     * At runtime, float32 and float64 use the polynomial kernel of log_runtime instead.
+     */
+
+    template <typename T>
+    constexpr return_t<T> log(const T x)
+    {
+      if constexpr(internal::has_runtime_math_v<return_t<T>>)
+      {
+        if(!rsl::is_constant_evaluated())
+        {
+          return internal::log_runtime(static_cast<return_t<T>>(x));
+        }
+      }
+
+      return internal::log_check(static_cast<return_t<T>>(x));
+    }
+
+  } // namespace v1
+} // namespace rsl
@@ -12,19 +12,52 @@
 
 #pragma once
 
+#include "rex_std/bonus/types.h"
 #include "rex_std/internal/type_traits/is_arithmetic.h"
+#include "rex_std/internal/type_traits/is_constant_evaluated.h"
 
 namespace rsl
 {
   inline namespace v1
   {
 
+    namespace internal
+    {
+      template <typename T>
+      constexpr T pow_recur(const T base, const card32 exp) // NOLINT(misc-no-recursion)
+      {
+        return exp == 0 ? static_cast<T>(1) : base * pow_recur(base, exp - 1);
+      }
+    } // namespace internal
+
     template <typename T>
-    constexpr T pow(const T base, const card32 exp) // NOLINT(misc-no-recursion)
+    constexpr T pow(const T base, const card32 exp)
     {
       static_assert(rsl::is_arithmetic_v<T>, "T must be of an arithmetic type");
 
-      return exp == 0 ? static_cast<T>(1) : base * pow(base, exp - 1);
+      if(rsl::is_constant_evaluated())
+      {
+        return internal::pow_recur(base, exp);
+      }
+
+      // square and multiply at runtime, which needs log2(exp) multiplications instead of exp.
+      // for floating points, this also rounds fewer times
+      T res       = static_cast<T>(1);
+      T square    = base;
+      uint32 bits = static_cast<uint32>(exp);
+      while(bits != 0)
+      {
+        if((bits & 1u) != 0)
+        {
+          res *= square;
+        }
+        bits >>= 1u;
+        if(bits != 0)
+        {
+          square *= square;
+        }
+      }
+      return res;
     }
 
   } // namespace v1
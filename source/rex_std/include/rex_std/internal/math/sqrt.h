@@ -15,6 +15,7 @@
 #include "rex_std/bonus//math/is_posinf.h"
 #include "rex_std/bonus/math/return_type.h"
 #include "rex_std/internal/math/is_nan.h"
+#include "rex_std/internal/type_traits/is_constant_evaluated.h"
 #include "rex_std/limits.h"
 
 namespace rsl
@@ -55,18 +56,31 @@ namespace rsl
                              : mVal * sqrt_recur(x, x / T(2), 0));
       }
 
+      // Uses the sqrt instruction of the cpu, which is correctly rounded.
+      float32 sqrt_runtime(float32 x);
+      float64 sqrt_runtime(float64 x);
+
     } // namespace internal
 
     /**
-     * Compile-time square-root function
+     * Square-root function
      *
      * @param x a real-valued input.
-     * @return Computes \f$ \sqrt{x} \f$ using a Newton-Raphson approach.
+     * @return Computes \f$ \sqrt{x} \f$ using a Newton-Raphson approach at compile time.
+     * At runtime, float32 and float64 use the sqrt instruction of the cpu instead.
      */
 
     template <typename T>
     constexpr return_t<T> sqrt(const T x)
     {
+      if constexpr(internal::has_runtime_math_v<return_t<T>>)
+      {
+        if(!rsl::is_constant_evaluated())
+        {
+          return internal::sqrt_runtime(static_cast<return_t<T>>(x));
+        }
+      }
+
       return internal::sqrt_check(static_cast<return_t<T>>(x), return_t<T>(1));
     }
 
@@ -14,32 +14,49 @@
 
 #include "rex_std/bonus/types.h"
 #include "rex_std/internal/memory/byte.h"
+#include "rex_std/internal/type_traits/is_constant_evaluated.h"
 
 namespace rsl
 {
   inline namespace v1
   {
-    // TODO: are there more performant ways of copying bytes over that is defined behavior?
-    // Maybe cast the memory to int32 or int64, so we can copy over more bytes in 1 go
-    constexpr void* memcpy(void* dst, const void* src, card64 len)
+    namespace internal
     {
-      const rsl::byte* src_byte = static_cast<const rsl::byte*>(src);
-      rsl::byte* dst_byte       = static_cast<rsl::byte*>(dst);
-
-      // Copy contents of src[] to dest[]
-      for(card64 i = 0; i < len; ++i)
+      // the byte at a time copy, this is the only version that can run at compile time
+      constexpr void* memcpy_bytewise(void* dst, const void* src, card64 len)
       {
-        dst_byte[i] = src_byte[i];
+        const rsl::byte* src_byte = static_cast<const rsl::byte*>(src);
+        rsl::byte* dst_byte       = static_cast<rsl::byte*>(dst);
+
+        // Copy contents of src[] to dest[]
+        for(card64 i = 0; i < len; ++i)
+        {
+          dst_byte[i] = src_byte[i];
+
+          // using the following code instead of the above breaks clang when optimizations are enabled
+          // as it can possibly skip a call to memcpy, resulting in bugs that are incredibly hard to track down
+
+          //   *dst_byte = *src_byte;
+          //   ++dst_byte;
+          //   ++src_byte;
+        }
 
-        // using the following code instead of the above breaks clang when optimizations are enabled
-        // as it can possibly skip a call to memcpy, resulting in bugs that are incredibly hard to track down
+        return dst;
+      }
+
+      // copies using words or SIMD registers, depending on what the cpu supports.
+      // the implementation is chosen the first time it's called.
+      void* memcpy_runtime(void* dst, const void* src, card64 len);
+    } // namespace internal
 
-        //   *dst_byte = *src_byte;
-        //   ++dst_byte;
-        //   ++src_byte;
+    constexpr void* memcpy(void* dst, const void* src, card64 len)
+    {
+      if(rsl::is_constant_evaluated())
+      {
+        return internal::memcpy_bytewise(dst, src, len);
       }
 
-      return dst;
+      return internal::memcpy_runtime(dst, src, len);
     }
   } // namespace v1
 } // namespace rsl
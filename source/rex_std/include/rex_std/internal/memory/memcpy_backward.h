@@ -20,14 +20,14 @@ namespace rsl
   inline namespace v1
   {
 
-    constexpr void* memcpy_backward(void* dst, const void* src, card32 len)
+    constexpr void* memcpy_backward(void* dst, const void* src, card64 len)
     {
       byte* dst_byte       = static_cast<byte*>(dst);
       const byte* src_byte = static_cast<const byte*>(src);
 
-      for(card32 i = len - 1; i >= 0; --i)
+      for(card64 i = len; i > 0; --i)
       {
-        dst_byte[i] = src_byte[i];
+        dst_byte[i - 1] = src_byte[i - 1];
       }
       return dst;
     }
@@ -15,27 +15,45 @@
 #include "rex_std/bonus/types.h"
 #include "rex_std/internal/memory/memcpy.h"
 #include "rex_std/internal/memory/memcpy_backward.h"
+#include "rex_std/internal/type_traits/is_constant_evaluated.h"
 
 namespace rsl
 {
   inline namespace v1
   {
-
-    constexpr void* memmove(void* dst, const void* src, card32 len)
+    namespace internal
     {
-      // If the buffers don't overlap, it doesn't matter what direction
-      // we copy in. If they do overlap, we can't copy from front to back
-      // If they overlap and src sits before dst, we need to copy from
-      // back to front
-      // If the destination is below the source, we copy front to back
-      if(src < dst)
+      // the byte at a time move, this is the only version that can run at compile time
+      constexpr void* memmove_bytewise(void* dst, const void* src, card64 len)
       {
-        return memcpy_backward(dst, src, len);
+        // If the buffers don't overlap, it doesn't matter what direction
+        // we copy in. If they do overlap, we can't copy from front to back
+        // If they overlap and src sits before dst, we need to copy from
+        // back to front
+        // If the destination is below the source, we copy front to back
+        if(src < dst)
+        {
+          return memcpy_backward(dst, src, len);
+        }
+        else
+        {
+          return memcpy_bytewise(dst, src, len);
+        }
       }
-      else
+
+      // moves using words or SIMD registers, depending on what the cpu supports.
+      // the implementation is chosen the first time it's called.
+      void* memmove_runtime(void* dst, const void* src, card64 len);
+    } // namespace internal
+
+    constexpr void* memmove(void* dst, const void* src, card64 len)
+    {
+      if(rsl::is_constant_evaluated())
       {
-        return memcpy(dst, src, len);
+        return internal::memmove_bytewise(dst, src, len);
       }
+
+      return internal::memmove_runtime(dst, src, len);
     }
 
   } // namespace v1
@@ -14,20 +14,38 @@
 
 #include "rex_std/bonus/types.h"
 #include "rex_std/internal/memory/byte.h"
+#include "rex_std/internal/type_traits/is_constant_evaluated.h"
 
 namespace rsl
 {
   inline namespace v1
   {
+    namespace internal
+    {
+      // the byte at a time fill, this is the only version that can run at compile time
+      constexpr void* memset_bytewise(void* dest, char val, card64 len)
+      {
+        rsl::byte* dest_b = static_cast<byte*>(dest);
+        while(len-- > 0)
+        {
+          *dest_b++ = static_cast<byte>(val);
+        }
+        return dest;
+      }
+
+      // fills using words or SIMD registers, depending on what the cpu supports.
+      // the implementation is chosen the first time it's called.
+      void* memset_runtime(void* dest, char val, card64 len);
+    } // namespace internal
 
     constexpr void* memset(void* dest, char val, card64 len)
     {
-      rsl::byte* dest_b = static_cast<byte*>(dest);
-      while (len-- > 0)
+      if(rsl::is_constant_evaluated())
       {
-        *dest_b++ = static_cast<byte>(val);
+        return internal::memset_bytewise(dest, val, len);
       }
-      return dest;
+
+      return internal::memset_runtime(dest, val, len);
     }
 
   } // namespace v1
@@ -26,6 +26,7 @@
 #include "rex_std/internal/type_traits/is_move_constructible.h"
 #include "rex_std/internal/type_traits/is_pointer.h"
 #include "rex_std/internal/type_traits/is_reference.h"
+#include "rex_std/internal/type_traits/is_trivially_relocatable.h"
 #include "rex_std/internal/type_traits/negation.h"
 #include "rex_std/internal/type_traits/remove_reference.h"
 #include "rex_std/internal/utility/exchange.h"
@@ -387,5 +388,12 @@ namespace rsl
       }
     };
 
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // a unique_ptr only holds its pointer and its deleter, so it can be memcpy'd if they can
+    template <typename T, typename D>
+    struct is_trivially_relocatable<unique_ptr<T, D>> : bool_constant<is_trivially_relocatable_v<typename unique_ptr<T, D>::pointer> && is_trivially_relocatable_v<D>>
+    {
+    };
+
   } // namespace v1
 } // namespace rsl
@@ -0,0 +1,85 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: memory_resource.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/attributes.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/stddef.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace pmr
+    {
+      // the alignment used when no alignment is specified
+      inline constexpr size_t g_default_memory_resource_alignment = alignof(rsl::max_align);
+
+      // an abstract interface to an unbounded set of classes encapsulating memory resources
+      class memory_resource
+      {
+      public:
+        memory_resource()                                  = default;
+        memory_resource(const memory_resource&)            = default;
+        memory_resource& operator=(const memory_resource&) = default;
+
+        virtual ~memory_resource() = default;
+
+        // allocates storage with a size of at least bytes bytes, aligned to the specified alignment
+        RSL_NO_DISCARD void* allocate(size_t bytes, size_t alignment = g_default_memory_resource_alignment)
+        {
+          return do_allocate(bytes, alignment);
+        }
+        // deallocates the storage pointed to by p.
+        // p must have been returned by a prior call to allocate(bytes, alignment) on a memory_resource
+        // that compares equal to this
+        void deallocate(void* p, size_t bytes, size_t alignment = g_default_memory_resource_alignment)
+        {
+          do_deallocate(p, bytes, alignment);
+        }
+        // compares this for equality with other.
+        // 2 memory resources compare equal if and only if memory allocated from one can be deallocated from the other
+        bool is_equal(const memory_resource& other) const
+        {
+          return do_is_equal(other);
+        }
+
+      private:
+        virtual void* do_allocate(size_t bytes, size_t alignment)           = 0;
+        virtual void do_deallocate(void* p, size_t bytes, size_t alignment) = 0;
+        virtual bool do_is_equal(const memory_resource& other) const        = 0;
+      };
+
+      inline bool operator==(const memory_resource& lhs, const memory_resource& rhs)
+      {
+        return &lhs == &rhs || lhs.is_equal(rhs);
+      }
+      inline bool operator!=(const memory_resource& lhs, const memory_resource& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      // returns a memory resource that uses the global operator new and operator delete
+      memory_resource* new_delete_resource();
+      /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Oct/2023)
+      // the standard throws bad_alloc when allocating from this resource, rsl asserts and returns nullptr
+      // returns a memory resource that fails every allocation
+      memory_resource* null_memory_resource();
+      // sets the default memory resource, returns the previous one.
+      // if r is nullptr, the default resource is reset to new_delete_resource()
+      memory_resource* set_default_resource(memory_resource* r);
+      // returns the default memory resource, used by default constructed polymorphic allocators
+      memory_resource* get_default_resource();
+    } // namespace pmr
+  }   // namespace v1
+} // namespace rsl
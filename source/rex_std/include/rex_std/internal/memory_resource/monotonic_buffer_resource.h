@@ -0,0 +1,87 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: monotonic_buffer_resource.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/memory_resource/memory_resource.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace pmr
+    {
+      // a special purpose memory resource that only releases the allocated memory when the resource is destroyed.
+      // allocating is bumping a pointer and deallocating does nothing,
+      // which makes it ideal for frame or request scoped containers.
+      // when the current buffer runs out, a new one is allocated from the upstream resource,
+      // every new buffer is bigger than the previous one.
+      // this resource is not thread safe.
+      class monotonic_buffer_resource : public memory_resource
+      {
+      public:
+        monotonic_buffer_resource();
+        explicit monotonic_buffer_resource(memory_resource* upstream);
+        explicit monotonic_buffer_resource(size_t initialSize);
+        monotonic_buffer_resource(size_t initialSize, memory_resource* upstream);
+        // the first allocations use the given buffer, this buffer is never freed by the resource
+        monotonic_buffer_resource(void* buffer, size_t bufferSize);
+        monotonic_buffer_resource(void* buffer, size_t bufferSize, memory_resource* upstream);
+
+        monotonic_buffer_resource(const monotonic_buffer_resource&) = delete;
+        monotonic_buffer_resource(monotonic_buffer_resource&&)      = delete;
+
+        ~monotonic_buffer_resource() override;
+
+        monotonic_buffer_resource& operator=(const monotonic_buffer_resource&) = delete;
+        monotonic_buffer_resource& operator=(monotonic_buffer_resource&&)      = delete;
+
+        // releases all memory allocated from the upstream resource.
+        // if an initial buffer was provided, allocations start from the beginning of it again.
+        void release();
+        // returns the resource the buffers get allocated from
+        memory_resource* upstream_resource() const;
+
+      private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const memory_resource& other) const override;
+
+        // allocates a buffer from upstream big enough to hold bytes with the given alignment
+        void allocate_buffer(size_t bytes, size_t alignment);
+
+      private:
+        struct buffer_header
+        {
+          buffer_header* next;
+          size_t size;
+          size_t alignment;
+        };
+
+        memory_resource* m_upstream;
+        // the initial buffer, provided by the user
+        void* m_initial_buffer;
+        size_t m_initial_buffer_size;
+        // the part of the current buffer that's not been handed out yet
+        char8* m_current;
+        size_t m_space_available;
+        // the size of the next buffer allocated from upstream
+        size_t m_next_buffer_size;
+        // the size of the first buffer allocated from upstream, restored on release
+        size_t m_first_buffer_size;
+        // the buffers allocated from upstream
+        buffer_header* m_buffers;
+      };
+    } // namespace pmr
+  }   // namespace v1
+} // namespace rsl
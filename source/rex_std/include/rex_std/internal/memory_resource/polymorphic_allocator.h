@@ -0,0 +1,130 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: polymorphic_allocator.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/attributes.h"
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/memory_resource/memory_resource.h"
+#include "rex_std/internal/utility/forward.h"
+#include "rex_std/limits.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace pmr
+    {
+      /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Oct/2023)
+      // like rsl::allocator, this allocator is not type based and allocates in number of bytes.
+      // this means it can be passed to any rsl container as is
+      // eg. rsl::vector<int, rsl::pmr::polymorphic_allocator>
+      //
+      // all allocations are forwarded to the memory resource the allocator got constructed with.
+      // the allocator doesn't own the resource, the resource has to outlive every container using it.
+      class polymorphic_allocator
+      {
+      public:
+        using size_type       = size_t;
+        using difference_type = ptrdiff;
+
+        // constructs an allocator using the default memory resource
+        polymorphic_allocator()
+            : m_resource(get_default_resource())
+        {
+        }
+        // constructs an allocator using r as its memory resource
+        polymorphic_allocator(memory_resource* r) // NOLINT(google-explicit-constructor)
+            : m_resource(r)
+        {
+        }
+        polymorphic_allocator(const polymorphic_allocator&) = default;
+        polymorphic_allocator(polymorphic_allocator&&)      = default;
+
+        ~polymorphic_allocator() = default;
+
+        /// RSL Comment: Different from ISO C++ Standard at time of writing (17/Oct/2023)
+        // the standard deletes the assignment operators, as the allocator doesn't propagate.
+        // rsl containers assign their allocator when they're assigned, so this is allowed here
+        polymorphic_allocator& operator=(const polymorphic_allocator&) = default;
+        polymorphic_allocator& operator=(polymorphic_allocator&&)      = default;
+
+        // allocates count bytes of uninitialized storage from the memory resource
+        RSL_NO_DISCARD void* allocate(const size_type count)
+        {
+          return m_resource->allocate(count, g_default_memory_resource_alignment);
+        }
+        // deallocates the storage reference by the pointer p.
+        // the pointer must be obtained by an earlier call to allocate
+        // performed by this allocator or an allocator that's equal to this.
+        void deallocate(void* const ptr, size_type count)
+        {
+          // like operator delete, freeing a nullptr does nothing
+          if(ptr == nullptr)
+          {
+            return;
+          }
+          m_resource->deallocate(ptr, count, g_default_memory_resource_alignment);
+        }
+
+        // allocates bytes bytes of uninitialized storage with the given alignment
+        RSL_NO_DISCARD void* allocate_bytes(size_type bytes, size_type alignment = g_default_memory_resource_alignment)
+        {
+          return m_resource->allocate(bytes, alignment);
+        }
+        // deallocates storage allocated with allocate_bytes
+        void deallocate_bytes(void* p, size_type bytes, size_type alignment = g_default_memory_resource_alignment)
+        {
+          m_resource->deallocate(p, bytes, alignment);
+        }
+
+        // returns the maximum theoretically possible value of n for,
+        // for which all calls to allocate(n) could succeed.
+        size_type max_size() const // NOLINT(readability-convert-member-functions-to-static)
+        {
+          return (rsl::numeric_limits<size_type>::max)();
+        }
+
+        // construct an object of type T in allocated uninitialized storage pointer to by p
+        template <typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+          new(static_cast<void*>(p)) U(rsl::forward<Args>(args)...);
+        }
+        // calls the destructor of the object pointed to by p
+        template <typename U>
+        void destroy(U* p)
+        {
+          p->~U();
+        }
+
+        // returns the memory resource used by this allocator
+        memory_resource* resource() const
+        {
+          return m_resource;
+        }
+
+        bool operator==(const polymorphic_allocator& other) const
+        {
+          return *m_resource == *other.m_resource;
+        }
+        bool operator!=(const polymorphic_allocator& other) const
+        {
+          return !(*this == other);
+        }
+
+      private:
+        memory_resource* m_resource;
+      };
+    } // namespace pmr
+  }   // namespace v1
+} // namespace rsl
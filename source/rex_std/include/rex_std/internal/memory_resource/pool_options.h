@@ -0,0 +1,35 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: pool_options.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace pmr
+    {
+      // the constructor options for the pool resources.
+      // a value of 0 means the implementation's default gets used.
+      struct pool_options
+      {
+        // the maximum number of blocks that will be allocated at once from the upstream memory resource to replenish a pool
+        size_t max_blocks_per_chunk = 0;
+        // the largest allocation size that is handled by a pool,
+        // bigger allocations are passed to the upstream memory resource directly
+        size_t largest_required_pool_block = 0;
+      };
+    } // namespace pmr
+  }   // namespace v1
+} // namespace rsl
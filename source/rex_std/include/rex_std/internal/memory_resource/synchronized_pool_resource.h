@@ -0,0 +1,63 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: synchronized_pool_resource.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/memory_resource/memory_resource.h"
+#include "rex_std/internal/memory_resource/pool_options.h"
+#include "rex_std/internal/memory_resource/unsynchronized_pool_resource.h"
+#include "rex_std/internal/mutex/mutex.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace pmr
+    {
+      // a thread safe version of unsynchronized_pool_resource.
+      // every call is serialized by a mutex
+      class synchronized_pool_resource : public memory_resource
+      {
+      public:
+        synchronized_pool_resource();
+        explicit synchronized_pool_resource(memory_resource* upstream);
+        explicit synchronized_pool_resource(const pool_options& opts);
+        synchronized_pool_resource(const pool_options& opts, memory_resource* upstream);
+
+        synchronized_pool_resource(const synchronized_pool_resource&) = delete;
+        synchronized_pool_resource(synchronized_pool_resource&&)      = delete;
+
+        ~synchronized_pool_resource() override = default;
+
+        synchronized_pool_resource& operator=(const synchronized_pool_resource&) = delete;
+        synchronized_pool_resource& operator=(synchronized_pool_resource&&)      = delete;
+
+        // releases all memory owned by the resource back to upstream
+        void release();
+        // returns the resource the chunks get allocated from
+        memory_resource* upstream_resource() const;
+        // returns the options, with the defaults and limits of the implementation applied
+        pool_options options() const;
+
+      private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const memory_resource& other) const override;
+
+      private:
+        rsl::mutex m_mutex;
+        unsynchronized_pool_resource m_pool;
+      };
+    } // namespace pmr
+  }   // namespace v1
+} // namespace rsl
@@ -0,0 +1,110 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: unsynchronized_pool_resource.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/memory_resource/memory_resource.h"
+#include "rex_std/internal/memory_resource/pool_options.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace pmr
+    {
+      // a general purpose memory resource that owns a pool per block size.
+      // every pool hands out blocks of a fixed size from chunks allocated from the upstream resource,
+      // deallocated blocks go on a free list and get reused by the next allocation of the pool.
+      // block sizes are powers of 2, from 8 bytes up to pool_options::largest_required_pool_block,
+      // allocations bigger than that are passed to the upstream resource directly.
+      // memory is only returned to the upstream resource on release() or when the resource is destroyed.
+      // this resource is not thread safe, see synchronized_pool_resource for a thread safe version.
+      class unsynchronized_pool_resource : public memory_resource
+      {
+      public:
+        unsynchronized_pool_resource();
+        explicit unsynchronized_pool_resource(memory_resource* upstream);
+        explicit unsynchronized_pool_resource(const pool_options& opts);
+        unsynchronized_pool_resource(const pool_options& opts, memory_resource* upstream);
+
+        unsynchronized_pool_resource(const unsynchronized_pool_resource&) = delete;
+        unsynchronized_pool_resource(unsynchronized_pool_resource&&)      = delete;
+
+        ~unsynchronized_pool_resource() override;
+
+        unsynchronized_pool_resource& operator=(const unsynchronized_pool_resource&) = delete;
+        unsynchronized_pool_resource& operator=(unsynchronized_pool_resource&&)      = delete;
+
+        // releases all memory owned by the resource back to upstream
+        void release();
+        // returns the resource the chunks get allocated from
+        memory_resource* upstream_resource() const;
+        // returns the options, with the defaults and limits of the implementation applied
+        pool_options options() const;
+
+      private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const memory_resource& other) const override;
+
+      private:
+        struct free_block
+        {
+          free_block* next;
+        };
+
+        // lives at the end of every chunk, so it doesn't interfere with the alignment of the blocks
+        struct chunk_footer
+        {
+          chunk_footer* next;
+          char8* begin;
+          size_t size;
+        };
+
+        // lives in front of every allocation passed to upstream, so release() can free them
+        struct large_header
+        {
+          large_header* next;
+          large_header* prev;
+          size_t size;
+          size_t alignment;
+        };
+
+        struct pool
+        {
+          free_block* free_list;
+          // the blocks of the newest chunk that haven't been handed out yet
+          char8* unused_begin;
+          char8* unused_end;
+          size_t next_chunk_block_count;
+          chunk_footer* chunks;
+        };
+
+        // 8 bytes up to 1 MiB
+        static constexpr card32 s_max_num_pools = 18;
+
+        card32 pool_index(size_t bytes, size_t alignment) const;
+        void* allocate_from_new_chunk(pool& pool, size_t blockSize);
+        void* allocate_large(size_t bytes, size_t alignment);
+        void deallocate_large(void* p, size_t bytes, size_t alignment);
+
+      private:
+        memory_resource* m_upstream;
+        pool_options m_options;
+        card32 m_num_pools;
+        pool m_pools[s_max_num_pools];
+        large_header* m_large_allocations;
+      };
+    } // namespace pmr
+  }   // namespace v1
+} // namespace rsl
@@ -85,8 +85,8 @@ namespace rsl
         // finalizes the stream object after formatted output
         ~sentry()
         {
-          /// [09/Sep/2022] RSL Comment: Because ios_base doesn't have any flags, this always flushes.
-          if(m_ostream->good())
+          // only flush if requested, the stream buffer decides when to flush otherwise
+          if(m_ostream->good() && (m_ostream->flags() & io::fmtflags::unitbuf) == io::fmtflags::unitbuf)
           {
             // flush the stream
             if(m_ostream->rdbuf()->pubsync() == -1)
@@ -326,7 +326,8 @@ namespace rsl
       // calls func(this). This function is implemented to enable I/O manipulators
       basic_ostream& operator<<(ios_base& (*func)(ios_base&))
       {
-        return func(*this);
+        func(*this);
+        return *this;
       }
       // calls func(this). This function is implemented to enable I/O manipulators
       basic_ostream& operator<<(basic_ios<CharT, Traits>& (*func)(basic_ios<CharT, Traits>&))
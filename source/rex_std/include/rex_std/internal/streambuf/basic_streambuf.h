@@ -69,7 +69,7 @@ namespace rsl
       // calls setbuf(s, n) of the most derived class
       basic_streambuf<CharT, Traits>* pubsetbuf(char_type* s, streamsize n)
       {
-        setbuf(s, n);
+        return setbuf(s, n);
       }
 
       // calls seekoff(off, dir, which) of the most derived class
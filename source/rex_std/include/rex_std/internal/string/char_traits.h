@@ -14,6 +14,8 @@
 
 #include "rex_std/bonus/types.h"
 #include "rex_std/cstring.h"
+#include "rex_std/internal/string/memchr.h"
+#include "rex_std/internal/type_traits/is_constant_evaluated.h"
 #include "rex_std/internal/ios/fpos.h"
 #include "rex_std/internal/ios/io_types.h"
 #include "rex_std/internal/wchar/mbstate.h"
@@ -230,6 +232,17 @@ namespace rsl
       {
         return static_cast<unsigned char>(a) < static_cast<unsigned char>(b);
       }
+
+      // Searches for character ch within the first count characters of the sequence pointed to by p.
+      static constexpr const char_type* find(const char_type* p, count_t count, const char_type& ch)
+      {
+        if(!rsl::is_constant_evaluated())
+        {
+          return static_cast<const char_type*>(rsl::memchr(p, ch, count));
+        }
+
+        return internal::char_traits_base<char8, int32>::find(p, count, ch);
+      }
     };
 
     template <>
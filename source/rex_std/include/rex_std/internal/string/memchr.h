@@ -19,7 +19,8 @@ namespace rsl
   inline namespace v1
   {
 
-    void* memchr(const void* ptr, char8 ch, card32 length);
+    // finds the first occurrence of ch in the first length bytes of ptr
+    void* memchr(const void* ptr, char8 ch, card64 length);
 
   } // namespace v1
 } // namespace rsl
@@ -28,6 +28,13 @@
 #include "rex_std/internal/sstream/basic_sstream.h"
 #include "rex_std/internal/utility/forward.h"
 
+// the calling convention the OS expects a thread's entry point to have
+#if defined(RSL_PLATFORM_WINDOWS)
+  #define RSL_THREAD_START_CALL __stdcall
+#else
+  #define RSL_THREAD_START_CALL
+#endif
+
 namespace rsl
 {
   inline namespace v1
@@ -57,7 +64,12 @@ namespace rsl
     class thread
     {
     private:
-      using thread_start_func = unsigned long(__stdcall*)(void*);
+#if defined(RSL_PLATFORM_WINDOWS)
+      using thread_start_result = ulong;
+#else
+      using thread_start_result = void*;
+#endif
+      using thread_start_func = thread_start_result(RSL_THREAD_START_CALL*)(void*);
 
     public:
       class id
@@ -159,7 +171,7 @@ namespace rsl
       }
 
       template <typename Func>
-      static ulong __stdcall invoke(void* param)
+      static thread_start_result RSL_THREAD_START_CALL invoke(void* param)
       {
         // the reason why I copy the function ptr is so that we don't have a possible heap alloc
         // that lasts for the rest of the program
@@ -167,7 +179,7 @@ namespace rsl
         rsl::unique_ptr<internal::func_wrapper<Func>> func(static_cast<internal::func_wrapper<Func>*>(param));
         auto& function_ptr = func->function();
         rsl::invoke(function_ptr);
-        return 0;
+        return {};
       }
 
     private:
@@ -0,0 +1,37 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: is_trivially_relocatable.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/internal/type_traits/integral_constant.h"
+#include "rex_std/internal/type_traits/is_trivially_copyable.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // a type is trivially relocatable if moving an object to new memory and destroying the old one
+    // has the same effect as copying its bytes over, so containers can memcpy it when they reallocate.
+    // trivially copyable types always are. other types can opt in by specializing this,
+    // which is only correct if the object doesn't hold a pointer to itself.
+    template <typename T>
+    struct is_trivially_relocatable : bool_constant<is_trivially_copyable_v<T>>
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+  } // namespace v1
+} // namespace rsl
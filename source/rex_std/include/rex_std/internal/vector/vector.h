@@ -25,11 +25,16 @@
 #include "rex_std/internal/iterator/random_access_iterator.h"
 #include "rex_std/internal/memory/allocator.h"
 #include "rex_std/internal/memory/allocator_traits.h"
+#include "rex_std/internal/memory/memcpy.h"
+#include "rex_std/internal/memory/memmove.h"
+#include "rex_std/internal/type_traits/is_empty.h"
 #include "rex_std/internal/type_traits/is_trivially_constructible.h"
 #include "rex_std/internal/type_traits/is_trivially_destructible.h"
+#include "rex_std/internal/type_traits/is_trivially_relocatable.h"
 #include "rex_std/internal/utility/forward.h"
 #include "rex_std/internal/utility/move.h"
 #include "rex_std/internal/utility/swap.h"
+#include "rex_std/internal/vector/vector_growth.h"
 #include "rex_std/iterator.h"
 
 namespace rsl
@@ -38,14 +43,14 @@ namespace rsl
   {
 
     /// RSL Comment: Different from ISO C++ Standard at time of writing (27/Jun/2022)
-    // RSL vector also has the numerator and denumerator which used to expand the vector in case of reallocation.
+    // RSL vector gets the capacity of a new buffer from rsl::vector_growth_policy<T, Alloc>.
     // by default, the vector's capacity is doubled.
+    // trivially relocatable elements are memcpy'd when the vector reallocates or shifts them.
     template <typename T, typename Alloc>
     class vector
     {
     private:
-      static constexpr card32 realloc_numerator = 2;
-      static constexpr card32 realloc_denumerator = 1;
+      using growth_policy = typename rsl::vector_growth_policy<T, Alloc>::type;
 
     public:
       using value_type = T;
@@ -465,8 +470,8 @@ namespace rsl
         // prepare_for_new_insert can reallocate, which would invalidate the input it
         difference_type idx = rsl::distance(cbegin(), pos);
         const bool is_pushing_back = pos == cend();
-        const bool did_reallocate = prepare_for_new_insert(pos);
-        const bool should_assign = !did_reallocate && !is_pushing_back;
+        const bool is_gap_uninitialized = prepare_for_new_insert(pos);
+        const bool should_assign = !is_gap_uninitialized && !is_pushing_back;
         return insert_at(should_assign, idx, value);
       }
       // inserts value before pos
@@ -475,8 +480,8 @@ namespace rsl
         // prepare_for_new_insert can reallocate, which would invalidate the input it
         const difference_type idx = rsl::distance(cbegin(), pos);
         const bool is_pushing_back = pos == cend();
-        const bool did_reallocate = prepare_for_new_insert(pos);
-        const bool should_assign = !did_reallocate && !is_pushing_back;
+        const bool is_gap_uninitialized = prepare_for_new_insert(pos);
+        const bool should_assign = !is_gap_uninitialized && !is_pushing_back;
         return insert_at(should_assign, idx, rsl::move(value));
       }
       // inserts count copies of the value before pos
@@ -485,8 +490,8 @@ namespace rsl
         // prepare_for_new_insert can reallocate, which would invalidate the input it
         difference_type idx = rsl::distance(cbegin(), pos);
         const card32 current_size = size(); // once we're at our current size, we can't assign anymore and must construct instead
-        const bool did_reallocate = prepare_for_new_insert(pos, count);
-        const card32 stop_assigning_index = did_reallocate ? 0 : current_size; // if we reallocated, we can never assign
+        const bool is_gap_uninitialized = prepare_for_new_insert(pos, count);
+        const card32 stop_assigning_index = is_gap_uninitialized ? 0 : current_size; // if the gap is uninitialized, we can never assign
         return insert_at(stop_assigning_index, idx, value, count);
       }
       // inserts elements from range [first, last) before pos.
@@ -508,14 +513,23 @@ namespace rsl
         // prepare_for_new_insert can reallocate, which would invalidate the input it
         difference_type idx = rsl::distance(cbegin(), pos);
         const bool is_pushing_back = pos == cend();
-        const bool did_reallocate = prepare_for_new_insert(pos);
-        const bool should_assign = !did_reallocate && !is_pushing_back;
+        const bool is_gap_uninitialized = prepare_for_new_insert(pos);
+        const bool should_assign = !is_gap_uninitialized && !is_pushing_back;
         return insert_at(should_assign, idx, rsl::forward<Args>(args)...);
       }
       // Removes the element at pos.
       iterator erase(const_iterator pos)
       {
         auto idx = rsl::distance(cbegin(), pos);
+        if constexpr (rsl::is_trivially_relocatable_v<T>)
+        {
+          // destroy the element and slide the ones behind it over its bytes
+          get_mutable_allocator().destroy(m_begin + idx);
+          rsl::memmove(m_begin + idx, m_begin + idx + 1, calc_bytes_needed(size() - idx - 1));
+          --m_end;
+          return begin() + idx;
+        }
+
         for (auto i = idx; i < size() - 1; ++i)
         {
           operator[](i) = rsl::move(operator[](i + 1));
@@ -534,9 +548,23 @@ namespace rsl
         // make sure the range belongs to the container
         RSL_ASSERT_X(rsl::in_range(dst_idx, 0, size()), "Trying to remove a range of elements not belonging to the container.");
 
+        if constexpr (rsl::is_trivially_relocatable_v<T>)
+        {
+          if constexpr (!rsl::is_trivially_destructible_v<value_type>)
+          {
+            for (auto i = dst_idx; i < src_idx; ++i)
+            {
+              get_mutable_allocator().destroy(m_begin + i);
+            }
+          }
+          rsl::memmove(m_begin + dst_idx, m_begin + src_idx, calc_bytes_needed(size() - src_idx));
+          m_end -= count;
+          return begin() + distance_from_begin;
+        }
+
         for (size_type i = src_idx; i < size(); ++i)
         {
-          operator[](dst_idx) = rsl::move(operator[](src_idx));
+          operator[](dst_idx) = rsl::move(operator[](i));
           ++dst_idx;
         }
 
@@ -615,18 +643,19 @@ namespace rsl
       }
 
     private:
-      // Allocates a bigger buffer and copies over all elements
+      // Allocates a bigger buffer and moves over all elements
       // Also sets m_begin, m_end and m_cp_last_and_allocator.first() to point to the new buffer
       void reallocate(size_type newCapacity)
       {
-        pointer new_buffer = static_cast<pointer>(get_mutable_allocator().allocate(calc_bytes_needed(newCapacity)));
+        if (try_expand(newCapacity))
+        {
+          return;
+        }
 
-        pointer dest = new_buffer;
-        move(dest, m_begin, size());
+        pointer new_buffer = static_cast<pointer>(get_mutable_allocator().allocate(calc_bytes_needed(newCapacity)));
 
         const size_type old_size = size();
-
-        clear(); // to call the dtor of non trivially destructible types
+        relocate(new_buffer, m_begin, old_size);
         deallocate();
 
         m_begin = new_buffer;
@@ -634,6 +663,18 @@ namespace rsl
         m_cp_last_and_allocator.first() = m_begin + newCapacity;
       }
 
+      // grows the current buffer without moving it, if the allocator supports it
+      bool try_expand(size_type newCapacity)
+      {
+        if (!internal::try_expand_in_place(get_mutable_allocator(), m_begin, calc_bytes_needed(capacity()), calc_bytes_needed(newCapacity)))
+        {
+          return false;
+        }
+
+        m_cp_last_and_allocator.first() = m_begin + newCapacity;
+        return true;
+      }
+
       // Deallocates the buffer
       void deallocate()
       {
@@ -645,16 +686,15 @@ namespace rsl
       {
         if (newRequiredCapacity > capacity())
         {
-          const size_type num_elements_to_add = newRequiredCapacity - capacity();
-          reallocate(new_buffer_capacity(num_elements_to_add));
+          reallocate(new_buffer_capacity(newRequiredCapacity));
           return true;
         }
         return false;
       }
       // returns the size of a new buffer on reallocation
-      size_type new_buffer_capacity(size_type numElementsToAdd) const
+      size_type new_buffer_capacity(size_type requiredCapacity) const
       {
-        return (capacity() * realloc_numerator / realloc_denumerator) + numElementsToAdd;
+        return growth_policy::new_capacity(capacity(), requiredCapacity, sizeof(T));
       }
 
       // reallocates if we surpassed our capacity with the new element
@@ -663,48 +703,59 @@ namespace rsl
         increase_capacity_if_needed(size() + 1);
       }
 
-      // moves every element starting at 'pos' one space to the right
+      // moves every element starting at 'pos' count spaces to the right
+      // returns true if the memory of the new elements is uninitialized,
+      // false if the slots that held elements before still hold moved from elements that need to be assigned to
       bool prepare_for_new_insert(const_iterator pos, size_type count = 1)
       {
         const size_type idx = rsl::distance(cbegin(), pos);
-        if (size() + count > capacity())
+        const size_type old_size = size();
+        if (old_size + count > capacity())
+        {
+          const size_type size_for_new_buffer = new_buffer_capacity(old_size + count);
+          if (!try_expand(size_for_new_buffer))
+          {
+            // This is similar to what basic_string does.
+            // Please look at basic_string::prepare_for_new_insert if you want to have more
+            // documentation about what goes on here
+
+            // when this branch is executed, the memory where the new elements should be is not yet initialized
+            pointer new_buffer = static_cast<pointer>(get_mutable_allocator().allocate(calc_bytes_needed(size_for_new_buffer)));
+
+            // move the elements before pos and the elements from pos to end() into the new buffer, leaving a gap in between
+            relocate(new_buffer, m_begin, idx);
+            relocate(new_buffer + idx + count, m_begin + idx, old_size - idx);
+
+            // all that's left is to deallocate the old buffer
+            deallocate();
+
+            // reset the data pointers.
+            m_begin = new_buffer;
+            m_end = m_begin + old_size + count;
+            m_cp_last_and_allocator.first() = m_begin + size_for_new_buffer;
+            return true;
+          }
+        }
+
+        m_end += count;
+        if constexpr (rsl::is_trivially_relocatable_v<T>)
         {
-          // This is similar to what basic_string does.
-          // Please look at basic_string::prepare_for_new_insert if you want to have more
-          // documentation about what goes on here
-
-          // when this branch is executed, the memory where the new elements should be is not yet initialized
-
-          const size_type old_size = size();
-          const size_type size_for_new_buffer = new_buffer_capacity(count);
-          pointer new_buffer = static_cast<pointer>(get_mutable_allocator().allocate(calc_bytes_needed(size_for_new_buffer)));
-
-          // move the first set of elements up to pos into the new buffer
-          pointer dest = new_buffer;
-          pointer start = m_begin;
-          move(dest, start, idx);
-
-          // move the second set of elements from pos to end() into the new buffer
-          start = start + idx;
-          dest += idx + count;
-          move(dest, start, size() - idx);
-
-          // all that's left is to call the dtors of the elements and deallocate the old buffer
-          clear();
-          deallocate();
-
-          // reset the data pointers.
-          m_begin = new_buffer;
-          m_end = m_begin + old_size + count;
-          m_cp_last_and_allocator.first() = m_begin + size_for_new_buffer;
+          // using memmove here as the dst and src could overlap
+          rsl::memmove(m_begin + idx + count, m_begin + idx, calc_bytes_needed(old_size - idx));
           return true;
         }
         else
         {
-          // using memmove here as the dst and src could overlap
-          pointer dst_in_buffer = data() + idx + count;
-          move_bwd(dst_in_buffer, data() + idx, size() - idx);
-          m_end += count;
+          // the elements moving past the old end are constructed, the others are assigned to, back to front
+          const size_type first_to_construct = (rsl::max)(idx, old_size - count);
+          for (size_type i = old_size; i > first_to_construct; --i)
+          {
+            new(m_begin + i - 1 + count) T(rsl::move(m_begin[i - 1]));
+          }
+          for (size_type i = first_to_construct; i > idx; --i)
+          {
+            m_begin[i - 1 + count] = rsl::move(m_begin[i - 1]);
+          }
           return false;
         }
       }
@@ -951,8 +1002,8 @@ namespace rsl
         // prepare_for_new_insert can reallocate, which would invalidate the input it
         difference_type idx = static_cast<difference_type>(rsl::distance(cbegin(), pos));
         const card32 current_size = size();
-        const bool did_reallocate = prepare_for_new_insert(pos, count);
-        const card32 stop_assigning_index = did_reallocate ? 0 : current_size; // if we reallocated, we can never assign
+        const bool is_gap_uninitialized = prepare_for_new_insert(pos, count);
+        const card32 stop_assigning_index = is_gap_uninitialized ? 0 : current_size; // if the gap is uninitialized, we can never assign
         return insert_at(stop_assigning_index, idx, first, count);
       }
 
@@ -976,16 +1027,27 @@ namespace rsl
           --count;
         }
       }
-      void move_bwd(pointer dst, pointer src, size_type count)
+      // moves count elements from src to the uninitialized memory at dst and destroys them at src.
+      // the ranges can't overlap
+      void relocate(pointer dst, pointer src, size_type count)
       {
-        pointer dst_bwd = dst + count - 1;
-        pointer src_bwd = src + count - 1;
-        while (count > 0)
+        if constexpr (rsl::is_trivially_relocatable_v<T>)
         {
-          new(dst_bwd) T(rsl::move(*src_bwd));
-          --dst_bwd;
-          --src_bwd;
-          --count;
+          if (count > 0)
+          {
+            rsl::memcpy(dst, src, calc_bytes_needed(count));
+          }
+        }
+        else
+        {
+          move(dst, src, count);
+          if constexpr (!rsl::is_trivially_destructible_v<T>)
+          {
+            for (size_type i = 0; i < count; ++i)
+            {
+              get_mutable_allocator().destroy(src + i);
+            }
+          }
         }
       }
 
@@ -1075,6 +1137,15 @@ namespace rsl
       return r;
     }
 
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // a vector only holds pointers to its buffer and its allocator, so it can be memcpy'd if its allocator can.
+    // only empty allocators are trusted, a stateful allocator can hand out memory that lives inside itself,
+    // which moves along with the allocator. such allocators have to specialize this trait if they're safe to relocate.
+    template <typename T, typename Alloc>
+    struct is_trivially_relocatable<rsl::vector<T, Alloc>> : bool_constant<is_empty_v<Alloc> && is_trivially_relocatable_v<Alloc>>
+    {
+    };
+
     // This deduction guide is provided for vector to allow deduction from an iterator range.
     template <typename InputIt, typename Alloc = rsl::allocator>
     vector(InputIt, InputIt, Alloc = Alloc())->vector<typename rsl::iterator_traits<InputIt>::value_type, Alloc>;
@@ -0,0 +1,119 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: vector_growth.h
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#pragma once
+
+#include "rex_std/bonus/types.h"
+#include "rex_std/internal/algorithm/max.h"
+#include "rex_std/internal/algorithm/min.h"
+#include "rex_std/internal/type_traits/integral_constant.h"
+#include "rex_std/internal/type_traits/void.h"
+#include "rex_std/internal/utility/declval.h"
+#include "rex_std/limits.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      // clamps a capacity calculated in 64 bit to what a vector can hold
+      constexpr card32 clamp_vector_capacity(card64 capacity)
+      {
+        return static_cast<card32>((rsl::min)(capacity, static_cast<card64>((rsl::numeric_limits<card32>::max)())));
+      }
+    } // namespace internal
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // a growth policy decides the capacity of a vector's new buffer when it runs out of room.
+    // new_capacity returns at least requiredCapacity.
+
+    // doubles the capacity, the fewest reallocations at the cost of more unused memory
+    struct vector_growth_double
+    {
+      static constexpr card32 new_capacity(card32 capacity, card32 requiredCapacity, card64 /*elementSize*/)
+      {
+        return (rsl::max)(internal::clamp_vector_capacity(capacity * card64(2)), requiredCapacity);
+      }
+    };
+
+    // grows the capacity by half, freed buffers can be reused by later reallocations of the same vector
+    struct vector_growth_one_and_half
+    {
+      static constexpr card32 new_capacity(card32 capacity, card32 requiredCapacity, card64 /*elementSize*/)
+      {
+        return (rsl::max)(internal::clamp_vector_capacity(capacity + capacity / card64(2)), requiredCapacity);
+      }
+    };
+
+    // grows like Base, but rounds buffers of at least Threshold bytes up to a multiple of PageSize bytes.
+    // big allocations are served in whole pages anyway, this hands the rest of the last page to the vector
+    template <typename Base = vector_growth_double, card64 PageSize = 4096, card64 Threshold = 4 * PageSize>
+    struct vector_growth_page_rounded
+    {
+      static constexpr card32 new_capacity(card32 capacity, card32 requiredCapacity, card64 elementSize)
+      {
+        const card32 base_capacity = Base::new_capacity(capacity, requiredCapacity, elementSize);
+        const card64 num_bytes     = base_capacity * elementSize;
+        if(num_bytes < Threshold)
+        {
+          return base_capacity;
+        }
+
+        const card64 rounded_bytes = (num_bytes + PageSize - 1) / PageSize * PageSize;
+        return (rsl::max)(internal::clamp_vector_capacity(rounded_bytes / elementSize), base_capacity);
+      }
+    };
+
+    /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+    // the growth policy used by rsl::vector<T, Alloc>, specialize this to change it for an instantiation.
+    // by default, the vector's capacity is doubled
+    template <typename T, typename Alloc>
+    struct vector_growth_policy
+    {
+      using type = vector_growth_double;
+    };
+
+    namespace internal
+    {
+      template <typename Alloc, typename = void>
+      struct has_try_expand : false_type
+      {
+      };
+      template <typename Alloc>
+      struct has_try_expand<Alloc, void_t<decltype(rsl::declval<Alloc&>().try_expand(rsl::declval<void*>(), card64(), card64()))>> : true_type
+      {
+      };
+
+      /// RSL Comment: Not in ISO C++ Standard at time of writing (17/Oct/2023)
+      // an allocator can provide bool try_expand(void* ptr, size_type oldCount, size_type newCount)
+      // which grows the allocation at ptr to newCount bytes without moving it, or returns false if it can't.
+      // containers try this before allocating a new buffer and moving their elements over
+      template <typename Alloc>
+      bool try_expand_in_place(Alloc& alloc, void* ptr, card64 oldCount, card64 newCount)
+      {
+        if constexpr(has_try_expand<Alloc>::value)
+        {
+          return ptr != nullptr && alloc.try_expand(ptr, oldCount, newCount);
+        }
+        else
+        {
+          (void)alloc;
+          (void)ptr;
+          (void)oldCount;
+          (void)newCount;
+          return false;
+        }
+      }
+    } // namespace internal
+  } // namespace v1
+} // namespace rsl
@@ -56,8 +56,18 @@ namespace rsl
     ios_base& uppercase(ios_base& stream);
     ios_base& nouppercase(ios_base& stream);
 
-    ios_base& unitbuf(ios_base& stream);
-    ios_base& nounitbuf(ios_base& stream);
+    // flushes the output after every output operation
+    inline ios_base& unitbuf(ios_base& stream)
+    {
+      stream.setf(io::fmtflags::unitbuf);
+      return stream;
+    }
+    // lets the stream buffer decide when the output is flushed
+    inline ios_base& nounitbuf(ios_base& stream)
+    {
+      stream.unsetf(io::fmtflags::unitbuf);
+      return stream;
+    }
 
     // ios_base& internal(ios_base& stream); /// [08/Sep/2022] RSL Comment: collides with internal namespace
     ios_base& left(ios_base& stream);
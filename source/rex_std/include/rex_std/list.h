@@ -377,7 +377,7 @@ namespace rsl
           , m_size(0)
 #endif
       {
-        swap(other);
+        swap_nodes(other);
       }
       list(list&& other, const allocator_type& alloc)
           : m_cp_head_tail_link_and_alloc(alloc)
@@ -385,7 +385,19 @@ namespace rsl
           , m_size(0)
 #endif
       {
-        swap(other);
+        if(get_allocator() == other.get_allocator())
+        {
+          swap_nodes(other);
+        }
+        else
+        {
+          // the nodes of other are owned by its allocator and go away along with it,
+          // so the elements are moved into nodes of our own allocator instead
+          for(value_type& value : other)
+          {
+            emplace_back(rsl::move(value));
+          }
+        }
       }
       list(rsl::initializer_list<value_type> ilist, const allocator_type& alloc = allocator_type())
           : m_cp_head_tail_link_and_alloc(alloc)
@@ -759,7 +771,7 @@ namespace rsl
       }
       void swap(list<T, allocator_type>& other)
       {
-        rsl::swap(m_cp_head_tail_link_and_alloc, other.m_cp_head_tail_link_and_alloc);
+        swap_nodes(other);
         rsl::swap(get_allocator(), other.get_allocator());
       }
 
@@ -1090,6 +1102,38 @@ namespace rsl
       }
 
     private:
+      // exchanges the nodes of both lists, leaving the allocators untouched.
+      // the head tail links live inside the lists, so they can't be swapped by value,
+      // the first and last node need to be pointed to their new head tail link.
+      void swap_nodes(list& other)
+      {
+        list_node_base& link       = m_cp_head_tail_link_and_alloc.first();
+        list_node_base& other_link = other.m_cp_head_tail_link_and_alloc.first();
+
+        rsl::swap(link.next, other_link.next);
+        rsl::swap(link.prev, other_link.prev);
+        relink_head_tail_link(link, other_link);
+        relink_head_tail_link(other_link, link);
+
+#ifdef RSL_ENABLE_SIZE_IN_LISTS
+        rsl::swap(m_size, other.m_size);
+#endif
+      }
+      static void relink_head_tail_link(list_node_base& link, list_node_base& previousOwner)
+      {
+        // the nodes came from an empty list, so they point to that list's head tail link
+        if(link.next == &previousOwner)
+        {
+          link.next = &link;
+          link.prev = &link;
+        }
+        else
+        {
+          link.next->prev = &link;
+          link.prev->next = &link;
+        }
+      }
+
       /// head_tail_link() is a fictional node that sits between the last and the first node.
       /// it is mainly used to create the begin and end iterators
       ///
@@ -97,24 +97,24 @@ namespace rsl
       {
       }
       // constructs an empty container
-      explicit map(const Compare& comp, const allocator& alloc = allocator())
-          : base_type(comp, allocator)
+      explicit map(const Compare& comp, const allocator_type& alloc = allocator_type())
+          : base_type(comp, alloc)
       {
       }
       // constructs an empty container
-      explicit map(const allocator& alloc)
-          : base_type(allocator)
+      explicit map(const allocator_type& alloc)
+          : base_type(alloc)
       {
       }
       // constructs the container with the contents of [first, last)
       template <typename InputIt>
-      map(InputIt first, InputIt last, const Compare& comp = Compare(), const allocator& alloc = allocator())
+      map(InputIt first, InputIt last, const Compare& comp = Compare(), const allocator_type& alloc = allocator_type())
           : base_type(first, last, comp, alloc)
       {
       }
       // constructs the container with the contents of [first, last)
       template <typename InputIt>
-      map(InputIt first, InputIt last, const allocator& alloc)
+      map(InputIt first, InputIt last, const allocator_type& alloc)
           : base_type(first, last, alloc)
       {
       }
@@ -124,7 +124,7 @@ namespace rsl
       {
       }
       // constructs the container with the copy of the contents of other
-      map(const map& other, const allocator& alloc)
+      map(const map& other, const allocator_type& alloc)
           : base_type(other, alloc)
       {
       }
@@ -134,17 +134,17 @@ namespace rsl
       {
       }
       // constructs the container with the contents of other using move semantics
-      map(map&& other, const allocator& alloc)
+      map(map&& other, const allocator_type& alloc)
           : base_type(rsl::move(other), alloc)
       {
       }
       // constructs the container with the contents of the initializer list
-      map(rsl::initializer_list<value_type> ilist, const Compare& comp = Compare(), const allocator& alloc = allocator())
+      map(rsl::initializer_list<value_type> ilist, const Compare& comp = Compare(), const allocator_type& alloc = allocator_type())
           : base_type(ilist.begin(), ilist.end(), comp, alloc)
       {
       }
       // constructs the container with the contents of the initializer list
-      map(rsl::initializer_list<value_type> ilist, const allocator& alloc)
+      map(rsl::initializer_list<value_type> ilist, const allocator_type& alloc)
           : base_type(ilist.begin(), ilist.end(), alloc)
       {
       }
@@ -320,11 +320,11 @@ namespace rsl
     //
 
     template <typename Key, typename Value, typename Compare = rsl::less<Key>, typename Alloc = rsl::allocator>
-    class multimap : public RedBlackTree<Key, key_value<const Key, Value>, Compare, allocator, rsl::use_first<key_value<const Key, Value>>, true, false>
+    class multimap : public RedBlackTree<Key, key_value<const Key, Value>, Compare, Alloc, rsl::use_first<key_value<const Key, Value>>, true, false>
     {
     private:
-      using base_type   = RedBlackTree<Key, key_value<const Key, Value>, Compare, allocator, rsl::use_first<key_value<const Key, Value>>, true, false>;
-      using this_type   = multimap<Key, Value, Compare, allocator>;
+      using base_type   = RedBlackTree<Key, key_value<const Key, Value>, Compare, Alloc, rsl::use_first<key_value<const Key, Value>>, true, false>;
+      using this_type   = multimap<Key, Value, Compare, Alloc>;
       using extract_key = typename base_type::extract_key;
 
     public:
@@ -469,7 +469,7 @@ namespace rsl
     };
 
     template <typename Key, typename Value, typename Compare, typename Alloc, typename Predicate>
-    typename multimap<Key, Value, Compare, allocator>::size_type erase_if(multimap<Key, Value, Compare, allocator>& c, Predicate pred)
+    typename multimap<Key, Value, Compare, Alloc>::size_type erase_if(multimap<Key, Value, Compare, Alloc>& c, Predicate pred)
     {
       auto old_size = c.size();
 
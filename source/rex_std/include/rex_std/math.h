@@ -25,6 +25,7 @@
 #include "rex_std/internal/math/floor.h"
 #include "rex_std/internal/math/is_finite.h"
 #include "rex_std/internal/math/is_nan.h"
+#include "rex_std/internal/math/log.h"
 #include "rex_std/internal/math/pow.h"
 #include "rex_std/internal/math/round.h"
 #include "rex_std/internal/math/signbit.h"
@@ -400,7 +401,6 @@ namespace rsl
     RSL_FUNC_ALIAS(lerp);
     RSL_FUNC_ALIAS(exp2);
     RSL_FUNC_ALIAS(expm1);
-    RSL_FUNC_ALIAS(log);
     RSL_FUNC_ALIAS(log10);
     RSL_FUNC_ALIAS(log2);
     RSL_FUNC_ALIAS(log1p);
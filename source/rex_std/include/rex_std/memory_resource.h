@@ -12,23 +12,9 @@
 
 #pragma once
 
-#include "rex_std/bonus/defines.h"
-#include "rex_std/enable_std_checking.h"
-#include "rex_std/std_alias_defines.h"
-
-#include <memory_resource>
-
-namespace rsl
-{
-  inline namespace v1
-  {
-
-    namespace pmr
-    {
-      using namespace std::pmr;
-    }
-
-  } // namespace v1
-} // namespace rsl
-
-#include "rex_std/enable_std_checking.h"
+#include "rex_std/internal/memory_resource/memory_resource.h"
+#include "rex_std/internal/memory_resource/monotonic_buffer_resource.h"
+#include "rex_std/internal/memory_resource/polymorphic_allocator.h"
+#include "rex_std/internal/memory_resource/pool_options.h"
+#include "rex_std/internal/memory_resource/synchronized_pool_resource.h"
+#include "rex_std/internal/memory_resource/unsynchronized_pool_resource.h"
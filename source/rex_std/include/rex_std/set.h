@@ -26,11 +26,11 @@ namespace rsl
   {
 
     template <typename Key, typename Compare = rsl::less<Key>, typename Alloc = rsl::allocator>
-    class set : public RedBlackTree<Key, Key, Compare, allocator, rsl::use_self<Key>, false, true>
+    class set : public RedBlackTree<Key, Key, Compare, Alloc, rsl::use_self<Key>, false, true>
     {
     private:
-      using base_type = RedBlackTree<Key, Key, Compare, allocator, rsl::use_self<Key>, false, true>;
-      using this_type = set<Key, Compare, allocator>;
+      using base_type = RedBlackTree<Key, Key, Compare, Alloc, rsl::use_self<Key>, false, true>;
+      using this_type = set<Key, Compare, Alloc>;
 
     public:
       using size_type              = typename base_type::size_type;
@@ -176,9 +176,9 @@ namespace rsl
     };
 
     template <typename Key, typename Compare, typename Alloc, typename Predicate>
-    typename set<Key, Compare, allocator>::size_type erase_if(set<Key, Compare, allocator>& c, Predicate predicate)
+    typename set<Key, Compare, Alloc>::size_type erase_if(set<Key, Compare, Alloc>& c, Predicate predicate)
     {
-      typename set<Key, Compare, allocator>::size_type old_size = c.size();
+      typename set<Key, Compare, Alloc>::size_type old_size = c.size();
 
       for(auto i = c.begin(), last = c.end(); i != last;)
       {
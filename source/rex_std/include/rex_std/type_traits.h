@@ -104,6 +104,7 @@
 #include "rex_std/internal/type_traits/is_trivially_destructible.h"
 #include "rex_std/internal/type_traits/is_trivially_move_assignable.h"
 #include "rex_std/internal/type_traits/is_trivially_move_constructible.h"
+#include "rex_std/internal/type_traits/is_trivially_relocatable.h"
 #include "rex_std/internal/type_traits/is_unbounded_array.h"
 #include "rex_std/internal/type_traits/is_union.h"
 #include "rex_std/internal/type_traits/is_unsigned.h"
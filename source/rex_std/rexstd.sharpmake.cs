@@ -75,10 +75,17 @@ public class RexStd : BasicCPPProject
         conf.AddPublicDefine("RSL_PLATFORM_X64");
         conf.AddPublicDefine("RSL_PLATFORM_WINDOWS");
         break;
+      case Platform.linux:
+        conf.AddPublicDefine("RSL_PLATFORM_X64");
+        conf.AddPublicDefine("RSL_PLATFORM_LINUX");
+        break;
       default:
         break;
     }
 
-    conf.LibraryFiles.Add("Dbghelp.lib");
+    if (conf.Platform != Platform.linux)
+    {
+      conf.LibraryFiles.Add("Dbghelp.lib");
+    }
   }
 }
\ No newline at end of file
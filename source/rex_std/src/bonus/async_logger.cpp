@@ -0,0 +1,255 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: async_logger.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/bonus/async_logger.h"
+
+#include "rex_std/bonus/atomic/atomic_wait.h"
+#include "rex_std/internal/memory/allocator.h"
+#include "rex_std/internal/memory/memcpy.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      namespace
+      {
+        // the writer takes this many records off the queue at once
+        constexpr card64 g_log_writer_batch_size = 64;
+        // the writer writes its buffer once it holds this much, even if there are more records waiting
+        constexpr count_t g_log_write_size = 64 * 1024;
+
+        template <typename T>
+        void store_in_payload(log_record& record, T value)
+        {
+          rsl::memcpy(record.payload, &value, sizeof(T));
+        }
+        template <typename T>
+        T load_from_payload(const log_record& record)
+        {
+          T value;
+          rsl::memcpy(&value, record.payload, sizeof(T));
+          return value;
+        }
+
+        // frees what a record owns when it's dropped instead of written
+        void release_record(const log_record& record)
+        {
+          if(record.kind == log_record_kind::heap_text)
+          {
+            rsl::allocator alloc;
+            alloc.deallocate(load_from_payload<char8*>(record), record.size);
+          }
+        }
+        bool is_control_record(const log_record& record)
+        {
+          return record.kind == log_record_kind::flush || record.kind == log_record_kind::stop;
+        }
+        // wakes up the thread waiting on a flush record
+        void signal_flush(const log_record& record)
+        {
+          rsl::atomic<uint32>* is_written = load_from_payload<rsl::atomic<uint32>*>(record);
+          // the flushing thread can return as soon as it sees the store, notify only uses the address
+          is_written->store(1, rsl::memory_order_release);
+          internal::atomic_notify_all(*is_written);
+        }
+      } // namespace
+
+      rsl::memory_buffer& log_format_buffer()
+      {
+        thread_local rsl::memory_buffer buffer;
+        return buffer;
+      }
+    } // namespace internal
+
+    async_logger::async_logger(internal::console_handle handle, log_overflow_policy policy, card64 capacity)
+        : m_handle(handle)
+        , m_policy(policy)
+        , m_queue(capacity)
+        , m_num_dropped(0)
+        , m_writer()
+    {
+      m_writer = rsl::thread([this]() { run(); });
+    }
+
+    async_logger::~async_logger()
+    {
+      internal::log_record record; // NOLINT(cppcoreguidelines-pro-type-member-init), the payload is unused
+      record.kind   = internal::log_record_kind::stop;
+      record.size   = 0;
+      record.format = nullptr;
+      push_control(record);
+      m_writer.join();
+
+      // records logged while the logger is destroyed end up behind the stop record, the writer never sees them
+      while(m_queue.try_pop(record))
+      {
+        if(record.kind == internal::log_record_kind::flush)
+        {
+          internal::signal_flush(record);
+        }
+        else if(record.kind != internal::log_record_kind::stop)
+        {
+          internal::release_record(record);
+          m_num_dropped.fetch_add(1, rsl::memory_order_relaxed);
+        }
+      }
+    }
+
+    void async_logger::flush()
+    {
+      rsl::atomic<uint32> is_written(0);
+
+      internal::log_record record; // NOLINT(cppcoreguidelines-pro-type-member-init), the payload is only partially used
+      record.kind   = internal::log_record_kind::flush;
+      record.size   = 0;
+      record.format = nullptr;
+      internal::store_in_payload(record, &is_written);
+      push_control(record);
+
+      internal::atomic_wait(is_written, 0);
+    }
+
+    bool async_logger::push_text(const char8* text, count_t size)
+    {
+      internal::log_record record; // NOLINT(cppcoreguidelines-pro-type-member-init), the payload is only partially used
+      record.size   = size;
+      record.format = nullptr;
+      if(size <= internal::g_log_record_payload_size)
+      {
+        record.kind = internal::log_record_kind::text;
+        rsl::memcpy(record.payload, text, static_cast<card64>(size));
+      }
+      else
+      {
+        // the writer frees it again after writing it
+        rsl::allocator alloc;
+        char8* heap_text = static_cast<char8*>(alloc.allocate(size));
+        rsl::memcpy(heap_text, text, static_cast<card64>(size));
+        record.kind = internal::log_record_kind::heap_text;
+        internal::store_in_payload(record, heap_text);
+      }
+
+      return push(record);
+    }
+
+    bool async_logger::push(const internal::log_record& record)
+    {
+      switch(m_policy)
+      {
+        case log_overflow_policy::block: m_queue.push(record); return true;
+        case log_overflow_policy::drop:
+          if(m_queue.try_push(record))
+          {
+            return true;
+          }
+          internal::release_record(record);
+          m_num_dropped.fetch_add(1, rsl::memory_order_relaxed);
+          return false;
+        case log_overflow_policy::overwrite:
+          while(!m_queue.try_push(record))
+          {
+            internal::log_record oldest; // NOLINT(cppcoreguidelines-pro-type-member-init), filled in by try_pop
+            if(!m_queue.try_pop(oldest))
+            {
+              // the writer emptied the queue in the meantime
+              continue;
+            }
+
+            if(internal::is_control_record(oldest))
+            {
+              // someone's waiting on this one, it goes back in the queue behind the newer records
+              m_queue.push(oldest);
+              continue;
+            }
+            internal::release_record(oldest);
+            m_num_dropped.fetch_add(1, rsl::memory_order_relaxed);
+          }
+          return true;
+      }
+
+      return false;
+    }
+
+    void async_logger::push_control(const internal::log_record& record)
+    {
+      m_queue.push(record);
+    }
+
+    void async_logger::run()
+    {
+      rsl::memory_buffer buffer;
+      internal::log_record records[internal::g_log_writer_batch_size]; // NOLINT(modernize-avoid-c-arrays, cppcoreguidelines-pro-type-member-init)
+
+      bool is_stopped = false;
+      while(!is_stopped)
+      {
+        card64 num_records = m_queue.try_pop_n(records, internal::g_log_writer_batch_size);
+        if(num_records == 0)
+        {
+          // nothing left to batch with, write what's gathered before waiting for more
+          write(buffer);
+          m_queue.pop(records[0]);
+          num_records = 1;
+        }
+
+        for(card64 i = 0; i < num_records; ++i)
+        {
+          const internal::log_record& record = records[i];
+          switch(record.kind)
+          {
+            case internal::log_record_kind::text:
+              buffer.append(record.payload, record.payload + record.size);
+              buffer.push_back('\n');
+              break;
+            case internal::log_record_kind::heap_text:
+            {
+              const char8* text = internal::load_from_payload<char8*>(record);
+              buffer.append(text, text + record.size);
+              buffer.push_back('\n');
+              internal::release_record(record);
+              break;
+            }
+            case internal::log_record_kind::deferred:
+              record.format(record.payload, buffer);
+              buffer.push_back('\n');
+              break;
+            case internal::log_record_kind::flush:
+              write(buffer);
+              internal::signal_flush(record);
+              break;
+            case internal::log_record_kind::stop: is_stopped = true; break;
+          }
+        }
+
+        if(buffer.size() >= internal::g_log_write_size)
+        {
+          write(buffer);
+        }
+      }
+
+      write(buffer);
+    }
+
+    void async_logger::write(rsl::memory_buffer& buffer)
+    {
+      if(buffer.size() == 0)
+      {
+        return;
+      }
+
+      internal::write_console(m_handle, buffer.data(), buffer.size());
+      buffer.clear();
+    }
+  } // namespace v1
+} // namespace rsl
@@ -10,7 +10,9 @@
 //
 // ============================================
 
-#include <Windows.h> // IWYU pragma: keep
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include <Windows.h> // IWYU pragma: keep
+#endif
 
 namespace rsl
 {
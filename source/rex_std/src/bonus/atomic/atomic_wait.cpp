@@ -0,0 +1,81 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: atomic_wait.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/bonus/atomic/atomic_wait.h"
+
+#include "rex_std/internal/condition_variable/condition_variable.h"
+#include "rex_std/internal/mutex/mutex.h"
+#include "rex_std/internal/mutex/unique_lock.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      namespace
+      {
+        // different addresses can share a bucket, a wake up then wakes threads waiting on another address as well.
+        // they check their value again and go back to sleep
+        constexpr card32 g_atomic_wait_num_buckets = 64;
+        constexpr card32 g_atomic_wait_padding     = 64;
+
+        struct alignas(g_atomic_wait_padding) wait_bucket
+        {
+          rsl::mutex mtx;
+          rsl::condition_variable cv;
+        };
+
+        wait_bucket& bucket_for(const void* address)
+        {
+          static wait_bucket buckets[g_atomic_wait_num_buckets]; // NOLINT(modernize-avoid-c-arrays)
+
+          // the low bits are the same for all objects with the same alignment
+          const uint64 key = reinterpret_cast<uint64>(address) >> 4; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          return buckets[(key ^ (key >> 7)) % g_atomic_wait_num_buckets];
+        }
+      } // namespace
+
+      void atomic_wait(const rsl::atomic<uint32>& value, uint32 expected)
+      {
+        wait_bucket& bucket = bucket_for(&value);
+
+        // the value is checked under the lock, a notify in between can't get lost
+        // because it takes the same lock before waking anyone up
+        rsl::unique_lock<rsl::mutex> lock(bucket.mtx);
+        while(value.load(rsl::memory_order_acquire) == expected)
+        {
+          bucket.cv.wait(lock);
+        }
+      }
+
+      bool atomic_wait_for(const rsl::atomic<uint32>& value, uint32 expected, rsl::chrono::nanoseconds timeout)
+      {
+        wait_bucket& bucket = bucket_for(&value);
+
+        rsl::unique_lock<rsl::mutex> lock(bucket.mtx);
+        return bucket.cv.wait_for(lock, timeout, [&]() { return value.load(rsl::memory_order_acquire) != expected; });
+      }
+
+      void atomic_notify_all(const rsl::atomic<uint32>& value)
+      {
+        wait_bucket& bucket = bucket_for(&value);
+
+        {
+          // a waiter that already checked the value is sleeping by the time we get the lock
+          const rsl::unique_lock<rsl::mutex> lock(bucket.mtx);
+        }
+        bucket.cv.notify_all();
+      }
+    } // namespace internal
+  }   // namespace v1
+} // namespace rsl
@@ -9,6 +9,7 @@
 #include "rex_std/bonus/functional/crc/crc32c_internal.h"
 #include "rex_std/bonus/functional/crc/crc32c_sse42.h"
 #include "rex_std/bonus/functional/crc/crc32c_sse42_check.h"
+#include "rex_std/bonus/platform/cpu_features.h"
 #include "rex_std/bonus/types.h"
 
 namespace rsl
@@ -17,37 +18,32 @@ namespace rsl
   {
     namespace crc32
     {
+      namespace
+      {
+        using extend_func = uint32_t (*)(uint32_t, const uint8_t*, size_t);
+
+        constexpr cpu_kernel<extend_func> g_extend_kernels[] = {
+#if HAVE_SSE42 && (defined(_M_X64) || defined(__x86_64__))
+            {&crc32c::CanUseSse42, &crc32c::ExtendSse42},
+#elif HAVE_ARM64_CRC32C
+            {&crc32c::CanUseArm64Crc32, &crc32c::ExtendArm64},
+#endif // HAVE_SSE42 && (defined(_M_X64) || defined(__x86_64__))
+            {nullptr, &crc32c::ExtendPortable}};
+      } // namespace
 
-//      uint32_t Extend(uint32_t crc, const uint8_t* data, size_t count)
-//      {
-//#if HAVE_SSE42 && (defined(_M_X64) || defined(__x86_64__))
-//        constexpr bool can_use_sse42 = CanUseSse42();
-//        if(can_use_sse42)
-//          return ExtendSse42(crc, data, count);
-//#elif HAVE_ARM64_CRC32C
-//        static bool can_use_arm64_crc32 = CanUseArm64Crc32();
-//        if(can_use_arm64_crc32)
-//          return ExtendArm64(crc, data, count);
-//#endif // HAVE_SSE42 && (defined(_M_X64) || defined(__x86_64__))
-//
-//        return ExtendPortable(crc, data, count);
-//      }
-//
-//      extern "C" uint32_t crc32c_extend(uint32_t crc, const uint8_t* data, size_t count)
-//      {
-//        return crc32c::Extend(crc, data, count);
-//      }
-//
-//      extern "C" uint32_t crc32c_value(const uint8_t* data, size_t count)
-//      {
-//        return crc32c::Crc32c(data, count);
-//      }
+      namespace internal
+      {
+        uint32 compute_runtime(const void* data, card64 len, uint32 crc)
+        {
+          return best_cpu_kernel<g_extend_kernels>()(crc, static_cast<const uint8_t*>(data), len);
+        }
+      } // namespace internal
 
       uint32 compute(const void* data, uint32 len)
       {
-        return compute(static_cast<const char*>(data), len);
+        return internal::compute_runtime(data, len, 0);
       }
 
-    } // namespace crc32c
+    } // namespace crc32
   }   // namespace v1
-} // namespace rsl
\ No newline at end of file
+} // namespace rsl
@@ -0,0 +1,76 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: wyhash.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/bonus/functional/wyhash.h"
+
+#if defined(RSL_COMPILER_MSVC) && defined(RSL_PLATFORM_X64)
+  #include <intrin.h> // _umul128
+#endif
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace wyhash
+    {
+      namespace internal
+      {
+        namespace
+        {
+#if defined(RSL_COMPILER_MSVC)
+          using unaligned_uint64 = uint64;
+          using unaligned_uint32 = uint32;
+#else
+          // these tell the compiler the load can be unaligned and aliases other types
+          typedef uint64 unaligned_uint64 __attribute__((__may_alias__, __aligned__(1))); // NOLINT(modernize-use-using)
+          typedef uint32 unaligned_uint32 __attribute__((__may_alias__, __aligned__(1))); // NOLINT(modernize-use-using)
+#endif
+
+          // loads whole words at once, all platforms we support are little endian
+          // so this gives the same result as the byte at a time reader.
+          struct native_reader
+          {
+            uint64 read8(const char8* p) const
+            {
+              return *reinterpret_cast<const unaligned_uint64*>(p); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            }
+            uint64 read4(const char8* p) const
+            {
+              return *reinterpret_cast<const unaligned_uint32*>(p); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            }
+            uint64 read3(const char8* p, card64 k) const
+            {
+              return (static_cast<uint64>(static_cast<uint8>(p[0])) << 16) | (static_cast<uint64>(static_cast<uint8>(p[k >> 1])) << 8) | static_cast<uint64>(static_cast<uint8>(p[k - 1]));
+            }
+            void mum(uint64& a, uint64& b) const
+            {
+#if defined(RSL_COMPILER_MSVC) && defined(RSL_PLATFORM_X64)
+              a = _umul128(a, b, &b);
+#elif defined(__SIZEOF_INT128__)
+              const unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+              a                         = static_cast<uint64>(r);
+              b                         = static_cast<uint64>(r >> 64);
+#else
+              mum_portable(a, b);
+#endif
+            }
+          };
+        } // namespace
+
+        uint64 compute_runtime(const void* data, card64 len, uint64 seed)
+        {
+          return compute_impl(static_cast<const char8*>(data), len, seed, native_reader {});
+        }
+      } // namespace internal
+    }   // namespace wyhash
+  }     // namespace v1
+} // namespace rsl
@@ -0,0 +1,105 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: power_of_two_rehash_policy.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/bonus/hashtable/power_of_two_rehash_policy.h"
+
+#include "rex_std/internal/algorithm/max.h"
+#include "rex_std/internal/algorithm/min.h"
+#include "rex_std/internal/bit/bit_ceil.h"
+#include "rex_std/internal/bit/bit_floor.h"
+#include "rex_std/internal/math/ceil.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    // the biggest power of 2 that fits in a count_t, which is what the hashtable stores its bucket count in
+    constexpr uint32 g_max_power_of_two_bucket_count = 1u << 30u;
+
+    namespace
+    {
+      uint32 round_up_to_power_of_two(uint32 bucketCountHint)
+      {
+        return rsl::bit_ceil((rsl::min)((rsl::max)(bucketCountHint, 1u), g_max_power_of_two_bucket_count));
+      }
+    } // namespace
+
+    power_of_two_rehash_policy::power_of_two_rehash_policy(float32 maxLoadFactor)
+        : m_max_load_factor(maxLoadFactor)
+        , m_next_resize(0)
+    {
+    }
+
+    float32 power_of_two_rehash_policy::get_max_load_factor() const
+    {
+      return m_max_load_factor;
+    }
+
+    void power_of_two_rehash_policy::set_max_load_factor(float32 maxLoadFactor)
+    {
+      m_max_load_factor = maxLoadFactor;
+    }
+
+    uint32 power_of_two_rehash_policy::get_prev_bucket_count_only(uint32 bucketCountHint)
+    {
+      return (rsl::max)(rsl::bit_floor(bucketCountHint), 1u);
+    }
+
+    uint32 power_of_two_rehash_policy::get_prev_bucket_count(uint32 bucketCountHint) const
+    {
+      const uint32 bucket_count = get_prev_bucket_count_only(bucketCountHint);
+
+      m_next_resize = static_cast<uint32>(ceil(bucket_count * m_max_load_factor)); // NOLINT
+      return bucket_count;
+    }
+
+    uint32 power_of_two_rehash_policy::get_next_bucket_count(uint32 bucketCountHint) const
+    {
+      const uint32 bucket_count = round_up_to_power_of_two(bucketCountHint);
+
+      m_next_resize = static_cast<uint32>(ceil(bucket_count * m_max_load_factor)); // NOLINT
+      return bucket_count;
+    }
+
+    uint32 power_of_two_rehash_policy::get_bucket_count(uint32 elementCount) const
+    {
+      const float32 min_bucket_count = elementCount / m_max_load_factor; // NOLINT
+      return get_next_bucket_count(static_cast<uint32>(ceil(min_bucket_count)));
+    }
+
+    hash_required_result power_of_two_rehash_policy::is_rehash_required(uint32 bucketCount, uint32 elementCount, uint32 elementAdd) const
+    {
+      if((elementCount + elementAdd) >= m_next_resize)
+      {
+        const float32 min_bucket_count = (elementCount + elementAdd) / m_max_load_factor; // NOLINT
+
+        if(min_bucket_count > static_cast<float32>(bucketCount))
+        {
+          // at least double the bucket count, so the amortized cost of an insert stays constant
+          const uint32 wanted_bucket_count = (rsl::max)(static_cast<uint32>(ceil(min_bucket_count)), bucketCount * 2);
+          const uint32 new_bucket_count    = round_up_to_power_of_two(wanted_bucket_count);
+          m_next_resize                    = static_cast<uint32>(ceil(new_bucket_count * m_max_load_factor)); // NOLINT
+
+          return hash_required_result {static_cast<count_t>(new_bucket_count), true};
+        }
+        else
+        {
+          m_next_resize = static_cast<uint32>(ceil(bucketCount * m_max_load_factor)); // NOLINT
+          return hash_required_result {0, false};
+        }
+      }
+
+      return hash_required_result {0, false};
+    }
+
+  } // namespace v1
+} // namespace rsl
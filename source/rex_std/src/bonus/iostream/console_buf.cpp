@@ -12,10 +12,19 @@
 
 #include "rex_std/bonus/iostream/console_buf.h"
 
+#include "rex_std/internal/algorithm/min.h"
 #include "rex_std/internal/assert/assert_fwd.h"
+#include "rex_std/internal/memory/memcpy.h"
 #include "rex_std/internal/utility/size.h"
 
-#include <Windows.h>
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include <Windows.h>
+#elif defined(RSL_PLATFORM_LINUX)
+  #include <sys/uio.h>
+  #include <unistd.h>
+
+  #include <cerrno>
+#endif
 
 namespace rsl
 {
@@ -24,30 +33,229 @@ namespace rsl
 
     namespace internal
     {
-      console_buf_impl::console_buf_impl(win::handle_t handle)
+      namespace
+      {
+        // a single read or write syscall never transfers more than this
+        constexpr streamsize g_max_console_io_size = 1 << 30;
+
+        // a range of bytes to write to the console
+        struct console_chunk
+        {
+          const char8* data;
+          streamsize size;
+        };
+      } // namespace
+
+#if defined(RSL_PLATFORM_WINDOWS)
+      bool is_terminal(console_handle handle)
+      {
+        return GetFileType(handle) == FILE_TYPE_CHAR;
+      }
+      streamsize read_console(console_handle handle, char8* dst, streamsize size)
+      {
+        DWORD num_read = 0;
+        ReadFile(handle, dst, static_cast<DWORD>((rsl::min)(size, g_max_console_io_size)), &num_read, nullptr);
+        SetLastError(0); // we don't care if it works, just got to make sure SetLastError is always valid
+        return static_cast<streamsize>(num_read);
+      }
+      // Windows has no gather write for console handles, so every chunk is written on its own
+      bool write_console(console_handle handle, console_chunk* chunks, card32 numChunks)
+      {
+        for(card32 i = 0; i < numChunks; ++i)
+        {
+          const char8* src = chunks[i].data;
+          streamsize size  = chunks[i].size;
+          while(size > 0)
+          {
+            DWORD num_written = 0;
+            if(!WriteFile(handle, src, static_cast<DWORD>((rsl::min)(size, g_max_console_io_size)), &num_written, nullptr) || num_written == 0)
+            {
+              SetLastError(0); // we don't care if it works, just got to make sure SetLastError is always valid
+              return false;
+            }
+            src += num_written;
+            size -= static_cast<streamsize>(num_written);
+          }
+        }
+        return true;
+      }
+#elif defined(RSL_PLATFORM_LINUX)
+      bool is_terminal(console_handle handle)
+      {
+        return isatty(handle) == 1;
+      }
+      streamsize read_console(console_handle handle, char8* dst, streamsize size)
+      {
+        for(;;)
+        {
+          const ssize_t num_read = read(handle, dst, static_cast<size_t>((rsl::min)(size, g_max_console_io_size)));
+          if(num_read != -1)
+          {
+            return static_cast<streamsize>(num_read);
+          }
+          if(errno != EINTR)
+          {
+            return 0;
+          }
+        }
+      }
+      // all chunks are handed to the kernel in a single writev, which only needs another call after a partial write
+      bool write_console(console_handle handle, console_chunk* chunks, card32 numChunks)
+      {
+        constexpr card32 max_chunks = 2;
+        RSL_ASSERT_X(numChunks <= max_chunks, "too many chunks to write to the console at once");
+
+        iovec iov[max_chunks]; // NOLINT(modernize-avoid-c-arrays)
+        for(card32 i = 0; i < numChunks; ++i)
+        {
+          iov[i].iov_base = const_cast<char8*>(chunks[i].data); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+          iov[i].iov_len  = static_cast<size_t>(chunks[i].size);
+        }
+
+        iovec* current  = iov;
+        card32 num_left = numChunks;
+        while(num_left > 0)
+        {
+          ssize_t num_written = writev(handle, current, static_cast<int>(num_left));
+          if(num_written == -1)
+          {
+            if(errno == EINTR)
+            {
+              continue;
+            }
+            return false;
+          }
+
+          // skip what's written, the rest goes in the next call
+          while(num_left > 0 && static_cast<size_t>(num_written) >= current->iov_len)
+          {
+            num_written -= static_cast<ssize_t>(current->iov_len);
+            ++current;
+            --num_left;
+          }
+          if(num_left > 0)
+          {
+            current->iov_base = static_cast<char8*>(current->iov_base) + num_written;
+            current->iov_len -= static_cast<size_t>(num_written);
+          }
+        }
+        return true;
+      }
+#endif
+
+      bool write_console(console_handle handle, const char8* data, streamsize size)
+      {
+        console_chunk chunk = {data, size};
+        return write_console(handle, &chunk, 1);
+      }
+
+      console_buf_impl::console_buf_impl(console_handle handle)
           : m_get_area()
           , m_handle(handle)
+          , m_put_begin(nullptr)
+          , m_put_current(nullptr)
+          , m_put_end(nullptr)
+          , m_buffer_size(g_default_console_buffer_size)
+          , m_owns_buffer(true)
+          , m_is_line_buffered(is_terminal(handle))
       {
       }
 
       console_buf_impl::~console_buf_impl()
       {
+        flush_writes();
+        free_buffer();
         m_get_area.deallocate();
       }
 
+      bool console_buf_impl::is_line_buffered() const
+      {
+        return m_is_line_buffered;
+      }
+
+      void console_buf_impl::setbuf(char8* s, streamsize size)
+      {
+        flush_writes();
+        free_buffer();
+
+        m_buffer_size = size;
+        if(s != nullptr)
+        {
+          m_put_begin   = s;
+          m_put_current = s;
+          m_put_end     = s + size;
+          m_owns_buffer = false;
+        }
+      }
+
+      int32 console_buf_impl::sync()
+      {
+        return flush_writes() ? 0 : -1;
+      }
+
       streamsize console_buf_impl::xsgetn(char8* s, size_t elemSize, streamsize count)
       {
-        DWORD num_read = 0;
-        ReadFile(m_handle, s, static_cast<DWORD>(count * elemSize), &num_read, nullptr);
-        SetLastError(0); // we don't care if it works, just got to make sure SetLastError is always valid
-        return static_cast<streamsize>(num_read);
+        return read_console(m_handle, s, count * static_cast<streamsize>(elemSize));
       }
       streamsize console_buf_impl::xsputn(const char8* s, size_t elemSize, streamsize count)
       {
-        DWORD num_written = 0;
-        WriteFile(m_handle, s, static_cast<DWORD>(count * elemSize), &num_written, nullptr);
-        SetLastError(0); // we don't care if it works, just got to make sure SetLastError is always valid
-        return static_cast<streamsize>(num_written);
+        const streamsize size = count * static_cast<streamsize>(elemSize);
+
+        allocate_buffer();
+        const streamsize num_pending = m_put_current - m_put_begin;
+        if(num_pending + size <= m_buffer_size)
+        {
+          rsl::memcpy(m_put_current, s, static_cast<card64>(size));
+          m_put_current += size;
+
+          if(m_is_line_buffered && char_traits<char8>::find(s, static_cast<count_t>(size), '\n') != nullptr)
+          {
+            return flush_writes() ? size : 0;
+          }
+          return size;
+        }
+
+        // it doesn't fit, hand what's pending and the new bytes to the OS at once
+        console_chunk chunks[] = {{m_put_begin, num_pending}, {s, size}}; // NOLINT(modernize-avoid-c-arrays)
+        m_put_current          = m_put_begin;
+        return write_console(m_handle, chunks, static_cast<card32>(rsl::size(chunks))) ? size : 0;
+      }
+
+      void console_buf_impl::allocate_buffer()
+      {
+        if(m_put_begin != nullptr || m_buffer_size == 0)
+        {
+          return;
+        }
+
+        m_put_begin   = new char8[static_cast<size_t>(m_buffer_size)];
+        m_put_current = m_put_begin;
+        m_put_end     = m_put_begin + m_buffer_size;
+        m_owns_buffer = true;
+      }
+      void console_buf_impl::free_buffer()
+      {
+        if(m_owns_buffer)
+        {
+          delete[] m_put_begin;
+        }
+
+        m_put_begin   = nullptr;
+        m_put_current = nullptr;
+        m_put_end     = nullptr;
+        m_owns_buffer = true;
+      }
+      bool console_buf_impl::flush_writes()
+      {
+        const streamsize num_pending = m_put_current - m_put_begin;
+        if(num_pending == 0)
+        {
+          return true;
+        }
+
+        m_put_current       = m_put_begin;
+        console_chunk chunk = {m_put_begin, num_pending};
+        return write_console(m_handle, &chunk, 1);
       }
 
     } // namespace internal
@@ -0,0 +1,190 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: node_pool.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/bonus/memory/node_pool.h"
+
+#include "rex_std/internal/algorithm/min.h"
+#include "rex_std/internal/memory/allocator.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace
+    {
+      // the first slab of a size class holds this many blocks
+      constexpr card32 g_first_slab_block_count = 32;
+      // the header in front of a large allocation, a multiple of the granularity to keep the allocation aligned
+      constexpr card64 g_large_header_size = 2 * g_node_pool_granularity;
+
+      constexpr card32 size_class_index(card64 size)
+      {
+        // sizes of 0 are treated as 1, so they don't underflow
+        return size == 0 ? 0 : static_cast<card32>((size - 1) / g_node_pool_granularity);
+      }
+    } // namespace
+
+    node_pool::node_pool()
+        : m_size_classes()
+        , m_slabs(nullptr)
+        , m_large_allocations(nullptr)
+        , m_stats()
+    {
+      for(size_class& cls : m_size_classes)
+      {
+        cls.next_slab_block_count = g_first_slab_block_count;
+      }
+    }
+
+    node_pool::~node_pool()
+    {
+      release();
+    }
+
+    void* node_pool::allocate(card64 size)
+    {
+      if(size > g_node_pool_max_block_size)
+      {
+        static_assert(sizeof(large_header) <= g_large_header_size, "large header would misalign the allocation");
+
+        large_header* header = static_cast<large_header*>(rsl::allocator().allocate(g_large_header_size + size));
+        header->prev         = nullptr;
+        header->next         = m_large_allocations;
+        header->size         = size;
+        if(m_large_allocations)
+        {
+          m_large_allocations->prev = header;
+        }
+        m_large_allocations = header;
+
+        ++m_stats.live_large_allocations;
+        return reinterpret_cast<char8*>(header) + g_large_header_size; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      }
+
+      ++m_stats.live_nodes;
+      size_class& cls = m_size_classes[size_class_index(size)];
+
+      // recently freed blocks first, they're most likely still in cache
+      if(cls.free_list)
+      {
+        free_block* block = cls.free_list;
+        cls.free_list     = block->next;
+        return block;
+      }
+
+      const card32 block_size = (size_class_index(size) + 1) * g_node_pool_granularity;
+      if(cls.unused_begin != cls.unused_end)
+      {
+        void* block = cls.unused_begin;
+        cls.unused_begin += block_size;
+        return block;
+      }
+
+      return allocate_from_new_slab(cls, block_size);
+    }
+
+    void node_pool::deallocate(void* ptr, card64 size)
+    {
+      if(size > g_node_pool_max_block_size)
+      {
+        large_header* header = reinterpret_cast<large_header*>(static_cast<char8*>(ptr) - g_large_header_size); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        if(header->prev)
+        {
+          header->prev->next = header->next;
+        }
+        else
+        {
+          m_large_allocations = header->next;
+        }
+        if(header->next)
+        {
+          header->next->prev = header->prev;
+        }
+
+        --m_stats.live_large_allocations;
+        rsl::allocator().deallocate(header, g_large_header_size + size);
+        return;
+      }
+
+      --m_stats.live_nodes;
+      size_class& cls   = m_size_classes[size_class_index(size)];
+      free_block* block = static_cast<free_block*>(ptr);
+      block->next       = cls.free_list;
+      cls.free_list     = block;
+    }
+
+    void node_pool::release()
+    {
+      while(m_slabs)
+      {
+        slab_header* next = m_slabs->next;
+        rsl::allocator().deallocate(m_slabs, m_slabs->size);
+        m_slabs = next;
+      }
+
+      while(m_large_allocations)
+      {
+        large_header* next = m_large_allocations->next;
+        rsl::allocator().deallocate(m_large_allocations, g_large_header_size + m_large_allocations->size);
+        m_large_allocations = next;
+      }
+
+      for(size_class& cls : m_size_classes)
+      {
+        cls = size_class {nullptr, nullptr, nullptr, g_first_slab_block_count};
+      }
+
+      m_stats.live_nodes             = 0;
+      m_stats.slab_count             = 0;
+      m_stats.slab_bytes             = 0;
+      m_stats.live_large_allocations = 0;
+    }
+
+    const node_pool_stats& node_pool::stats() const
+    {
+      return m_stats;
+    }
+
+    node_pool& node_pool::thread_local_pool()
+    {
+      thread_local node_pool pool;
+      return pool;
+    }
+
+    void* node_pool::allocate_from_new_slab(size_class& sizeClass, card32 blockSize)
+    {
+      // the header is the size of the granularity, so the blocks following it keep their alignment
+      static_assert(sizeof(slab_header) <= g_node_pool_granularity, "slab header would misalign the blocks");
+
+      const card32 max_block_count = (g_node_pool_max_slab_size - g_node_pool_granularity) / blockSize;
+      const card32 block_count     = (rsl::min)(sizeClass.next_slab_block_count, max_block_count);
+      const card64 slab_size       = g_node_pool_granularity + static_cast<card64>(block_count) * blockSize;
+
+      slab_header* slab = static_cast<slab_header*>(rsl::allocator().allocate(slab_size));
+      slab->next        = m_slabs;
+      slab->size        = slab_size;
+      m_slabs           = slab;
+
+      ++m_stats.slab_count;
+      m_stats.slab_bytes += slab_size;
+
+      // every slab is twice as big as the previous one, so the number of slabs stays small
+      sizeClass.next_slab_block_count = (rsl::min)(block_count * 2, max_block_count);
+
+      char8* blocks          = reinterpret_cast<char8*>(slab) + g_node_pool_granularity; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      sizeClass.unused_begin = blocks + blockSize;
+      sizeClass.unused_end   = blocks + static_cast<card64>(block_count) * blockSize;
+      return blocks;
+    }
+
+  } // namespace v1
+} // namespace rsl
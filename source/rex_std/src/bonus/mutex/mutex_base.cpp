@@ -14,7 +14,16 @@
 
 #include "rex_std/assert.h"
 
-#include <Windows.h>
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include <Windows.h>
+#elif defined(RSL_PLATFORM_LINUX)
+  #include "rex_std/bonus/atomic/atomic_cmpxchg_strong.h"
+  #include "rex_std/bonus/atomic/atomic_cpu_pause.h"
+  #include "rex_std/bonus/atomic/atomic_exchange.h"
+  #include "rex_std/bonus/atomic/atomic_load.h"
+  #include "rex_std/bonus/atomic/atomic_store.h"
+  #include "rex_std/bonus/platform/linux/futex.h"
+#endif
 
 namespace rsl
 {
@@ -22,6 +31,7 @@ namespace rsl
   {
     namespace internal
     {
+#if defined(RSL_PLATFORM_WINDOWS)
       class mutex_base::internal
       {
         friend bool does_current_thread_own_mtx(mutex_base* mtx);
@@ -77,6 +87,120 @@ namespace rsl
         return mtx->native_handle()->m_count != 0 && mtx->native_handle()->m_thread_id == GetCurrentThreadId();
       }
 
+#elif defined(RSL_PLATFORM_LINUX)
+      namespace
+      {
+        // the whole mutex is a single 32 bit word, which is what the futex syscall operates on
+        constexpr uint32 g_mutex_unlocked = 0;
+        constexpr uint32 g_mutex_locked   = 1;
+        // locked and other threads might be sleeping on the mutex, unlocking has to wake 1 of them up
+        constexpr uint32 g_mutex_contended = 2;
+
+        // the number of times a thread polls a locked mutex before going to sleep.
+        // most critical sections are short, so the owner often unlocks the mutex before this runs out
+        // and the thread doesn't have to pay for 2 syscalls.
+        constexpr card32 g_mutex_spin_count = 100;
+      } // namespace
+
+      class mutex_base::internal
+      {
+        friend bool does_current_thread_own_mtx(mutex_base* mtx);
+
+      public:
+        internal()
+            : m_state(g_mutex_unlocked)
+            , m_thread_id(0)
+        {
+        }
+
+        void lock()
+        {
+          const uint32 thread_id = current_thread_id();
+          RSL_ASSERT_X(rsl::atomic_load(&m_thread_id, rsl::memory_order::relaxed) != thread_id, "deadlock! trying to lock the same mutex twice on the same thread");
+          uint32 expected = g_mutex_unlocked;
+          if(!rsl::atomic_cmpxchg_strong(&m_state, expected, g_mutex_locked, rsl::memory_order::acquire, rsl::memory_order::relaxed))
+          {
+            lock_contended();
+          }
+          rsl::atomic_store(&m_thread_id, thread_id, rsl::memory_order::relaxed);
+        }
+        bool try_lock()
+        {
+          uint32 expected = g_mutex_unlocked;
+          if(rsl::atomic_cmpxchg_strong(&m_state, expected, g_mutex_locked, rsl::memory_order::acquire, rsl::memory_order::relaxed))
+          {
+            rsl::atomic_store(&m_thread_id, current_thread_id(), rsl::memory_order::relaxed);
+            return true;
+          }
+          return false;
+        }
+        void unlock()
+        {
+          rsl::atomic_store(&m_thread_id, 0u, rsl::memory_order::relaxed);
+          if(rsl::atomic_exchange(&m_state, g_mutex_unlocked, rsl::memory_order::release) == g_mutex_contended)
+          {
+            futex_wake_one(&m_state);
+          }
+        }
+
+        void clear_owner()
+        {
+          rsl::atomic_store(&m_thread_id, static_cast<uint32>(-1), rsl::memory_order::relaxed);
+        }
+        void reset_owner()
+        {
+          rsl::atomic_store(&m_thread_id, current_thread_id(), rsl::memory_order::relaxed);
+        }
+        uint32* os_handle()
+        {
+          return &m_state;
+        }
+
+      private:
+        void lock_contended()
+        {
+          // spin for a bit first, going to sleep and waking up again is expensive
+          for(card32 i = 0; i < g_mutex_spin_count; ++i)
+          {
+            const uint32 state = rsl::atomic_load(&m_state, rsl::memory_order::relaxed);
+            if(state == g_mutex_contended)
+            {
+              // other threads are already sleeping on the mutex, no point in spinning any longer
+              break;
+            }
+
+            uint32 expected = g_mutex_unlocked;
+            if(state == g_mutex_unlocked && rsl::atomic_cmpxchg_strong(&m_state, expected, g_mutex_locked, rsl::memory_order::acquire, rsl::memory_order::relaxed))
+            {
+              return;
+            }
+
+            rsl::cpu_pause();
+          }
+
+          // mark the mutex as contended, so the owner wakes us up when it unlocks the mutex.
+          // if the exchange returns unlocked, we own the mutex. It stays marked as contended,
+          // which might cause 1 unnecessary wake up, but never a missed one.
+          while(rsl::atomic_exchange(&m_state, g_mutex_contended, rsl::memory_order::acquire) != g_mutex_unlocked)
+          {
+            futex_wait(&m_state, g_mutex_contended);
+          }
+        }
+
+      private:
+        uint32 m_state;
+        // only used to detect deadlocks, other threads read it while it's being written,
+        // so it's accessed atomically, but it doesn't need any ordering
+        uint32 m_thread_id;
+      };
+
+      bool does_current_thread_own_mtx(mutex_base* mtx)
+      {
+        return rsl::atomic_load(&mtx->native_handle()->m_thread_id, rsl::memory_order::relaxed) == current_thread_id();
+      }
+
+#endif
+
       void mtx_clear_owner(mutex_base::internal* mtx)
       {
         mtx->clear_owner();
@@ -89,6 +213,14 @@ namespace rsl
       {
         return mtx->os_handle();
       }
+      void mtx_lock(mutex_base::internal* mtx)
+      {
+        mtx->lock();
+      }
+      void mtx_unlock(mutex_base::internal* mtx)
+      {
+        mtx->unlock();
+      }
 
       static_assert(sizeof(mutex_base::internal) <= g_mutex_size, "incorrect g_mutex_size");
       static_assert(alignof(mutex_base::internal) <= g_mutex_alignment, "incorrect g_mutex_alignment");
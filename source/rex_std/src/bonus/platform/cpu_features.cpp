@@ -0,0 +1,105 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: cpu_features.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/bonus/platform/cpu_features.h"
+
+#if defined(RSL_PLATFORM_X64) || defined(RSL_PLATFORM_X86)
+  #if defined(RSL_COMPILER_MSVC)
+    #include <intrin.h>
+  #else
+    #include <cpuid.h>
+  #endif
+#elif defined(RSL_PLATFORM_ARM64) && defined(__linux__)
+  #include <sys/auxv.h>
+#endif
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+#if defined(RSL_PLATFORM_X64) || defined(RSL_PLATFORM_X86)
+      void cpuid(int32 leaf, int32 subleaf, uint32 (&regs)[4])
+      {
+  #if defined(RSL_COMPILER_MSVC)
+        int32 info[4] = {};
+        __cpuidex(info, leaf, subleaf);
+        regs[0] = static_cast<uint32>(info[0]);
+        regs[1] = static_cast<uint32>(info[1]);
+        regs[2] = static_cast<uint32>(info[2]);
+        regs[3] = static_cast<uint32>(info[3]);
+  #else
+        __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+  #endif
+      }
+
+      // The OS needs to save the ymm registers on a context switch,
+      // otherwise we can't use AVX even if the cpu supports it.
+      bool os_saves_ymm_registers()
+      {
+  #if defined(RSL_COMPILER_MSVC)
+        const uint64 xcr0 = _xgetbv(0);
+  #else
+        uint32 eax = 0;
+        uint32 edx = 0;
+        __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0)); // NOLINT(hicpp-no-assembler)
+        const uint64 xcr0 = (static_cast<uint64>(edx) << 32) | eax;
+  #endif
+        constexpr uint64 xmm_and_ymm_state = 0x6;
+        return (xcr0 & xmm_and_ymm_state) == xmm_and_ymm_state;
+      }
+#endif
+
+      cpu_feature_set query_cpu_features()
+      {
+        cpu_feature_set features {};
+
+#if defined(RSL_PLATFORM_X64) || defined(RSL_PLATFORM_X86)
+        uint32 regs[4] = {};
+        cpuid(0, 0, regs);
+        const uint32 max_leaf = regs[0];
+
+        cpuid(1, 0, regs);
+        const uint32 ecx = regs[2];
+        const uint32 edx = regs[3];
+
+        features.sse2  = (edx & (1u << 26)) != 0;
+        features.sse42 = (ecx & (1u << 20)) != 0;
+
+        const bool has_osxsave = (ecx & (1u << 27)) != 0;
+        const bool has_avx     = (ecx & (1u << 28)) != 0;
+        if(max_leaf >= 7 && has_osxsave && has_avx && os_saves_ymm_registers())
+        {
+          cpuid(7, 0, regs);
+          features.avx2 = (regs[1] & (1u << 5)) != 0;
+        }
+#elif defined(RSL_PLATFORM_ARM64) && defined(__linux__)
+        // From 'arch/arm64/include/uapi/asm/hwcap.h' in Linux kernel source code.
+        constexpr ulong hwcap_pmull = 1 << 4;
+        constexpr ulong hwcap_crc32 = 1 << 7;
+        const ulong hwcap           = getauxval(AT_HWCAP);
+        features.arm64_pmull        = (hwcap & hwcap_pmull) != 0;
+        features.arm64_crc32        = (hwcap & hwcap_crc32) != 0;
+#endif
+
+        return features;
+      }
+    } // namespace internal
+
+    const cpu_feature_set& cpu_features()
+    {
+      static const cpu_feature_set features = internal::query_cpu_features();
+      return features;
+    }
+  } // namespace v1
+} // namespace rsl
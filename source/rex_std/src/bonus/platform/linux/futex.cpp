@@ -0,0 +1,74 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: futex.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/bonus/platform/linux/futex.h"
+
+#if defined(RSL_PLATFORM_LINUX)
+
+  #include <climits>
+  #include <linux/futex.h>
+  #include <sys/syscall.h>
+  #include <time.h>
+  #include <unistd.h>
+
+  #include <cerrno>
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      namespace
+      {
+        long futex(uint32* addr, int op, uint32 val, const timespec* timeout)
+        {
+          return syscall(SYS_futex, addr, op, val, timeout, nullptr, 0);
+        }
+      } // namespace
+
+      bool futex_wait(uint32* addr, uint32 expected, int32 timeoutMs)
+      {
+        // all futexes used by rsl are private to the process, which lets the kernel skip the shared mapping lookup
+        if(timeoutMs < 0)
+        {
+          futex(addr, FUTEX_WAIT_PRIVATE, expected, nullptr);
+          return true;
+        }
+
+        timespec timeout {};
+        timeout.tv_sec  = timeoutMs / 1000;
+        timeout.tv_nsec = static_cast<long>(timeoutMs % 1000) * 1'000'000;
+        return futex(addr, FUTEX_WAIT_PRIVATE, expected, &timeout) == 0 || errno != ETIMEDOUT;
+      }
+
+      void futex_wake_one(uint32* addr)
+      {
+        futex(addr, FUTEX_WAKE_PRIVATE, 1, nullptr);
+      }
+
+      void futex_wake_all(uint32* addr)
+      {
+        futex(addr, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr);
+      }
+
+      uint32 current_thread_id()
+      {
+        // the syscall is cheap, but locking a mutex is cheaper, so cache it
+        thread_local const uint32 thread_id = static_cast<uint32>(syscall(SYS_gettid));
+        return thread_id;
+      }
+    } // namespace internal
+  }   // namespace v1
+} // namespace rsl
+
+#endif
@@ -0,0 +1,212 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: task_allocator.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/bonus/thread/task_allocator.h"
+
+#include "rex_std/assert.h"
+#include "rex_std/internal/memory/allocator.h"
+#include "rex_std/internal/memory/byte.h"
+#include "rex_std/internal/mutex/unique_lock.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace
+    {
+      // blocks of the global heap don't belong to any cache
+      constexpr card32 g_task_allocator_large_size_class = -1;
+
+      card64 block_size(card32 sizeClass)
+      {
+        return internal::g_task_allocator_min_block_size << sizeClass;
+      }
+
+      // returns the smallest size class the size fits in, or the large size class if it doesn't fit any
+      card32 size_class_for(card64 size)
+      {
+        for(card32 size_class = 0; size_class < internal::g_task_allocator_num_size_classes; ++size_class)
+        {
+          if(size <= block_size(size_class))
+          {
+            return size_class;
+          }
+        }
+
+        return g_task_allocator_large_size_class;
+      }
+    } // namespace
+
+    // sits right in front of every block handed out, it stays valid while the block is free
+    struct alignas(task_allocator::alignment) task_allocator::block_header
+    {
+      card32 cache_index;
+      card32 size_class;
+      // only used by blocks allocated from the global heap
+      card64 size;
+    };
+
+    // a free block reuses the memory handed out to the user to link it to the other free blocks
+    struct task_allocator::free_block
+    {
+      free_block* next;
+    };
+
+    struct alignas(task_allocator::alignment) task_allocator::slab
+    {
+      slab* next;
+    };
+
+    struct alignas(internal::g_task_allocator_padding) task_allocator::cache
+    {
+      cache()
+          : slabs(nullptr)
+      {
+        for(card32 i = 0; i < internal::g_task_allocator_num_size_classes; ++i)
+        {
+          local_free[i] = nullptr;
+          remote_free[i].store(nullptr, rsl::memory_order_relaxed);
+        }
+      }
+
+      // only touched by the thread owning the cache
+      free_block* local_free[internal::g_task_allocator_num_size_classes]; // NOLINT(modernize-avoid-c-arrays)
+      slab* slabs;
+      // blocks freed by other threads, kept away from the fields only the owner touches
+      alignas(internal::g_task_allocator_padding) rsl::atomic<free_block*> remote_free[internal::g_task_allocator_num_size_classes]; // NOLINT(modernize-avoid-c-arrays)
+    };
+
+    task_allocator::task_allocator(card32 numCaches)
+        : m_caches()
+        , m_shared_mtx()
+    {
+      m_caches.reserve(numCaches + 1);
+      for(card32 i = 0; i < numCaches + 1; ++i)
+      {
+        m_caches.push_back(rsl::make_unique<cache>());
+      }
+    }
+
+    task_allocator::~task_allocator()
+    {
+      rsl::allocator alloc;
+      for(rsl::unique_ptr<cache>& cache : m_caches)
+      {
+        slab* slab = cache->slabs;
+        while(slab != nullptr)
+        {
+          task_allocator::slab* next = slab->next;
+          alloc.deallocate(slab, internal::g_task_allocator_slab_size);
+          slab = next;
+        }
+      }
+    }
+
+    void* task_allocator::allocate(card64 size, card32 cacheIndex)
+    {
+      RSL_ASSERT_X(cacheIndex >= 0 && cacheIndex < static_cast<card32>(m_caches.size()) - 1, "invalid task allocator cache index");
+      return allocate_from(*m_caches[cacheIndex], cacheIndex, size);
+    }
+
+    void* task_allocator::allocate_shared(card64 size)
+    {
+      const card32 shared_index = static_cast<card32>(m_caches.size()) - 1;
+
+      const rsl::unique_lock<rsl::mutex> lock(m_shared_mtx);
+      return allocate_from(*m_caches[shared_index], shared_index, size);
+    }
+
+    void task_allocator::deallocate(void* ptr, card32 cacheIndex)
+    {
+      block_header* header = static_cast<block_header*>(ptr) - 1;
+      if(header->size_class == g_task_allocator_large_size_class)
+      {
+        rsl::allocator alloc;
+        alloc.deallocate(header, sizeof(block_header) + header->size);
+        return;
+      }
+
+      free_block* block = static_cast<free_block*>(ptr);
+      cache& owner      = *m_caches[header->cache_index];
+      if(header->cache_index == cacheIndex)
+      {
+        block->next                          = owner.local_free[header->size_class];
+        owner.local_free[header->size_class] = block;
+        return;
+      }
+
+      // the owner only ever takes the whole list at once, so a block getting reused
+      // while we're pushing can't corrupt the list
+      rsl::atomic<free_block*>& remote_free = owner.remote_free[header->size_class];
+      free_block* head                      = remote_free.load(rsl::memory_order_relaxed);
+      do // NOLINT(cppcoreguidelines-avoid-do-while)
+      {
+        block->next = head;
+      } while(!remote_free.compare_exchange_strong(head, block, rsl::memory_order_release, rsl::memory_order_relaxed));
+    }
+
+    void* task_allocator::allocate_from(cache& cache, card32 cacheIndex, card64 size)
+    {
+      const card32 size_class = size_class_for(size);
+      if(size_class == g_task_allocator_large_size_class)
+      {
+        rsl::allocator alloc;
+        block_header* header = static_cast<block_header*>(alloc.allocate(sizeof(block_header) + size));
+        header->cache_index  = cacheIndex;
+        header->size_class   = g_task_allocator_large_size_class;
+        header->size         = size;
+        return header + 1;
+      }
+
+      free_block* block = cache.local_free[size_class];
+      if(block == nullptr)
+      {
+        block = cache.remote_free[size_class].exchange(nullptr, rsl::memory_order_acquire);
+        if(block == nullptr)
+        {
+          block = carve_slab(cache, cacheIndex, size_class);
+        }
+      }
+
+      cache.local_free[size_class] = block->next;
+      return block;
+    }
+
+    task_allocator::free_block* task_allocator::carve_slab(cache& cache, card32 cacheIndex, card32 sizeClass)
+    {
+      rsl::allocator alloc;
+      slab* new_slab = static_cast<slab*>(alloc.allocate(internal::g_task_allocator_slab_size));
+      new_slab->next = cache.slabs;
+      cache.slabs    = new_slab;
+
+      // every block is preceded by its header, the headers are written once and never change
+      const card64 stride     = sizeof(block_header) + block_size(sizeClass);
+      const card64 num_blocks = (internal::g_task_allocator_slab_size - sizeof(slab)) / stride;
+      rsl::byte* first        = reinterpret_cast<rsl::byte*>(new_slab + 1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+      free_block* head = nullptr;
+      for(card64 i = num_blocks; i > 0; --i)
+      {
+        block_header* header = reinterpret_cast<block_header*>(first + (i - 1) * stride); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        header->cache_index  = cacheIndex;
+        header->size_class   = sizeClass;
+        header->size         = 0;
+
+        free_block* block = reinterpret_cast<free_block*>(header + 1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        block->next       = head;
+        head              = block;
+      }
+
+      return head;
+    }
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,423 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: thread_pool.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/bonus/thread/thread_pool.h"
+
+#include "rex_std/assert.h"
+#include "rex_std/bonus/atomic/atomic_cpu_pause.h"
+#include "rex_std/internal/chrono/duration.h"
+#include "rex_std/internal/mutex/unique_lock.h"
+#include "rex_std/internal/thread/this_thread.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace
+    {
+      // the worker running on this thread, nullptr if this thread isn't a worker of any pool
+      thread_local internal::pool_worker* g_current_worker = nullptr;
+
+      // a worker that can't find any work spins for a while before it yields
+      // and yields for a while before it goes to sleep, going to sleep and waking up is expensive
+      constexpr card32 g_thread_pool_spin_rounds  = 32;
+      constexpr card32 g_thread_pool_yield_rounds = 64;
+      // a sleeping worker checks for work every so often, even if nobody woke it up.
+      // this catches a wake up that got lost because the scheduling thread didn't see
+      // the worker going to sleep yet
+      constexpr card32 g_thread_pool_park_timeout_ms = 5;
+
+      // 0 workers means a worker for every hardware thread
+      card32 resolve_num_workers(card32 numWorkers)
+      {
+        return numWorkers != 0 ? numWorkers : (rsl::max)(rsl::thread::hardware_concurrency(), card32(1));
+      }
+
+      // xorshift, only used to spread the steal attempts over the workers
+      uint32 next_random(uint32& seed)
+      {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed;
+      }
+
+      // backs off a little more every time a thread fails to find any work
+      void back_off(card32 idleRounds)
+      {
+        if(idleRounds < g_thread_pool_spin_rounds)
+        {
+          rsl::cpu_pause();
+        }
+        else
+        {
+          rsl::this_thread::yield();
+        }
+      }
+
+      // runs a task scheduled from outside the pool and notifies the thread waiting for it
+      class external_task : public internal::pool_task
+      {
+      public:
+        explicit external_task(internal::pool_task* task)
+            : pool_task(&external_task::execute_impl)
+            , m_task(task)
+            , m_done(false)
+        {
+        }
+
+        void wait()
+        {
+          rsl::unique_lock<rsl::mutex> lock(m_mtx);
+          m_cv.wait(lock, [this]() { return m_done; });
+        }
+
+      private:
+        static void execute_impl(internal::pool_task* task)
+        {
+          external_task* self = static_cast<external_task*>(task);
+          self->m_task->execute();
+
+          // notify while holding the lock, the waiting thread destroys the task as soon as it sees m_done
+          const rsl::unique_lock<rsl::mutex> lock(self->m_mtx);
+          self->m_done = true;
+          self->m_cv.notify_one();
+        }
+
+      private:
+        internal::pool_task* m_task;
+        rsl::mutex m_mtx;
+        rsl::condition_variable m_cv;
+        bool m_done;
+      };
+    } // namespace
+
+    thread_pool::thread_pool()
+        : thread_pool(0)
+    {
+    }
+
+    thread_pool::thread_pool(card32 numWorkers)
+        : m_workers()
+        , m_threads()
+        , m_task_allocator(resolve_num_workers(numWorkers))
+        , m_injection_mtx()
+        , m_injection_head(nullptr)
+        , m_injection_tail(nullptr)
+        , m_num_injected(0)
+        , m_sleep_mtx()
+        , m_sleep_cv()
+        , m_wake_epoch(0)
+        , m_num_sleeping(0)
+        , m_stop(false)
+    {
+      numWorkers = resolve_num_workers(numWorkers);
+
+      // all workers need to exist before any of them starts stealing from the others
+      m_workers.reserve(numWorkers);
+      for(card32 i = 0; i < numWorkers; ++i)
+      {
+        rsl::unique_ptr<internal::pool_worker> worker = rsl::make_unique<internal::pool_worker>();
+        worker->pool                                  = this;
+        worker->index                                 = i;
+        worker->steal_seed                            = i * 2654435761u + 1; // never 0, xorshift would get stuck on it
+        m_workers.push_back(rsl::move(worker));
+      }
+
+      m_threads.reserve(numWorkers);
+      for(rsl::unique_ptr<internal::pool_worker>& worker : m_workers)
+      {
+        internal::pool_worker* worker_ptr = worker.get();
+        m_threads.emplace_back([this, worker_ptr]() { worker_main(worker_ptr); });
+      }
+    }
+
+    thread_pool::~thread_pool()
+    {
+      m_stop.store(true, rsl::memory_order_release);
+      wake_all();
+
+      for(rsl::thread& thread : m_threads)
+      {
+        thread.join();
+      }
+    }
+
+    thread_pool& thread_pool::default_pool()
+    {
+      static thread_pool pool;
+      return pool;
+    }
+
+    card32 thread_pool::num_workers() const
+    {
+      return static_cast<card32>(m_workers.size());
+    }
+
+    internal::pool_worker* thread_pool::current_worker() const
+    {
+      internal::pool_worker* worker = g_current_worker;
+      return worker != nullptr && worker->pool == this ? worker : nullptr;
+    }
+
+    void thread_pool::push(internal::pool_worker* worker, internal::pool_task* task)
+    {
+      worker->deque.push(task);
+      wake_one();
+    }
+
+    bool thread_pool::pop_if_top(internal::pool_worker* worker, internal::pool_task* task)
+    {
+      // tasks are popped in the reverse order they're pushed, everything pushed after the task
+      // is already finished. So the top is either the task or it got stolen and the deque is empty
+      internal::pool_task* top = worker->deque.pop();
+      RSL_ASSERT_X(top == nullptr || top == task, "thread pool tasks got popped out of order");
+      return top == task;
+    }
+
+    void thread_pool::help(internal::pool_worker* worker, card32& idleRounds)
+    {
+      internal::pool_task* task = find_task(worker);
+      if(task != nullptr)
+      {
+        task->execute();
+        idleRounds = 0;
+      }
+      else
+      {
+        back_off(idleRounds++);
+      }
+    }
+
+    void thread_pool::schedule(internal::pool_task* task)
+    {
+      internal::pool_worker* worker = current_worker();
+      if(worker != nullptr)
+      {
+        push(worker, task);
+      }
+      else
+      {
+        inject(task);
+      }
+    }
+
+    void* thread_pool::allocate_task(card64 size)
+    {
+      internal::pool_worker* worker = current_worker();
+      return worker != nullptr ? m_task_allocator.allocate(size, worker->index) : m_task_allocator.allocate_shared(size);
+    }
+
+    void thread_pool::deallocate_task(void* ptr)
+    {
+      internal::pool_worker* worker = current_worker();
+      m_task_allocator.deallocate(ptr, worker != nullptr ? worker->index : task_allocator::no_cache);
+    }
+
+    void thread_pool::run_external(internal::pool_task* task)
+    {
+      external_task wrapper(task);
+      inject(&wrapper);
+      wrapper.wait();
+    }
+
+    void thread_pool::worker_main(internal::pool_worker* worker)
+    {
+      g_current_worker = worker;
+
+      card32 idle_rounds = 0;
+      for(;;)
+      {
+        internal::pool_task* task = find_task(worker);
+        if(task != nullptr)
+        {
+          task->execute();
+          idle_rounds = 0;
+          continue;
+        }
+
+        // only stop once all scheduled work is done
+        if(m_stop.load(rsl::memory_order_acquire))
+        {
+          break;
+        }
+
+        if(idle_rounds < g_thread_pool_yield_rounds)
+        {
+          back_off(idle_rounds++);
+        }
+        else
+        {
+          park();
+          idle_rounds = 0;
+        }
+      }
+
+      g_current_worker = nullptr;
+    }
+
+    internal::pool_task* thread_pool::find_task(internal::pool_worker* worker)
+    {
+      internal::pool_task* task = worker->deque.pop();
+      if(task != nullptr)
+      {
+        return task;
+      }
+
+      task = pop_injected_task();
+      if(task != nullptr)
+      {
+        return task;
+      }
+
+      return steal_task(worker);
+    }
+
+    internal::pool_task* thread_pool::steal_task(internal::pool_worker* worker)
+    {
+      // start at a random victim, so thieves don't all go after the same worker
+      const card32 num_workers = static_cast<card32>(m_workers.size());
+      const card32 start       = next_random(worker->steal_seed) % num_workers;
+      for(card32 i = 0; i < num_workers; ++i)
+      {
+        internal::pool_worker* victim = m_workers[(start + i) % num_workers].get();
+        if(victim == worker)
+        {
+          continue;
+        }
+
+        internal::pool_task* task = victim->deque.steal();
+        if(task != nullptr)
+        {
+          return task;
+        }
+      }
+
+      return nullptr;
+    }
+
+    internal::pool_task* thread_pool::pop_injected_task()
+    {
+      // avoid taking the lock when there's nothing to take, which is almost always
+      if(m_num_injected.load(rsl::memory_order_relaxed) == 0)
+      {
+        return nullptr;
+      }
+
+      const rsl::unique_lock<rsl::mutex> lock(m_injection_mtx);
+      internal::pool_task* task = m_injection_head;
+      if(task != nullptr)
+      {
+        m_injection_head = task->next();
+        if(m_injection_head == nullptr)
+        {
+          m_injection_tail = nullptr;
+        }
+        task->set_next(nullptr);
+        m_num_injected.fetch_sub(1, rsl::memory_order_relaxed);
+      }
+
+      return task;
+    }
+
+    void thread_pool::inject(internal::pool_task* task)
+    {
+      {
+        const rsl::unique_lock<rsl::mutex> lock(m_injection_mtx);
+        if(m_injection_tail != nullptr)
+        {
+          m_injection_tail->set_next(task);
+        }
+        else
+        {
+          m_injection_head = task;
+        }
+        m_injection_tail = task;
+        m_num_injected.fetch_add(1, rsl::memory_order_relaxed);
+      }
+
+      wake_one();
+    }
+
+    bool thread_pool::has_work() const
+    {
+      if(m_num_injected.load(rsl::memory_order_seq_cst) != 0)
+      {
+        return true;
+      }
+
+      for(const rsl::unique_ptr<internal::pool_worker>& worker : m_workers)
+      {
+        if(!worker->deque.empty())
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    void thread_pool::park()
+    {
+      rsl::unique_lock<rsl::mutex> lock(m_sleep_mtx);
+
+      // announce we're going to sleep before checking for work one last time,
+      // a thread scheduling work after this sees us sleeping and wakes us up
+      m_num_sleeping.fetch_add(1, rsl::memory_order_seq_cst);
+      if(!has_work() && !m_stop.load(rsl::memory_order_acquire))
+      {
+        const card64 epoch = m_wake_epoch;
+        m_sleep_cv.wait_for(lock, rsl::chrono::milliseconds(g_thread_pool_park_timeout_ms), [&]() { return m_wake_epoch != epoch || m_stop.load(rsl::memory_order_relaxed); });
+      }
+      m_num_sleeping.fetch_sub(1, rsl::memory_order_seq_cst);
+    }
+
+    void thread_pool::wake_one()
+    {
+      // most of the time all workers are busy and this is all we pay for scheduling a task
+      if(m_num_sleeping.load(rsl::memory_order_seq_cst) == 0)
+      {
+        return;
+      }
+
+      {
+        const rsl::unique_lock<rsl::mutex> lock(m_sleep_mtx);
+        ++m_wake_epoch;
+      }
+      m_sleep_cv.notify_one();
+    }
+
+    void thread_pool::wake_all()
+    {
+      {
+        const rsl::unique_lock<rsl::mutex> lock(m_sleep_mtx);
+        ++m_wake_epoch;
+      }
+      m_sleep_cv.notify_all();
+    }
+
+    namespace internal
+    {
+      bool help_pool_until_ready(const future_shared_state_base& state)
+      {
+        pool_worker* worker = g_current_worker;
+        if(worker == nullptr)
+        {
+          return false;
+        }
+
+        worker->pool->wait_until(worker, [&]() { return state.is_ready(); });
+        return true;
+      }
+    } // namespace internal
+  } // namespace v1
+} // namespace rsl
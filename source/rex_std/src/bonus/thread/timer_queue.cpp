@@ -0,0 +1,157 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: timer_queue.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/bonus/thread/timer_queue.h"
+
+#include "rex_std/internal/mutex/unique_lock.h"
+#include "rex_std/internal/utility/swap.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    timer_queue::timer_queue()
+        : m_mtx()
+        , m_cv()
+        , m_timers()
+        , m_stop(false)
+        // the thread is the last member, everything it uses is initialized by the time it starts
+        , m_thread([this]() { timer_main(); })
+    {
+    }
+
+    timer_queue::~timer_queue()
+    {
+      {
+        const rsl::unique_lock<rsl::mutex> lock(m_mtx);
+        m_stop = true;
+      }
+      m_cv.notify_one();
+      m_thread.join();
+    }
+
+    timer_queue& timer_queue::default_queue()
+    {
+      static timer_queue queue;
+      return queue;
+    }
+
+    void timer_queue::schedule(internal::timer_entry* timer, chrono::steady_clock::time_point deadline)
+    {
+      timer->set_deadline(deadline);
+
+      bool is_earliest = false;
+      {
+        const rsl::unique_lock<rsl::mutex> lock(m_mtx);
+        push_timer(timer);
+        is_earliest = m_timers.front() == timer;
+      }
+
+      // the timer thread only needs to wake up if it's sleeping until a later deadline
+      if(is_earliest)
+      {
+        m_cv.notify_one();
+      }
+    }
+
+    void timer_queue::timer_main()
+    {
+      rsl::unique_lock<rsl::mutex> lock(m_mtx);
+      for(;;)
+      {
+        if(m_stop)
+        {
+          break;
+        }
+
+        if(m_timers.empty())
+        {
+          m_cv.wait(lock);
+          continue;
+        }
+
+        const chrono::steady_clock::time_point deadline = m_timers.front()->deadline();
+        if(chrono::steady_clock::now() < deadline)
+        {
+          m_cv.wait_until(lock, deadline);
+          continue;
+        }
+
+        // firing a timer can schedule another one, so the lock is released while it fires
+        internal::timer_entry* timer = pop_timer();
+        lock.unlock();
+        timer->fire();
+        lock.lock();
+      }
+
+      // fire whatever is left, including timers scheduled by the ones firing here
+      while(!m_timers.empty())
+      {
+        internal::timer_entry* timer = pop_timer();
+        lock.unlock();
+        timer->fire();
+        lock.lock();
+      }
+    }
+
+    void timer_queue::push_timer(internal::timer_entry* timer)
+    {
+      m_timers.push_back(timer);
+
+      // sift up until the parent fires earlier
+      card32 index = static_cast<card32>(m_timers.size()) - 1;
+      while(index > 0)
+      {
+        const card32 parent = (index - 1) / 2;
+        if(!(m_timers[index]->deadline() < m_timers[parent]->deadline()))
+        {
+          break;
+        }
+        rsl::swap(m_timers[index], m_timers[parent]);
+        index = parent;
+      }
+    }
+
+    internal::timer_entry* timer_queue::pop_timer()
+    {
+      internal::timer_entry* earliest = m_timers.front();
+      m_timers.front()                = m_timers.back();
+      m_timers.pop_back();
+
+      // sift down until both children fire later
+      const card32 size = static_cast<card32>(m_timers.size());
+      card32 index      = 0;
+      for(;;)
+      {
+        const card32 left  = index * 2 + 1;
+        const card32 right = left + 1;
+        card32 smallest    = index;
+        if(left < size && m_timers[left]->deadline() < m_timers[smallest]->deadline())
+        {
+          smallest = left;
+        }
+        if(right < size && m_timers[right]->deadline() < m_timers[smallest]->deadline())
+        {
+          smallest = right;
+        }
+        if(smallest == index)
+        {
+          break;
+        }
+        rsl::swap(m_timers[index], m_timers[smallest]);
+        index = smallest;
+      }
+
+      return earliest;
+    }
+  } // namespace v1
+} // namespace rsl
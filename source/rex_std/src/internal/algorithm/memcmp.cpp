@@ -0,0 +1,175 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: memcmp.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/internal/algorithm/memcmp.h"
+
+#include "rex_std/bonus/platform/cpu_features.h"
+#include "rex_std/internal/bit/countr_zero.h"
+
+#if defined(RSL_PLATFORM_X64) || defined(RSL_PLATFORM_X86)
+  #include <immintrin.h>
+  #define RSL_MEMCMP_SIMD
+#endif
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      namespace
+      {
+        using memcmp_func = int32 (*)(const uint8*, const uint8*, card64);
+
+#if defined(RSL_COMPILER_MSVC)
+        using unaligned_uint64 = uint64;
+#else
+        // this tells the compiler the load can be unaligned and aliases other types
+        typedef uint64 unaligned_uint64 __attribute__((__may_alias__, __aligned__(1))); // NOLINT(modernize-use-using)
+#endif
+
+        int32 compare_bytes(const uint8* lhs, const uint8* rhs, card64 count)
+        {
+          for(card64 i = 0; i < count; ++i)
+          {
+            if(lhs[i] != rhs[i])
+            {
+              return lhs[i] - rhs[i];
+            }
+          }
+          return 0;
+        }
+
+        int32 memcmp_word(const uint8* lhs, const uint8* rhs, card64 count)
+        {
+          // skip over the equal words, the bytes of the first different word get compared one by one
+          while(count >= 8)
+          {
+            const uint64 lhs_word = *reinterpret_cast<const unaligned_uint64*>(lhs); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const uint64 rhs_word = *reinterpret_cast<const unaligned_uint64*>(rhs); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            if(lhs_word != rhs_word)
+            {
+              return compare_bytes(lhs, rhs, 8);
+            }
+            lhs += 8;
+            rhs += 8;
+            count -= 8;
+          }
+
+          return compare_bytes(lhs, rhs, count);
+        }
+
+#if defined(RSL_MEMCMP_SIMD)
+        // returns the difference between the first mismatching byte of a block
+        // mask has a bit set for every byte that's equal in the block
+        int32 block_difference(const uint8* lhs, const uint8* rhs, uint32 equal_mask)
+        {
+          const int32 idx = rsl::countr_zero(~equal_mask);
+          return lhs[idx] - rhs[idx];
+        }
+
+        int32 memcmp_sse2(const uint8* lhs, const uint8* rhs, card64 count)
+        {
+          if(count < 16)
+          {
+            return memcmp_word(lhs, rhs, count);
+          }
+
+          constexpr uint32 all_equal = 0xFFFF;
+          const uint8* lhs_end       = lhs + count;
+          while(lhs_end - lhs >= 16)
+          {
+            const __m128i a   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const __m128i b   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const uint32 mask = static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+            if(mask != all_equal)
+            {
+              return block_difference(lhs, rhs, mask);
+            }
+            lhs += 16;
+            rhs += 16;
+          }
+
+          // compare the last 16 bytes, overlapping with what we've already compared
+          const card64 remaining = lhs_end - lhs;
+          if(remaining != 0)
+          {
+            lhs               = lhs - 16 + remaining;
+            rhs               = rhs - 16 + remaining;
+            const __m128i a   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const __m128i b   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const uint32 mask = static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+            if(mask != all_equal)
+            {
+              return block_difference(lhs, rhs, mask);
+            }
+          }
+
+          return 0;
+        }
+
+        RSL_TARGET_AVX2 int32 memcmp_avx2(const uint8* lhs, const uint8* rhs, card64 count)
+        {
+          if(count < 32)
+          {
+            return memcmp_sse2(lhs, rhs, count);
+          }
+
+          constexpr uint32 all_equal = 0xFFFFFFFF;
+          const uint8* lhs_end       = lhs + count;
+          while(lhs_end - lhs >= 32)
+          {
+            const __m256i a   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const __m256i b   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const uint32 mask = static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+            if(mask != all_equal)
+            {
+              return block_difference(lhs, rhs, mask);
+            }
+            lhs += 32;
+            rhs += 32;
+          }
+
+          // compare the last 32 bytes, overlapping with what we've already compared
+          const card64 remaining = lhs_end - lhs;
+          if(remaining != 0)
+          {
+            lhs               = lhs - 32 + remaining;
+            rhs               = rhs - 32 + remaining;
+            const __m256i a   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const __m256i b   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const uint32 mask = static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+            if(mask != all_equal)
+            {
+              return block_difference(lhs, rhs, mask);
+            }
+          }
+
+          return 0;
+        }
+#endif
+
+        constexpr cpu_kernel<memcmp_func> g_memcmp_kernels[] = {
+#if defined(RSL_MEMCMP_SIMD)
+            {&cpu_has_avx2, &memcmp_avx2},
+            {&cpu_has_sse2, &memcmp_sse2},
+#endif
+            {nullptr, &memcmp_word}};
+      } // namespace
+
+      int32 memcmp_runtime(const void* first1, const void* first2, card64 count)
+      {
+        return best_cpu_kernel<g_memcmp_kernels>()(static_cast<const uint8*>(first1), static_cast<const uint8*>(first2), count);
+      }
+    } // namespace internal
+  }   // namespace v1
+} // namespace rsl
@@ -17,12 +17,22 @@
 #include "rex_std/internal/exception/teminate.h"
 #include "rex_std/internal/thread/this_thread.h"
 
-#include <Windows.h>
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include <Windows.h>
+#elif defined(RSL_PLATFORM_LINUX)
+  #include "rex_std/bonus/atomic/atomic_fetch_add.h"
+  #include "rex_std/bonus/atomic/atomic_load.h"
+  #include "rex_std/bonus/platform/linux/futex.h"
+  #include "rex_std/internal/algorithm/max.h"
+
+  #include <stdlib.h> // calloc
+#endif
 
 namespace rsl
 {
   inline namespace v1
   {
+#if defined(RSL_PLATFORM_WINDOWS)
     class condition_variable::impl
     {
     public:
@@ -65,6 +75,61 @@ namespace rsl
       CONDITION_VARIABLE m_condition_variable;
     };
 
+#elif defined(RSL_PLATFORM_LINUX)
+    class condition_variable::impl
+    {
+    public:
+      impl()
+          : m_sequence(0)
+      {
+      }
+
+      impl(const impl&)            = delete;
+      ~impl()                      = delete;
+      impl& operator=(const impl&) = delete;
+
+      void destroy() {}
+
+      void wait(mutex::native_handle_type mtx)
+      {
+        wait_impl(mtx, internal::g_futex_infinite);
+      }
+
+      bool wait_for(mutex::native_handle_type mtx, int32 timeoutMs)
+      {
+        return wait_impl(mtx, (rsl::max)(timeoutMs, 0));
+      }
+
+      // every notify bumps the sequence and wakes up threads sleeping on it.
+      // a waiter reads the sequence before it unlocks the mutex and only goes to sleep if it hasn't changed since,
+      // so a notify that happens between unlocking the mutex and going to sleep is never missed.
+      void notify_one()
+      {
+        rsl::atomic_fetch_add(&m_sequence, 1u, rsl::memory_order::release);
+        internal::futex_wake_one(&m_sequence);
+      }
+      void notify_all()
+      {
+        rsl::atomic_fetch_add(&m_sequence, 1u, rsl::memory_order::release);
+        internal::futex_wake_all(&m_sequence);
+      }
+
+    private:
+      bool wait_impl(mutex::native_handle_type mtx, int32 timeoutMs)
+      {
+        const uint32 sequence = rsl::atomic_load(&m_sequence, rsl::memory_order::relaxed);
+        internal::mtx_unlock(mtx);
+        const bool woken_up = internal::futex_wait(&m_sequence, sequence, timeoutMs);
+        internal::mtx_lock(mtx);
+        return woken_up;
+      }
+
+    private:
+      uint32 m_sequence;
+    };
+
+#endif
+
     namespace internal
     {
       bool cnd_timedwait(condition_variable::impl* cond, mutex::native_handle_type mtx, const xtime& target)
@@ -86,7 +151,11 @@ namespace rsl
       }
 
       inline constexpr card32 num_items = 20; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-      SRWLOCK g_thread_exit_mtx;              // NOLINT(fuchsia-statically-constructed-objects, cppcoreguidelines-avoid-non-const-global-variables)
+
+#if defined(RSL_PLATFORM_WINDOWS)
+      using os_thread_id = DWORD;
+
+      SRWLOCK g_thread_exit_mtx; // NOLINT(fuchsia-statically-constructed-objects, cppcoreguidelines-avoid-non-const-global-variables)
 
       void lock_thread_exit_mtx()
       {
@@ -96,10 +165,32 @@ namespace rsl
       {
         ReleaseSRWLockExclusive(&g_thread_exit_mtx);
       }
+      os_thread_id current_os_thread_id()
+      {
+        return GetCurrentThreadId();
+      }
+#elif defined(RSL_PLATFORM_LINUX)
+      using os_thread_id = uint32;
+
+      mutex_base g_thread_exit_mtx; // NOLINT(fuchsia-statically-constructed-objects, cppcoreguidelines-avoid-non-const-global-variables)
+
+      void lock_thread_exit_mtx()
+      {
+        g_thread_exit_mtx.lock();
+      }
+      void unlock_thread_exit_mtx()
+      {
+        g_thread_exit_mtx.unlock();
+      }
+      os_thread_id current_os_thread_id()
+      {
+        return current_thread_id();
+      }
+#endif
 
       struct at_thread_exit_data
       {
-        DWORD thread_id;
+        os_thread_id thread_id;
         mutex::native_handle_type mtx;
         condition_variable::impl* cv;
         card32* res;
@@ -141,7 +232,7 @@ namespace rsl
               // store into empty slot
               if(i.mtx == nullptr)
               {
-                i.thread_id = GetCurrentThreadId();
+                i.thread_id = current_os_thread_id();
                 i.mtx       = mtx;
                 i.cv        = cnd;
                 i.res       = p;
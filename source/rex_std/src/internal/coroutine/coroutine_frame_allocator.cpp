@@ -0,0 +1,140 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: coroutine_frame_allocator.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/internal/coroutine/coroutine_frame_allocator.h"
+
+#include "rex_std/internal/memory/allocator.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace
+    {
+      // frames are rounded up to a power of 2, from 128 bytes up to 4 KiB.
+      // bigger frames are rare and go straight to the global heap
+      constexpr card64 g_coroutine_min_frame_size        = 128;
+      constexpr card32 g_coroutine_num_frame_size_classes = 6;
+      constexpr card32 g_coroutine_large_frame_class      = -1;
+      // a thread never holds on to more than this many free frames of a size class,
+      // so a burst of coroutines doesn't keep its memory forever
+      constexpr card32 g_coroutine_max_cached_frames = 64;
+
+      card64 frame_size(card32 sizeClass)
+      {
+        return g_coroutine_min_frame_size << sizeClass;
+      }
+
+      card32 frame_size_class(card64 size)
+      {
+        for(card32 size_class = 0; size_class < g_coroutine_num_frame_size_classes; ++size_class)
+        {
+          if(size <= frame_size(size_class))
+          {
+            return size_class;
+          }
+        }
+
+        return g_coroutine_large_frame_class;
+      }
+
+      // a free frame reuses its own memory to link it to the other free frames
+      struct free_frame
+      {
+        free_frame* next;
+      };
+
+      class frame_cache
+      {
+      public:
+        frame_cache()
+            : m_free_frames()
+            , m_num_free_frames()
+        {
+        }
+        frame_cache(const frame_cache&) = delete;
+        frame_cache(frame_cache&&)      = delete;
+        ~frame_cache()
+        {
+          for(card32 size_class = 0; size_class < g_coroutine_num_frame_size_classes; ++size_class)
+          {
+            free_frame* frame = m_free_frames[size_class];
+            while(frame != nullptr)
+            {
+              free_frame* next = frame->next;
+              rsl::allocator().deallocate(frame, frame_size(size_class));
+              frame = next;
+            }
+          }
+        }
+
+        frame_cache& operator=(const frame_cache&) = delete;
+        frame_cache& operator=(frame_cache&&)      = delete;
+
+        void* allocate(card32 sizeClass)
+        {
+          free_frame* frame = m_free_frames[sizeClass];
+          if(frame == nullptr)
+          {
+            return rsl::allocator().allocate(frame_size(sizeClass));
+          }
+
+          m_free_frames[sizeClass] = frame->next;
+          --m_num_free_frames[sizeClass];
+          return frame;
+        }
+
+        void deallocate(void* ptr, card32 sizeClass)
+        {
+          if(m_num_free_frames[sizeClass] == g_coroutine_max_cached_frames)
+          {
+            rsl::allocator().deallocate(ptr, frame_size(sizeClass));
+            return;
+          }
+
+          free_frame* frame        = static_cast<free_frame*>(ptr);
+          frame->next              = m_free_frames[sizeClass];
+          m_free_frames[sizeClass] = frame;
+          ++m_num_free_frames[sizeClass];
+        }
+
+      private:
+        free_frame* m_free_frames[g_coroutine_num_frame_size_classes];
+        card32 m_num_free_frames[g_coroutine_num_frame_size_classes];
+      };
+
+      thread_local frame_cache g_frame_cache;
+    } // namespace
+
+    namespace internal
+    {
+      void* allocate_coroutine_frame(card64 size)
+      {
+        const card32 size_class = frame_size_class(size);
+        return size_class != g_coroutine_large_frame_class ? g_frame_cache.allocate(size_class) : rsl::allocator().allocate(size);
+      }
+
+      void deallocate_coroutine_frame(void* frame, card64 size)
+      {
+        const card32 size_class = frame_size_class(size);
+        if(size_class != g_coroutine_large_frame_class)
+        {
+          g_frame_cache.deallocate(frame, size_class);
+        }
+        else
+        {
+          rsl::allocator().deallocate(frame, size);
+        }
+      }
+    } // namespace internal
+  } // namespace v1
+} // namespace rsl
@@ -12,22 +12,45 @@
 
 #include "rex_std/internal/fstream/basic_filebuf.h"
 
-#include <Windows.h> // for FILE_BEGIN, FILE_END
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include <Windows.h> // for FILE_BEGIN, FILE_END
 // IWYU pragma: no_include <built-in>
+#elif defined(RSL_PLATFORM_LINUX)
+  #include <fcntl.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+
+  #include <cerrno>
+#endif
 
 #include "rex_std/assert.h"                 // for rex_assert, basic_string_view, string_view, memcpy
 #include "rex_std/bonus/utility/flags.h" // for has_flag
 #include "rex_std/bonus/utility/nand.h"     // for nand
+#include "rex_std/internal/algorithm/max.h"
+#include "rex_std/internal/algorithm/min.h"
 #include "rex_std/internal/array/array.h"
 #include "rex_std/internal/memory/memcpy.h"
 #include "rex_std/stddef.h" // for size_t
 
+#include <new> // for aligned operator new
+
 namespace rsl
 {
   inline namespace v1
   {
     namespace internal
     {
+      namespace
+      {
+        // direct io requires the buffer, the size and the file offset of every read and write to be aligned to the block size
+        // of the device. 4 KiB is the block size of pretty much every device in use today.
+        constexpr card64 g_direct_io_alignment = 4096;
+
+        // a single read or write syscall never transfers more than this
+        constexpr streamsize g_max_io_size = 1 << 30;
+      } // namespace
+
+#if defined(RSL_PLATFORM_WINDOWS)
       DWORD mode_to_creation_disposition(io::openmode mode)
       {
         RSL_ASSERT_X(rsl::nand(rsl::has_flag(mode, io::openmode::app), rsl::has_flag(mode, io::openmode::trunc)), "both append and trunc provided as openmode");
@@ -35,7 +58,8 @@ namespace rsl
         DWORD result = 0;
         if(rsl::has_flag(mode, io::openmode::trunc))
         {
-          result |= TRUNCATE_EXISTING;
+          // like std, trunc creates the file if it doesn't exist yet
+          result |= CREATE_ALWAYS;
         }
         else if(rsl::has_flag(mode, io::openmode::out))
         {
@@ -49,35 +73,157 @@ namespace rsl
         return result;
       }
 
-      void append_file(HANDLE fileHandle)
+      file_handle invalid_file_handle()
       {
-        SetFilePointer(fileHandle, 0, nullptr, FILE_END);
+        return INVALID_HANDLE_VALUE;
       }
-      void trunc_file(HANDLE fileHandle)
+      file_handle open_file(const char8* filename, io::openmode mode)
       {
-        SetFilePointer(fileHandle, 0, nullptr, FILE_BEGIN);
+        // this function opens the file handle but doesn't read anything
+        return CreateFileA(filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, mode_to_creation_disposition(mode), FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
       }
-      HANDLE open_impl(const char8* filename, io::openmode mode)
+      bool close_file(file_handle handle)
       {
-        // this function opens the file handle but doesn't read anything
-        HANDLE handle = CreateFileA(filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, mode_to_creation_disposition(mode), FILE_ATTRIBUTE_NORMAL, nullptr);
+        return CloseHandle(handle) != 0;
+      }
+      card64 file_size(file_handle handle)
+      {
+        LARGE_INTEGER size {};
+        return GetFileSizeEx(handle, &size) != 0 ? static_cast<card64>(size.QuadPart) : 0;
+      }
+      // returns the number of bytes read, 0 at the end of the file and -1 on failure
+      streamsize read_at(file_handle handle, char8* dst, streamsize size, card64 offset)
+      {
+        OVERLAPPED overlapped {};
+        overlapped.Offset     = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
 
-        if(rsl::has_flag(mode, rsl::io::openmode::app) || rsl::has_flag(mode, rsl::io::openmode::ate))
+        DWORD num_read = 0;
+        if(ReadFile(handle, dst, static_cast<DWORD>(size), &num_read, &overlapped) == 0)
+        {
+          return GetLastError() == ERROR_HANDLE_EOF ? 0 : -1;
+        }
+        return static_cast<streamsize>(num_read);
+      }
+      // returns the number of bytes written and -1 on failure
+      streamsize write_at(file_handle handle, const char8* src, streamsize size, card64 offset)
+      {
+        OVERLAPPED overlapped {};
+        overlapped.Offset     = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+        DWORD num_written = 0;
+        if(WriteFile(handle, src, static_cast<DWORD>(size), &num_written, &overlapped) == 0)
+        {
+          return -1;
+        }
+        return static_cast<streamsize>(num_written);
+      }
+      void disable_direct_io(file_handle /*handle*/)
+      {
+        // direct io is not supported on Windows, so it's never enabled
+      }
+#elif defined(RSL_PLATFORM_LINUX)
+      file_handle invalid_file_handle()
+      {
+        return -1;
+      }
+      file_handle open_file(const char8* filename, io::openmode mode)
+      {
+        RSL_ASSERT_X(rsl::nand(rsl::has_flag(mode, io::openmode::app), rsl::has_flag(mode, io::openmode::trunc)), "both append and trunc provided as openmode");
+
+        const bool read  = rsl::has_flag(mode, io::openmode::in);
+        const bool write = rsl::has_flag(mode, io::openmode::out) || rsl::has_flag(mode, io::openmode::app);
+
+        int flags = O_CLOEXEC;
+        if(read && write)
+        {
+          flags |= O_RDWR;
+        }
+        else if(write)
+        {
+          flags |= O_WRONLY;
+        }
+        else
+        {
+          flags |= O_RDONLY;
+        }
+
+        if(write)
         {
-          append_file(handle);
+          flags |= O_CREAT;
         }
-        else if(rsl::has_flag(mode, rsl::io::openmode::trunc))
+        if(rsl::has_flag(mode, io::openmode::trunc))
         {
-          trunc_file(handle);
+          flags |= O_TRUNC;
+        }
+        if(rsl::has_flag(mode, io::openmode::direct))
+        {
+          flags |= O_DIRECT;
         }
 
-        return handle;
+        const file_handle fd = ::open(filename, flags, 0666); // NOLINT(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        if(fd != -1 && !rsl::has_flag(mode, io::openmode::direct))
+        {
+          // files are mostly read front to back, which lets the kernel read ahead more aggressively.
+          // with direct io, there's no page cache to read ahead into
+          posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+        }
+        return fd;
+      }
+      bool close_file(file_handle handle)
+      {
+        return ::close(handle) == 0;
+      }
+      card64 file_size(file_handle handle)
+      {
+        struct stat file_stat
+        {
+        };
+        return fstat(handle, &file_stat) == 0 ? static_cast<card64>(file_stat.st_size) : 0;
+      }
+      // returns the number of bytes read, 0 at the end of the file and -1 on failure
+      streamsize read_at(file_handle handle, char8* dst, streamsize size, card64 offset)
+      {
+        for(;;)
+        {
+          const ssize_t num_read = pread(handle, dst, static_cast<size_t>(size), static_cast<off_t>(offset));
+          if(num_read != -1 || errno != EINTR)
+          {
+            return static_cast<streamsize>(num_read);
+          }
+        }
+      }
+      // returns the number of bytes written and -1 on failure
+      streamsize write_at(file_handle handle, const char8* src, streamsize size, card64 offset)
+      {
+        for(;;)
+        {
+          const ssize_t num_written = pwrite(handle, src, static_cast<size_t>(size), static_cast<off_t>(offset));
+          if(num_written != -1 || errno != EINTR)
+          {
+            return static_cast<streamsize>(num_written);
+          }
+        }
       }
+      void disable_direct_io(file_handle handle)
+      {
+        const int flags = fcntl(handle, F_GETFL); // NOLINT(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        fcntl(handle, F_SETFL, flags & ~O_DIRECT); // NOLINT(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+      }
+#endif
 
       filebuf_impl::filebuf_impl()
           : m_get_area()
-          , m_handle(INVALID_HANDLE_VALUE)
+          , m_handle(invalid_file_handle())
           , m_openmode(rsl::io::openmode::app) // open in append mode to not accidentally delete file content
+          , m_buffer(nullptr)
+          , m_buffer_size(g_default_filebuf_buffer_size)
+          , m_owns_buffer(true)
+          , m_num_pending_writes(0)
+          , m_read_pos(0)
+          , m_read_end(0)
+          , m_file_pos(0)
       {
       }
 
@@ -85,34 +231,78 @@ namespace rsl
           : m_get_area(other.m_get_area)
           , m_handle(other.m_handle)
           , m_openmode(other.m_openmode)
+          , m_buffer(other.m_buffer)
+          , m_buffer_size(other.m_buffer_size)
+          , m_owns_buffer(other.m_owns_buffer)
+          , m_num_pending_writes(other.m_num_pending_writes)
+          , m_read_pos(other.m_read_pos)
+          , m_read_end(other.m_read_end)
+          , m_file_pos(other.m_file_pos)
       {
-        other.m_get_area = internal::get_area();
-        other.m_handle   = win::handle_t();
+        other.m_get_area           = internal::get_area();
+        other.m_handle             = invalid_file_handle();
+        other.m_buffer             = nullptr;
+        other.m_owns_buffer        = true;
+        other.m_num_pending_writes = 0;
+        other.m_read_pos           = 0;
+        other.m_read_end           = 0;
+        other.m_file_pos           = 0;
       }
 
       filebuf_impl::~filebuf_impl()
       {
+        close();
+        free_buffer();
         m_get_area.deallocate();
       }
 
       bool filebuf_impl::open(const char8* filename, io::openmode mode)
       {
+        // like std, opening a file buffer that's already open fails.
+        // the file that's open stays open and its pending writes are kept
+        if(is_open())
+        {
+          return false;
+        }
+
         m_openmode = mode;
 
-        m_handle = open_impl(filename, mode);
+        m_handle = open_file(filename, mode);
+        if(m_handle == invalid_file_handle())
+        {
+          return false;
+        }
 
-        return m_handle != INVALID_HANDLE_VALUE;
+        m_num_pending_writes = 0;
+        m_read_pos           = 0;
+        m_read_end           = 0;
+        m_file_pos           = 0;
+        if(rsl::has_flag(mode, rsl::io::openmode::app) || rsl::has_flag(mode, rsl::io::openmode::ate))
+        {
+          m_file_pos = file_size(m_handle);
+        }
+
+        drop_unaligned_user_buffer();
+        return true;
       }
       bool filebuf_impl::open(const rsl::string_view filename, io::openmode mode)
       {
         // need to copy this into a temporary buffer because it's possible the string view
         // is not null terminated and would therefore pass in an invalid path
         rsl::array<char8, 256> buff = {};
+        if(filename.length() < buff.max_size())
+        {
+          rsl::memcpy(buff.data(), filename.data(), filename.length());
+          return open(buff.data(), mode);
+        }
 
-        RSL_ASSERT_X(filename.length() < buff.max_size(), "exceeded max filename length of {} characters", buff.max_size());
-        rsl::memcpy(buff.data(), filename.data(), filename.length());
-
-        return open(buff.data(), mode);
+        // long paths are rare, so they're allowed to allocate
+        char8* long_buff = new char8[filename.length() + 1]; // NOLINT(cppcoreguidelines-owning-memory)
+        rsl::memcpy(long_buff, filename.data(), filename.length());
+        long_buff[filename.length()] = '\0';
+        const bool res               = open(long_buff, mode);
+        delete[] long_buff; // NOLINT(cppcoreguidelines-owning-memory)
+        return res;
       }
       // bool filebuf_impl::open(const rsl::filesystem::path& filename, io::openmode mode)
       //{
@@ -125,12 +315,39 @@ namespace rsl
 
       bool filebuf_impl::close()
       {
-        if(m_handle != INVALID_HANDLE_VALUE)
+        if(m_handle == invalid_file_handle())
         {
-          return CloseHandle(m_handle) != 0;
+          return true;
         }
 
-        return true;
+        const bool flushed = flush_writes();
+        const bool closed  = close_file(m_handle);
+        m_handle           = invalid_file_handle();
+        m_read_pos         = 0;
+        m_read_end         = 0;
+        return flushed && closed;
+      }
+
+      bool filebuf_impl::is_open() const
+      {
+        return m_handle != invalid_file_handle();
+      }
+
+      void filebuf_impl::setbuf(char8* s, streamsize size)
+      {
+        flush_writes();
+        discard_reads();
+        free_buffer();
+
+        m_buffer      = s;
+        m_buffer_size = size;
+        m_owns_buffer = s == nullptr;
+        drop_unaligned_user_buffer();
+      }
+
+      int32 filebuf_impl::sync()
+      {
+        return flush_writes() ? 0 : -1;
       }
 
       streamsize filebuf_impl::xsgetn(char8* s, size_t elemSize, streamsize count)
@@ -140,9 +357,55 @@ namespace rsl
           count--; // don't get the nullchar, as there isn't any
         }
 
-        DWORD num_read = 0;
-        ReadFile(m_handle, s, static_cast<DWORD>(count * elemSize), &num_read, nullptr);
-        return static_cast<streamsize>(num_read);
+        if(!flush_writes())
+        {
+          return 0;
+        }
+
+        const streamsize size = count * static_cast<streamsize>(elemSize);
+        streamsize num_read   = 0;
+
+        while(num_read < size)
+        {
+          // first hand out what's left in the buffer
+          const streamsize num_buffered = (rsl::min)(size - num_read, m_read_end - m_read_pos);
+          if(num_buffered > 0)
+          {
+            rsl::memcpy(s + num_read, m_buffer + m_read_pos, static_cast<card64>(num_buffered));
+            m_read_pos += num_buffered;
+            num_read += num_buffered;
+            continue;
+          }
+
+          // big reads go straight into the destination, going through the buffer would only add a copy.
+          // direct io needs an aligned destination, which only the buffer is guaranteed to be
+          const streamsize remaining = size - num_read;
+          if(remaining >= m_buffer_size && !rsl::has_flag(m_openmode, rsl::io::openmode::direct))
+          {
+            num_read += read_all(s + num_read, remaining);
+            break;
+          }
+
+          // direct io can't read from an offset that's not block aligned, which happens after an unaligned write.
+          // the file continues without direct io from here on.
+          if(rsl::has_flag(m_openmode, rsl::io::openmode::direct) && m_file_pos % g_direct_io_alignment != 0)
+          {
+            disable_direct_io(m_handle);
+            m_openmode &= static_cast<io::openmode>(~static_cast<io::internal::openmode_int>(io::openmode::direct));
+          }
+
+          allocate_buffer();
+          const streamsize num_loaded = read_at(m_handle, m_buffer, m_buffer_size, m_file_pos);
+          if(num_loaded <= 0)
+          {
+            break;
+          }
+          m_file_pos += static_cast<card64>(num_loaded);
+          m_read_pos = 0;
+          m_read_end = num_loaded;
+        }
+
+        return num_read;
       }
       streamsize filebuf_impl::xsputn(const char8* s, size_t elemSize, streamsize count)
       {
@@ -151,10 +414,158 @@ namespace rsl
           count--; // don't write the nullchar
         }
 
-        DWORD num_written = 0;
-        WriteFile(m_handle, s, static_cast<DWORD>(count * elemSize), &num_written, nullptr);
-        return static_cast<streamsize>(num_written);
+        discard_reads();
+
+        const streamsize size = count * static_cast<streamsize>(elemSize);
+        const bool direct     = rsl::has_flag(m_openmode, rsl::io::openmode::direct);
+
+        // small writes are gathered in the buffer, so writing a file 1 value at a time doesn't result in a syscall per value
+        if(m_num_pending_writes + size <= m_buffer_size)
+        {
+          allocate_buffer();
+          rsl::memcpy(m_buffer + m_num_pending_writes, s, static_cast<card64>(size));
+          m_num_pending_writes += size;
+          return size;
+        }
+
+        // big writes go straight to the file, going through the buffer would only add a copy.
+        // direct io needs an aligned source, which only the buffer is guaranteed to be
+        if(!direct)
+        {
+          if(!flush_writes())
+          {
+            return 0;
+          }
+          if(size >= m_buffer_size)
+          {
+            return write_all(s, size);
+          }
+
+          allocate_buffer();
+          rsl::memcpy(m_buffer, s, static_cast<card64>(size));
+          m_num_pending_writes = size;
+          return size;
+        }
+
+        allocate_buffer();
+        streamsize num_written = 0;
+        while(num_written < size)
+        {
+          const streamsize to_buffer = (rsl::min)(size - num_written, m_buffer_size - m_num_pending_writes);
+          rsl::memcpy(m_buffer + m_num_pending_writes, s + num_written, static_cast<card64>(to_buffer));
+          m_num_pending_writes += to_buffer;
+          num_written += to_buffer;
+
+          if(m_num_pending_writes == m_buffer_size && !flush_writes())
+          {
+            break;
+          }
+        }
+        return num_written;
+      }
+
+      void filebuf_impl::allocate_buffer()
+      {
+        if(m_buffer != nullptr)
+        {
+          return;
+        }
+
+        if(rsl::has_flag(m_openmode, rsl::io::openmode::direct))
+        {
+          // direct io only transfers whole blocks, so it always needs a buffer of at least 1 block
+          m_buffer_size = (rsl::max)(m_buffer_size, static_cast<streamsize>(g_direct_io_alignment));
+          m_buffer_size = static_cast<streamsize>((static_cast<card64>(m_buffer_size) + g_direct_io_alignment - 1) & ~(g_direct_io_alignment - 1));
+        }
+        else if(m_buffer_size == 0)
+        {
+          return;
+        }
+
+        // always aligned for direct io, so the buffer doesn't have to be reallocated if a file is reopened with direct io
+        m_buffer      = static_cast<char8*>(operator new(static_cast<size_t>(m_buffer_size), static_cast<std::align_val_t>(g_direct_io_alignment)));
+        m_owns_buffer = true;
+      }
+      void filebuf_impl::free_buffer()
+      {
+        if(m_owns_buffer && m_buffer != nullptr)
+        {
+          operator delete(m_buffer, static_cast<std::align_val_t>(g_direct_io_alignment));
+        }
+        m_buffer = nullptr;
+      }
+      void filebuf_impl::drop_unaligned_user_buffer()
+      {
+        if(m_owns_buffer || !is_open() || !rsl::has_flag(m_openmode, rsl::io::openmode::direct))
+        {
+          return;
+        }
+
+        // the size is kept, allocate_buffer rounds it up to whole blocks
+        const card64 size = static_cast<card64>(m_buffer_size);
+        if(reinterpret_cast<uintptr>(m_buffer) % static_cast<uintptr>(g_direct_io_alignment) != 0 || size == 0 || size % g_direct_io_alignment != 0) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        {
+          m_buffer      = nullptr;
+          m_owns_buffer = true;
+        }
+      }
+
+      bool filebuf_impl::flush_writes()
+      {
+        if(m_num_pending_writes == 0)
+        {
+          return true;
+        }
+
+        // direct io can't write a partial block, which happens for the last block of the file.
+        // the file continues without direct io from here on.
+        if(rsl::has_flag(m_openmode, rsl::io::openmode::direct) && (m_file_pos % g_direct_io_alignment != 0 || static_cast<card64>(m_num_pending_writes) % g_direct_io_alignment != 0))
+        {
+          disable_direct_io(m_handle);
+          m_openmode &= static_cast<io::openmode>(~static_cast<io::internal::openmode_int>(io::openmode::direct));
+        }
+
+        const streamsize num_pending = m_num_pending_writes;
+        m_num_pending_writes         = 0;
+        return write_all(m_buffer, num_pending) == num_pending;
+      }
+      void filebuf_impl::discard_reads()
+      {
+        m_file_pos -= static_cast<card64>(m_read_end - m_read_pos);
+        m_read_pos = 0;
+        m_read_end = 0;
+      }
+
+      streamsize filebuf_impl::read_all(char8* dst, streamsize size)
+      {
+        streamsize num_read = 0;
+        while(num_read < size)
+        {
+          const streamsize res = read_at(m_handle, dst + num_read, (rsl::min)(size - num_read, g_max_io_size), m_file_pos);
+          if(res <= 0)
+          {
+            break;
+          }
+          num_read += res;
+          m_file_pos += static_cast<card64>(res);
+        }
+        return num_read;
+      }
+      streamsize filebuf_impl::write_all(const char8* src, streamsize size)
+      {
+        streamsize num_written = 0;
+        while(num_written < size)
+        {
+          const streamsize res = write_at(m_handle, src + num_written, (rsl::min)(size - num_written, g_max_io_size), m_file_pos);
+          if(res <= 0)
+          {
+            break;
+          }
+          num_written += res;
+          m_file_pos += static_cast<card64>(res);
+        }
+        return num_written;
       }
     } // namespace internal
   }   // namespace v1
-} // namespace rsl
\ No newline at end of file
+} // namespace rsl
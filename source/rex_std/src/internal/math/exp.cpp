@@ -0,0 +1,258 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: exp.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// The runtime exponential kernels.
+//
+// Both split x in k * ln(2) + r, with |r| <= ln(2) / 2, so exp(x) = 2^k * exp(r).
+// The float64 kernel approximates exp(r) with the rational minimax approximation of fdlibm,
+// which is below 1 ulp.
+// The float32 kernel evaluates a degree 6 polynomial in float64, with an error below 2^-28,
+// so rounding the result to float32 keeps it below 0.54 ulp.
+
+#include "rex_std/internal/math/exp.h"
+
+#include "rex_std/internal/bit/bit_cast.h"
+#include "rex_std/limits.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      namespace
+      {
+        constexpr float64 g_inv_ln2 = 1.44269504088896338700e+00;
+        // ln(2) split up so k * g_ln2_hi is exact
+        constexpr float64 g_ln2_hi = 6.93147180369123816490e-01;
+        constexpr float64 g_ln2_lo = 1.90821492927058770002e-10;
+        constexpr float64 g_ln2    = 6.93147180559945286227e-01;
+
+        // beyond these exp overflows to inf or underflows to 0
+        constexpr float64 g_overflow_f64  = 709.782712893383973096;
+        constexpr float64 g_underflow_f64 = -745.13321910194110842;
+        constexpr float64 g_overflow_f32  = 88.7228394;
+        constexpr float64 g_underflow_f32 = -103.972084;
+        // below this, 2^k is a normal float64 which we can build from its bits directly
+        constexpr float64 g_max_direct_scale_f64 = 708.0;
+
+        // the bits of g_max_direct_scale_f64 and g_overflow_f32, which the batch versions compare against |x|
+        constexpr uint64 g_max_direct_scale_f64_bits = 0x4086200000000000;
+        constexpr uint32 g_overflow_f32_bits         = 0x42b17218;
+        constexpr uint64 g_abs_mask_f64              = 0x7fffffffffffffff;
+        constexpr uint32 g_abs_mask_f32              = 0x7fffffff;
+
+        // adding and removing this rounds a float64 to an integer, without a branch
+        constexpr float64 g_round_shifter = 6755399441055744.0; // 1.5 * 2^52
+
+        // 2^k, k has to be in [-1022, 1023]
+        float64 power_of_two(int32 k)
+        {
+          return rsl::bit_cast<float64>(static_cast<uint64>(k + 1023) << 52);
+        }
+
+        // y * 2^k for k beyond what a single power of 2 can represent,
+        // taking care to only round once if the result is subnormal
+        float64 scale(float64 y, int32 k)
+        {
+          if(k > 1023)
+          {
+            y *= power_of_two(1023);
+            k -= 1023;
+          }
+          else if(k < -1022)
+          {
+            y *= power_of_two(-1022) * power_of_two(53);
+            k += 1022 - 53;
+          }
+          return y * power_of_two(k);
+        }
+
+        // exp(x) / 2^k, where k is the multiple of ln(2) closest to x
+        float64 exp_reduced(float64 x, int32& k)
+        {
+          constexpr float64 p1 = 1.66666666666666019037e-01;
+          constexpr float64 p2 = -2.77777777770155933842e-03;
+          constexpr float64 p3 = 6.61375632143793436117e-05;
+          constexpr float64 p4 = -1.65339022054652515390e-06;
+          constexpr float64 p5 = 4.13813679705723846039e-08;
+
+          const float64 fk = (x * g_inv_ln2 + g_round_shifter) - g_round_shifter;
+          const float64 hi = x - fk * g_ln2_hi;
+          const float64 lo = fk * g_ln2_lo;
+          const float64 r  = hi - lo;
+          const float64 rr = r * r;
+          const float64 c  = r - rr * (p1 + rr * (p2 + rr * (p3 + rr * (p4 + rr * p5))));
+
+          k = static_cast<int32>(fk);
+          return 1.0 + (r * c / (2.0 - c) - lo + hi);
+        }
+
+        // exp(x) for |x| < g_max_direct_scale_f64
+        float64 exp_in_range(float64 x)
+        {
+          int32 k         = 0;
+          const float64 y = exp_reduced(x, k);
+          return y * power_of_two(k);
+        }
+
+        // exp(x) for x in [g_underflow_f32, g_overflow_f32], before rounding to float32
+        float64 exp_f32_in_range(float64 x)
+        {
+          constexpr float64 c1 = 1.0000000400118612;
+          constexpr float64 c2 = 0.5000000049985063;
+          constexpr float64 c3 = 0.16666405420231623;
+          constexpr float64 c4 = 0.04166634028910043;
+          constexpr float64 c5 = 0.008375958626588976;
+          constexpr float64 c6 = 0.0013942147844205415;
+
+          // the lower bits of the shifted value hold k, which we move into the exponent of 2^k.
+          // this avoids converting to an integer, which doesn't vectorize well
+          const float64 shifted = x * g_inv_ln2 + g_round_shifter;
+          const float64 fk      = shifted - g_round_shifter;
+          const float64 scale   = rsl::bit_cast<float64>((rsl::bit_cast<uint64>(shifted) + 1023) << 52);
+
+          const float64 r  = x - fk * g_ln2;
+          const float64 rr = r * r;
+          const float64 p  = (1.0 + r * c1) + rr * ((c2 + r * c3) + rr * ((c4 + r * c5) + rr * c6));
+          return p * scale;
+        }
+      } // namespace
+
+      float64 exp_runtime(float64 x)
+      {
+        // this also catches nan
+        if(!(x < g_max_direct_scale_f64 && x > -g_max_direct_scale_f64))
+        {
+          if(x != x) // NOLINT(misc-redundant-expression)
+          {
+            return x + x;
+          }
+          if(x > g_overflow_f64)
+          {
+            return x * power_of_two(1023);
+          }
+          if(x < g_underflow_f64)
+          {
+            return 0.0;
+          }
+
+          int32 k         = 0;
+          const float64 y = exp_reduced(x, k);
+          return scale(y, k);
+        }
+
+        return exp_in_range(x);
+      }
+
+      float32 exp_runtime(float32 x)
+      {
+        if(!(x < g_overflow_f32 && x > g_underflow_f32))
+        {
+          if(x != x) // NOLINT(misc-redundant-expression)
+          {
+            return x + x;
+          }
+          return x > 0.0f ? numeric_limits<float32>::infinity() : 0.0f;
+        }
+        return static_cast<float32>(exp_f32_in_range(x));
+      }
+
+      namespace
+      {
+        constexpr count_t g_batch_block_size = 256;
+
+        // Like sin_n, these go over the values twice. The first pass vectorizes
+        // and the second one fixes up the values outside of the common range, if there were any.
+        void exp_n_block(const float32* src, float32* dst, count_t count)
+        {
+          uint32 any_out_of_range = 0;
+          for(count_t i = 0; i < count; ++i)
+          {
+            const uint32 bits         = rsl::bit_cast<uint32>(src[i]);
+            const uint32 out_of_range = (bits & internal::g_abs_mask_f32) >= internal::g_overflow_f32_bits;
+            any_out_of_range |= out_of_range;
+
+            const float32 x = rsl::bit_cast<float32>(bits & (out_of_range - 1));
+            dst[i]          = static_cast<float32>(internal::exp_f32_in_range(x));
+          }
+
+          if(any_out_of_range == 0)
+          {
+            return;
+          }
+          for(count_t i = 0; i < count; ++i)
+          {
+            if((rsl::bit_cast<uint32>(src[i]) & internal::g_abs_mask_f32) >= internal::g_overflow_f32_bits)
+            {
+              dst[i] = internal::exp_runtime(src[i]);
+            }
+          }
+        }
+
+        void exp_n_block(const float64* src, float64* dst, count_t count)
+        {
+          uint64 any_out_of_range = 0;
+          for(count_t i = 0; i < count; ++i)
+          {
+            const uint64 bits         = rsl::bit_cast<uint64>(src[i]);
+            const uint64 out_of_range = (bits & internal::g_abs_mask_f64) >= internal::g_max_direct_scale_f64_bits;
+            any_out_of_range |= out_of_range;
+
+            const float64 x = rsl::bit_cast<float64>(bits & (out_of_range - 1));
+            dst[i]          = internal::exp_in_range(x);
+          }
+
+          if(any_out_of_range == 0)
+          {
+            return;
+          }
+          for(count_t i = 0; i < count; ++i)
+          {
+            if((rsl::bit_cast<uint64>(src[i]) & internal::g_abs_mask_f64) >= internal::g_max_direct_scale_f64_bits)
+            {
+              dst[i] = internal::exp_runtime(src[i]);
+            }
+          }
+        }
+      } // namespace
+    } // namespace internal
+
+    void exp_n(const float32* src, float32* dst, count_t count)
+    {
+      float32 block[internal::g_batch_block_size]; // NOLINT(modernize-avoid-c-arrays)
+      for(count_t first = 0; first < count; first += internal::g_batch_block_size)
+      {
+        const count_t block_count = count - first < internal::g_batch_block_size ? count - first : internal::g_batch_block_size;
+        for(count_t i = 0; i < block_count; ++i)
+        {
+          block[i] = src[first + i];
+        }
+        internal::exp_n_block(block, dst + first, block_count);
+      }
+    }
+
+    void exp_n(const float64* src, float64* dst, count_t count)
+    {
+      float64 block[internal::g_batch_block_size]; // NOLINT(modernize-avoid-c-arrays)
+      for(count_t first = 0; first < count; first += internal::g_batch_block_size)
+      {
+        const count_t block_count = count - first < internal::g_batch_block_size ? count - first : internal::g_batch_block_size;
+        for(count_t i = 0; i < block_count; ++i)
+        {
+          block[i] = src[first + i];
+        }
+        internal::exp_n_block(block, dst + first, block_count);
+      }
+    }
+  } // namespace v1
+} // namespace rsl
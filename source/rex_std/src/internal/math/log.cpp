@@ -0,0 +1,104 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: log.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// The runtime natural logarithm kernel.
+//
+// x is split in 2^k * (1 + f), with 1 + f in [sqrt(2)/2, sqrt(2)], so log(x) = k * ln(2) + log(1 + f).
+// log(1 + f) is then approximated using s = f / (2 + f), as log(1 + f) = 2 * atanh(s),
+// with the minimax polynomial of fdlibm in s^2. This is below 1 ulp.
+// float32 goes through the same kernel, which is precise enough to only lose
+// the final rounding to float32.
+
+#include "rex_std/internal/math/log.h"
+
+#include "rex_std/internal/bit/bit_cast.h"
+#include "rex_std/limits.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      namespace
+      {
+        // ln(2) split up so k * g_ln2_hi is exact
+        constexpr float64 g_ln2_hi = 6.93147180369123816490e-01;
+        constexpr float64 g_ln2_lo = 1.90821492927058770002e-10;
+
+        // the upper 32 bits of the smallest normal float64, 1.0 and sqrt(2)/2
+        constexpr uint32 g_min_normal_hi = 0x00100000;
+        constexpr uint32 g_one_hi        = 0x3ff00000;
+        constexpr uint32 g_sqrt_half_hi  = 0x3fe6a09e;
+      } // namespace
+
+      float64 log_runtime(float64 x)
+      {
+        constexpr float64 lg1 = 6.666666666666735130e-01;
+        constexpr float64 lg2 = 3.999999999940941908e-01;
+        constexpr float64 lg3 = 2.857142874366239149e-01;
+        constexpr float64 lg4 = 2.222219843214978396e-01;
+        constexpr float64 lg5 = 1.818357216161805012e-01;
+        constexpr float64 lg6 = 1.531383769920937332e-01;
+        constexpr float64 lg7 = 1.479819860511658591e-01;
+
+        uint64 bits = rsl::bit_cast<uint64>(x);
+        uint32 hi   = static_cast<uint32>(bits >> 32);
+        int32 k     = 0;
+
+        if(hi < g_min_normal_hi || (hi >> 31) != 0)
+        {
+          if((bits << 1) == 0)
+          {
+            return -numeric_limits<float64>::infinity();
+          }
+          if((hi >> 31) != 0)
+          {
+            return numeric_limits<float64>::quiet_nan();
+          }
+          // subnormal, scale it up into the normal range
+          k -= 54;
+          x *= 18014398509481984.0; // 2^54
+          bits = rsl::bit_cast<uint64>(x);
+          hi   = static_cast<uint32>(bits >> 32);
+        }
+        else if(hi >= 0x7ff00000)
+        {
+          // inf and nan
+          return x + x;
+        }
+
+        // move the mantissa to [sqrt(2)/2, sqrt(2)], adjusting k along with it
+        hi += g_one_hi - g_sqrt_half_hi;
+        k += static_cast<int32>(hi >> 20) - 0x3ff;
+        hi   = (hi & 0x000fffff) + g_sqrt_half_hi;
+        bits = (static_cast<uint64>(hi) << 32) | (bits & 0xffffffff);
+
+        const float64 f    = rsl::bit_cast<float64>(bits) - 1.0;
+        const float64 hfsq = 0.5 * f * f;
+        const float64 s    = f / (2.0 + f);
+        const float64 z    = s * s;
+        const float64 w    = z * z;
+        const float64 t1   = w * (lg2 + w * (lg4 + w * lg6));
+        const float64 t2   = z * (lg1 + w * (lg3 + w * (lg5 + w * lg7)));
+        const float64 r    = t2 + t1;
+        const float64 dk   = k;
+        return s * (hfsq + r) + dk * g_ln2_lo - hfsq + f + dk * g_ln2_hi;
+      }
+
+      float32 log_runtime(float32 x)
+      {
+        return static_cast<float32>(log_runtime(static_cast<float64>(x)));
+      }
+    } // namespace internal
+  } // namespace v1
+} // namespace rsl
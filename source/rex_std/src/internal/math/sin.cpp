@@ -0,0 +1,398 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: sin.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// The runtime sine and cosine kernels.
+// cos lives here as well as it shares the range reduction and the polynomials with sin.
+//
+// The float64 kernels are the minimax polynomials of fdlibm, evaluated on [-pi/4, pi/4]
+// after a Cody-Waite reduction with pi/2 split in 3 parts. They're below 1 ulp.
+// The float32 kernels reduce and evaluate in float64 with shorter polynomials,
+// so the only error is the final rounding to float32, which keeps them below 0.51 ulp.
+// Both fall back to the C runtime for inputs too big for the reduction (see g_max_reduction_f64).
+
+#include "rex_std/internal/math/cos.h"
+#include "rex_std/internal/math/sin.h"
+
+#include "rex_std/internal/bit/bit_cast.h"
+
+#include "rex_std/disable_std_checking.h"
+
+#include <cmath>
+
+#include "rex_std/enable_std_checking.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      namespace
+      {
+        constexpr float64 g_inv_pio2 = 6.36619772367581382433e-01;
+
+        // pi/2 split up in parts of 33 bits, with the remainder after each part.
+        // n * part is exact as long as n fits in 20 bits
+        constexpr float64 g_pio2_1  = 1.57079632673412561417e+00;
+        constexpr float64 g_pio2_1t = 6.07710050650619224932e-11;
+        constexpr float64 g_pio2_2  = 6.07710050630396597660e-11;
+        constexpr float64 g_pio2_2t = 2.02226624879595063154e-21;
+        constexpr float64 g_pio2_3  = 2.02226624871116645580e-21;
+        constexpr float64 g_pio2_3t = 8.47842766036889956997e-32;
+
+        // pi/2 split in 25 bits and the remainder, which is precise enough for float32 inputs
+        constexpr float64 g_pio2_1_f32  = 1.57079631090164184570e+00;
+        constexpr float64 g_pio2_1t_f32 = 1.58932547735281966916e-08;
+
+        // Beyond these, n doesn't fit the bits we reserved for it and we'd need the full Payne-Hanek reduction.
+        // They're compared against the bits of |x| so inf and nan are out of range too.
+        constexpr uint64 g_max_reduction_f64 = 0x413921fb00000000; // ~2^20 * pi/2
+        constexpr uint32 g_max_reduction_f32 = 0x4dc90fdb;         // ~2^28 * pi/2
+        constexpr uint64 g_abs_mask_f64      = 0x7fffffffffffffff;
+        constexpr uint32 g_abs_mask_f32      = 0x7fffffff;
+        constexpr float64 g_pio4             = 0.785398163397448279;
+
+        // adding and removing this rounds a float64 to an integer, without a branch.
+        // the lower bits of the shifted value hold the integer
+        constexpr float64 g_round_shifter = 6755399441055744.0; // 1.5 * 2^52
+
+        bool is_reducible(float64 x)
+        {
+          return (rsl::bit_cast<uint64>(x) & g_abs_mask_f64) < g_max_reduction_f64;
+        }
+        bool is_reducible(float32 x)
+        {
+          return (rsl::bit_cast<uint32>(x) & g_abs_mask_f32) < g_max_reduction_f32;
+        }
+
+        int32 exponent_of(float64 x)
+        {
+          return static_cast<int32>((rsl::bit_cast<uint64>(x) >> 52) & 0x7ff);
+        }
+
+        // sin(x + y) for |x + y| <= pi/4, where y is the tail of the reduced argument
+        float64 sin_kernel(float64 x, float64 y)
+        {
+          constexpr float64 s1 = -1.66666666666666324348e-01;
+          constexpr float64 s2 = 8.33333333332248946124e-03;
+          constexpr float64 s3 = -1.98412698298579493134e-04;
+          constexpr float64 s4 = 2.75573137070700676789e-06;
+          constexpr float64 s5 = -2.50507602534068634195e-08;
+          constexpr float64 s6 = 1.58969099521155010221e-10;
+
+          const float64 z = x * x;
+          const float64 w = z * z;
+          const float64 r = s2 + z * (s3 + z * s4) + z * w * (s5 + z * s6);
+          const float64 v = z * x;
+          return x - ((z * (0.5 * y - v * r) - y) - v * s1);
+        }
+
+        // cos(x + y) for |x + y| <= pi/4, where y is the tail of the reduced argument
+        float64 cos_kernel(float64 x, float64 y)
+        {
+          constexpr float64 c1 = 4.16666666666666019037e-02;
+          constexpr float64 c2 = -1.38888888888741095749e-03;
+          constexpr float64 c3 = 2.48015872894767294178e-05;
+          constexpr float64 c4 = -2.75573143513906633035e-07;
+          constexpr float64 c5 = 2.08757232129817482790e-09;
+          constexpr float64 c6 = -1.13596475577881948265e-11;
+
+          const float64 z  = x * x;
+          const float64 w  = z * z;
+          const float64 r  = z * (c1 + z * (c2 + z * c3)) + w * w * (c4 + z * (c5 + z * c6));
+          const float64 hz = 0.5 * z;
+          const float64 a  = 1.0 - hz;
+          return a + (((1.0 - a) - hz) + (z * r - x * y));
+        }
+
+        // sin(x) for |x| <= pi/4, precise enough to round to float32
+        float64 sin_kernel_f32(float64 x)
+        {
+          constexpr float64 s1 = -0.166666666416265235595;
+          constexpr float64 s2 = 0.0083333293858894631756;
+          constexpr float64 s3 = -0.000198393348360966317347;
+          constexpr float64 s4 = 0.0000027183114939898219064;
+
+          // written as a product so the sign of -0.0 survives
+          const float64 z = x * x;
+          const float64 w = z * z;
+          const float64 r = s3 + z * s4;
+          return x * (1.0 + (z * (s1 + z * s2) + z * w * r));
+        }
+
+        // cos(x) for |x| <= pi/4, precise enough to round to float32
+        float64 cos_kernel_f32(float64 x)
+        {
+          constexpr float64 c0 = -0.499999997251031003120;
+          constexpr float64 c1 = 0.0416666233237390631894;
+          constexpr float64 c2 = -0.00138867637746099294692;
+          constexpr float64 c3 = 0.0000243904487962774090654;
+
+          const float64 z = x * x;
+          const float64 w = z * z;
+          const float64 r = c2 + z * c3;
+          return ((1.0 + z * c0) + w * c1) + (w * z) * r;
+        }
+
+        // sin(x + n * pi/2) given sin(x) and cos(x).
+        // This only uses masks, so the batch versions vectorize
+        float64 select_quadrant(float64 sin_x, float64 cos_x, uint64 n)
+        {
+          const uint64 use_cos = 0 - (n & 1);
+          const uint64 res     = (rsl::bit_cast<uint64>(cos_x) & use_cos) | (rsl::bit_cast<uint64>(sin_x) & ~use_cos);
+          return rsl::bit_cast<float64>(res ^ ((n & 2) << 62));
+        }
+
+        // The first round of the reduction, which is good to 85 bits of pi/2.
+        // That's enough unless x is very close to a multiple of pi/2.
+        float64 reduce_first_round(float64 x, float64 fn, float64& tail)
+        {
+          const float64 r = x - fn * g_pio2_1;
+          const float64 w = fn * g_pio2_1t;
+          const float64 y = r - w;
+          tail            = (r - y) - w;
+          return y;
+        }
+        // the first round cancelled too many bits of x if the result lost 16 or more bits of exponent
+        bool needs_more_reduction(float64 x, float64 y)
+        {
+          return exponent_of(x) - exponent_of(y) > 16;
+        }
+
+        // Reduces x to y + tail in [-pi/4, pi/4] and returns the quadrant it ended up in.
+        // x has to be reducible
+        int32 reduce(float64 x, float64& y, float64& tail)
+        {
+          const float64 fn = (x * g_inv_pio2 + g_round_shifter) - g_round_shifter;
+          y                = reduce_first_round(x, fn, tail);
+          if(needs_more_reduction(x, y))
+          {
+            // second round, good to 118 bits
+            float64 t = x - fn * g_pio2_1;
+            float64 w = fn * g_pio2_2;
+            float64 r = t - w;
+            w         = fn * g_pio2_2t - ((t - r) - w);
+            y         = r - w;
+            if(exponent_of(x) - exponent_of(y) > 49)
+            {
+              // third round, good to 151 bits, which covers every input we get here
+              t = r;
+              w = fn * g_pio2_3;
+              r = t - w;
+              w = fn * g_pio2_3t - ((t - r) - w);
+              y = r - w;
+            }
+            tail = (r - y) - w;
+          }
+          return static_cast<int32>(fn);
+        }
+
+        // the batch version only does the first round of the reduction, these values need the scalar version
+        bool needs_scalar_path(float64 x)
+        {
+          if(!is_reducible(x))
+          {
+            return true;
+          }
+          const float64 fn = (x * g_inv_pio2 + g_round_shifter) - g_round_shifter;
+          float64 tail     = 0.0;
+          return needs_more_reduction(x, reduce_first_round(x, fn, tail));
+        }
+
+        // Reduces a reducible float32 x to [-pi/4, pi/4] and returns the quadrant it ended up in
+        uint64 reduce_f32(float64 x, float64& y)
+        {
+          const float64 shifted = x * g_inv_pio2 + g_round_shifter;
+          const float64 fn      = shifted - g_round_shifter;
+          y                     = x - fn * g_pio2_1_f32 - fn * g_pio2_1t_f32;
+          return rsl::bit_cast<uint64>(shifted);
+        }
+
+        // sin(x + quadrant * pi/2) for a reducible float32 x, before rounding it back to float32
+        float64 sin_f32(float64 x, uint64 quadrant)
+        {
+          float64 y      = 0.0;
+          const uint64 n = reduce_f32(x, y) + quadrant;
+          // only evaluate the polynomial we need, unlike the batch version
+          const float64 res = (n & 1) != 0 ? cos_kernel_f32(y) : sin_kernel_f32(y);
+          return (n & 2) != 0 ? -res : res;
+        }
+      } // namespace
+
+      float64 sin_runtime(float64 x)
+      {
+        const float64 abs_x = x < 0.0 ? -x : x;
+        if(abs_x <= g_pio4)
+        {
+          return sin_kernel(x, 0.0);
+        }
+        if(!is_reducible(x))
+        {
+          return std::sin(x);
+        }
+
+        float64 y     = 0.0;
+        float64 tail  = 0.0;
+        const int32 n = reduce(x, y, tail);
+        switch(n & 3)
+        {
+          case 0: return sin_kernel(y, tail);
+          case 1: return cos_kernel(y, tail);
+          case 2: return -sin_kernel(y, tail);
+          default: return -cos_kernel(y, tail);
+        }
+      }
+
+      float64 cos_runtime(float64 x)
+      {
+        const float64 abs_x = x < 0.0 ? -x : x;
+        if(abs_x <= g_pio4)
+        {
+          return cos_kernel(x, 0.0);
+        }
+        if(!is_reducible(x))
+        {
+          return std::cos(x);
+        }
+
+        float64 y     = 0.0;
+        float64 tail  = 0.0;
+        const int32 n = reduce(x, y, tail);
+        switch(n & 3)
+        {
+          case 0: return cos_kernel(y, tail);
+          case 1: return -sin_kernel(y, tail);
+          case 2: return -cos_kernel(y, tail);
+          default: return sin_kernel(y, tail);
+        }
+      }
+
+      float32 sin_runtime(float32 x)
+      {
+        if(!is_reducible(x))
+        {
+          return static_cast<float32>(sin_runtime(static_cast<float64>(x)));
+        }
+        return static_cast<float32>(sin_f32(x, 0));
+      }
+
+      float32 cos_runtime(float32 x)
+      {
+        if(!is_reducible(x))
+        {
+          return static_cast<float32>(cos_runtime(static_cast<float64>(x)));
+        }
+        // cos(x) is sin(x + pi/2)
+        return static_cast<float32>(sin_f32(x, 1));
+      }
+
+      namespace
+      {
+        constexpr count_t g_batch_block_size = 256;
+
+        // Both batch versions go over the values twice.
+        // The first pass has no branches and no calls, so the compiler can vectorize it,
+        // but it's only correct for the common case. The second pass fixes up the values the first pass got wrong,
+        // which is skipped entirely when there weren't any.
+        // Out of range values are replaced by 0 in the first pass, using a mask as a compare would stop it from vectorizing.
+        // As the second pass needs the original values, sin_n copies them to a block on the stack first,
+        // which also makes it fine for src and dst to be the same buffer.
+        void sin_n_block(const float32* src, float32* dst, count_t count)
+        {
+          uint32 any_out_of_range = 0;
+          for(count_t i = 0; i < count; ++i)
+          {
+            const uint32 bits         = rsl::bit_cast<uint32>(src[i]);
+            const uint32 out_of_range = (bits & internal::g_abs_mask_f32) >= internal::g_max_reduction_f32;
+            any_out_of_range |= out_of_range;
+
+            const float32 x = rsl::bit_cast<float32>(bits & (out_of_range - 1));
+            float64 y       = 0.0;
+            const uint64 n  = internal::reduce_f32(x, y);
+            dst[i]          = static_cast<float32>(internal::select_quadrant(internal::sin_kernel_f32(y), internal::cos_kernel_f32(y), n));
+          }
+
+          if(any_out_of_range == 0)
+          {
+            return;
+          }
+          for(count_t i = 0; i < count; ++i)
+          {
+            if(!internal::is_reducible(src[i]))
+            {
+              dst[i] = internal::sin_runtime(src[i]);
+            }
+          }
+        }
+
+        void sin_n_block(const float64* src, float64* dst, count_t count)
+        {
+          uint64 any_scalar = 0;
+          for(count_t i = 0; i < count; ++i)
+          {
+            const uint64 bits         = rsl::bit_cast<uint64>(src[i]);
+            const uint64 out_of_range = (bits & internal::g_abs_mask_f64) >= internal::g_max_reduction_f64;
+            const float64 x           = rsl::bit_cast<float64>(bits & (out_of_range - 1));
+
+            const float64 shifted = x * internal::g_inv_pio2 + internal::g_round_shifter;
+            const float64 fn      = shifted - internal::g_round_shifter;
+            float64 tail          = 0.0;
+            const float64 y       = internal::reduce_first_round(x, fn, tail);
+            dst[i]                = internal::select_quadrant(internal::sin_kernel(y, tail), internal::cos_kernel(y, tail), rsl::bit_cast<uint64>(shifted));
+
+            any_scalar |= out_of_range | static_cast<uint64>(internal::needs_more_reduction(x, y));
+          }
+
+          if(any_scalar == 0)
+          {
+            return;
+          }
+          for(count_t i = 0; i < count; ++i)
+          {
+            if(internal::needs_scalar_path(src[i]))
+            {
+              dst[i] = internal::sin_runtime(src[i]);
+            }
+          }
+        }
+      } // namespace
+    } // namespace internal
+
+    void sin_n(const float32* src, float32* dst, count_t count)
+    {
+      float32 block[internal::g_batch_block_size]; // NOLINT(modernize-avoid-c-arrays)
+      for(count_t first = 0; first < count; first += internal::g_batch_block_size)
+      {
+        const count_t block_count = count - first < internal::g_batch_block_size ? count - first : internal::g_batch_block_size;
+        for(count_t i = 0; i < block_count; ++i)
+        {
+          block[i] = src[first + i];
+        }
+        internal::sin_n_block(block, dst + first, block_count);
+      }
+    }
+
+    void sin_n(const float64* src, float64* dst, count_t count)
+    {
+      float64 block[internal::g_batch_block_size]; // NOLINT(modernize-avoid-c-arrays)
+      for(count_t first = 0; first < count; first += internal::g_batch_block_size)
+      {
+        const count_t block_count = count - first < internal::g_batch_block_size ? count - first : internal::g_batch_block_size;
+        for(count_t i = 0; i < block_count; ++i)
+        {
+          block[i] = src[first + i];
+        }
+        internal::sin_n_block(block, dst + first, block_count);
+      }
+    }
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,54 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: sqrt.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// The runtime square root kernel.
+//
+// sqrtss and sqrtsd are correctly rounded, so these are exact to 0.5 ulp.
+// They live in this translation unit so the intrinsics header isn't pulled in
+// by everything that includes the math headers.
+
+#include "rex_std/internal/math/sqrt.h"
+
+#if defined(RSL_PLATFORM_X64) || defined(RSL_PLATFORM_X86)
+  #include <emmintrin.h>
+#endif
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+#if defined(RSL_PLATFORM_X64) || defined(RSL_PLATFORM_X86)
+      float32 sqrt_runtime(float32 x)
+      {
+        return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(x)));
+      }
+      float64 sqrt_runtime(float64 x)
+      {
+        const __m128d v = _mm_set_sd(x);
+        return _mm_cvtsd_f64(_mm_sqrt_sd(v, v));
+      }
+#else
+      // without SSE2, the Newton-Raphson approximation used at compile time is used at runtime as well
+      float32 sqrt_runtime(float32 x)
+      {
+        return sqrt_check(x, 1.0f);
+      }
+      float64 sqrt_runtime(float64 x)
+      {
+        return sqrt_check(x, 1.0);
+      }
+#endif
+    } // namespace internal
+  } // namespace v1
+} // namespace rsl
@@ -0,0 +1,268 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: memcpy.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/internal/memory/memcpy.h"
+
+#include "rex_std/bonus/platform/cpu_features.h"
+
+#if defined(RSL_PLATFORM_X64) || defined(RSL_PLATFORM_X86)
+  #include <immintrin.h>
+  #define RSL_MEMCPY_SIMD
+#endif
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      namespace
+      {
+        using memcpy_func = void* (*)(void*, const void*, card64);
+
+        // Copies bigger than this bypass the cache as the destination
+        // wouldn't fit in it anyway and we'd only evict useful data
+        constexpr card64 g_non_temporal_threshold = 4 * 1024 * 1024;
+
+#if defined(RSL_COMPILER_MSVC)
+        using unaligned_uint64 = uint64;
+        using unaligned_uint32 = uint32;
+#else
+        // these tell the compiler the load can be unaligned and aliases other types
+        typedef uint64 unaligned_uint64 __attribute__((__may_alias__, __aligned__(1))); // NOLINT(modernize-use-using)
+        typedef uint32 unaligned_uint32 __attribute__((__may_alias__, __aligned__(1))); // NOLINT(modernize-use-using)
+#endif
+
+        // Copies 0 to 16 bytes, using 2 overlapping loads and stores.
+        // All loads happen before the stores, so this is safe to use on overlapping buffers
+        void copy_small(rsl::byte* dst, const rsl::byte* src, card64 len)
+        {
+          if(len >= 8)
+          {
+            const uint64 head = *reinterpret_cast<const unaligned_uint64*>(src);           // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const uint64 tail = *reinterpret_cast<const unaligned_uint64*>(src + len - 8); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            *reinterpret_cast<unaligned_uint64*>(dst)           = head;                    // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            *reinterpret_cast<unaligned_uint64*>(dst + len - 8) = tail;                    // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          }
+          else if(len >= 4)
+          {
+            const uint32 head = *reinterpret_cast<const unaligned_uint32*>(src);           // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const uint32 tail = *reinterpret_cast<const unaligned_uint32*>(src + len - 4); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            *reinterpret_cast<unaligned_uint32*>(dst)           = head;                    // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            *reinterpret_cast<unaligned_uint32*>(dst + len - 4) = tail;                    // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          }
+          else if(len > 0)
+          {
+            // for 1, 2 or 3 bytes, these 3 indices cover all of them
+            const rsl::byte first  = src[0];
+            const rsl::byte middle = src[len / 2];
+            const rsl::byte last   = src[len - 1];
+            dst[0]                 = first;
+            dst[len / 2]           = middle;
+            dst[len - 1]           = last;
+          }
+        }
+
+        // Portable version, copies a word at a time into an aligned destination
+        void* memcpy_word(void* dst, const void* src, card64 len)
+        {
+          rsl::byte* dst_byte       = static_cast<rsl::byte*>(dst);
+          const rsl::byte* src_byte = static_cast<const rsl::byte*>(src);
+
+          if(len <= 16)
+          {
+            copy_small(dst_byte, src_byte, len);
+            return dst;
+          }
+
+          // copy byte by byte until the destination is aligned to a word
+          while((reinterpret_cast<uintptr>(dst_byte) & (sizeof(uint64) - 1)) != 0) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          {
+            *dst_byte++ = *src_byte++;
+            --len;
+          }
+
+          // the source might still be unaligned, but unaligned loads are cheap on all hardware we support
+          uint64* dst_word = reinterpret_cast<uint64*>(dst_byte); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          while(len >= 32)
+          {
+            const uint64 a = *reinterpret_cast<const unaligned_uint64*>(src_byte);      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const uint64 b = *reinterpret_cast<const unaligned_uint64*>(src_byte + 8);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const uint64 c = *reinterpret_cast<const unaligned_uint64*>(src_byte + 16); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const uint64 d = *reinterpret_cast<const unaligned_uint64*>(src_byte + 24); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            dst_word[0]    = a;
+            dst_word[1]    = b;
+            dst_word[2]    = c;
+            dst_word[3]    = d;
+            dst_word += 4;
+            src_byte += 32;
+            len -= 32;
+          }
+          while(len >= 8)
+          {
+            *dst_word++ = *reinterpret_cast<const unaligned_uint64*>(src_byte); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            src_byte += 8;
+            len -= 8;
+          }
+
+          copy_small(reinterpret_cast<rsl::byte*>(dst_word), src_byte, len); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          return dst;
+        }
+
+#if defined(RSL_MEMCPY_SIMD)
+        void* memcpy_sse2(void* dst, const void* src, card64 len)
+        {
+          rsl::byte* dst_byte       = static_cast<rsl::byte*>(dst);
+          const rsl::byte* src_byte = static_cast<const rsl::byte*>(src);
+
+          if(len <= 16)
+          {
+            copy_small(dst_byte, src_byte, len);
+            return dst;
+          }
+
+          const __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_byte));            // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          const __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_byte + len - 16)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          rsl::byte* dst_end = dst_byte + len;
+
+          if(len <= 32)
+          {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_byte), head);     // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_end - 16), tail); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            return dst;
+          }
+
+          // store the unaligned head and continue from the next 16 byte aligned address
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_byte), head);                       // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          const card64 skew = 16 - static_cast<card64>(reinterpret_cast<uintptr>(dst_byte) & 15); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          dst_byte += skew;
+          src_byte += skew;
+          len -= skew;
+
+          while(len >= 64)
+          {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_byte));      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_byte + 16)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_byte + 32)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_byte + 48)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst_byte), a);                           // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst_byte + 16), b);                      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst_byte + 32), c);                      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst_byte + 48), d);                      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            dst_byte += 64;
+            src_byte += 64;
+            len -= 64;
+          }
+          while(len >= 16)
+          {
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst_byte), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_byte))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            dst_byte += 16;
+            src_byte += 16;
+            len -= 16;
+          }
+
+          // the remainder is covered by the tail we loaded at the start
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_end - 16), tail); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          return dst;
+        }
+
+        RSL_TARGET_AVX2 void* memcpy_avx2(void* dst, const void* src, card64 len)
+        {
+          rsl::byte* dst_byte       = static_cast<rsl::byte*>(dst);
+          const rsl::byte* src_byte = static_cast<const rsl::byte*>(src);
+
+          if(len <= 32)
+          {
+            return memcpy_sse2(dst, src, len);
+          }
+
+          const __m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_byte));            // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          const __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_byte + len - 32)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          rsl::byte* dst_end = dst_byte + len;
+
+          if(len <= 64)
+          {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_byte), head);     // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_end - 32), tail); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            return dst;
+          }
+
+          // store the unaligned head and continue from the next 32 byte aligned address
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_byte), head);                    // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          const card64 skew = 32 - static_cast<card64>(reinterpret_cast<uintptr>(dst_byte) & 31); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          dst_byte += skew;
+          src_byte += skew;
+          len -= skew;
+
+          if(len >= g_non_temporal_threshold)
+          {
+            while(len >= 128)
+            {
+              const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_byte));      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_byte + 32)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_byte + 64)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_byte + 96)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              _mm256_stream_si256(reinterpret_cast<__m256i*>(dst_byte), a);                          // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              _mm256_stream_si256(reinterpret_cast<__m256i*>(dst_byte + 32), b);                     // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              _mm256_stream_si256(reinterpret_cast<__m256i*>(dst_byte + 64), c);                     // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              _mm256_stream_si256(reinterpret_cast<__m256i*>(dst_byte + 96), d);                     // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              dst_byte += 128;
+              src_byte += 128;
+              len -= 128;
+            }
+            // streaming stores are weakly ordered, make them visible before anything that follows
+            _mm_sfence();
+          }
+
+          while(len >= 128)
+          {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_byte));      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_byte + 32)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_byte + 64)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_byte + 96)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst_byte), a);                           // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst_byte + 32), b);                      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst_byte + 64), c);                      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst_byte + 96), d);                      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            dst_byte += 128;
+            src_byte += 128;
+            len -= 128;
+          }
+          while(len >= 32)
+          {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst_byte), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_byte))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            dst_byte += 32;
+            src_byte += 32;
+            len -= 32;
+          }
+
+          // the remainder is covered by the tail we loaded at the start
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_end - 32), tail); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          return dst;
+        }
+#endif
+
+        constexpr cpu_kernel<memcpy_func> g_memcpy_kernels[] = {
+#if defined(RSL_MEMCPY_SIMD)
+            {&cpu_has_avx2, &memcpy_avx2},
+            {&cpu_has_sse2, &memcpy_sse2},
+#endif
+            {nullptr, &memcpy_word}};
+      } // namespace
+
+      void* memcpy_runtime(void* dst, const void* src, card64 len)
+      {
+        return best_cpu_kernel<g_memcpy_kernels>()(dst, src, len);
+      }
+    } // namespace internal
+  }   // namespace v1
+} // namespace rsl
@@ -0,0 +1,266 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: memmove.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/internal/memory/memmove.h"
+
+#include "rex_std/bonus/platform/cpu_features.h"
+
+#if defined(RSL_PLATFORM_X64) || defined(RSL_PLATFORM_X86)
+  #include <immintrin.h>
+  #define RSL_MEMMOVE_SIMD
+#endif
+
+// All kernels in here load a block before storing it
+// and load the head and tail of the buffer before anything gets stored.
+// This makes them safe to use on overlapping buffers, as long as
+// the forward kernels only get used when dst sits below src
+// and the backward kernels only when dst sits above src.
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      namespace
+      {
+        using memmove_func = void* (*)(void*, const void*, card64);
+
+#if defined(RSL_COMPILER_MSVC)
+        using unaligned_uint64 = uint64;
+        using unaligned_uint32 = uint32;
+#else
+        // these tell the compiler the load can be unaligned and aliases other types
+        typedef uint64 unaligned_uint64 __attribute__((__may_alias__, __aligned__(1))); // NOLINT(modernize-use-using)
+        typedef uint32 unaligned_uint32 __attribute__((__may_alias__, __aligned__(1))); // NOLINT(modernize-use-using)
+#endif
+
+        // Moves 0 to 16 bytes, all loads happen before the stores
+        void move_small(rsl::byte* dst, const rsl::byte* src, card64 len)
+        {
+          if(len >= 8)
+          {
+            const uint64 head = *reinterpret_cast<const unaligned_uint64*>(src);           // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const uint64 tail = *reinterpret_cast<const unaligned_uint64*>(src + len - 8); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            *reinterpret_cast<unaligned_uint64*>(dst)           = head;                    // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            *reinterpret_cast<unaligned_uint64*>(dst + len - 8) = tail;                    // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          }
+          else if(len >= 4)
+          {
+            const uint32 head = *reinterpret_cast<const unaligned_uint32*>(src);           // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const uint32 tail = *reinterpret_cast<const unaligned_uint32*>(src + len - 4); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            *reinterpret_cast<unaligned_uint32*>(dst)           = head;                    // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            *reinterpret_cast<unaligned_uint32*>(dst + len - 4) = tail;                    // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          }
+          else if(len > 0)
+          {
+            const rsl::byte first  = src[0];
+            const rsl::byte middle = src[len / 2];
+            const rsl::byte last   = src[len - 1];
+            dst[0]                 = first;
+            dst[len / 2]           = middle;
+            dst[len - 1]           = last;
+          }
+        }
+
+        bool must_move_backward(const void* dst, const void* src, card64 len)
+        {
+          // if dst sits inside [src, src + len) copying front to back would overwrite
+          // source bytes before we've read them. Unsigned wrap around makes dst < src fail this check.
+          return reinterpret_cast<uintptr>(dst) - reinterpret_cast<uintptr>(src) < static_cast<uintptr>(len); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+
+        void* memmove_word(void* dst, const void* src, card64 len)
+        {
+          rsl::byte* dst_byte       = static_cast<rsl::byte*>(dst);
+          const rsl::byte* src_byte = static_cast<const rsl::byte*>(src);
+
+          if(len <= 16)
+          {
+            move_small(dst_byte, src_byte, len);
+            return dst;
+          }
+
+          if(!must_move_backward(dst, src, len))
+          {
+            while(len >= 8)
+            {
+              const uint64 word                             = *reinterpret_cast<const unaligned_uint64*>(src_byte); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              *reinterpret_cast<unaligned_uint64*>(dst_byte) = word;                                                // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              dst_byte += 8;
+              src_byte += 8;
+              len -= 8;
+            }
+            while(len-- > 0)
+            {
+              *dst_byte++ = *src_byte++;
+            }
+          }
+          else
+          {
+            dst_byte += len;
+            src_byte += len;
+            while(len >= 8)
+            {
+              dst_byte -= 8;
+              src_byte -= 8;
+              len -= 8;
+              const uint64 word                             = *reinterpret_cast<const unaligned_uint64*>(src_byte); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              *reinterpret_cast<unaligned_uint64*>(dst_byte) = word;                                                // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            }
+            while(len-- > 0)
+            {
+              *--dst_byte = *--src_byte;
+            }
+          }
+
+          return dst;
+        }
+
+#if defined(RSL_MEMMOVE_SIMD)
+        void* memmove_sse2(void* dst, const void* src, card64 len)
+        {
+          rsl::byte* dst_byte       = static_cast<rsl::byte*>(dst);
+          const rsl::byte* src_byte = static_cast<const rsl::byte*>(src);
+
+          if(len <= 16)
+          {
+            move_small(dst_byte, src_byte, len);
+            return dst;
+          }
+
+          const __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_byte));            // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          const __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_byte + len - 16)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          rsl::byte* dst_end = dst_byte + len;
+
+          if(len > 32)
+          {
+            if(!must_move_backward(dst, src, len))
+            {
+              // continue from the next 16 byte aligned address, the head covers the bytes before it
+              const card64 skew = 16 - static_cast<card64>(reinterpret_cast<uintptr>(dst_byte) & 15); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              rsl::byte* dst_it       = dst_byte + skew;
+              const rsl::byte* src_it = src_byte + skew;
+              card64 remaining        = len - skew;
+              while(remaining > 16)
+              {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_it)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                _mm_store_si128(reinterpret_cast<__m128i*>(dst_it), block);                      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                dst_it += 16;
+                src_it += 16;
+                remaining -= 16;
+              }
+            }
+            else
+            {
+              // walk backwards from the last 16 byte aligned address, the tail covers the bytes after it
+              rsl::byte* dst_it       = dst_end - static_cast<card64>(reinterpret_cast<uintptr>(dst_end) & 15); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              const rsl::byte* src_it = src_byte + (dst_it - dst_byte);
+              while(dst_it - dst_byte > 16)
+              {
+                dst_it -= 16;
+                src_it -= 16;
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_it)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                _mm_store_si128(reinterpret_cast<__m128i*>(dst_it), block);                      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              }
+            }
+          }
+
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_byte), head);     // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_end - 16), tail); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          return dst;
+        }
+
+        RSL_TARGET_AVX2 void* memmove_avx2(void* dst, const void* src, card64 len)
+        {
+          rsl::byte* dst_byte       = static_cast<rsl::byte*>(dst);
+          const rsl::byte* src_byte = static_cast<const rsl::byte*>(src);
+
+          if(len <= 32)
+          {
+            return memmove_sse2(dst, src, len);
+          }
+
+          const __m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_byte));            // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          const __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_byte + len - 32)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          rsl::byte* dst_end = dst_byte + len;
+
+          if(len > 64)
+          {
+            if(!must_move_backward(dst, src, len))
+            {
+              // continue from the next 32 byte aligned address, the head covers the bytes before it
+              const card64 skew = 32 - static_cast<card64>(reinterpret_cast<uintptr>(dst_byte) & 31); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              rsl::byte* dst_it       = dst_byte + skew;
+              const rsl::byte* src_it = src_byte + skew;
+              card64 remaining        = len - skew;
+              while(remaining > 64)
+              {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_it));      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_it + 32)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                _mm256_store_si256(reinterpret_cast<__m256i*>(dst_it), a);                           // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                _mm256_store_si256(reinterpret_cast<__m256i*>(dst_it + 32), b);                      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                dst_it += 64;
+                src_it += 64;
+                remaining -= 64;
+              }
+              if(remaining > 32)
+              {
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_it)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                _mm256_store_si256(reinterpret_cast<__m256i*>(dst_it), block);                      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              }
+            }
+            else
+            {
+              // walk backwards from the last 32 byte aligned address, the tail covers the bytes after it
+              rsl::byte* dst_it       = dst_end - static_cast<card64>(reinterpret_cast<uintptr>(dst_end) & 31); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              const rsl::byte* src_it = src_byte + (dst_it - dst_byte);
+              while(dst_it - dst_byte > 64)
+              {
+                dst_it -= 64;
+                src_it -= 64;
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_it + 32)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_it));      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                _mm256_store_si256(reinterpret_cast<__m256i*>(dst_it + 32), b);                      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                _mm256_store_si256(reinterpret_cast<__m256i*>(dst_it), a);                           // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              }
+              if(dst_it - dst_byte > 32)
+              {
+                dst_it -= 32;
+                src_it -= 32;
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_it)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                _mm256_store_si256(reinterpret_cast<__m256i*>(dst_it), block);                      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              }
+            }
+          }
+
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_byte), head);     // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_end - 32), tail); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          return dst;
+        }
+#endif
+
+        constexpr cpu_kernel<memmove_func> g_memmove_kernels[] = {
+#if defined(RSL_MEMMOVE_SIMD)
+            {&cpu_has_avx2, &memmove_avx2},
+            {&cpu_has_sse2, &memmove_sse2},
+#endif
+            {nullptr, &memmove_word}};
+      } // namespace
+
+      void* memmove_runtime(void* dst, const void* src, card64 len)
+      {
+        return best_cpu_kernel<g_memmove_kernels>()(dst, src, len);
+      }
+    } // namespace internal
+  }   // namespace v1
+} // namespace rsl
@@ -0,0 +1,225 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: memset.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/internal/memory/memset.h"
+
+#include "rex_std/bonus/platform/cpu_features.h"
+
+#if defined(RSL_PLATFORM_X64) || defined(RSL_PLATFORM_X86)
+  #include <immintrin.h>
+  #define RSL_MEMSET_SIMD
+#endif
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      namespace
+      {
+        using memset_func = void* (*)(void*, char, card64);
+
+        // Fills bigger than this bypass the cache as the destination
+        // wouldn't fit in it anyway and we'd only evict useful data
+        constexpr card64 g_non_temporal_threshold = 4 * 1024 * 1024;
+
+#if defined(RSL_COMPILER_MSVC)
+        using unaligned_uint64 = uint64;
+        using unaligned_uint32 = uint32;
+#else
+        // these tell the compiler the store can be unaligned and aliases other types
+        typedef uint64 unaligned_uint64 __attribute__((__may_alias__, __aligned__(1))); // NOLINT(modernize-use-using)
+        typedef uint32 unaligned_uint32 __attribute__((__may_alias__, __aligned__(1))); // NOLINT(modernize-use-using)
+#endif
+
+        // returns a word with every byte set to val
+        uint64 splat_byte(char val)
+        {
+          return 0x0101010101010101ull * static_cast<uint8>(val);
+        }
+
+        // Fills 0 to 16 bytes, using 2 overlapping stores
+        void fill_small(rsl::byte* dst, uint64 pattern, card64 len)
+        {
+          if(len >= 8)
+          {
+            *reinterpret_cast<unaligned_uint64*>(dst)           = pattern; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            *reinterpret_cast<unaligned_uint64*>(dst + len - 8) = pattern; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          }
+          else if(len >= 4)
+          {
+            *reinterpret_cast<unaligned_uint32*>(dst)           = static_cast<uint32>(pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            *reinterpret_cast<unaligned_uint32*>(dst + len - 4) = static_cast<uint32>(pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          }
+          else if(len > 0)
+          {
+            const rsl::byte b = static_cast<rsl::byte>(static_cast<uint8>(pattern));
+            dst[0]            = b;
+            dst[len / 2]      = b;
+            dst[len - 1]      = b;
+          }
+        }
+
+        // Portable version, fills a word at a time into an aligned destination
+        void* memset_word(void* dest, char val, card64 len)
+        {
+          rsl::byte* dst_byte  = static_cast<rsl::byte*>(dest);
+          const uint64 pattern = splat_byte(val);
+
+          if(len <= 16)
+          {
+            fill_small(dst_byte, pattern, len);
+            return dest;
+          }
+
+          // the first word is written unaligned, then continue from the next aligned address
+          *reinterpret_cast<unaligned_uint64*>(dst_byte) = pattern;                                   // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          const card64 skew = 8 - static_cast<card64>(reinterpret_cast<uintptr>(dst_byte) & 7); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          rsl::byte* dst_end = dst_byte + len;
+          uint64* dst_word   = reinterpret_cast<uint64*>(dst_byte + skew); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          len -= skew;
+
+          while(len >= 32)
+          {
+            dst_word[0] = pattern;
+            dst_word[1] = pattern;
+            dst_word[2] = pattern;
+            dst_word[3] = pattern;
+            dst_word += 4;
+            len -= 32;
+          }
+          while(len >= 8)
+          {
+            *dst_word++ = pattern;
+            len -= 8;
+          }
+
+          // the last word is written unaligned, overlapping with what we've already written
+          *reinterpret_cast<unaligned_uint64*>(dst_end - 8) = pattern; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          return dest;
+        }
+
+#if defined(RSL_MEMSET_SIMD)
+        void* memset_sse2(void* dest, char val, card64 len)
+        {
+          rsl::byte* dst_byte = static_cast<rsl::byte*>(dest);
+
+          if(len <= 16)
+          {
+            fill_small(dst_byte, splat_byte(val), len);
+            return dest;
+          }
+
+          const __m128i pattern = _mm_set1_epi8(val);
+          rsl::byte* dst_end    = dst_byte + len;
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_byte), pattern);     // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_end - 16), pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          if(len <= 32)
+          {
+            return dest;
+          }
+
+          // the head and tail are already written, fill everything in between with aligned stores
+          rsl::byte* dst_it = dst_byte + 16 - static_cast<card64>(reinterpret_cast<uintptr>(dst_byte) & 15); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          len               = dst_end - dst_it;
+          while(len >= 64)
+          {
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst_it), pattern);      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst_it + 16), pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst_it + 32), pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst_it + 48), pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            dst_it += 64;
+            len -= 64;
+          }
+          while(len >= 16)
+          {
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst_it), pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            dst_it += 16;
+            len -= 16;
+          }
+
+          return dest;
+        }
+
+        RSL_TARGET_AVX2 void* memset_avx2(void* dest, char val, card64 len)
+        {
+          rsl::byte* dst_byte = static_cast<rsl::byte*>(dest);
+
+          if(len <= 32)
+          {
+            return memset_sse2(dest, val, len);
+          }
+
+          const __m256i pattern = _mm256_set1_epi8(val);
+          rsl::byte* dst_end    = dst_byte + len;
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_byte), pattern);     // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_end - 32), pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          if(len <= 64)
+          {
+            return dest;
+          }
+
+          // the head and tail are already written, fill everything in between with aligned stores
+          rsl::byte* dst_it = dst_byte + 32 - static_cast<card64>(reinterpret_cast<uintptr>(dst_byte) & 31); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          len               = dst_end - dst_it;
+
+          if(len >= g_non_temporal_threshold)
+          {
+            while(len >= 128)
+            {
+              _mm256_stream_si256(reinterpret_cast<__m256i*>(dst_it), pattern);      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              _mm256_stream_si256(reinterpret_cast<__m256i*>(dst_it + 32), pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              _mm256_stream_si256(reinterpret_cast<__m256i*>(dst_it + 64), pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              _mm256_stream_si256(reinterpret_cast<__m256i*>(dst_it + 96), pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              dst_it += 128;
+              len -= 128;
+            }
+            // streaming stores are weakly ordered, make them visible before anything that follows
+            _mm_sfence();
+          }
+
+          while(len >= 128)
+          {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst_it), pattern);      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst_it + 32), pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst_it + 64), pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst_it + 96), pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            dst_it += 128;
+            len -= 128;
+          }
+          while(len >= 32)
+          {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dst_it), pattern); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            dst_it += 32;
+            len -= 32;
+          }
+
+          return dest;
+        }
+#endif
+
+        constexpr cpu_kernel<memset_func> g_memset_kernels[] = {
+#if defined(RSL_MEMSET_SIMD)
+            {&cpu_has_avx2, &memset_avx2},
+            {&cpu_has_sse2, &memset_sse2},
+#endif
+            {nullptr, &memset_word}};
+      } // namespace
+
+      void* memset_runtime(void* dest, char val, card64 len)
+      {
+        return best_cpu_kernel<g_memset_kernels>()(dest, val, len);
+      }
+    } // namespace internal
+  }   // namespace v1
+} // namespace rsl
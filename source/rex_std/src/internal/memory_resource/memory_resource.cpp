@@ -0,0 +1,116 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: memory_resource.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/internal/memory_resource/memory_resource.h"
+
+#include "rex_std/assert.h"
+#include "rex_std/atomic.h"
+
+#include <new> // needed for aligned operator new
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace pmr
+    {
+      namespace
+      {
+        class new_delete_memory_resource final : public memory_resource
+        {
+        private:
+          void* do_allocate(size_t bytes, size_t alignment) override
+          {
+            // the aligned overloads are only needed when operator new doesn't give us the alignment already
+            if(alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+              return operator new(bytes, static_cast<std::align_val_t>(alignment));
+            }
+            return operator new(bytes);
+          }
+          void do_deallocate(void* p, size_t bytes, size_t alignment) override
+          {
+            if(alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+              operator delete(p, bytes, static_cast<std::align_val_t>(alignment));
+              return;
+            }
+            operator delete(p, bytes);
+          }
+          bool do_is_equal(const memory_resource& other) const override
+          {
+            // there's only 1 instance of this resource
+            return this == &other;
+          }
+        };
+
+        class null_resource final : public memory_resource
+        {
+        private:
+          void* do_allocate(size_t /*bytes*/, size_t /*alignment*/) override
+          {
+            RSL_ASSERT_X(false, "allocating from the null memory resource");
+            return nullptr;
+          }
+          void do_deallocate(void* /*p*/, size_t /*bytes*/, size_t /*alignment*/) override {}
+          bool do_is_equal(const memory_resource& other) const override
+          {
+            return this == &other;
+          }
+        };
+
+        // these never get destroyed, so memory can still be freed through them
+        // when containers in other static objects get destroyed at exit
+        new_delete_memory_resource& new_delete_instance()
+        {
+          alignas(new_delete_memory_resource) static char8 storage[sizeof(new_delete_memory_resource)];
+          static new_delete_memory_resource* instance = new(storage) new_delete_memory_resource();
+          return *instance;
+        }
+        null_resource& null_instance()
+        {
+          alignas(null_resource) static char8 storage[sizeof(null_resource)];
+          static null_resource* instance = new(storage) null_resource();
+          return *instance;
+        }
+
+        rsl::atomic<memory_resource*>& default_resource()
+        {
+          static rsl::atomic<memory_resource*> resource(new_delete_resource());
+          return resource;
+        }
+      } // namespace
+
+      memory_resource* new_delete_resource()
+      {
+        return &new_delete_instance();
+      }
+      memory_resource* null_memory_resource()
+      {
+        return &null_instance();
+      }
+
+      memory_resource* set_default_resource(memory_resource* r)
+      {
+        if(r == nullptr)
+        {
+          r = new_delete_resource();
+        }
+        return default_resource().exchange(r);
+      }
+      memory_resource* get_default_resource()
+      {
+        return default_resource().load();
+      }
+    } // namespace pmr
+  }   // namespace v1
+} // namespace rsl
@@ -0,0 +1,153 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: monotonic_buffer_resource.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/internal/memory_resource/monotonic_buffer_resource.h"
+
+#include "rex_std/internal/algorithm/max.h"
+#include "rex_std/limits.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace pmr
+    {
+      namespace
+      {
+        // the size of the first buffer allocated from upstream when no initial size is given
+        constexpr size_t g_default_first_buffer_size = 1024;
+        // every buffer allocated from upstream is this much bigger than the previous one
+        constexpr size_t g_buffer_growth_factor = 2;
+
+        // returns the number of bytes needed to align p to alignment
+        size_t align_padding(const void* p, size_t alignment)
+        {
+          const uintptr address = reinterpret_cast<uintptr>(p); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          return static_cast<size_t>(((address + alignment - 1) & ~(alignment - 1)) - address);
+        }
+
+        size_t grow(size_t size)
+        {
+          return size > (rsl::numeric_limits<size_t>::max)() / g_buffer_growth_factor ? size : size * g_buffer_growth_factor;
+        }
+      } // namespace
+
+      monotonic_buffer_resource::monotonic_buffer_resource()
+          : monotonic_buffer_resource(g_default_first_buffer_size, get_default_resource())
+      {
+      }
+      monotonic_buffer_resource::monotonic_buffer_resource(memory_resource* upstream)
+          : monotonic_buffer_resource(g_default_first_buffer_size, upstream)
+      {
+      }
+      monotonic_buffer_resource::monotonic_buffer_resource(size_t initialSize)
+          : monotonic_buffer_resource(initialSize, get_default_resource())
+      {
+      }
+      monotonic_buffer_resource::monotonic_buffer_resource(size_t initialSize, memory_resource* upstream)
+          : m_upstream(upstream)
+          , m_initial_buffer(nullptr)
+          , m_initial_buffer_size(0)
+          , m_current(nullptr)
+          , m_space_available(0)
+          , m_next_buffer_size(initialSize != 0 ? initialSize : 1)
+          , m_first_buffer_size(m_next_buffer_size)
+          , m_buffers(nullptr)
+      {
+      }
+      monotonic_buffer_resource::monotonic_buffer_resource(void* buffer, size_t bufferSize)
+          : monotonic_buffer_resource(buffer, bufferSize, get_default_resource())
+      {
+      }
+      monotonic_buffer_resource::monotonic_buffer_resource(void* buffer, size_t bufferSize, memory_resource* upstream)
+          : m_upstream(upstream)
+          , m_initial_buffer(buffer)
+          , m_initial_buffer_size(bufferSize)
+          , m_current(static_cast<char8*>(buffer))
+          , m_space_available(bufferSize)
+          , m_next_buffer_size(bufferSize != 0 ? grow(bufferSize) : g_default_first_buffer_size)
+          , m_first_buffer_size(m_next_buffer_size)
+          , m_buffers(nullptr)
+      {
+      }
+
+      monotonic_buffer_resource::~monotonic_buffer_resource()
+      {
+        release();
+      }
+
+      void monotonic_buffer_resource::release()
+      {
+        while(m_buffers)
+        {
+          buffer_header* next = m_buffers->next;
+          m_upstream->deallocate(m_buffers, m_buffers->size, m_buffers->alignment);
+          m_buffers = next;
+        }
+
+        m_current          = static_cast<char8*>(m_initial_buffer);
+        m_space_available  = m_initial_buffer_size;
+        m_next_buffer_size = m_first_buffer_size;
+      }
+
+      memory_resource* monotonic_buffer_resource::upstream_resource() const
+      {
+        return m_upstream;
+      }
+
+      void* monotonic_buffer_resource::do_allocate(size_t bytes, size_t alignment)
+      {
+        size_t padding = align_padding(m_current, alignment);
+        if(m_current == nullptr || padding + bytes > m_space_available)
+        {
+          allocate_buffer(bytes, alignment);
+          padding = align_padding(m_current, alignment);
+        }
+
+        char8* ptr = m_current + padding;
+        m_current  = ptr + bytes;
+        m_space_available -= padding + bytes;
+        return ptr;
+      }
+
+      void monotonic_buffer_resource::do_deallocate(void* /*p*/, size_t /*bytes*/, size_t /*alignment*/)
+      {
+        // memory is only released when the resource is released or destroyed
+      }
+
+      bool monotonic_buffer_resource::do_is_equal(const memory_resource& other) const
+      {
+        return this == &other;
+      }
+
+      void monotonic_buffer_resource::allocate_buffer(size_t bytes, size_t alignment)
+      {
+        // the header lives at the start of the buffer, the blocks are carved from the memory after it.
+        // reserve enough space so the requested block fits after aligning it
+        const size_t header_alignment = alignof(buffer_header);
+        const size_t buffer_alignment = (rsl::max)(alignment, header_alignment);
+        const size_t min_size         = sizeof(buffer_header) + (alignment > header_alignment ? alignment : 0) + bytes;
+        const size_t size             = (rsl::max)(m_next_buffer_size, min_size);
+
+        buffer_header* buffer = static_cast<buffer_header*>(m_upstream->allocate(size, buffer_alignment));
+        buffer->next          = m_buffers;
+        buffer->size          = size;
+        buffer->alignment     = buffer_alignment;
+        m_buffers             = buffer;
+
+        m_current          = reinterpret_cast<char8*>(buffer) + sizeof(buffer_header); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        m_space_available  = size - sizeof(buffer_header);
+        m_next_buffer_size = grow(size);
+      }
+    } // namespace pmr
+  }   // namespace v1
+} // namespace rsl
@@ -0,0 +1,78 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: synchronized_pool_resource.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/internal/memory_resource/synchronized_pool_resource.h"
+
+#include "rex_std/internal/mutex/unique_lock.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace pmr
+    {
+      synchronized_pool_resource::synchronized_pool_resource()
+          : m_mutex()
+          , m_pool()
+      {
+      }
+      synchronized_pool_resource::synchronized_pool_resource(memory_resource* upstream)
+          : m_mutex()
+          , m_pool(upstream)
+      {
+      }
+      synchronized_pool_resource::synchronized_pool_resource(const pool_options& opts)
+          : m_mutex()
+          , m_pool(opts)
+      {
+      }
+      synchronized_pool_resource::synchronized_pool_resource(const pool_options& opts, memory_resource* upstream)
+          : m_mutex()
+          , m_pool(opts, upstream)
+      {
+      }
+
+      void synchronized_pool_resource::release()
+      {
+        const rsl::unique_lock<rsl::mutex> lock(m_mutex);
+        m_pool.release();
+      }
+
+      memory_resource* synchronized_pool_resource::upstream_resource() const
+      {
+        return m_pool.upstream_resource();
+      }
+
+      pool_options synchronized_pool_resource::options() const
+      {
+        return m_pool.options();
+      }
+
+      void* synchronized_pool_resource::do_allocate(size_t bytes, size_t alignment)
+      {
+        const rsl::unique_lock<rsl::mutex> lock(m_mutex);
+        return m_pool.allocate(bytes, alignment);
+      }
+
+      void synchronized_pool_resource::do_deallocate(void* p, size_t bytes, size_t alignment)
+      {
+        const rsl::unique_lock<rsl::mutex> lock(m_mutex);
+        m_pool.deallocate(p, bytes, alignment);
+      }
+
+      bool synchronized_pool_resource::do_is_equal(const memory_resource& other) const
+      {
+        return this == &other;
+      }
+    } // namespace pmr
+  }   // namespace v1
+} // namespace rsl
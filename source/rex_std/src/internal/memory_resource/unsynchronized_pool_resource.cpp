@@ -0,0 +1,263 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: unsynchronized_pool_resource.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/internal/memory_resource/unsynchronized_pool_resource.h"
+
+#include "rex_std/internal/algorithm/max.h"
+#include "rex_std/internal/algorithm/min.h"
+#include "rex_std/internal/bit/bit_ceil.h"
+#include "rex_std/internal/bit/countr_zero.h"
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace pmr
+    {
+      namespace
+      {
+        // the smallest block a pool hands out, a free block needs to be able to hold a pointer
+        constexpr size_t g_min_pool_block_size = 8;
+        // used when the options don't specify the largest block
+        constexpr size_t g_default_largest_pool_block = 4096;
+        // used when the options don't specify the max blocks per chunk
+        constexpr size_t g_default_max_blocks_per_chunk = 1024;
+        // the hard limit on the number of blocks in a chunk
+        constexpr size_t g_max_blocks_per_chunk_limit = size_t(1) << 20u;
+        // the first chunk of a pool is roughly this big, so pools of big blocks don't start with huge chunks
+        constexpr size_t g_first_chunk_size = 4096;
+        // chunks are aligned to their block size, capped at this.
+        // allocations with a bigger alignment are passed to upstream
+        constexpr size_t g_max_chunk_alignment = 4096;
+
+        size_t pool_block_size(card32 poolIdx)
+        {
+          return g_min_pool_block_size << poolIdx;
+        }
+
+        size_t first_chunk_block_count(size_t blockSize, size_t maxBlocksPerChunk)
+        {
+          return (rsl::min)((rsl::max)(g_first_chunk_size / blockSize, size_t(1)), maxBlocksPerChunk);
+        }
+
+        size_t round_up(size_t value, size_t alignment)
+        {
+          return (value + alignment - 1) & ~(alignment - 1);
+        }
+      } // namespace
+
+      unsynchronized_pool_resource::unsynchronized_pool_resource()
+          : unsynchronized_pool_resource(pool_options {}, get_default_resource())
+      {
+      }
+      unsynchronized_pool_resource::unsynchronized_pool_resource(memory_resource* upstream)
+          : unsynchronized_pool_resource(pool_options {}, upstream)
+      {
+      }
+      unsynchronized_pool_resource::unsynchronized_pool_resource(const pool_options& opts)
+          : unsynchronized_pool_resource(opts, get_default_resource())
+      {
+      }
+      unsynchronized_pool_resource::unsynchronized_pool_resource(const pool_options& opts, memory_resource* upstream)
+          : m_upstream(upstream)
+          , m_options(opts)
+          , m_num_pools(0)
+          , m_pools()
+          , m_large_allocations(nullptr)
+      {
+        // apply the defaults and the limits of the implementation to the options
+        if(m_options.max_blocks_per_chunk == 0)
+        {
+          m_options.max_blocks_per_chunk = g_default_max_blocks_per_chunk;
+        }
+        m_options.max_blocks_per_chunk = (rsl::min)(m_options.max_blocks_per_chunk, g_max_blocks_per_chunk_limit);
+
+        if(m_options.largest_required_pool_block == 0)
+        {
+          m_options.largest_required_pool_block = g_default_largest_pool_block;
+        }
+        const size_t largest_pool_block       = pool_block_size(s_max_num_pools - 1);
+        m_options.largest_required_pool_block = rsl::bit_ceil((rsl::max)((rsl::min)(m_options.largest_required_pool_block, largest_pool_block), g_min_pool_block_size));
+
+        m_num_pools = static_cast<card32>(rsl::countr_zero(m_options.largest_required_pool_block / g_min_pool_block_size)) + 1;
+        for(card32 i = 0; i < m_num_pools; ++i)
+        {
+          m_pools[i].next_chunk_block_count = first_chunk_block_count(pool_block_size(i), m_options.max_blocks_per_chunk);
+        }
+      }
+
+      unsynchronized_pool_resource::~unsynchronized_pool_resource()
+      {
+        release();
+      }
+
+      void unsynchronized_pool_resource::release()
+      {
+        for(card32 i = 0; i < m_num_pools; ++i)
+        {
+          pool& pool             = m_pools[i];
+          const size_t alignment = (rsl::min)(pool_block_size(i), g_max_chunk_alignment);
+          while(pool.chunks)
+          {
+            chunk_footer* next = pool.chunks->next;
+            m_upstream->deallocate(pool.chunks->begin, pool.chunks->size, alignment);
+            pool.chunks = next;
+          }
+          pool = {nullptr, nullptr, nullptr, first_chunk_block_count(pool_block_size(i), m_options.max_blocks_per_chunk), nullptr};
+        }
+
+        while(m_large_allocations)
+        {
+          large_header* next = m_large_allocations->next;
+          deallocate_large(reinterpret_cast<char8*>(m_large_allocations) + sizeof(large_header), m_large_allocations->size, m_large_allocations->alignment); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          m_large_allocations = next;
+        }
+      }
+
+      memory_resource* unsynchronized_pool_resource::upstream_resource() const
+      {
+        return m_upstream;
+      }
+
+      pool_options unsynchronized_pool_resource::options() const
+      {
+        return m_options;
+      }
+
+      void* unsynchronized_pool_resource::do_allocate(size_t bytes, size_t alignment)
+      {
+        const card32 pool_idx = pool_index(bytes, alignment);
+        if(pool_idx == m_num_pools)
+        {
+          return allocate_large(bytes, alignment);
+        }
+
+        pool& pool = m_pools[pool_idx];
+
+        // recently freed blocks first, they're most likely still in cache
+        if(pool.free_list)
+        {
+          free_block* block = pool.free_list;
+          pool.free_list    = block->next;
+          return block;
+        }
+
+        const size_t block_size = pool_block_size(pool_idx);
+        if(pool.unused_begin != pool.unused_end)
+        {
+          void* block = pool.unused_begin;
+          pool.unused_begin += block_size;
+          return block;
+        }
+
+        return allocate_from_new_chunk(pool, block_size);
+      }
+
+      void unsynchronized_pool_resource::do_deallocate(void* p, size_t bytes, size_t alignment)
+      {
+        const card32 pool_idx = pool_index(bytes, alignment);
+        if(pool_idx == m_num_pools)
+        {
+          large_header* header = reinterpret_cast<large_header*>(static_cast<char8*>(p) - sizeof(large_header)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          if(header->prev)
+          {
+            header->prev->next = header->next;
+          }
+          else
+          {
+            m_large_allocations = header->next;
+          }
+          if(header->next)
+          {
+            header->next->prev = header->prev;
+          }
+          deallocate_large(p, bytes, alignment);
+          return;
+        }
+
+        pool& pool        = m_pools[pool_idx];
+        free_block* block = static_cast<free_block*>(p);
+        block->next       = pool.free_list;
+        pool.free_list    = block;
+      }
+
+      bool unsynchronized_pool_resource::do_is_equal(const memory_resource& other) const
+      {
+        return this == &other;
+      }
+
+      card32 unsynchronized_pool_resource::pool_index(size_t bytes, size_t alignment) const
+      {
+        // blocks are aligned to their size, so a bigger alignment is met by using a bigger block
+        const size_t block_size = rsl::bit_ceil((rsl::max)((rsl::max)(bytes, alignment), g_min_pool_block_size));
+        if(block_size > m_options.largest_required_pool_block || alignment > g_max_chunk_alignment)
+        {
+          return m_num_pools;
+        }
+        return static_cast<card32>(rsl::countr_zero(block_size / g_min_pool_block_size));
+      }
+
+      void* unsynchronized_pool_resource::allocate_from_new_chunk(pool& pool, size_t blockSize)
+      {
+        // the footer goes after the blocks, which are a multiple of 8 bytes, so it's always aligned
+        static_assert(alignof(chunk_footer) <= g_min_pool_block_size, "chunk footer would be misaligned");
+
+        const size_t block_count = pool.next_chunk_block_count;
+        const size_t blocks_size = block_count * blockSize;
+        const size_t chunk_size  = blocks_size + sizeof(chunk_footer);
+
+        char8* blocks         = static_cast<char8*>(m_upstream->allocate(chunk_size, (rsl::min)(blockSize, g_max_chunk_alignment)));
+        chunk_footer* footer  = reinterpret_cast<chunk_footer*>(blocks + blocks_size); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        footer->next          = pool.chunks;
+        footer->begin         = blocks;
+        footer->size          = chunk_size;
+        pool.chunks           = footer;
+
+        // every chunk is twice as big as the previous one, so the number of chunks stays small
+        pool.next_chunk_block_count = (rsl::min)(block_count * 2, m_options.max_blocks_per_chunk);
+
+        pool.unused_begin = blocks + blockSize;
+        pool.unused_end   = blocks + blocks_size;
+        return blocks;
+      }
+
+      void* unsynchronized_pool_resource::allocate_large(size_t bytes, size_t alignment)
+      {
+        // the header lives right in front of the block
+        const size_t upstream_alignment = (rsl::max)(alignment, alignof(large_header));
+        const size_t header_space       = round_up(sizeof(large_header), upstream_alignment);
+
+        char8* memory        = static_cast<char8*>(m_upstream->allocate(header_space + bytes, upstream_alignment));
+        char8* block         = memory + header_space;
+        large_header* header = reinterpret_cast<large_header*>(block - sizeof(large_header)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        header->next         = m_large_allocations;
+        header->prev         = nullptr;
+        header->size         = bytes;
+        header->alignment    = alignment;
+        if(m_large_allocations)
+        {
+          m_large_allocations->prev = header;
+        }
+        m_large_allocations = header;
+
+        return block;
+      }
+
+      void unsynchronized_pool_resource::deallocate_large(void* p, size_t bytes, size_t alignment)
+      {
+        const size_t upstream_alignment = (rsl::max)(alignment, alignof(large_header));
+        const size_t header_space       = round_up(sizeof(large_header), upstream_alignment);
+        m_upstream->deallocate(static_cast<char8*>(p) - header_space, header_space + bytes, upstream_alignment);
+      }
+    } // namespace pmr
+  }   // namespace v1
+} // namespace rsl
@@ -12,27 +12,194 @@
 
 #include "rex_std/internal/string/memchr.h"
 
+#include "rex_std/bonus/platform/cpu_features.h"
+#include "rex_std/internal/bit/countr_zero.h"
+
+#if defined(RSL_PLATFORM_X64) || defined(RSL_PLATFORM_X86)
+  #include <immintrin.h>
+  #define RSL_MEMCHR_SIMD
+#endif
+
 // IWYU pragma: no_include <built-in>
 
+// The SIMD kernels only ever load aligned blocks.
+// An aligned block never crosses a page boundary, so reading the bytes
+// in front of ptr or past its end that share a block with it can't fault.
+// Those bytes are masked out of the result.
+
 namespace rsl
 {
   inline namespace v1
   {
-
-    void* memchr(const void* ptr, char8 ch, card32 length)
+    namespace internal
     {
-      const char8* str = reinterpret_cast<const char8*>(ptr); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-
-      for(card32 n = 0; n < length; n++)
+      namespace
       {
-        if(str[n] == ch)
+        using memchr_func = const char8* (*)(const char8*, char8, card64);
+
+#if defined(RSL_COMPILER_MSVC)
+        using unaligned_uint64 = uint64;
+#else
+        // the words we load are aligned, but they alias the char8 buffer, which needs may_alias
+        typedef uint64 unaligned_uint64 __attribute__((__may_alias__, __aligned__(1))); // NOLINT(modernize-use-using)
+#endif
+
+        const char8* memchr_word(const char8* str, char8 ch, card64 length)
         {
-          return reinterpret_cast<void*>(const_cast<char8*>(str + n)); // NOLINT
+          const char8* end = str + length;
+
+          // check byte by byte until we're aligned to a word
+          while(str != end && (reinterpret_cast<uintptr>(str) & (sizeof(uint64) - 1)) != 0) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          {
+            if(*str == ch)
+            {
+              return str;
+            }
+            ++str;
+          }
+
+          // a word has a zero byte if subtracting 1 from every byte borrows into its top bit
+          constexpr uint64 low_bits  = 0x0101010101010101ull;
+          constexpr uint64 high_bits = 0x8080808080808080ull;
+          const uint64 pattern       = low_bits * static_cast<uint8>(ch);
+          while(end - str >= static_cast<card64>(sizeof(uint64)))
+          {
+            const uint64 word = *reinterpret_cast<const unaligned_uint64*>(str) ^ pattern; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            if(((word - low_bits) & ~word & high_bits) != 0)
+            {
+              break;
+            }
+            str += sizeof(uint64);
+          }
+
+          while(str != end)
+          {
+            if(*str == ch)
+            {
+              return str;
+            }
+            ++str;
+          }
+
+          return nullptr;
         }
-      }
 
-      return nullptr;
+#if defined(RSL_MEMCHR_SIMD)
+        const char8* memchr_sse2(const char8* str, char8 ch, card64 length)
+        {
+          if(length == 0)
+          {
+            return nullptr;
+          }
+
+          const char8* end     = str + length;
+          const __m128i needle = _mm_set1_epi8(ch);
+
+          // start at the aligned block holding the first byte and ignore the bytes in front of str
+          const char8* block = reinterpret_cast<const char8*>(reinterpret_cast<uintptr>(str) & ~static_cast<uintptr>(15)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          uint32 mask        = static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(block)), needle))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          mask &= ~0u << (str - block);
+
+          while(end - block > 16)
+          {
+            if(mask != 0)
+            {
+              return block + rsl::countr_zero(mask);
+            }
+            block += 16;
+
+            // check 64 bytes per iteration while we're far enough from the end
+            while(end - block > 64)
+            {
+              const __m128i a   = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(block)), needle);      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              const __m128i b   = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(block + 16)), needle); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              const __m128i c   = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(block + 32)), needle); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              const __m128i d   = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(block + 48)), needle); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              const __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+              if(_mm_movemask_epi8(any) != 0)
+              {
+                break;
+              }
+              block += 64;
+            }
+
+            mask = static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(block)), needle))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          }
+
+          // this is the last block, ignore the bytes past the end
+          const card64 valid = end - block;
+          if(valid < 16)
+          {
+            mask &= (1u << valid) - 1;
+          }
+          return mask != 0 ? block + rsl::countr_zero(mask) : nullptr;
+        }
+
+        RSL_TARGET_AVX2 const char8* memchr_avx2(const char8* str, char8 ch, card64 length)
+        {
+          if(length == 0)
+          {
+            return nullptr;
+          }
+
+          const char8* end     = str + length;
+          const __m256i needle = _mm256_set1_epi8(ch);
+
+          // start at the aligned block holding the first byte and ignore the bytes in front of str
+          const char8* block = reinterpret_cast<const char8*>(reinterpret_cast<uintptr>(str) & ~static_cast<uintptr>(31)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          uint32 mask        = static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(block)), needle))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          mask &= ~0u << (str - block);
+
+          while(end - block > 32)
+          {
+            if(mask != 0)
+            {
+              return block + rsl::countr_zero(mask);
+            }
+            block += 32;
+
+            // check 128 bytes per iteration while we're far enough from the end
+            while(end - block > 128)
+            {
+              const __m256i a   = _mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(block)), needle);      // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              const __m256i b   = _mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(block + 32)), needle); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              const __m256i c   = _mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(block + 64)), needle); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              const __m256i d   = _mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(block + 96)), needle); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+              const __m256i any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+              if(_mm256_movemask_epi8(any) != 0)
+              {
+                break;
+              }
+              block += 128;
+            }
+
+            mask = static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(block)), needle))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          }
+
+          // this is the last block, ignore the bytes past the end
+          const card64 valid = end - block;
+          if(valid < 32)
+          {
+            mask &= (1u << valid) - 1;
+          }
+          return mask != 0 ? block + rsl::countr_zero(mask) : nullptr;
+        }
+#endif
+
+        constexpr cpu_kernel<memchr_func> g_memchr_kernels[] = {
+#if defined(RSL_MEMCHR_SIMD)
+            {&cpu_has_avx2, &memchr_avx2},
+            {&cpu_has_sse2, &memchr_sse2},
+#endif
+            {nullptr, &memchr_word}};
+      } // namespace
+    }   // namespace internal
+
+    void* memchr(const void* ptr, char8 ch, card64 length)
+    {
+      const char8* str = static_cast<const char8*>(ptr);
+      return const_cast<char8*>(best_cpu_kernel<internal::g_memchr_kernels>()(str, ch, length)); // NOLINT(cppcoreguidelines-pro-type-const-cast)
     }
 
   } // namespace v1
-} // namespace rsl
\ No newline at end of file
+} // namespace rsl
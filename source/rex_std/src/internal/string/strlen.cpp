@@ -0,0 +1,129 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: strlen.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std/bonus/platform/cpu_features.h"
+#include "rex_std/cstring.h"
+#include "rex_std/internal/bit/countr_zero.h"
+
+#if defined(RSL_PLATFORM_X64) || defined(RSL_PLATFORM_X86)
+  #include <immintrin.h>
+  #define RSL_STRLEN_SIMD
+#endif
+
+// We don't know the length up front, so all kernels only ever load aligned blocks.
+// An aligned block never crosses a page boundary, so reading past the null terminator
+// or in front of the string within the same block can't fault.
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    namespace internal
+    {
+      namespace
+      {
+        using strlen_func = card64 (*)(const char8*);
+
+#if defined(RSL_COMPILER_MSVC)
+        using unaligned_uint64 = uint64;
+#else
+        // the string is read a word at a time, so the word type has to be allowed to alias the characters
+        typedef uint64 unaligned_uint64 __attribute__((__may_alias__, __aligned__(1))); // NOLINT(modernize-use-using)
+#endif
+
+        card64 strlen_word(const char8* str)
+        {
+          const char8* it = str;
+
+          // check byte by byte until we're aligned to a word
+          while((reinterpret_cast<uintptr>(it) & (sizeof(uint64) - 1)) != 0) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          {
+            if(*it == '\0')
+            {
+              return it - str;
+            }
+            ++it;
+          }
+
+          // a word has a zero byte if subtracting 1 from every byte borrows into its top bit
+          constexpr uint64 low_bits  = 0x0101010101010101ull;
+          constexpr uint64 high_bits = 0x8080808080808080ull;
+          while(true)
+          {
+            const uint64 word = *reinterpret_cast<const unaligned_uint64*>(it); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            if(((word - low_bits) & ~word & high_bits) != 0)
+            {
+              break;
+            }
+            it += sizeof(uint64);
+          }
+
+          while(*it != '\0')
+          {
+            ++it;
+          }
+          return it - str;
+        }
+
+#if defined(RSL_STRLEN_SIMD)
+        card64 strlen_sse2(const char8* str)
+        {
+          const __m128i zero = _mm_setzero_si128();
+
+          // start at the aligned block holding the first byte and ignore the bytes in front of str
+          const char8* block = reinterpret_cast<const char8*>(reinterpret_cast<uintptr>(str) & ~static_cast<uintptr>(15));                     // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          uint32 mask        = static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(block)), zero))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          mask &= ~0u << (str - block);
+
+          while(mask == 0)
+          {
+            block += 16;
+            mask = static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(block)), zero))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          }
+
+          return (block + rsl::countr_zero(mask)) - str;
+        }
+
+        RSL_TARGET_AVX2 card64 strlen_avx2(const char8* str)
+        {
+          const __m256i zero = _mm256_setzero_si256();
+
+          // start at the aligned block holding the first byte and ignore the bytes in front of str
+          const char8* block = reinterpret_cast<const char8*>(reinterpret_cast<uintptr>(str) & ~static_cast<uintptr>(31));                              // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          uint32 mask        = static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(block)), zero))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          mask &= ~0u << (str - block);
+
+          while(mask == 0)
+          {
+            block += 32;
+            mask = static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(block)), zero))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+          }
+
+          return (block + rsl::countr_zero(mask)) - str;
+        }
+#endif
+
+        constexpr cpu_kernel<strlen_func> g_strlen_kernels[] = {
+#if defined(RSL_STRLEN_SIMD)
+            {&cpu_has_avx2, &strlen_avx2},
+            {&cpu_has_sse2, &strlen_sse2},
+#endif
+            {nullptr, &strlen_word}};
+      } // namespace
+
+      card64 strlen_runtime(const char8* str)
+      {
+        return best_cpu_kernel<g_strlen_kernels>()(str);
+      }
+    } // namespace internal
+  }   // namespace v1
+} // namespace rsl
@@ -12,8 +12,14 @@
 
 #include "rex_std/internal/thread/this_thread.h"
 
-#include <Windows.h>
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include <Windows.h>
 // IWYU pragma: no_include <built-in>
+#elif defined(RSL_PLATFORM_LINUX)
+  #include <pthread.h>
+  #include <sched.h>
+  #include <time.h>
+#endif
 
 namespace rsl
 {
@@ -31,7 +37,15 @@ namespace rsl
             auto diff = sleeptime.diff_in_ms(now);
             if (diff > 0)
             {
+#if defined(RSL_PLATFORM_WINDOWS)
               Sleep(diff);
+#elif defined(RSL_PLATFORM_LINUX)
+              timespec duration {};
+              duration.tv_sec  = diff / 1000;
+              duration.tv_nsec = (diff % 1000) * 1'000'000;
+              // an interrupted sleep is fine, the loop sleeps again for the remaining time
+              nanosleep(&duration, nullptr);
+#endif
             }
             now = rsl::internal::xtime::get();
           } while((now.sec < sleeptime.sec || now.sec == sleeptime.sec) && now.nsec < sleeptime.nsec);
@@ -40,12 +54,21 @@ namespace rsl
 
       thread::id get_id()
       {
+#if defined(RSL_PLATFORM_WINDOWS)
         return thread::id(GetCurrentThreadId());
+#elif defined(RSL_PLATFORM_LINUX)
+        // rsl::thread uses the pthread_t as its id, so use the same here
+        return thread::id(static_cast<ulong>(pthread_self()));
+#endif
       }
 
       void yield()
       {
+#if defined(RSL_PLATFORM_WINDOWS)
         SwitchToThread();
+#elif defined(RSL_PLATFORM_LINUX)
+        sched_yield();
+#endif
       }
     } // namespace this_thread
   }   // namespace v1
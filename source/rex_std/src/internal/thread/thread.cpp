@@ -12,8 +12,13 @@
 
 #include "rex_std/internal/thread/thread.h"
 
-#include <Windows.h> // for INFINITE
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include <Windows.h> // for INFINITE
 // IWYU pragma: no_include <built-in>
+#elif defined(RSL_PLATFORM_LINUX)
+  #include <pthread.h>
+  #include <unistd.h>
+#endif
 
 #include "rex_std/internal/exception/teminate.h"
 #include "rex_std/internal/utility/exchange.h"
@@ -23,8 +28,30 @@ namespace rsl
 {
   inline namespace v1
   {
+    namespace
+    {
+#if defined(RSL_PLATFORM_WINDOWS)
+      thread::native_handle_type invalid_thread_handle()
+      {
+        return INVALID_HANDLE_VALUE;
+      }
+#elif defined(RSL_PLATFORM_LINUX)
+      // pthread_t is an integer on linux, we store it in the native handle
+      static_assert(sizeof(pthread_t) <= sizeof(thread::native_handle_type), "pthread_t doesn't fit in a native handle");
+
+      thread::native_handle_type invalid_thread_handle()
+      {
+        return nullptr;
+      }
+      pthread_t to_pthread(thread::native_handle_type handle)
+      {
+        return reinterpret_cast<pthread_t>(handle); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+      }
+#endif
+    } // namespace
+
     thread::thread()
-        : m_handle(INVALID_HANDLE_VALUE)
+        : m_handle(invalid_thread_handle())
         , m_id(0)
     {
     }
@@ -34,7 +61,7 @@ namespace rsl
         , m_id(other.m_id)
     {
       other.m_id     = thread::id(0);
-      other.m_handle = INVALID_HANDLE_VALUE;
+      other.m_handle = invalid_thread_handle();
     }
 
     thread::~thread()
@@ -53,7 +80,7 @@ namespace rsl
       }
 
       m_id     = rsl::exchange(other.m_id, thread::id(0));
-      m_handle = rsl::exchange(other.m_handle, INVALID_HANDLE_VALUE);
+      m_handle = rsl::exchange(other.m_handle, invalid_thread_handle());
 
       return *this;
     }
@@ -70,22 +97,30 @@ namespace rsl
 
     bool thread::joinable() const
     {
-      return m_handle != INVALID_HANDLE_VALUE;
+      return m_handle != invalid_thread_handle();
     }
 
     void thread::join()
     {
+#if defined(RSL_PLATFORM_WINDOWS)
       WaitForSingleObject(m_handle, INFINITE);
       CloseHandle(m_handle);
+#elif defined(RSL_PLATFORM_LINUX)
+      pthread_join(to_pthread(m_handle), nullptr);
+#endif
 
-      m_handle = INVALID_HANDLE_VALUE;
+      m_handle = invalid_thread_handle();
       m_id     = thread::id(0);
     }
 
     void thread::detach()
     {
+#if defined(RSL_PLATFORM_WINDOWS)
       CloseHandle(m_handle);
-      m_handle = INVALID_HANDLE_VALUE;
+#elif defined(RSL_PLATFORM_LINUX)
+      pthread_detach(to_pthread(m_handle));
+#endif
+      m_handle = invalid_thread_handle();
     }
 
     void thread::swap(thread& other)
@@ -94,10 +129,34 @@ namespace rsl
       rsl::swap(m_handle, other.m_handle);
     }
 
+    card32 thread::hardware_concurrency()
+    {
+#if defined(RSL_PLATFORM_WINDOWS)
+      SYSTEM_INFO info {};
+      GetSystemInfo(&info);
+      return static_cast<card32>(info.dwNumberOfProcessors);
+#elif defined(RSL_PLATFORM_LINUX)
+      // the standard allows returning 0 if the value can't be determined
+      const long num_processors = sysconf(_SC_NPROCESSORS_ONLN);
+      return num_processors > 0 ? static_cast<card32>(num_processors) : 0;
+#endif
+    }
+
     void thread::create(thread_start_func func, void* param)
     {
+#if defined(RSL_PLATFORM_WINDOWS)
       m_handle = CreateThread(nullptr, 0, func, param, 0, &m_id.m_id);
-      RSL_ASSERT_X(m_handle != INVALID_HANDLE_VALUE, "Failed to create thread with error: {}", GetLastError());
+      RSL_ASSERT_X(m_handle != invalid_thread_handle(), "Failed to create thread with error: {}", GetLastError());
+#elif defined(RSL_PLATFORM_LINUX)
+      pthread_t handle {};
+      const int32 error = pthread_create(&handle, nullptr, func, param);
+      RSL_ASSERT_X(error == 0, "Failed to create thread with error: {}", error);
+      if(error == 0)
+      {
+        m_handle = reinterpret_cast<native_handle_type>(handle); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+        m_id     = thread::id(static_cast<ulong>(handle));
+      }
+#endif
     }
 
     void swap(thread& lhs, thread& rhs)
@@ -20,9 +20,14 @@
 
 #include "rex_std/bonus/iostream/console_buf.h"
 #include "rex_std/internal/type_traits/is_same.h"
+#include "rex_std/ios.h"
 #include "rex_std/streambuf.h"
 
-#include <Windows.h>
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include <Windows.h>
+#elif defined(RSL_PLATFORM_LINUX)
+  #include <unistd.h>
+#endif
 
 namespace rsl
 {
@@ -31,21 +36,33 @@ namespace rsl
 
     rsl::streambuf* cin_streambuf()
     {
-      HANDLE input_handle = GetStdHandle(STD_INPUT_HANDLE);
+#if defined(RSL_PLATFORM_WINDOWS)
+      const internal::console_handle input_handle = GetStdHandle(STD_INPUT_HANDLE);
+#else
+      const internal::console_handle input_handle = STDIN_FILENO;
+#endif
 
       static console_buf<char8> buff(input_handle);
       return &buff;
     }
     rsl::streambuf* cout_streambuf()
     {
-      HANDLE output_handle = GetStdHandle(STD_OUTPUT_HANDLE);
+#if defined(RSL_PLATFORM_WINDOWS)
+      const internal::console_handle output_handle = GetStdHandle(STD_OUTPUT_HANDLE);
+#else
+      const internal::console_handle output_handle = STDOUT_FILENO;
+#endif
 
       static console_buf<char8> buff(output_handle);
       return &buff;
     }
     rsl::streambuf* cerr_streambuf()
     {
-      HANDLE error_handle = GetStdHandle(STD_ERROR_HANDLE);
+#if defined(RSL_PLATFORM_WINDOWS)
+      const internal::console_handle error_handle = GetStdHandle(STD_ERROR_HANDLE);
+#else
+      const internal::console_handle error_handle = STDERR_FILENO;
+#endif
 
       static console_buf<char8> buff(error_handle);
       return &buff;
@@ -65,6 +82,9 @@ namespace rsl
         {
           cin.tie(&cout);
           cerr.tie(&cout);
+
+          // errors need to show up straight away, even when they're redirected to a file
+          cerr.setf(io::fmtflags::unitbuf);
         }
         ~init_cout()
         {
@@ -12,7 +12,8 @@
 
 #include "rex_std/bonus/math/matrix_44.h"
 
-#include <corecrt_math.h>
+#include "rex_std/math.h"
+
 #include <cstdlib>
 
 rsl::matrix44::matrix44()
@@ -200,8 +201,8 @@ rsl::matrix44 rsl::matrix44::zero()
 
 void rsl::matrix44::rotate_x(const rad_angle angle)
 {
-  const float32 sa = sinf(angle.get());
-  const float32 ca = cosf(angle.get());
+  const float32 sa = rsl::sin(angle.get());
+  const float32 ca = rsl::cos(angle.get());
 
   float32 temp_1i = 0.0f;
 
@@ -214,8 +215,8 @@ void rsl::matrix44::rotate_x(const rad_angle angle)
 }
 void rsl::matrix44::rotate_y(const rad_angle angle)
 {
-  const float32 sa = sinf(angle.get());
-  const float32 ca = cosf(angle.get());
+  const float32 sa = rsl::sin(angle.get());
+  const float32 ca = rsl::cos(angle.get());
 
   float32 temp_0i = 0.0f;
 
@@ -228,8 +229,8 @@ void rsl::matrix44::rotate_y(const rad_angle angle)
 }
 void rsl::matrix44::rotate_z(const rad_angle angle)
 {
-  const float32 sa = sinf(angle.get());
-  const float32 ca = cosf(angle.get());
+  const float32 sa = rsl::sin(angle.get());
+  const float32 ca = rsl::cos(angle.get());
 
   float32 temp_0i = 0.0f;
 
@@ -243,8 +244,8 @@ void rsl::matrix44::rotate_z(const rad_angle angle)
 
 rsl::matrix44& rsl::matrix44::set_rotate_x(const rad_angle angle)
 {
-  const float32 sine   = sinf(angle.get());
-  const float32 cosine = cosf(angle.get());
+  const float32 sine   = rsl::sin(angle.get());
+  const float32 cosine = rsl::cos(angle.get());
 
   elem(1, 1) = cosine;
   elem(1, 2) = -sine;
@@ -255,8 +256,8 @@ rsl::matrix44& rsl::matrix44::set_rotate_x(const rad_angle angle)
 }
 rsl::matrix44& rsl::matrix44::set_rotate_y(const rad_angle angle)
 {
-  const float32 sine   = sinf(angle.get());
-  const float32 cosine = cosf(angle.get());
+  const float32 sine   = rsl::sin(angle.get());
+  const float32 cosine = rsl::cos(angle.get());
 
   elem(0, 0) = cosine;
   elem(0, 2) = sine;
@@ -267,8 +268,8 @@ rsl::matrix44& rsl::matrix44::set_rotate_y(const rad_angle angle)
 }
 rsl::matrix44& rsl::matrix44::set_rotate_z(const rad_angle angle)
 {
-  const float32 sine   = sinf(angle.get());
-  const float32 cosine = cosf(angle.get());
+  const float32 sine   = rsl::sin(angle.get());
+  const float32 cosine = rsl::cos(angle.get());
 
   elem(0, 0) = cosine;
   elem(0, 1) = -sine;
@@ -14,11 +14,7 @@
 
 #include "rex_std/bonus/math/float.h"
 #include "rex_std/format.h"
-#include "rex_std/internal/math/cos.h"
-#include "rex_std/internal/math/sin.h"
-#include "rex_std/internal/math/sqrt.h"
-
-#include <corecrt_math.h>
+#include "rex_std/math.h"
 
 rsl::vec2::vec2()
     : x(0.0f)
@@ -129,7 +125,7 @@ rsl::vec2 rsl::vec2::normalised() const
 
 float32 rsl::vec2::length() const
 {
-  return sqrtf(length_squared());
+  return rsl::sqrt(length_squared());
 }
 float32 rsl::vec2::length_squared() const
 {
@@ -140,8 +136,8 @@ rsl::vec2& rsl::vec2::rotate(const rad_angle angle)
 {
   const float32 copy_x = x;
 
-  const float32 cosz = cosf(angle.get());
-  const float32 sinz = sinf(angle.get());
+  const float32 cosz = rsl::cos(angle.get());
+  const float32 sinz = rsl::sin(angle.get());
 
   x = x * cosz + y * sinz;
   y = copy_x * -sinz + y * cosz;
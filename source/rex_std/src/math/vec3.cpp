@@ -146,7 +146,7 @@ rsl::vec3 rsl::vec3::left()
 
 float32 rsl::vec3::length() const
 {
-  return sqrt(length_squared());
+  return rsl::sqrt(length_squared());
 }
 float32 rsl::vec3::length_squared() const
 {
@@ -14,8 +14,7 @@
 
 #include "rex_std/bonus/math/float.h"
 #include "rex_std/format.h"
-
-#include <cmath>
+#include "rex_std/math.h"
 
 rsl::vec4::vec4()
     : x(0.0f)
@@ -120,7 +119,7 @@ float32 rsl::vec4::dot(const vec4& other) const
 
 float32 rsl::vec4::length() const
 {
-  return sqrt(length_squared());
+  return rsl::sqrt(length_squared());
 }
 float32 rsl::vec4::length_squared() const
 {
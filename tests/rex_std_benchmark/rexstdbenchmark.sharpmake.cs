@@ -0,0 +1,44 @@
+using Sharpmake;
+using System.IO;
+
+[Generate]
+public class RexStdBenchmark : TestProject
+{
+  public RexStdBenchmark() : base()
+  {
+    Name = GenerateName("RexStdBenchmark");
+    GenerateTargets();
+
+    string ThisFileFolder = Path.GetDirectoryName(Utils.CurrentFile());
+    SourceRootPath = ThisFileFolder;
+  }
+
+  protected override void SetupLibDependencies(RexConfiguration conf, RexTarget target)
+  {
+    base.SetupLibDependencies(conf, target);
+
+    conf.AddPublicDependency<RexStd>(target, DependencySetting.Default | DependencySetting.IncludeHeadersForClangtools);
+  }
+
+  protected override void SetupIncludePaths(RexConfiguration conf, RexTarget target)
+  {
+    base.SetupIncludePaths(conf, target);
+
+    // The benchmarks use the catch2 header that lives in the unit test project
+    conf.IncludePaths.Add(Path.Combine(Globals.Root, "tests", "rex_std_test", "include"));
+  }
+
+  protected override void SetupConfigRules(RexConfiguration conf, RexTarget target)
+  {
+    base.SetupConfigRules(conf, target);
+
+    conf.add_public_define("CATCH_CONFIG_ENABLE_BENCHMARKING");
+  }
+
+  protected override void SetupConfigSettings(RexConfiguration conf, RexTarget target)
+  {
+    base.SetupConfigSettings(conf, target);
+
+    conf.Options.Remove(Options.Vc.Compiler.JumboBuild.Enable);
+  }
+}
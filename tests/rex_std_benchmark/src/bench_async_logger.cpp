@@ -0,0 +1,168 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_async_logger.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/async_logger.h"
+#include "rex_std/bonus/iostream/console_buf.h"
+#include "rex_std/ios.h"
+#include "rex_std/mutex.h"
+#include "rex_std/ostream.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include <Windows.h>
+#elif defined(RSL_PLATFORM_LINUX)
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+namespace
+{
+  constexpr card32 g_thread_counts[] = {1, 4, 16};
+  // the number of messages logged for every throughput run, split over the threads
+  constexpr card32 g_messages_per_run = 1 << 16;
+
+  // the log is written to the null device, so the numbers show the cost of logging, not of the disk
+  rsl::internal::console_handle open_null_device()
+  {
+#if defined(RSL_PLATFORM_WINDOWS)
+    return CreateFileA("NUL", GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+    return open("/dev/null", O_WRONLY);
+#endif
+  }
+  void close_null_device(rsl::internal::console_handle handle)
+  {
+#if defined(RSL_PLATFORM_WINDOWS)
+    CloseHandle(handle);
+#else
+    close(handle);
+#endif
+  }
+
+  std::string bench_name(const char* name, card32 numThreads)
+  {
+    return std::string(name) + " " + std::to_string(numThreads) + " threads";
+  }
+
+  // what writing to rsl::cerr does: format on the calling thread and flush after every message.
+  // the lock keeps the messages of different threads from interleaving
+  class direct_logger
+  {
+  public:
+    explicit direct_logger(rsl::internal::console_handle handle)
+        : m_buf(handle)
+        , m_stream(&m_buf)
+    {
+      m_stream.setf(rsl::io::fmtflags::unitbuf);
+    }
+
+    void log(card32 frame, float32 ms)
+    {
+      const rsl::unique_lock<rsl::mutex> lock(m_mtx);
+      m_stream << "frame " << static_cast<int32>(frame) << " took " << ms << "ms\n";
+    }
+
+  private:
+    rsl::mutex m_mtx;
+    rsl::console_buf<char8> m_buf;
+    rsl::ostream m_stream;
+  };
+
+  template <typename LogFunc>
+  void run_producers(card32 numThreads, const LogFunc& logFunc)
+  {
+    const card32 per_thread = g_messages_per_run / numThreads;
+    std::vector<std::thread> threads;
+    for(card32 t = 0; t < numThreads; ++t)
+    {
+      threads.emplace_back(
+          [&logFunc, per_thread]()
+          {
+            for(card32 i = 0; i < per_thread; ++i)
+            {
+              logFunc(i);
+            }
+          });
+    }
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+  }
+} // namespace
+
+// the time a single message costs the thread logging it
+TEST_CASE("async logger latency")
+{
+  const rsl::internal::console_handle handle = open_null_device();
+  card32 frame                               = 0;
+
+  {
+    direct_logger logger(handle);
+    BENCHMARK("direct cerr style write")
+    {
+      logger.log(++frame, 16.6f);
+      return frame;
+    };
+  }
+  {
+    rsl::async_logger logger(handle);
+    BENCHMARK("rsl::async_logger log")
+    {
+      return logger.log("frame {} took {}ms", ++frame, 16.6f);
+    };
+    BENCHMARK("rsl::async_logger log_deferred")
+    {
+      return logger.log_deferred("frame {} took {}ms", ++frame, 16.6f);
+    };
+  }
+
+  close_null_device(handle);
+}
+
+// the time it takes to get all messages written
+TEST_CASE("async logger throughput")
+{
+  const rsl::internal::console_handle handle = open_null_device();
+
+  for(card32 num_threads : g_thread_counts)
+  {
+    BENCHMARK(bench_name("direct cerr style write", num_threads))
+    {
+      direct_logger logger(handle);
+      run_producers(num_threads, [&logger](card32 i) { logger.log(i, 16.6f); });
+    };
+    BENCHMARK(bench_name("rsl::async_logger log", num_threads))
+    {
+      rsl::async_logger logger(handle);
+      run_producers(num_threads, [&logger](card32 i) { logger.log("frame {} took {}ms", i, 16.6f); });
+      logger.flush();
+    };
+    BENCHMARK(bench_name("rsl::async_logger log_deferred", num_threads))
+    {
+      rsl::async_logger logger(handle);
+      run_producers(num_threads, [&logger](card32 i) { logger.log_deferred("frame {} took {}ms", i, 16.6f); });
+      logger.flush();
+    };
+  }
+
+  close_null_device(handle);
+}
+
+// NOLINTEND
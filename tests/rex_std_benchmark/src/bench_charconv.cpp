@@ -0,0 +1,303 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_charconv.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bit.h"
+#include "rex_std/charconv.h"
+#include "rex_std/string.h"
+#include "rex_std/vector.h"
+
+#include <charconv>
+#include <string>
+
+namespace
+{
+  constexpr card32 g_num_values = 4096;
+
+  // a simple lcg so the runs are reproducible
+  uint64 next_random(uint64& state)
+  {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state;
+  }
+
+  // uniformly random over the whole range, so most of them have 19 or 20 digits
+  rsl::vector<uint64> uniform_integers()
+  {
+    uint64 state = 1;
+    rsl::vector<uint64> values;
+    for(card32 i = 0; i < g_num_values; ++i)
+    {
+      values.push_back(next_random(state));
+    }
+    return values;
+  }
+  // ids, counts and indices, which rarely have more than a few digits
+  rsl::vector<uint64> small_integers()
+  {
+    uint64 state = 1;
+    rsl::vector<uint64> values;
+    for(card32 i = 0; i < g_num_values; ++i)
+    {
+      values.push_back(next_random(state) % 10'000);
+    }
+    return values;
+  }
+
+  // one digit per division, like string_utils used to do
+  char8* digitwise_to_chars(char8* last, uint64 value)
+  {
+    do
+    {
+      *--last = static_cast<char8>('0' + value % 10);
+      value /= 10;
+    } while(value != 0);
+    return last;
+  }
+  const char8* digitwise_from_chars(const char8* first, const char8* last, uint64& value)
+  {
+    value = 0;
+    for(; first != last && *first >= '0' && *first <= '9'; ++first)
+    {
+      value = value * 10 + static_cast<uint64>(*first - '0');
+    }
+    return first;
+  }
+
+  // values like the ones in our exports: a few digits before and after the radix point
+  rsl::vector<float64> short_doubles()
+  {
+    uint64 state = 1;
+    rsl::vector<float64> values;
+    for(card32 i = 0; i < g_num_values; ++i)
+    {
+      values.push_back(static_cast<float64>(next_random(state) % 10'000'000) / 1000.0);
+    }
+    return values;
+  }
+  // random bit patterns, which need the full 17 digits
+  rsl::vector<float64> random_doubles()
+  {
+    uint64 state = 1;
+    rsl::vector<float64> values;
+    while(values.size() != g_num_values)
+    {
+      const float64 value = rsl::bit_cast<float64>(next_random(state));
+      if(value == value)
+      {
+        values.push_back(value);
+      }
+    }
+    return values;
+  }
+
+  // all the values written one after the other, separated by a space
+  template <typename T>
+  rsl::string write_all(const rsl::vector<T>& values)
+  {
+    rsl::string str;
+    char8 buf[64];
+    for(T value : values)
+    {
+      const rsl::to_chars_result res = rsl::to_chars(buf, buf + 64, value);
+      str.append(buf, static_cast<count_t>(res.ptr - buf));
+      str += ' ';
+    }
+    return str;
+  }
+} // namespace
+
+TEST_CASE("integer to_chars")
+{
+  const rsl::vector<uint64> inputs[] = {uniform_integers(), small_integers()};
+  const char8* names[]              = {"uniform", "small"};
+
+  for(card32 i = 0; i < 2; ++i)
+  {
+    const rsl::vector<uint64>& values = inputs[i];
+    char8 buf[64];
+
+    BENCHMARK(std::string("rsl::to_chars ") + names[i])
+    {
+      count_t total = 0;
+      for(uint64 value : values)
+      {
+        total += rsl::to_chars(buf, buf + 64, value).ptr - buf;
+      }
+      return total;
+    };
+    BENCHMARK(std::string("std::to_chars ") + names[i])
+    {
+      count_t total = 0;
+      for(uint64 value : values)
+      {
+        total += std::to_chars(buf, buf + 64, value).ptr - buf;
+      }
+      return total;
+    };
+    BENCHMARK(std::string("digitwise to_chars ") + names[i])
+    {
+      count_t total = 0;
+      for(uint64 value : values)
+      {
+        total += buf + 64 - digitwise_to_chars(buf + 64, value);
+      }
+      return total;
+    };
+    BENCHMARK(std::string("rsl::to_string ") + names[i])
+    {
+      count_t total = 0;
+      for(uint64 value : values)
+      {
+        total += rsl::to_string(value).length();
+      }
+      return total;
+    };
+  }
+}
+
+TEST_CASE("integer from_chars")
+{
+  const rsl::string inputs[] = {write_all(uniform_integers()), write_all(small_integers())};
+  const char8* names[]       = {"uniform", "small"};
+
+  for(card32 i = 0; i < 2; ++i)
+  {
+    const char8* first = inputs[i].data();
+    const char8* last  = first + inputs[i].length();
+
+    BENCHMARK(std::string("rsl::from_chars ") + names[i])
+    {
+      uint64 total = 0;
+      for(const char8* it = first; it < last;)
+      {
+        uint64 value = 0;
+        it           = rsl::from_chars(it, last, value).ptr + 1;
+        total += value;
+      }
+      return total;
+    };
+    BENCHMARK(std::string("std::from_chars ") + names[i])
+    {
+      uint64 total = 0;
+      for(const char8* it = first; it < last;)
+      {
+        uint64 value = 0;
+        it           = std::from_chars(it, last, value).ptr + 1;
+        total += value;
+      }
+      return total;
+    };
+    BENCHMARK(std::string("digitwise from_chars ") + names[i])
+    {
+      uint64 total = 0;
+      for(const char8* it = first; it < last;)
+      {
+        uint64 value = 0;
+        it           = digitwise_from_chars(it, last, value) + 1;
+        total += value;
+      }
+      return total;
+    };
+    BENCHMARK(std::string("rsl::strtoull ") + names[i])
+    {
+      uint64 total = 0;
+      char8* end   = nullptr;
+      for(const char8* it = first; it < last; it = end + 1)
+      {
+        total += rsl::strtoull(it, &end, 10).value_or(0);
+      }
+      return total;
+    };
+  }
+}
+
+TEST_CASE("float to_chars")
+{
+  const rsl::vector<float64> inputs[] = {short_doubles(), random_doubles()};
+  const char8* names[]               = {"short", "random"};
+
+  for(card32 i = 0; i < 2; ++i)
+  {
+    const rsl::vector<float64>& values = inputs[i];
+    char8 buf[64];
+
+    BENCHMARK(std::string("rsl::to_chars ") + names[i])
+    {
+      count_t total = 0;
+      for(float64 value : values)
+      {
+        total += rsl::to_chars(buf, buf + 64, value).ptr - buf;
+      }
+      return total;
+    };
+    BENCHMARK(std::string("std::to_chars ") + names[i])
+    {
+      count_t total = 0;
+      for(float64 value : values)
+      {
+        total += std::to_chars(buf, buf + 64, value).ptr - buf;
+      }
+      return total;
+    };
+  }
+}
+
+TEST_CASE("float from_chars")
+{
+  const rsl::string inputs[] = {write_all(short_doubles()), write_all(random_doubles())};
+  const char8* names[]       = {"short", "random"};
+
+  for(card32 i = 0; i < 2; ++i)
+  {
+    const char8* first = inputs[i].data();
+    const char8* last  = first + inputs[i].length();
+
+    BENCHMARK(std::string("rsl::from_chars ") + names[i])
+    {
+      float64 total = 0.0;
+      for(const char8* it = first; it < last;)
+      {
+        float64 value = 0.0;
+        it            = rsl::from_chars(it, last, value).ptr + 1;
+        total += value;
+      }
+      return total;
+    };
+    BENCHMARK(std::string("std::from_chars ") + names[i])
+    {
+      float64 total = 0.0;
+      for(const char8* it = first; it < last;)
+      {
+        float64 value = 0.0;
+        it            = std::from_chars(it, last, value).ptr + 1;
+        total += value;
+      }
+      return total;
+    };
+    BENCHMARK(std::string("rsl::strtod ") + names[i])
+    {
+      float64 total = 0.0;
+      char8* end    = nullptr;
+      for(const char8* it = first; it < last; it = end + 1)
+      {
+        total += rsl::strtod(it, &end).value_or(0.0);
+      }
+      return total;
+    };
+  }
+}
+
+// NOLINTEND
@@ -0,0 +1,224 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_concurrent_queue.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/circular_q.h"
+#include "rex_std/bonus/mpmc_queue.h"
+#include "rex_std/bonus/spsc_queue.h"
+#include "rex_std/mutex.h"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  constexpr card64 g_queue_capacity = 1024;
+  // the number of items going through the queue for every run, split over the producers
+  constexpr card64 g_items_per_run = 1 << 20;
+  constexpr card64 g_batch_size    = 32;
+
+  std::string bench_name(const char* queue, card32 numThreads)
+  {
+    return std::string(queue) + " " + std::to_string(numThreads) + "P" + std::to_string(numThreads) + "C";
+  }
+
+  // what the producer/consumer stages used before the lock free queues
+  class locked_circular_q
+  {
+  public:
+    explicit locked_circular_q(card32 capacity)
+        : m_queue(capacity)
+    {
+    }
+
+    bool try_push(card64 value)
+    {
+      const rsl::unique_lock<rsl::mutex> lock(m_mtx);
+      if(m_queue.full())
+      {
+        return false;
+      }
+      m_queue.push_back(rsl::move(value));
+      return true;
+    }
+    bool try_pop(card64& value)
+    {
+      const rsl::unique_lock<rsl::mutex> lock(m_mtx);
+      if(m_queue.empty())
+      {
+        return false;
+      }
+      value = m_queue.front();
+      m_queue.pop_front();
+      return true;
+    }
+
+  private:
+    rsl::mutex m_mtx;
+    rsl::circular_q<card64> m_queue;
+  };
+
+  // numThreads producers push g_items_per_run items in total, numThreads consumers pop them all
+  template <typename Queue>
+  card64 run_single(Queue& queue, card32 numThreads)
+  {
+    const card64 per_thread = g_items_per_run / numThreads;
+    std::vector<card64> sums(numThreads);
+    std::vector<std::thread> threads;
+    for(card32 t = 0; t < numThreads; ++t)
+    {
+      threads.emplace_back(
+          [&queue, per_thread]()
+          {
+            for(card64 i = 0; i < per_thread; ++i)
+            {
+              while(!queue.try_push(i))
+              {
+                std::this_thread::yield();
+              }
+            }
+          });
+      threads.emplace_back(
+          [&queue, &sums, per_thread, t]()
+          {
+            card64 value = 0;
+            for(card64 i = 0; i < per_thread; ++i)
+            {
+              while(!queue.try_pop(value))
+              {
+                std::this_thread::yield();
+              }
+              sums[t] += value;
+            }
+          });
+    }
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+
+    card64 sum = 0;
+    for(card64 s : sums)
+    {
+      sum += s;
+    }
+    return sum;
+  }
+
+  // the same, but items are pushed and popped g_batch_size at a time
+  template <typename Queue>
+  card64 run_batched(Queue& queue, card32 numThreads)
+  {
+    const card64 per_thread = g_items_per_run / numThreads;
+    std::vector<card64> sums(numThreads);
+    std::vector<std::thread> threads;
+    for(card32 t = 0; t < numThreads; ++t)
+    {
+      threads.emplace_back(
+          [&queue, per_thread]()
+          {
+            card64 batch[g_batch_size];
+            card64 pushed = 0;
+            while(pushed < per_thread)
+            {
+              const card64 count = std::min(g_batch_size, per_thread - pushed);
+              for(card64 i = 0; i < count; ++i)
+              {
+                batch[i] = pushed + i;
+              }
+              card64 done = 0;
+              while(done < count)
+              {
+                const card64 n = queue.try_push_n(batch + done, count - done);
+                if(n == 0)
+                {
+                  std::this_thread::yield();
+                }
+                done += n;
+              }
+              pushed += count;
+            }
+          });
+      threads.emplace_back(
+          [&queue, &sums, per_thread, t]()
+          {
+            card64 batch[g_batch_size];
+            card64 popped = 0;
+            while(popped < per_thread)
+            {
+              const card64 n = queue.try_pop_n(batch, std::min(g_batch_size, per_thread - popped));
+              if(n == 0)
+              {
+                std::this_thread::yield();
+              }
+              for(card64 i = 0; i < n; ++i)
+              {
+                sums[t] += batch[i];
+              }
+              popped += n;
+            }
+          });
+    }
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+
+    card64 sum = 0;
+    for(card64 s : sums)
+    {
+      sum += s;
+    }
+    return sum;
+  }
+} // namespace
+
+TEST_CASE("concurrent queue throughput")
+{
+  // an spsc queue only allows a single producer and a single consumer
+  BENCHMARK(bench_name("spsc_queue", 1))
+  {
+    rsl::spsc_queue<card64> queue(g_queue_capacity);
+    return run_single(queue, 1);
+  };
+  BENCHMARK(bench_name("spsc_queue batched", 1))
+  {
+    rsl::spsc_queue<card64> queue(g_queue_capacity);
+    return run_batched(queue, 1);
+  };
+
+  for(card32 num_threads : {1, 4, 16})
+  {
+    BENCHMARK(bench_name("mutex + circular_q", num_threads))
+    {
+      locked_circular_q queue(static_cast<card32>(g_queue_capacity));
+      return run_single(queue, num_threads);
+    };
+    BENCHMARK(bench_name("mpmc_queue", num_threads))
+    {
+      rsl::mpmc_queue<card64> queue(g_queue_capacity);
+      return run_single(queue, num_threads);
+    };
+    BENCHMARK(bench_name("mpmc_queue batched", num_threads))
+    {
+      rsl::mpmc_queue<card64> queue(g_queue_capacity);
+      return run_batched(queue, num_threads);
+    };
+  }
+}
+
+// NOLINTEND
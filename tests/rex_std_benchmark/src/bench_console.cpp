@@ -0,0 +1,104 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_console.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/iostream/console_buf.h"
+
+#include <fstream>
+#include <string>
+
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include <Windows.h>
+#elif defined(RSL_PLATFORM_LINUX)
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+namespace
+{
+  // console output is redirected to the null device, so the numbers show the cost of the syscalls, not the terminal
+  constexpr card32 g_num_lines = 100000;
+
+#if defined(RSL_PLATFORM_WINDOWS)
+  const char* g_null_device = "NUL";
+#else
+  const char* g_null_device = "/dev/null";
+#endif
+
+  std::string bench_name(const char* name)
+  {
+    return std::string(name) + " " + std::to_string(g_num_lines) + " lines";
+  }
+
+  rsl::internal::console_handle open_null_device()
+  {
+#if defined(RSL_PLATFORM_WINDOWS)
+    return CreateFileA(g_null_device, GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+    return open(g_null_device, O_WRONLY);
+#endif
+  }
+  void close_null_device(rsl::internal::console_handle handle)
+  {
+#if defined(RSL_PLATFORM_WINDOWS)
+    CloseHandle(handle);
+#else
+    close(handle);
+#endif
+  }
+
+  // a log line is written as a few fragments, the way a logger puts together a prefix, a message and a newline
+  template <typename Streambuf>
+  card64 write_lines(Streambuf& buf)
+  {
+    card64 num_written = 0;
+    for(card32 i = 0; i < g_num_lines; ++i)
+    {
+      num_written += buf.sputn("[info] ", 7);
+      num_written += buf.sputn("frame finished rendering", 24);
+      buf.sputc('\n');
+      ++num_written;
+    }
+    buf.pubsync();
+    return num_written;
+  }
+} // namespace
+
+TEST_CASE("console output")
+{
+  const rsl::internal::console_handle handle = open_null_device();
+
+  BENCHMARK(bench_name("rsl::console_buf unbuffered"))
+  {
+    rsl::console_buf<char8> buf(handle);
+    buf.pubsetbuf(nullptr, 0);
+    return write_lines(buf);
+  };
+  BENCHMARK(bench_name("rsl::console_buf buffered"))
+  {
+    rsl::console_buf<char8> buf(handle);
+    return write_lines(buf);
+  };
+  BENCHMARK(bench_name("std::filebuf"))
+  {
+    std::filebuf buf;
+    buf.open(g_null_device, std::ios::out);
+    return write_lines(buf);
+  };
+
+  close_null_device(handle);
+}
+
+// NOLINTEND
@@ -0,0 +1,126 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_execution.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/algorithm.h"
+#include "rex_std/bonus/thread/thread_pool.h"
+#include "rex_std/execution.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+  // the benchmarks pass pointers to the algorithms, rsl doesn't know the iterator category
+  // of std::vector's iterators and would run single threaded on them
+
+  // every algorithm runs on pools of these sizes, to see how it scales with the number of threads
+  constexpr card32 g_thread_counts[] = {1, 2, 4, 8, 16};
+  constexpr card64 g_num_elements    = 10'000'000;
+
+  std::string bench_name(const char* func, card32 numThreads)
+  {
+    return std::string(func) + " " + std::to_string(numThreads) + " threads";
+  }
+
+  std::vector<int32> random_ints()
+  {
+    std::mt19937 rng(1);
+    std::vector<int32> vec(g_num_elements);
+    for(int32& value : vec)
+    {
+      value = static_cast<int32>(rng());
+    }
+    return vec;
+  }
+} // namespace
+
+TEST_CASE("parallel sort scaling")
+{
+  const std::vector<int32> input = random_ints();
+
+  BENCHMARK("rsl::sort seq")
+  {
+    std::vector<int32> vec = input;
+    rsl::sort(rsl::execution::seq, vec.data(), vec.data() + vec.size());
+    return vec.front();
+  };
+
+  for(card32 num_threads : g_thread_counts)
+  {
+    rsl::thread_pool pool(num_threads);
+    BENCHMARK(bench_name("rsl::sort par", num_threads))
+    {
+      std::vector<int32> vec = input;
+      rsl::sort(rsl::execution::par.on(pool), vec.data(), vec.data() + vec.size());
+      return vec.front();
+    };
+  }
+}
+
+TEST_CASE("parallel for_each and transform scaling")
+{
+  std::vector<float64> vec(g_num_elements, 1.0);
+  std::vector<float64> dst(g_num_elements);
+
+  for(card32 num_threads : g_thread_counts)
+  {
+    rsl::thread_pool pool(num_threads);
+    BENCHMARK(bench_name("rsl::for_each par", num_threads))
+    {
+      rsl::for_each(rsl::execution::par.on(pool), vec.data(), vec.data() + vec.size(), [](float64& value) { value = value * 0.5 + 1.0; });
+      return vec.front();
+    };
+    BENCHMARK(bench_name("rsl::transform par_unseq", num_threads))
+    {
+      rsl::transform(rsl::execution::par_unseq.on(pool), vec.data(), vec.data() + vec.size(), dst.data(), [](float64 value) { return value * value; });
+      return dst.front();
+    };
+  }
+}
+
+TEST_CASE("parallel reduce, copy and fill scaling")
+{
+  const std::vector<int32> input = random_ints();
+  std::vector<int32> dst(g_num_elements);
+
+  BENCHMARK("rsl::reduce seq")
+  {
+    return rsl::reduce(rsl::execution::seq, input.data(), input.data() + input.size(), card64(0));
+  };
+
+  for(card32 num_threads : g_thread_counts)
+  {
+    rsl::thread_pool pool(num_threads);
+    BENCHMARK(bench_name("rsl::reduce par", num_threads))
+    {
+      return rsl::reduce(rsl::execution::par.on(pool), input.data(), input.data() + input.size(), card64(0));
+    };
+    BENCHMARK(bench_name("rsl::copy par", num_threads))
+    {
+      rsl::copy(rsl::execution::par.on(pool), input.data(), input.data() + input.size(), dst.data());
+      return dst.front();
+    };
+    BENCHMARK(bench_name("rsl::fill par", num_threads))
+    {
+      rsl::fill(rsl::execution::par.on(pool), dst.data(), dst.data() + dst.size(), 7);
+      return dst.front();
+    };
+  }
+}
+
+// NOLINTEND
@@ -0,0 +1,124 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_filebuf.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/fstream.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  // big enough that the file doesn't fit in any cache of the drive itself
+  constexpr card64 g_file_size = 1ull << 30;
+  // 16 bytes is the size of a small struct serialized 1 at a time,
+  // 4 KiB is a page and 1 MiB is a typical chunk of an asset loader
+  constexpr card64 g_chunk_sizes[] = {16, 4 * 1024, 1024 * 1024};
+
+  const char* g_bench_file = "rsl_bench_filebuf.bin";
+
+  std::string bench_name(const char* func, card64 chunkSize)
+  {
+    return std::string(func) + " " + std::to_string(chunkSize) + " byte chunks";
+  }
+
+  card64 write_file(rsl::basic_filebuf<char8, rsl::char_traits<char8>>& filebuf, card64 chunkSize)
+  {
+    const std::vector<char8> chunk(chunkSize, 'x');
+    card64 num_written = 0;
+    for(card64 i = 0; i < g_file_size / chunkSize; ++i)
+    {
+      num_written += filebuf.sputn(chunk.data(), static_cast<rsl::streamsize>(chunkSize));
+    }
+    filebuf.pubsync();
+    return num_written;
+  }
+
+  card64 read_file(rsl::basic_filebuf<char8, rsl::char_traits<char8>>& filebuf, card64 chunkSize)
+  {
+    std::vector<char8> chunk(chunkSize);
+    card64 num_read = 0;
+    for(card64 i = 0; i < g_file_size / chunkSize; ++i)
+    {
+      num_read += filebuf.sgetn(chunk.data(), static_cast<rsl::streamsize>(chunkSize));
+    }
+    return num_read;
+  }
+
+  void bench_rsl_filebuf(const char* name, rsl::io::openmode extraMode, card64 chunkSize)
+  {
+    BENCHMARK(bench_name(name, chunkSize) + " write")
+    {
+      rsl::basic_filebuf<char8, rsl::char_traits<char8>> filebuf;
+      filebuf.open(g_bench_file, rsl::io::openmode::out | rsl::io::openmode::trunc | rsl::io::openmode::binary | extraMode);
+      return write_file(filebuf, chunkSize);
+    };
+
+    BENCHMARK(bench_name(name, chunkSize) + " read")
+    {
+      rsl::basic_filebuf<char8, rsl::char_traits<char8>> filebuf;
+      filebuf.open(g_bench_file, rsl::io::openmode::in | rsl::io::openmode::binary | extraMode);
+      return read_file(filebuf, chunkSize);
+    };
+  }
+
+  void bench_std_filebuf(card64 chunkSize)
+  {
+    BENCHMARK(bench_name("std::filebuf", chunkSize) + " write")
+    {
+      const std::vector<char> chunk(chunkSize, 'x');
+      std::filebuf filebuf;
+      filebuf.open(g_bench_file, std::ios::out | std::ios::trunc | std::ios::binary);
+      card64 num_written = 0;
+      for(card64 i = 0; i < g_file_size / chunkSize; ++i)
+      {
+        num_written += filebuf.sputn(chunk.data(), static_cast<std::streamsize>(chunkSize));
+      }
+      filebuf.pubsync();
+      return num_written;
+    };
+
+    BENCHMARK(bench_name("std::filebuf", chunkSize) + " read")
+    {
+      std::vector<char> chunk(chunkSize);
+      std::filebuf filebuf;
+      filebuf.open(g_bench_file, std::ios::in | std::ios::binary);
+      card64 num_read = 0;
+      for(card64 i = 0; i < g_file_size / chunkSize; ++i)
+      {
+        num_read += filebuf.sgetn(chunk.data(), static_cast<std::streamsize>(chunkSize));
+      }
+      return num_read;
+    };
+  }
+} // namespace
+
+TEST_CASE("filebuf throughput")
+{
+  for(card64 chunk_size : g_chunk_sizes)
+  {
+    bench_rsl_filebuf("rsl::filebuf", rsl::io::openmode {}, chunk_size);
+#if defined(RSL_PLATFORM_LINUX)
+    bench_rsl_filebuf("rsl::filebuf direct", rsl::io::openmode::direct, chunk_size);
+#endif
+    bench_std_filebuf(chunk_size);
+  }
+
+  std::remove(g_bench_file);
+}
+
+// NOLINTEND
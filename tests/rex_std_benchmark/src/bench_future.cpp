@@ -0,0 +1,114 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_future.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/thread/thread_pool.h"
+#include "rex_std/future.h"
+
+#include <future>
+#include <vector>
+
+namespace
+{
+  constexpr card32 g_num_requests = 10'000;
+} // namespace
+
+TEST_CASE("promise future round trip")
+{
+  // creating the state, setting the value and reading it back, all on the same thread
+  BENCHMARK("std::promise")
+  {
+    card64 sum = 0;
+    for(card32 i = 0; i < g_num_requests; ++i)
+    {
+      std::promise<card32> promise;
+      std::future<card32> future = promise.get_future();
+      promise.set_value(i);
+      sum += future.get();
+    }
+    return sum;
+  };
+  BENCHMARK("rsl::promise")
+  {
+    card64 sum = 0;
+    for(card32 i = 0; i < g_num_requests; ++i)
+    {
+      rsl::promise<card32> promise;
+      rsl::future<card32> future = promise.get_future();
+      promise.set_value(i);
+      sum += future.get();
+    }
+    return sum;
+  };
+  BENCHMARK("rsl::promise then")
+  {
+    card64 sum = 0;
+    for(card32 i = 0; i < g_num_requests; ++i)
+    {
+      rsl::promise<card32> promise;
+      rsl::future<card32> future = promise.get_future().then([](rsl::future<card32> value) { return value.get() + 1; });
+      promise.set_value(i);
+      sum += future.get();
+    }
+    return sum;
+  };
+}
+
+TEST_CASE("async request fan out")
+{
+  // every request is answered by a task on the pool, its response gets post processed
+  // and all responses are gathered at the end
+  rsl::thread_pool pool(4);
+
+  // a task per request blocks on the response before post processing it
+  BENCHMARK("blocking get")
+  {
+    std::vector<rsl::future<card32>> responses;
+    responses.reserve(g_num_requests);
+    for(card32 i = 0; i < g_num_requests; ++i)
+    {
+      rsl::future<card32> response = pool.submit([i]() { return i; });
+      responses.push_back(pool.submit([response = rsl::move(response)]() mutable { return response.get() + 1; }));
+    }
+
+    card64 sum = 0;
+    for(rsl::future<card32>& response : responses)
+    {
+      sum += response.get();
+    }
+    return sum;
+  };
+
+  // the post processing is chained onto the response, nothing blocks until the final gather
+  BENCHMARK("then and when_all")
+  {
+    std::vector<rsl::future<card32>> responses;
+    responses.reserve(g_num_requests);
+    for(card32 i = 0; i < g_num_requests; ++i)
+    {
+      responses.push_back(pool.submit([i]() { return i; }).then([](rsl::future<card32> response) { return response.get() + 1; }));
+    }
+
+    rsl::future<rsl::vector<rsl::future<card32>>> all = rsl::when_all(responses.data(), responses.data() + responses.size());
+    card64 sum                                        = 0;
+    for(rsl::future<card32>& response : all.get())
+    {
+      sum += response.get();
+    }
+    return sum;
+  };
+}
+
+// NOLINTEND
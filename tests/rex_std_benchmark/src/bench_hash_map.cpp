@@ -0,0 +1,192 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_hash_map.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/functional/fast_hash.h"
+#include "rex_std/bonus/hashtable/flat_hash_map.h"
+#include "rex_std/bonus/hashtable/hash_map.h"
+#include "rex_std/bonus/hashtable/power_of_two_rehash_policy.h"
+#include "rex_std/vector.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+  // 1K up to 10M elements, every step is 10 times bigger than the previous
+  constexpr card32 g_sizes[] = {1'000, 10'000, 100'000, 1'000'000, 10'000'000};
+
+  std::string bench_name(const char* func, card32 size)
+  {
+    return std::string(func) + " " + std::to_string(size) + " elements";
+  }
+
+  // random looking keys, so neither table benefits from the keys being sequential
+  uint64 splitmix64(uint64 x)
+  {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+  }
+
+  // the keys in the tables are generated from even seeds, the keys that miss from odd seeds
+  rsl::vector<uint64> make_keys(card32 size, uint64 first_seed)
+  {
+    rsl::vector<uint64> keys;
+    keys.reserve(size);
+    for(card32 i = 0; i < size; ++i)
+    {
+      keys.push_back(splitmix64(first_seed + 2ull * i));
+    }
+    return keys;
+  }
+
+  template <typename Map>
+  Map make_map(const rsl::vector<uint64>& keys)
+  {
+    Map map;
+    for(uint64 key : keys)
+    {
+      map.emplace(key, key);
+    }
+    return map;
+  }
+
+  template <typename Map>
+  void bench_insert(const char* name, const rsl::vector<uint64>& keys)
+  {
+    BENCHMARK(bench_name(name, keys.size()))
+    {
+      Map map;
+      for(uint64 key : keys)
+      {
+        map.emplace(key, key);
+      }
+      return map.size();
+    };
+  }
+
+  template <typename Map>
+  void bench_lookup(const char* name, const Map& map, const rsl::vector<uint64>& keys)
+  {
+    BENCHMARK(bench_name(name, keys.size()))
+    {
+      uint64 sum = 0;
+      for(uint64 key : keys)
+      {
+        auto it = map.find(key);
+        sum += it != map.end() ? it->value : 1;
+      }
+      return sum;
+    };
+  }
+
+  template <typename Map>
+  void bench_erase(const char* name, const Map& map, const rsl::vector<uint64>& keys)
+  {
+    BENCHMARK_ADVANCED(bench_name(name, keys.size()))(Catch::Benchmark::Chronometer meter)
+    {
+      // every run needs a full map to erase from, these are made up front so the copies aren't measured
+      std::vector<Map> maps(meter.runs(), map);
+      meter.measure(
+          [&](int run)
+          {
+            Map& m = maps[run];
+            for(uint64 key : keys)
+            {
+              m.erase(key);
+            }
+            return m.size();
+          });
+    };
+  }
+
+  using flat_map_type = rsl::flat_hash_map<uint64, uint64>;
+  using node_map_type = rsl::hash_map<uint64, uint64>;
+
+  // both use the same hash, so the only difference is mapping the hash to a bucket: a modulo or a mask
+  using prime_map_type        = rsl::hash_map<uint64, uint64, rsl::fast_hash<uint64>, rsl::equal_to<uint64>, rsl::allocator, rsl::prime_rehash_policy>;
+  using power_of_two_map_type = rsl::hash_map<uint64, uint64, rsl::fast_hash<uint64>, rsl::equal_to<uint64>, rsl::allocator, rsl::power_of_two_rehash_policy>;
+} // namespace
+
+TEST_CASE("hash map insert")
+{
+  for(card32 size : g_sizes)
+  {
+    const rsl::vector<uint64> keys = make_keys(size, 0);
+
+    bench_insert<flat_map_type>("rsl::flat_hash_map insert", keys);
+    bench_insert<node_map_type>("rsl::hash_map insert", keys);
+  }
+}
+
+TEST_CASE("hash map lookup hit")
+{
+  for(card32 size : g_sizes)
+  {
+    const rsl::vector<uint64> keys = make_keys(size, 0);
+    const flat_map_type flat_map   = make_map<flat_map_type>(keys);
+    const node_map_type node_map   = make_map<node_map_type>(keys);
+
+    bench_lookup("rsl::flat_hash_map lookup hit", flat_map, keys);
+    bench_lookup("rsl::hash_map lookup hit", node_map, keys);
+  }
+}
+
+TEST_CASE("hash map lookup miss")
+{
+  for(card32 size : g_sizes)
+  {
+    const rsl::vector<uint64> keys         = make_keys(size, 0);
+    const rsl::vector<uint64> missing_keys = make_keys(size, 1);
+    const flat_map_type flat_map           = make_map<flat_map_type>(keys);
+    const node_map_type node_map           = make_map<node_map_type>(keys);
+
+    bench_lookup("rsl::flat_hash_map lookup miss", flat_map, missing_keys);
+    bench_lookup("rsl::hash_map lookup miss", node_map, missing_keys);
+  }
+}
+
+TEST_CASE("hash map erase")
+{
+  for(card32 size : g_sizes)
+  {
+    const rsl::vector<uint64> keys = make_keys(size, 0);
+    const flat_map_type flat_map   = make_map<flat_map_type>(keys);
+    const node_map_type node_map   = make_map<node_map_type>(keys);
+
+    bench_erase("rsl::flat_hash_map erase", flat_map, keys);
+    bench_erase("rsl::hash_map erase", node_map, keys);
+  }
+}
+
+TEST_CASE("hash map bucket index")
+{
+  for(card32 size : g_sizes)
+  {
+    const rsl::vector<uint64> keys            = make_keys(size, 0);
+    const rsl::vector<uint64> missing_keys    = make_keys(size, 1);
+    const prime_map_type prime_map            = make_map<prime_map_type>(keys);
+    const power_of_two_map_type power_two_map = make_map<power_of_two_map_type>(keys);
+
+    bench_lookup("rsl::hash_map prime buckets lookup hit", prime_map, keys);
+    bench_lookup("rsl::hash_map power of 2 buckets lookup hit", power_two_map, keys);
+    bench_lookup("rsl::hash_map prime buckets lookup miss", prime_map, missing_keys);
+    bench_lookup("rsl::hash_map power of 2 buckets lookup miss", power_two_map, missing_keys);
+  }
+}
+
+// NOLINTEND
@@ -0,0 +1,191 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_intrusive_concurrent.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/intrusive_mpsc_queue.h"
+#include "rex_std/bonus/intrusive_stack.h"
+#include "rex_std/mutex.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  constexpr card32 g_thread_counts[] = {1, 4, 16};
+  // the number of nodes pushed for every run, split over the producers
+  constexpr card64 g_nodes_per_run = 1 << 20;
+  // the number of pop/push rounds for every run, split over the threads
+  constexpr card64 g_rounds_per_run = 1 << 20;
+  constexpr card32 g_stack_nodes    = 256;
+
+  std::string bench_name(const char* name, card32 numThreads)
+  {
+    return std::string(name) + " " + std::to_string(numThreads) + " threads";
+  }
+
+  struct node : rsl::intrusive_mpsc_node, rsl::intrusive_stack_node
+  {
+    node* locked_next = nullptr;
+    card64 value      = 0;
+  };
+
+  // the intrusive list behind a lock the lock free containers replace
+  class locked_list
+  {
+  public:
+    void push(node* n)
+    {
+      const rsl::unique_lock<rsl::mutex> lock(m_mtx);
+      n->locked_next = m_head;
+      m_head         = n;
+    }
+    node* try_pop()
+    {
+      const rsl::unique_lock<rsl::mutex> lock(m_mtx);
+      node* n = m_head;
+      if(n != nullptr)
+      {
+        m_head = n->locked_next;
+      }
+      return n;
+    }
+
+  private:
+    rsl::mutex m_mtx;
+    node* m_head = nullptr;
+  };
+
+  // numProducers threads push their own nodes, the calling thread pops them all
+  template <typename Queue>
+  card64 run_many_to_one(Queue& queue, std::vector<node>& nodes, card32 numProducers)
+  {
+    const card64 per_producer = g_nodes_per_run / numProducers;
+    std::vector<std::thread> producers;
+    for(card32 p = 0; p < numProducers; ++p)
+    {
+      producers.emplace_back(
+          [&queue, &nodes, per_producer, p]()
+          {
+            for(card64 i = 0; i < per_producer; ++i)
+            {
+              queue.push(&nodes[p * per_producer + i]);
+            }
+          });
+    }
+
+    card64 sum = 0;
+    for(card64 num_popped = 0; num_popped < per_producer * numProducers;)
+    {
+      node* n = queue.try_pop();
+      if(n == nullptr)
+      {
+        std::this_thread::yield();
+        continue;
+      }
+      sum += n->value;
+      ++num_popped;
+    }
+    for(std::thread& producer : producers)
+    {
+      producer.join();
+    }
+    return sum;
+  }
+
+  // every thread pops a node and pushes it back, like threads sharing a free list
+  template <typename Stack>
+  card64 run_pop_push(Stack& stack, std::vector<node>& nodes, card32 numThreads)
+  {
+    for(node& n : nodes)
+    {
+      stack.push(&n);
+    }
+
+    const card64 per_thread = g_rounds_per_run / numThreads;
+    std::vector<std::thread> threads;
+    for(card32 t = 0; t < numThreads; ++t)
+    {
+      threads.emplace_back(
+          [&stack, per_thread]()
+          {
+            for(card64 i = 0; i < per_thread; ++i)
+            {
+              node* n = stack.try_pop();
+              if(n != nullptr)
+              {
+                ++n->value;
+                stack.push(n);
+              }
+            }
+          });
+    }
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+
+    card64 sum = 0;
+    while(node* n = stack.try_pop())
+    {
+      sum += n->value;
+    }
+    return sum;
+  }
+} // namespace
+
+TEST_CASE("intrusive mpsc queue throughput")
+{
+  std::vector<node> nodes(g_nodes_per_run);
+  for(card64 i = 0; i < g_nodes_per_run; ++i)
+  {
+    nodes[i].value = i;
+  }
+
+  for(card32 num_threads : g_thread_counts)
+  {
+    BENCHMARK(bench_name("mutex + list", num_threads))
+    {
+      locked_list list;
+      return run_many_to_one(list, nodes, num_threads);
+    };
+    BENCHMARK(bench_name("intrusive_mpsc_queue", num_threads))
+    {
+      rsl::intrusive_mpsc_queue<node> queue;
+      return run_many_to_one(queue, nodes, num_threads);
+    };
+  }
+}
+
+TEST_CASE("intrusive stack throughput")
+{
+  std::vector<node> nodes(g_stack_nodes);
+
+  for(card32 num_threads : g_thread_counts)
+  {
+    BENCHMARK(bench_name("mutex + list", num_threads))
+    {
+      locked_list list;
+      return run_pop_push(list, nodes, num_threads);
+    };
+    BENCHMARK(bench_name("intrusive_stack", num_threads))
+    {
+      rsl::intrusive_stack<node> stack;
+      return run_pop_push(stack, nodes, num_threads);
+    };
+  }
+}
+
+// NOLINTEND
@@ -0,0 +1,218 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_math.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/math.h"
+#include "rex_std/vector.h"
+
+#include <cmath>
+#include <string>
+
+namespace
+{
+  constexpr card32 g_num_values = 4096;
+
+  // a simple lcg so the runs are reproducible
+  uint64 next_random(uint64& state)
+  {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state;
+  }
+
+  // uniformly random values in [min, max)
+  template <typename T>
+  rsl::vector<T> random_values(float64 min, float64 max)
+  {
+    uint64 state = 1;
+    rsl::vector<T> values;
+    for(card32 i = 0; i < g_num_values; ++i)
+    {
+      values.push_back(static_cast<T>(min + (max - min) * static_cast<float64>(next_random(state) >> 11) / 9007199254740992.0));
+    }
+    return values;
+  }
+
+  // calls func on every value and sums up the results, so none of the calls get optimized away
+  template <typename T, typename Func>
+  T sum_all(const rsl::vector<T>& values, Func func)
+  {
+    T total = T(0);
+    for(T value : values)
+    {
+      total += func(value);
+    }
+    return total;
+  }
+} // namespace
+
+TEST_CASE("sqrt")
+{
+  const rsl::vector<float32> values32 = random_values<float32>(0.0, 1e6);
+  const rsl::vector<float64> values64 = random_values<float64>(0.0, 1e6);
+
+  BENCHMARK("rsl::sqrt float32")
+  {
+    return sum_all(values32, [](float32 x) { return rsl::sqrt(x); });
+  };
+  BENCHMARK("std::sqrt float32")
+  {
+    return sum_all(values32, [](float32 x) { return std::sqrt(x); });
+  };
+  BENCHMARK("rsl::sqrt float64")
+  {
+    return sum_all(values64, [](float64 x) { return rsl::sqrt(x); });
+  };
+  BENCHMARK("std::sqrt float64")
+  {
+    return sum_all(values64, [](float64 x) { return std::sqrt(x); });
+  };
+  // what rsl::sqrt used to do at runtime
+  BENCHMARK("newton sqrt float64")
+  {
+    return sum_all(values64, [](float64 x) { return rsl::internal::sqrt_check(x, 1.0); });
+  };
+}
+
+TEST_CASE("sin cos")
+{
+  // small angles, like the rotations in vec2 and matrix44, and bigger ones that need more range reduction
+  const float64 ranges[] = {rsl::pi_v<float64>, 1e5};
+  const char8* names[]   = {"small", "big"};
+
+  for(card32 i = 0; i < 2; ++i)
+  {
+    const rsl::vector<float32> values32 = random_values<float32>(-ranges[i], ranges[i]);
+    const rsl::vector<float64> values64 = random_values<float64>(-ranges[i], ranges[i]);
+    rsl::vector<float32> results32(rsl::Size(values32.size()));
+    rsl::vector<float64> results64(rsl::Size(values64.size()));
+
+    BENCHMARK(std::string("rsl::sin float32 ") + names[i])
+    {
+      return sum_all(values32, [](float32 x) { return rsl::sin(x); });
+    };
+    BENCHMARK(std::string("std::sin float32 ") + names[i])
+    {
+      return sum_all(values32, [](float32 x) { return std::sin(x); });
+    };
+    BENCHMARK(std::string("rsl::sin_n float32 ") + names[i])
+    {
+      rsl::sin_n(values32.data(), results32.data(), values32.size());
+      return results32.back();
+    };
+    BENCHMARK(std::string("rsl::sin float64 ") + names[i])
+    {
+      return sum_all(values64, [](float64 x) { return rsl::sin(x); });
+    };
+    BENCHMARK(std::string("std::sin float64 ") + names[i])
+    {
+      return sum_all(values64, [](float64 x) { return std::sin(x); });
+    };
+    BENCHMARK(std::string("rsl::sin_n float64 ") + names[i])
+    {
+      rsl::sin_n(values64.data(), results64.data(), values64.size());
+      return results64.back();
+    };
+    BENCHMARK(std::string("rsl::cos float64 ") + names[i])
+    {
+      return sum_all(values64, [](float64 x) { return rsl::cos(x); });
+    };
+    BENCHMARK(std::string("std::cos float64 ") + names[i])
+    {
+      return sum_all(values64, [](float64 x) { return std::cos(x); });
+    };
+  }
+
+  // what rsl::sin used to do at runtime, which only works for small angles
+  const rsl::vector<float64> small_values = random_values<float64>(-rsl::pi_v<float64>, rsl::pi_v<float64>);
+  BENCHMARK("series sin float64 small")
+  {
+    return sum_all(small_values, [](float64 x) { return rsl::internal::sin_check(x); });
+  };
+}
+
+TEST_CASE("exp log")
+{
+  const rsl::vector<float32> exp_values32 = random_values<float32>(-80.0, 80.0);
+  const rsl::vector<float64> exp_values64 = random_values<float64>(-700.0, 700.0);
+  const rsl::vector<float32> log_values32 = random_values<float32>(1e-3, 1e6);
+  const rsl::vector<float64> log_values64 = random_values<float64>(1e-3, 1e6);
+  rsl::vector<float32> results32(rsl::Size(exp_values32.size()));
+  rsl::vector<float64> results64(rsl::Size(exp_values64.size()));
+
+  BENCHMARK("rsl::exp float32")
+  {
+    return sum_all(exp_values32, [](float32 x) { return rsl::exp(x); });
+  };
+  BENCHMARK("std::exp float32")
+  {
+    return sum_all(exp_values32, [](float32 x) { return std::exp(x); });
+  };
+  BENCHMARK("rsl::exp_n float32")
+  {
+    rsl::exp_n(exp_values32.data(), results32.data(), exp_values32.size());
+    return results32.back();
+  };
+  BENCHMARK("rsl::exp float64")
+  {
+    return sum_all(exp_values64, [](float64 x) { return rsl::exp(x); });
+  };
+  BENCHMARK("std::exp float64")
+  {
+    return sum_all(exp_values64, [](float64 x) { return std::exp(x); });
+  };
+  BENCHMARK("rsl::exp_n float64")
+  {
+    rsl::exp_n(exp_values64.data(), results64.data(), exp_values64.size());
+    return results64.back();
+  };
+
+  BENCHMARK("rsl::log float32")
+  {
+    return sum_all(log_values32, [](float32 x) { return rsl::log(x); });
+  };
+  BENCHMARK("std::log float32")
+  {
+    return sum_all(log_values32, [](float32 x) { return std::log(x); });
+  };
+  BENCHMARK("rsl::log float64")
+  {
+    return sum_all(log_values64, [](float64 x) { return rsl::log(x); });
+  };
+  BENCHMARK("std::log float64")
+  {
+    return sum_all(log_values64, [](float64 x) { return std::log(x); });
+  };
+}
+
+TEST_CASE("pow")
+{
+  const rsl::vector<float64> values = random_values<float64>(0.5, 1.5);
+
+  BENCHMARK("rsl::pow float64")
+  {
+    return sum_all(values, [](float64 x) { return rsl::pow(x, 37); });
+  };
+  BENCHMARK("std::pow float64")
+  {
+    return sum_all(values, [](float64 x) { return std::pow(x, 37); });
+  };
+  // what rsl::pow used to do at runtime
+  BENCHMARK("recursive pow float64")
+  {
+    return sum_all(values, [](float64 x) { return rsl::internal::pow_recur(x, 37); });
+  };
+}
+
+// NOLINTEND
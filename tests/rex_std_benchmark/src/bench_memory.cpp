@@ -0,0 +1,89 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_memory.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/memory/unique_array.h"
+#include "rex_std/internal/memory/memcpy.h"
+#include "rex_std/internal/memory/memmove.h"
+#include "rex_std/internal/memory/memset.h"
+
+#include <string>
+
+namespace
+{
+  // 8 B up to 64 MiB, every step is 8 times bigger than the previous
+  constexpr card64 g_sizes[] = {8, 64, 512, 4 * 1024, 32 * 1024, 256 * 1024, 2 * 1024 * 1024, 16 * 1024 * 1024, 64 * 1024 * 1024};
+
+  std::string bench_name(const char* func, card64 size)
+  {
+    return std::string(func) + " " + std::to_string(size) + " bytes";
+  }
+} // namespace
+
+TEST_CASE("memcpy")
+{
+  for(card64 size : g_sizes)
+  {
+    // offset the source by 1 byte so we also measure the unaligned case
+    rsl::unique_array<rsl::byte> src = rsl::make_unique<rsl::byte[]>(size + 1);
+    rsl::unique_array<rsl::byte> dst = rsl::make_unique<rsl::byte[]>(size);
+
+    BENCHMARK(bench_name("rsl::memcpy", size))
+    {
+      return rsl::memcpy(dst.get(), src.get() + 1, size);
+    };
+    BENCHMARK(bench_name("bytewise memcpy", size))
+    {
+      return rsl::internal::memcpy_bytewise(dst.get(), src.get() + 1, size);
+    };
+  }
+}
+
+TEST_CASE("memmove")
+{
+  for(card64 size : g_sizes)
+  {
+    // moving the buffer 3 bytes forward makes src and dst overlap
+    rsl::unique_array<rsl::byte> buffer = rsl::make_unique<rsl::byte[]>(size + 3);
+
+    BENCHMARK(bench_name("rsl::memmove", size))
+    {
+      return rsl::memmove(buffer.get() + 3, buffer.get(), size);
+    };
+    BENCHMARK(bench_name("bytewise memmove", size))
+    {
+      return rsl::internal::memmove_bytewise(buffer.get() + 3, buffer.get(), size);
+    };
+  }
+}
+
+TEST_CASE("memset")
+{
+  for(card64 size : g_sizes)
+  {
+    rsl::unique_array<rsl::byte> dst = rsl::make_unique<rsl::byte[]>(size);
+
+    BENCHMARK(bench_name("rsl::memset", size))
+    {
+      return rsl::memset(dst.get(), 0x2a, size);
+    };
+    BENCHMARK(bench_name("bytewise memset", size))
+    {
+      return rsl::internal::memset_bytewise(dst.get(), 0x2a, size);
+    };
+  }
+}
+
+// NOLINTEND
@@ -0,0 +1,117 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_memory_resource.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/hashtable/hash_map.h"
+#include "rex_std/map.h"
+#include "rex_std/memory_resource.h"
+#include "rex_std/vector.h"
+
+#include <string>
+
+namespace
+{
+  // 1K up to 1M elements, every step is 10 times bigger than the previous
+  constexpr card32 g_sizes[] = {1'000, 10'000, 100'000, 1'000'000};
+
+  std::string bench_name(const char* func, card32 size)
+  {
+    return std::string(func) + " " + std::to_string(size) + " elements";
+  }
+
+  template <typename Resource>
+  struct resource_holder
+  {
+    Resource resource;
+    rsl::pmr::memory_resource* get()
+    {
+      return &resource;
+    }
+  };
+  struct new_delete_holder
+  {
+    rsl::pmr::memory_resource* get()
+    {
+      return rsl::pmr::new_delete_resource();
+    }
+  };
+
+  using pmr_vector   = rsl::vector<card32, rsl::pmr::polymorphic_allocator>;
+  using pmr_map      = rsl::map<card32, card32, rsl::less<card32>, rsl::pmr::polymorphic_allocator>;
+  using pmr_hash_map = rsl::hash_map<card32, card32, rsl::hash<card32>, rsl::equal_to<card32>, rsl::pmr::polymorphic_allocator>;
+
+  // builds a container and throws it away, the way a container scoped to a frame or request gets used.
+  // MakeResource creates the resource for a single iteration
+  template <typename Container, typename MakeResource>
+  void bench_fill(const char* name, card32 size, MakeResource makeResource)
+  {
+    BENCHMARK(bench_name(name, size))
+    {
+      auto resource = makeResource();
+      Container container(rsl::pmr::polymorphic_allocator(resource.get()));
+      for(card32 i = 0; i < size; ++i)
+      {
+        container.emplace(i, i);
+      }
+      return container.size();
+    };
+  }
+
+  template <typename MakeResource>
+  void bench_vector_fill(const char* name, card32 size, MakeResource makeResource)
+  {
+    BENCHMARK(bench_name(name, size))
+    {
+      auto resource = makeResource();
+      pmr_vector vec {rsl::pmr::polymorphic_allocator(resource.get())};
+      for(card32 i = 0; i < size; ++i)
+      {
+        vec.push_back(i);
+      }
+      return vec.size();
+    };
+  }
+} // namespace
+
+TEST_CASE("memory resource vector fill")
+{
+  for(card32 size : g_sizes)
+  {
+    bench_vector_fill("rsl::vector new_delete_resource", size, [] { return new_delete_holder {}; });
+    bench_vector_fill("rsl::vector monotonic_buffer_resource", size, [] { return resource_holder<rsl::pmr::monotonic_buffer_resource> {}; });
+  }
+}
+
+TEST_CASE("memory resource map fill")
+{
+  for(card32 size : g_sizes)
+  {
+    bench_fill<pmr_map>("rsl::map new_delete_resource", size, [] { return new_delete_holder {}; });
+    bench_fill<pmr_map>("rsl::map monotonic_buffer_resource", size, [] { return resource_holder<rsl::pmr::monotonic_buffer_resource> {}; });
+    bench_fill<pmr_map>("rsl::map unsynchronized_pool_resource", size, [] { return resource_holder<rsl::pmr::unsynchronized_pool_resource> {}; });
+  }
+}
+
+TEST_CASE("memory resource hash_map fill")
+{
+  for(card32 size : g_sizes)
+  {
+    bench_fill<pmr_hash_map>("rsl::hash_map new_delete_resource", size, [] { return new_delete_holder {}; });
+    bench_fill<pmr_hash_map>("rsl::hash_map monotonic_buffer_resource", size, [] { return resource_holder<rsl::pmr::monotonic_buffer_resource> {}; });
+    bench_fill<pmr_hash_map>("rsl::hash_map unsynchronized_pool_resource", size, [] { return resource_holder<rsl::pmr::unsynchronized_pool_resource> {}; });
+  }
+}
+
+// NOLINTEND
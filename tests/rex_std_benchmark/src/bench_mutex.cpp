@@ -0,0 +1,114 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_mutex.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/mutex.h"
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(RSL_PLATFORM_LINUX)
+  #include <pthread.h>
+#endif
+
+namespace
+{
+  // 1 thread measures the uncontended cost, 64 threads is heavier contention than we see in practice
+  constexpr card32 g_thread_counts[] = {1, 2, 4, 8, 16, 32, 64};
+  // the total number of lock/unlock pairs per run, divided over all threads
+  constexpr card32 g_total_locks = 1'000'000;
+
+  std::string bench_name(const char* func, card32 numThreads)
+  {
+    return std::string(func) + " " + std::to_string(numThreads) + " threads";
+  }
+
+#if defined(RSL_PLATFORM_LINUX)
+  class pthread_mutex
+  {
+  public:
+    pthread_mutex()
+    {
+      pthread_mutex_init(&m_mutex, nullptr);
+    }
+    ~pthread_mutex()
+    {
+      pthread_mutex_destroy(&m_mutex);
+    }
+
+    void lock()
+    {
+      pthread_mutex_lock(&m_mutex);
+    }
+    void unlock()
+    {
+      pthread_mutex_unlock(&m_mutex);
+    }
+
+  private:
+    pthread_mutex_t m_mutex;
+  };
+#endif
+
+  // every thread increments a shared counter under the lock.
+  // the critical section is tiny, so this measures the lock itself, which is the worst case for contention
+  template <typename Mutex>
+  void bench_contention(const char* name, card32 numThreads)
+  {
+    BENCHMARK(bench_name(name, numThreads))
+    {
+      Mutex mtx;
+      card64 counter = 0;
+
+      std::vector<std::thread> threads;
+      threads.reserve(numThreads);
+      for(card32 i = 0; i < numThreads; ++i)
+      {
+        threads.emplace_back(
+            [&]()
+            {
+              for(card32 j = 0; j < g_total_locks / numThreads; ++j)
+              {
+                mtx.lock();
+                ++counter;
+                mtx.unlock();
+              }
+            });
+      }
+      for(std::thread& thread : threads)
+      {
+        thread.join();
+      }
+
+      return counter;
+    };
+  }
+} // namespace
+
+TEST_CASE("mutex contention")
+{
+  for(card32 num_threads : g_thread_counts)
+  {
+    bench_contention<rsl::mutex>("rsl::mutex", num_threads);
+    bench_contention<std::mutex>("std::mutex", num_threads);
+#if defined(RSL_PLATFORM_LINUX)
+    bench_contention<pthread_mutex>("pthread_mutex", num_threads);
+#endif
+  }
+}
+
+// NOLINTEND
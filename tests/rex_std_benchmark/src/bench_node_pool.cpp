@@ -0,0 +1,104 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_node_pool.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/hashtable/hash_map.h"
+#include "rex_std/bonus/memory/node_pool_allocator.h"
+#include "rex_std/list.h"
+#include "rex_std/map.h"
+
+#include <string>
+
+namespace
+{
+  // 1K up to 1M elements, every step is 10 times bigger than the previous
+  constexpr card32 g_sizes[] = {1'000, 10'000, 100'000, 1'000'000};
+
+  std::string bench_name(const char* func, card32 size)
+  {
+    return std::string(func) + " " + std::to_string(size) + " elements";
+  }
+
+  // fills the container, then replaces every element with a new one, the way a container gets used under churn
+  template <typename List>
+  void bench_list_churn(const char* name, card32 size)
+  {
+    BENCHMARK(bench_name(name, size))
+    {
+      List list;
+      for(card32 i = 0; i < size; ++i)
+      {
+        list.push_back(i);
+      }
+      for(card32 i = 0; i < size; ++i)
+      {
+        list.pop_front();
+        list.push_back(i);
+      }
+      return list.front();
+    };
+  }
+
+  template <typename Map>
+  void bench_map_churn(const char* name, card32 size)
+  {
+    BENCHMARK(bench_name(name, size))
+    {
+      Map map;
+      for(card32 i = 0; i < size; ++i)
+      {
+        map.emplace(i, i);
+      }
+      for(card32 i = 0; i < size; ++i)
+      {
+        map.erase(i);
+        map.emplace(size + i, i);
+      }
+      return map.size();
+    };
+  }
+} // namespace
+
+TEST_CASE("node pool list churn")
+{
+  for(card32 size : g_sizes)
+  {
+    bench_list_churn<rsl::list<card32>>("rsl::list rsl::allocator", size);
+    bench_list_churn<rsl::list<card32, rsl::node_pool_allocator>>("rsl::list rsl::node_pool_allocator", size);
+    bench_list_churn<rsl::list<card32, rsl::thread_local_node_pool_allocator>>("rsl::list rsl::thread_local_node_pool_allocator", size);
+  }
+}
+
+TEST_CASE("node pool map churn")
+{
+  for(card32 size : g_sizes)
+  {
+    bench_map_churn<rsl::map<card32, card32>>("rsl::map rsl::allocator", size);
+    bench_map_churn<rsl::map<card32, card32, rsl::less<card32>, rsl::node_pool_allocator>>("rsl::map rsl::node_pool_allocator", size);
+    bench_map_churn<rsl::map<card32, card32, rsl::less<card32>, rsl::thread_local_node_pool_allocator>>("rsl::map rsl::thread_local_node_pool_allocator", size);
+  }
+}
+
+TEST_CASE("node pool hash_map churn")
+{
+  for(card32 size : g_sizes)
+  {
+    bench_map_churn<rsl::hash_map<card32, card32>>("rsl::hash_map rsl::allocator", size);
+    bench_map_churn<rsl::hash_map<card32, card32, rsl::hash<card32>, rsl::equal_to<card32>, rsl::node_pool_allocator>>("rsl::hash_map rsl::node_pool_allocator", size);
+    bench_map_churn<rsl::hash_map<card32, card32, rsl::hash<card32>, rsl::equal_to<card32>, rsl::thread_local_node_pool_allocator>>("rsl::hash_map rsl::thread_local_node_pool_allocator", size);
+  }
+}
+
+// NOLINTEND
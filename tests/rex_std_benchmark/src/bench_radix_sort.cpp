@@ -0,0 +1,134 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_radix_sort.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/algorithm.h"
+#include "rex_std/bonus/algorithm/quick_sort.h"
+#include "rex_std/bonus/algorithm/radix_sort.h"
+#include "rex_std/string.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+  constexpr card64 g_sizes[] = {1'000, 100'000, 10'000'000, 100'000'000};
+
+  struct scored_id
+  {
+    uint64 id;
+    float32 score;
+  };
+
+  std::string bench_name(const char* func, card64 size)
+  {
+    return std::string(func) + " " + std::to_string(size);
+  }
+
+  template <typename T, typename Generator>
+  std::vector<T> generate(card64 size, Generator gen)
+  {
+    std::mt19937_64 rng(size);
+    std::vector<T> vec(size);
+    for(T& value : vec)
+    {
+      value = gen(rng);
+    }
+    return vec;
+  }
+
+  template <typename T>
+  void bench_arithmetic(const char* typeName, const std::vector<T>& input)
+  {
+    // the buffer is allocated once, like a caller sorting batch after batch would
+    std::vector<T> buffer(input.size());
+
+    BENCHMARK(bench_name((std::string("rsl::radix_sort ") + typeName).c_str(), input.size()))
+    {
+      std::vector<T> vec = input;
+      rsl::radix_sort(vec.begin(), vec.end(), buffer.data());
+      return vec.front();
+    };
+    BENCHMARK(bench_name((std::string("rsl::quick_sort ") + typeName).c_str(), input.size()))
+    {
+      std::vector<T> vec = input;
+      rsl::quick_sort(vec.begin(), vec.end());
+      return vec.front();
+    };
+    BENCHMARK(bench_name((std::string("rsl::sort ") + typeName).c_str(), input.size()))
+    {
+      std::vector<T> vec = input;
+      rsl::sort(vec.begin(), vec.end());
+      return vec.front();
+    };
+  }
+} // namespace
+
+TEST_CASE("radix sort arithmetic")
+{
+  for(card64 size : g_sizes)
+  {
+    bench_arithmetic("uint32", generate<uint32>(size, [](std::mt19937_64& rng) { return static_cast<uint32>(rng()); }));
+    bench_arithmetic("uint64", generate<uint64>(size, [](std::mt19937_64& rng) { return static_cast<uint64>(rng()); }));
+    bench_arithmetic("float32", generate<float32>(size, [](std::mt19937_64& rng) { return std::uniform_real_distribution<float32>(-1000.0f, 1000.0f)(rng); }));
+  }
+}
+
+TEST_CASE("radix sort key extractor")
+{
+  for(card64 size : g_sizes)
+  {
+    const std::vector<scored_id> input = generate<scored_id>(size, [](std::mt19937_64& rng) { return scored_id {rng(), std::uniform_real_distribution<float32>(0.0f, 1.0f)(rng)}; });
+    std::vector<scored_id> buffer(input.size());
+
+    BENCHMARK(bench_name("rsl::radix_sort scored_id", size))
+    {
+      std::vector<scored_id> vec = input;
+      rsl::radix_sort(vec.begin(), vec.end(), buffer.data(), [](const scored_id& value) { return value.score; });
+      return vec.front().id;
+    };
+    BENCHMARK(bench_name("rsl::quick_sort scored_id", size))
+    {
+      std::vector<scored_id> vec = input;
+      rsl::quick_sort(vec.begin(), vec.end(), [](const scored_id& lhs, const scored_id& rhs) { return lhs.score < rhs.score; });
+      return vec.front().id;
+    };
+  }
+}
+
+TEST_CASE("radix sort strings")
+{
+  // strings are a lot bigger than integers, so we stop at 10M
+  for(card64 size : {1'000ull, 100'000ull, 10'000'000ull})
+  {
+    const std::vector<rsl::string> input = generate<rsl::string>(size, [](std::mt19937_64& rng) { return rsl::to_string(rng() % 1'000'000'000); });
+
+    BENCHMARK(bench_name("rsl::radix_sort rsl::string", size))
+    {
+      std::vector<rsl::string> vec = input;
+      rsl::radix_sort(vec.begin(), vec.end());
+      return vec.front().size();
+    };
+    BENCHMARK(bench_name("rsl::quick_sort rsl::string", size))
+    {
+      std::vector<rsl::string> vec = input;
+      rsl::quick_sort(vec.begin(), vec.end());
+      return vec.front().size();
+    };
+  }
+}
+
+// NOLINTEND
@@ -0,0 +1,106 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_sort.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/algorithm.h"
+#include "rex_std/bonus/algorithm/quick_sort.h"
+#include "rex_std/functional.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+  constexpr card32 g_sizes[] = {1'000, 100'000, 1'000'000};
+
+  enum class distribution
+  {
+    sorted,
+    reversed,
+    organ_pipe,
+    few_unique,
+    random
+  };
+
+  const char* distribution_name(distribution dist)
+  {
+    switch(dist)
+    {
+      case distribution::sorted: return "sorted";
+      case distribution::reversed: return "reversed";
+      case distribution::organ_pipe: return "organ pipe";
+      case distribution::few_unique: return "few unique";
+      case distribution::random: return "random";
+    }
+    return "";
+  }
+
+  std::vector<int32> generate(distribution dist, card32 size)
+  {
+    std::mt19937 rng(size);
+    std::vector<int32> vec(size);
+    for(card32 i = 0; i < size; ++i)
+    {
+      switch(dist)
+      {
+        case distribution::sorted: vec[i] = static_cast<int32>(i); break;
+        case distribution::reversed: vec[i] = static_cast<int32>(size - i); break;
+        case distribution::organ_pipe: vec[i] = static_cast<int32>(i < size / 2 ? i : size - i); break;
+        case distribution::few_unique: vec[i] = static_cast<int32>(rng() % 16); break;
+        case distribution::random: vec[i] = static_cast<int32>(rng()); break;
+      }
+    }
+    return vec;
+  }
+
+  std::string bench_name(const char* func, distribution dist, card32 size)
+  {
+    return std::string(func) + " " + distribution_name(dist) + " " + std::to_string(size);
+  }
+
+  // the input gets copied in every run, which is included in the measurement,
+  // but it's the same for all sorts so the comparison is fair
+  template <typename Sort>
+  void bench_sort(const char* name, distribution dist, card32 size, Sort sort)
+  {
+    const std::vector<int32> input = generate(dist, size);
+    BENCHMARK(bench_name(name, dist, size))
+    {
+      std::vector<int32> vec = input;
+      sort(vec.data(), vec.data() + vec.size());
+      return vec.front();
+    };
+  }
+} // namespace
+
+TEST_CASE("sort distributions")
+{
+  constexpr distribution distributions[] = {distribution::sorted, distribution::reversed, distribution::organ_pipe, distribution::few_unique, distribution::random};
+
+  for(distribution dist : distributions)
+  {
+    for(card32 size : g_sizes)
+    {
+      bench_sort("rsl::sort", dist, size, [](int32* first, int32* last) { rsl::sort(first, last); });
+      bench_sort("rsl::sort custom compare", dist, size, [](int32* first, int32* last) { rsl::sort(first, last, [](int32 lhs, int32 rhs) { return lhs < rhs; }); });
+      bench_sort("rsl::quick_sort", dist, size, [](int32* first, int32* last) { rsl::quick_sort(first, last); });
+      bench_sort("std::sort", dist, size, [](int32* first, int32* last) { std::sort(first, last); });
+    }
+  }
+}
+
+// NOLINTEND
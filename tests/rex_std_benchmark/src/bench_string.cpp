@@ -0,0 +1,139 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_string.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/functional/crc/crc32c.h"
+#include "rex_std/bonus/functional/wyhash.h"
+#include "rex_std/bonus/memory/unique_array.h"
+#include "rex_std/cstring.h"
+#include "rex_std/internal/algorithm/memcmp.h"
+#include "rex_std/internal/memory/memset.h"
+#include "rex_std/internal/string/memchr.h"
+
+#include <string>
+
+namespace
+{
+  // 8 B up to 16 MiB, every step is 8 times bigger than the previous
+  constexpr card64 g_sizes[] = {8, 64, 512, 4 * 1024, 32 * 1024, 256 * 1024, 2 * 1024 * 1024, 16 * 1024 * 1024};
+
+  std::string bench_name(const char* func, card64 size)
+  {
+    return std::string(func) + " " + std::to_string(size) + " bytes";
+  }
+
+  count_t strlen_bytewise(const char8* str)
+  {
+    count_t len = 0;
+    while(str[len] != '\0')
+    {
+      ++len;
+    }
+    return len;
+  }
+
+  const char8* memchr_bytewise(const char8* str, char8 ch, card64 length)
+  {
+    for(card64 i = 0; i < length; ++i)
+    {
+      if(str[i] == ch)
+      {
+        return str + i;
+      }
+    }
+    return nullptr;
+  }
+} // namespace
+
+TEST_CASE("memchr")
+{
+  for(card64 size : g_sizes)
+  {
+    // the needle is in the last byte so the whole buffer gets scanned
+    rsl::unique_array<char8> buffer = rsl::make_unique<char8[]>(size);
+    rsl::memset(buffer.get(), 'a', size);
+    buffer[size - 1] = 'b';
+
+    BENCHMARK(bench_name("rsl::memchr", size))
+    {
+      return rsl::memchr(buffer.get(), 'b', size);
+    };
+    BENCHMARK(bench_name("bytewise memchr", size))
+    {
+      return memchr_bytewise(buffer.get(), 'b', size);
+    };
+  }
+}
+
+TEST_CASE("memcmp")
+{
+  for(card64 size : g_sizes)
+  {
+    // the buffers only differ in the last byte so everything gets compared
+    rsl::unique_array<rsl::byte> lhs = rsl::make_unique<rsl::byte[]>(size);
+    rsl::unique_array<rsl::byte> rhs = rsl::make_unique<rsl::byte[]>(size);
+    rsl::memset(lhs.get(), 0x2a, size);
+    rsl::memset(rhs.get(), 0x2a, size);
+    rhs[size - 1] = rsl::byte(0x2b);
+
+    BENCHMARK(bench_name("rsl::memcmp", size))
+    {
+      return rsl::memcmp(lhs.get(), rhs.get(), static_cast<count_t>(size));
+    };
+    BENCHMARK(bench_name("bytewise memcmp", size))
+    {
+      return rsl::internal::memcmp_bytewise(lhs.get(), rhs.get(), static_cast<count_t>(size));
+    };
+  }
+}
+
+TEST_CASE("strlen")
+{
+  for(card64 size : g_sizes)
+  {
+    rsl::unique_array<char8> buffer = rsl::make_unique<char8[]>(size);
+    rsl::memset(buffer.get(), 'a', size);
+    buffer[size - 1] = '\0';
+
+    BENCHMARK(bench_name("rsl::strlen", size))
+    {
+      return rsl::strlen(buffer.get());
+    };
+    BENCHMARK(bench_name("bytewise strlen", size))
+    {
+      return strlen_bytewise(buffer.get());
+    };
+  }
+}
+
+TEST_CASE("string hash")
+{
+  for(card64 size : g_sizes)
+  {
+    rsl::unique_array<char8> buffer = rsl::make_unique<char8[]>(size);
+    rsl::memset(buffer.get(), 'a', size);
+
+    BENCHMARK(bench_name("rsl::crc32::compute", size))
+    {
+      return rsl::crc32::compute(buffer.get(), static_cast<uint32>(size));
+    };
+    BENCHMARK(bench_name("rsl::wyhash::compute", size))
+    {
+      return rsl::wyhash::compute(buffer.get(), size);
+    };
+  }
+}
+
+// NOLINTEND
@@ -0,0 +1,206 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_thread_pool.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/thread/thread_pool.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace
+{
+  // every benchmark runs on pools of these sizes, to see how it scales with the number of threads
+  constexpr card32 g_thread_counts[] = {1, 2, 4, 8, 16};
+
+  std::string bench_name(const char* func, card32 numThreads)
+  {
+    return std::string(func) + " " + std::to_string(numThreads) + " threads";
+  }
+
+  card64 fib_seq(card32 n)
+  {
+    return n < 2 ? n : fib_seq(n - 1) + fib_seq(n - 2);
+  }
+
+  // no cutoff, so this measures the cost of a fork and a join
+  card64 fib_invoke(rsl::thread_pool& pool, card32 n)
+  {
+    if(n < 2)
+    {
+      return n;
+    }
+
+    card64 lhs = 0;
+    card64 rhs = 0;
+    pool.invoke([&]() { lhs = fib_invoke(pool, n - 1); }, [&]() { rhs = fib_invoke(pool, n - 2); });
+    return lhs + rhs;
+  }
+
+  // every fork allocates a task and its shared state from the pool's task allocator
+  card64 fib_submit(rsl::thread_pool& pool, card32 n)
+  {
+    if(n < 2)
+    {
+      return n;
+    }
+
+    rsl::future<card64> lhs = pool.submit([&pool, n]() { return fib_submit(pool, n - 1); });
+    const card64 rhs        = fib_submit(pool, n - 2);
+    return lhs.get() + rhs;
+  }
+
+  float64 work(card64 i)
+  {
+    return std::sqrt(static_cast<float64>(i));
+  }
+} // namespace
+
+TEST_CASE("thread pool fork join fib")
+{
+  constexpr card32 n = 25;
+
+  BENCHMARK("fib seq")
+  {
+    return fib_seq(n);
+  };
+
+  for(card32 num_threads : g_thread_counts)
+  {
+    rsl::thread_pool pool(num_threads);
+    BENCHMARK(bench_name("fib invoke", num_threads))
+    {
+      return fib_invoke(pool, n);
+    };
+    BENCHMARK(bench_name("fib submit", num_threads))
+    {
+      return pool.submit([&pool]() { return fib_submit(pool, n); }).get();
+    };
+  }
+}
+
+TEST_CASE("thread pool parallel for")
+{
+  constexpr card64 num_elements = 10'000'000;
+  std::vector<float64> results(num_elements);
+
+  BENCHMARK("for seq")
+  {
+    for(card64 i = 0; i < num_elements; ++i)
+    {
+      results[i] = work(i);
+    }
+    return results.back();
+  };
+
+  for(card32 num_threads : g_thread_counts)
+  {
+    rsl::thread_pool pool(num_threads);
+    BENCHMARK(bench_name("parallel_for", num_threads))
+    {
+      pool.parallel_for(0, num_elements, 0,
+                        [&](card64 first, card64 last)
+                        {
+                          for(card64 i = first; i < last; ++i)
+                          {
+                            results[i] = work(i);
+                          }
+                        });
+      return results.back();
+    };
+
+    // the same chunks, but every chunk is submitted from the calling thread and waited on with a future
+    BENCHMARK(bench_name("submit per chunk", num_threads))
+    {
+      const card64 grain = pool.grain_size(num_elements);
+      std::vector<rsl::future<void>> chunks;
+      for(card64 first = 0; first < num_elements; first += grain)
+      {
+        const card64 last = std::min(first + grain, num_elements);
+        chunks.push_back(pool.submit(
+            [&results, first, last]()
+            {
+              for(card64 i = first; i < last; ++i)
+              {
+                results[i] = work(i);
+              }
+            }));
+      }
+      for(rsl::future<void>& chunk : chunks)
+      {
+        chunk.get();
+      }
+      return results.back();
+    };
+  }
+}
+
+TEST_CASE("thread pool high fan out task graph")
+{
+  // a root task spawns lots of tiny tasks, every one of them gets a continuation,
+  // and the root joins all the continuations. This is mostly scheduling and allocation overhead
+  constexpr card32 num_children = 100'000;
+
+  for(card32 num_threads : g_thread_counts)
+  {
+    rsl::thread_pool pool(num_threads);
+    BENCHMARK(bench_name("fan out submit", num_threads))
+    {
+      return pool
+          .submit(
+              [&pool]()
+              {
+                std::vector<rsl::future<card64>> children;
+                children.reserve(num_children);
+                for(card32 i = 0; i < num_children; ++i)
+                {
+                  children.push_back(pool.submit([i]() { return static_cast<card64>(i); }));
+                }
+
+                card64 sum = 0;
+                for(rsl::future<card64>& child : children)
+                {
+                  sum += child.get();
+                }
+                return sum;
+              })
+          .get();
+    };
+    BENCHMARK(bench_name("fan out submit then", num_threads))
+    {
+      return pool
+          .submit(
+              [&pool]()
+              {
+                std::vector<rsl::future<card64>> children;
+                children.reserve(num_children);
+                for(card32 i = 0; i < num_children; ++i)
+                {
+                  children.push_back(pool.then(pool.submit([i]() { return static_cast<card64>(i); }), [](rsl::future<card64> child) { return child.get() * 2; }));
+                }
+
+                card64 sum = 0;
+                for(rsl::future<card64>& child : children)
+                {
+                  sum += child.get();
+                }
+                return sum;
+              })
+          .get();
+    };
+  }
+}
+
+// NOLINTEND
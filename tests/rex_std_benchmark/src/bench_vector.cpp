@@ -0,0 +1,112 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: bench_vector.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/memory.h"
+#include "rex_std/string.h"
+#include "rex_std/vector.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+  constexpr card32 g_sizes[] = {16, 1024, 64 * 1024};
+
+  std::string bench_name(const char* func, card32 size)
+  {
+    return std::string(func) + " " + std::to_string(size) + " elements";
+  }
+} // namespace
+
+// growing without reserving, every reallocation moves all elements over
+TEST_CASE("vector growth")
+{
+  for(card32 size : g_sizes)
+  {
+    BENCHMARK(bench_name("std::vector<std::unique_ptr> push_back", size))
+    {
+      std::vector<std::unique_ptr<card32>> vec;
+      for(card32 i = 0; i < size; ++i)
+      {
+        vec.push_back(std::make_unique<card32>(i));
+      }
+      return vec.size();
+    };
+    BENCHMARK(bench_name("rsl::vector<rsl::unique_ptr> push_back", size))
+    {
+      rsl::vector<rsl::unique_ptr<card32>> vec;
+      for(card32 i = 0; i < size; ++i)
+      {
+        vec.push_back(rsl::make_unique<card32>(i));
+      }
+      return vec.size();
+    };
+    BENCHMARK(bench_name("std::vector<std::string> push_back", size))
+    {
+      std::vector<std::string> vec;
+      for(card32 i = 0; i < size; ++i)
+      {
+        vec.emplace_back("short");
+      }
+      return vec.size();
+    };
+    BENCHMARK(bench_name("rsl::vector<rsl::string> push_back", size))
+    {
+      rsl::vector<rsl::string> vec;
+      for(card32 i = 0; i < size; ++i)
+      {
+        vec.emplace_back("short");
+      }
+      return vec.size();
+    };
+  }
+}
+
+// inserting at the front shifts every element one place over
+TEST_CASE("vector insert front")
+{
+  for(card32 size : g_sizes)
+  {
+    if(size > 1024)
+    {
+      continue;
+    }
+
+    BENCHMARK(bench_name("std::vector<std::unique_ptr> insert front", size))
+    {
+      std::vector<std::unique_ptr<card32>> vec;
+      vec.reserve(size);
+      for(card32 i = 0; i < size; ++i)
+      {
+        vec.insert(vec.begin(), std::make_unique<card32>(i));
+      }
+      return vec.size();
+    };
+    BENCHMARK(bench_name("rsl::vector<rsl::unique_ptr> insert front", size))
+    {
+      rsl::vector<rsl::unique_ptr<card32>> vec;
+      vec.reserve(size);
+      for(card32 i = 0; i < size; ++i)
+      {
+        vec.insert(vec.cbegin(), rsl::make_unique<card32>(i));
+      }
+      return vec.size();
+    };
+  }
+}
+
+// NOLINTEND
@@ -0,0 +1,19 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: catch.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+// NOLINTBEGIN
+
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_DISABLE_EXCEPTIONS
+#include "rex_std_test/catch2/catch.hpp"
+
+// NOLINTEND
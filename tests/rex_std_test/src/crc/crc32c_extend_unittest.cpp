@@ -0,0 +1,118 @@
+// Copyright 2017 The CRC32C Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file. See the AUTHORS file for names of contributors.
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/functional/crc/crc32c.h"
+#include "rex_std/bonus/functional/crc/crc32c_arm64.h"
+#include "rex_std/bonus/functional/crc/crc32c_arm64_check.h"
+#include "rex_std/bonus/functional/crc/crc32c_internal.h"
+#include "rex_std/bonus/functional/crc/crc32c_sse42.h"
+#include "rex_std/bonus/functional/crc/crc32c_sse42_check.h"
+
+// NOLINTBEGIN
+
+namespace
+{
+  // big enough to go through every block size of the sse4.2 kernel
+  // and the 1032 byte blocks of the arm64 kernel
+  constexpr card64 g_crc_buffer_size = 20000;
+
+  // sizes around the block and stride boundaries of all kernels
+  constexpr card64 g_crc_test_sizes[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 255, 256, 257, 1007, 1008, 1031, 1032, 1033, 4095, 4096, 4097, 16319, 16320, 16321, 19990};
+
+  void fill_crc_pattern(uint8_t* buffer, card64 size)
+  {
+    for(card64 i = 0; i < size; ++i)
+    {
+      buffer[i] = static_cast<uint8_t>(i * 31 + (i >> 8));
+    }
+  }
+
+  uint32 reference_crc(const uint8_t* data, card64 size, uint32 crc)
+  {
+    return rsl::crc32::internal::compute_bytewise(reinterpret_cast<const char*>(data), size, crc);
+  }
+} // namespace
+
+// the check value of the Castagnoli polynomial, this has to work at compile time
+static_assert(rsl::crc32::compute("123456789", 9) == 0xE3069283);
+
+TEST_CASE("CRC32C portable kernel")
+{
+  static uint8_t buffer[g_crc_buffer_size];
+  fill_crc_pattern(buffer, g_crc_buffer_size);
+
+  for(card64 size : g_crc_test_sizes)
+  {
+    for(card64 offset = 0; offset < 8; ++offset)
+    {
+      CHECK(rsl::crc32c::ExtendPortable(0, buffer + offset, size) == reference_crc(buffer + offset, size, 0));
+      CHECK(rsl::crc32c::ExtendPortable(0x12345678, buffer + offset, size) == reference_crc(buffer + offset, size, 0x12345678));
+    }
+  }
+}
+
+#if HAVE_SSE42 && (defined(_M_X64) || defined(__x86_64__))
+TEST_CASE("CRC32C sse42 kernel")
+{
+  if(!rsl::crc32c::CanUseSse42())
+  {
+    return;
+  }
+
+  static uint8_t buffer[g_crc_buffer_size];
+  fill_crc_pattern(buffer, g_crc_buffer_size);
+
+  for(card64 size : g_crc_test_sizes)
+  {
+    for(card64 offset = 0; offset < 8; ++offset)
+    {
+      CHECK(rsl::crc32c::ExtendSse42(0, buffer + offset, size) == reference_crc(buffer + offset, size, 0));
+      CHECK(rsl::crc32c::ExtendSse42(0x12345678, buffer + offset, size) == reference_crc(buffer + offset, size, 0x12345678));
+    }
+  }
+}
+#endif // HAVE_SSE42 && (defined(_M_X64) || defined(__x86_64__))
+
+#if HAVE_ARM64_CRC32C
+TEST_CASE("CRC32C arm64 kernel")
+{
+  if(!rsl::crc32c::CanUseArm64Crc32())
+  {
+    return;
+  }
+
+  static uint8_t buffer[g_crc_buffer_size];
+  fill_crc_pattern(buffer, g_crc_buffer_size);
+
+  for(card64 size : g_crc_test_sizes)
+  {
+    for(card64 offset = 0; offset < 8; ++offset)
+    {
+      CHECK(rsl::crc32c::ExtendArm64(0, buffer + offset, size) == reference_crc(buffer + offset, size, 0));
+      CHECK(rsl::crc32c::ExtendArm64(0x12345678, buffer + offset, size) == reference_crc(buffer + offset, size, 0x12345678));
+    }
+  }
+}
+#endif // HAVE_ARM64_CRC32C
+
+TEST_CASE("CRC32C runtime dispatch")
+{
+  static uint8_t buffer[g_crc_buffer_size];
+  fill_crc_pattern(buffer, g_crc_buffer_size);
+
+  for(card64 size : g_crc_test_sizes)
+  {
+    const char* data = reinterpret_cast<const char*>(buffer + 3);
+    CHECK(rsl::crc32::compute(data, static_cast<uint32>(size)) == reference_crc(buffer + 3, size, 0));
+    CHECK(rsl::crc32::compute(buffer + 3, static_cast<uint32>(size)) == reference_crc(buffer + 3, size, 0));
+
+    // extending a crc in 2 parts gives the same result as computing it in one go
+    const uint32 first_half = rsl::crc32::compute(data, static_cast<uint32>(size / 2));
+    CHECK(rsl::crc32::compute(data + size / 2, static_cast<uint32>(size - size / 2), first_half) == reference_crc(buffer + 3, size, 0));
+  }
+}
+
+// NOLINTEND
@@ -0,0 +1,153 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_async_logger.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+// NOLINTBEGIN
+
+#include "rex_std/bonus/async_logger.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include <Windows.h>
+#elif defined(RSL_PLATFORM_LINUX)
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+namespace
+{
+  const char* g_log_file = "rsl_test_async_logger.log";
+
+  rsl::internal::console_handle open_log_file()
+  {
+#if defined(RSL_PLATFORM_WINDOWS)
+    return CreateFileA(g_log_file, GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+    return open(g_log_file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+  }
+  void close_log_file(rsl::internal::console_handle handle)
+  {
+#if defined(RSL_PLATFORM_WINDOWS)
+    CloseHandle(handle);
+#else
+    close(handle);
+#endif
+  }
+
+  std::string read_log_file()
+  {
+    std::ifstream file(g_log_file);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+  }
+} // namespace
+
+TEST_CASE("async logger")
+{
+  const rsl::internal::console_handle handle = open_log_file();
+  const std::string long_message(1000, 'x');
+  {
+    rsl::async_logger logger(handle);
+    CHECK(logger.log("hello {}", 42));
+    CHECK(logger.log_deferred("deferred {} {}", 1, 2.5f));
+    CHECK(logger.log("{}", long_message.c_str()));
+
+    // everything logged before a flush is written by the time it returns
+    logger.flush();
+    CHECK(read_log_file() == "hello 42\ndeferred 1 2.5\n" + long_message + "\n");
+
+    logger.log("logged right before destruction");
+  }
+  // the logger writes everything before it's destroyed
+  CHECK(read_log_file() == "hello 42\ndeferred 1 2.5\n" + long_message + "\nlogged right before destruction\n");
+  close_log_file(handle);
+
+  std::remove(g_log_file);
+}
+
+TEST_CASE("async logger overflow")
+{
+  const rsl::log_overflow_policy policies[] = {rsl::log_overflow_policy::block, rsl::log_overflow_policy::drop, rsl::log_overflow_policy::overwrite};
+  for(rsl::log_overflow_policy policy : policies)
+  {
+    // a tiny queue, so the producers overflow it all the time
+    constexpr card32 num_threads = 8;
+    constexpr card32 per_thread  = 10000;
+    card64 num_dropped           = 0;
+
+    const rsl::internal::console_handle handle = open_log_file();
+    {
+      rsl::async_logger logger(handle, policy, 16);
+      std::vector<std::thread> threads;
+      for(card32 t = 0; t < num_threads; ++t)
+      {
+        threads.emplace_back(
+            [&logger, t]()
+            {
+              for(card32 i = 0; i < per_thread; ++i)
+              {
+                if(i % 2 == 0)
+                {
+                  logger.log("{} {}", t, i);
+                }
+                else
+                {
+                  logger.log_deferred("{} {}", t, i);
+                }
+              }
+            });
+      }
+      for(std::thread& thread : threads)
+      {
+        thread.join();
+      }
+      logger.flush();
+      num_dropped = logger.num_dropped();
+    }
+    close_log_file(handle);
+
+    // every message is either written or counted as dropped, and the ones written keep their order per thread
+    const std::string content = read_log_file();
+    const card64 num_lines    = std::count(content.begin(), content.end(), '\n');
+    CHECK(num_lines + num_dropped == num_threads * per_thread);
+    if(policy == rsl::log_overflow_policy::block)
+    {
+      CHECK(num_dropped == 0);
+    }
+
+    std::istringstream lines(content);
+    std::vector<card32> last(num_threads, -1);
+    bool in_order = true;
+    card32 t      = 0;
+    card32 i      = 0;
+    while(lines >> t >> i)
+    {
+      in_order = in_order && i > last[t];
+      last[t]  = i;
+    }
+    CHECK(in_order);
+  }
+
+  std::remove(g_log_file);
+}
+
+// NOLINTEND
@@ -0,0 +1,360 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_charconv.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/string/string_utils.h"
+#include "rex_std/bit.h"
+#include "rex_std/charconv.h"
+#include "rex_std/iterator.h"
+#include "rex_std/limits.h"
+#include "rex_std/string.h"
+#include "rex_std/string_view.h"
+
+namespace
+{
+  template <typename T>
+  rsl::string_view write(char8 (&buf)[64], T value) // NOLINT(modernize-avoid-c-arrays)
+  {
+    const rsl::to_chars_result res = rsl::to_chars(rsl::begin(buf), rsl::end(buf), value);
+    REQUIRE(res.ec == rsl::errc {});
+    return rsl::string_view(buf, static_cast<count_t>(res.ptr - buf));
+  }
+
+  template <typename T>
+  T read(rsl::string_view str)
+  {
+    T value {};
+    const rsl::from_chars_result res = rsl::from_chars(str.data(), str.data() + str.length(), value);
+    REQUIRE(res.ec == rsl::errc {});
+    REQUIRE(res.ptr == str.data() + str.length());
+    return value;
+  }
+
+  // a simple lcg so the tests are reproducible
+  uint64 next_random(uint64& state)
+  {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state;
+  }
+} // namespace
+
+TEST_CASE("to_chars integer")
+{
+  char8 buf[64]; // NOLINT(modernize-avoid-c-arrays)
+
+  CHECK(write(buf, 0) == "0");
+  CHECK(write(buf, 7) == "7");
+  CHECK(write(buf, 10) == "10");
+  CHECK(write(buf, -99) == "-99");
+  CHECK(write(buf, 1234567890) == "1234567890");
+  CHECK(write(buf, rsl::numeric_limits<int8>::min()) == "-128");
+  CHECK(write(buf, rsl::numeric_limits<uint16>::max()) == "65535");
+  CHECK(write(buf, rsl::numeric_limits<int32>::min()) == "-2147483648");
+  CHECK(write(buf, rsl::numeric_limits<int64>::min()) == "-9223372036854775808");
+  CHECK(write(buf, rsl::numeric_limits<uint64>::max()) == "18446744073709551615");
+
+  // every length, right below and at each power of 10
+  uint64 power = 1;
+  for(card32 num_digits = 1; num_digits < 20; ++num_digits)
+  {
+    CHECK(write(buf, power).length() == num_digits);
+    CHECK(write(buf, power * 10 - 1).length() == num_digits);
+    power *= 10;
+  }
+
+  rsl::to_chars_result res = rsl::to_chars(rsl::begin(buf), rsl::end(buf), 255, 16);
+  CHECK(rsl::string_view(buf, static_cast<count_t>(res.ptr - buf)) == "ff");
+  res = rsl::to_chars(rsl::begin(buf), rsl::end(buf), -5, 2);
+  CHECK(rsl::string_view(buf, static_cast<count_t>(res.ptr - buf)) == "-101");
+  res = rsl::to_chars(rsl::begin(buf), rsl::end(buf), 35u, 36);
+  CHECK(rsl::string_view(buf, static_cast<count_t>(res.ptr - buf)) == "z");
+  res = rsl::to_chars(rsl::begin(buf), rsl::end(buf), 100u, 7);
+  CHECK(rsl::string_view(buf, static_cast<count_t>(res.ptr - buf)) == "202");
+
+  // not enough room
+  res = rsl::to_chars(rsl::begin(buf), rsl::begin(buf) + 2, 123);
+  CHECK(res.ec == rsl::errc::value_too_large);
+  CHECK(res.ptr == rsl::begin(buf) + 2);
+}
+
+TEST_CASE("from_chars integer")
+{
+  CHECK(read<int32>("0") == 0);
+  CHECK(read<int32>("-42") == -42);
+  CHECK(read<int32>("000000000000000000000000123") == 123);
+  CHECK(read<uint32>("4294967295") == rsl::numeric_limits<uint32>::max());
+  CHECK(read<int8>("-128") == rsl::numeric_limits<int8>::min());
+  CHECK(read<int64>("-9223372036854775808") == rsl::numeric_limits<int64>::min());
+  CHECK(read<uint64>("18446744073709551615") == rsl::numeric_limits<uint64>::max());
+  // long enough to go through the 8 digits at a time path
+  CHECK(read<uint64>("1234567812345678") == 1234567812345678ull);
+  CHECK(read<uint64>("12345678123456781") == 12345678123456781ull);
+
+  int32 value      = 5;
+  const char8* str = "ff";
+  rsl::from_chars_result res = rsl::from_chars(str, str + 2, value, 16);
+  CHECK(res.ec == rsl::errc {});
+  CHECK(value == 255);
+  str = "Zz";
+  res = rsl::from_chars(str, str + 2, value, 36);
+  CHECK(value == 35 * 36 + 35);
+
+  // stops at the first char that isn't a digit
+  str = "12345678x9";
+  res = rsl::from_chars(str, str + 10, value);
+  CHECK(res.ec == rsl::errc {});
+  CHECK(res.ptr == str + 8);
+  CHECK(value == 12345678);
+
+  value = 5;
+  str   = "+1";
+  res   = rsl::from_chars(str, str + 2, value);
+  CHECK(res.ec == rsl::errc::invalid_argument);
+  CHECK(res.ptr == str);
+  CHECK(value == 5);
+
+  uint32 unsigned_value = 5;
+  str                   = "-1";
+  res                   = rsl::from_chars(str, str + 2, unsigned_value);
+  CHECK(res.ec == rsl::errc::invalid_argument);
+  CHECK(unsigned_value == 5);
+
+  // out of range, but all the digits are consumed
+  str = "2147483648";
+  res = rsl::from_chars(str, str + 10, value);
+  CHECK(res.ec == rsl::errc::result_out_of_range);
+  CHECK(res.ptr == str + 10);
+  CHECK(value == 5);
+  str = "18446744073709551616";
+  uint64 value64 = 5;
+  res            = rsl::from_chars(str, str + 20, value64);
+  CHECK(res.ec == rsl::errc::result_out_of_range);
+  CHECK(value64 == 5);
+}
+
+TEST_CASE("integer round trip")
+{
+  char8 buf[64]; // NOLINT(modernize-avoid-c-arrays)
+  uint64 state = 1;
+  for(card32 i = 0; i < 100'000; ++i)
+  {
+    // shift by a random amount so small values show up as often as big ones
+    const uint64 bits  = next_random(state);
+    const int64 value  = static_cast<int64>(bits) >> (bits % 64);
+    const int32 base   = i % 4 == 0 ? static_cast<int32>(2 + bits % 35) : 10;
+    const rsl::to_chars_result written = rsl::to_chars(rsl::begin(buf), rsl::end(buf), value, base);
+    REQUIRE(written.ec == rsl::errc {});
+
+    int64 result = 0;
+    const rsl::from_chars_result res = rsl::from_chars(buf, written.ptr, result, base);
+    REQUIRE(res.ec == rsl::errc {});
+    REQUIRE(res.ptr == written.ptr);
+    REQUIRE(result == value);
+  }
+}
+
+TEST_CASE("string utils integer conversions")
+{
+  CHECK(rsl::to_string(0) == "0");
+  CHECK(rsl::to_string(-12345) == "-12345");
+  CHECK(rsl::to_string(rsl::numeric_limits<uint64>::max()) == "18446744073709551615");
+  CHECK(rsl::to_wstring(-12345) == L"-12345");
+
+  CHECK(rsl::stoi("123", 3).value() == 123);
+  CHECK(rsl::stoi("+123", 4).value() == 123);
+  CHECK(rsl::stoi("-123", 4).value() == -123);
+  CHECK(rsl::stoi(L"-123", 4).value() == -123);
+  CHECK(!rsl::stoi("12a", 3).has_value());
+  CHECK(!rsl::stoi("99999999999", 11).has_value());
+  CHECK(rsl::stoui("4294967295", 10).value() == rsl::numeric_limits<uint32>::max());
+
+  CHECK(rsl::atoi("  42").value() == 42);
+  CHECK(rsl::atoi("-17 apples").value() == -17);
+  CHECK(!rsl::atoi("apples").has_value());
+
+  char8* end      = nullptr;
+  const char8* str = "0x1F rest";
+  CHECK(rsl::strtol(str, &end, 0).value() == 31);
+  CHECK(end == str + 4);
+  CHECK(rsl::strtoll("0777", nullptr, 0).value() == 0777);
+  CHECK(rsl::strtoull("18446744073709551615", nullptr, 10).value() == rsl::numeric_limits<uint64>::max());
+
+  // the char pointer versions go through from_chars
+  CHECK(rsl::atoi("+42").value() == 42);
+  CHECK(rsl::atoi("\t\n 7").value() == 7);
+  CHECK(rsl::atoi("-2147483648").value() == rsl::numeric_limits<int32>::min());
+  CHECK(!rsl::atoi("-").has_value());
+  CHECK(!rsl::atoi("+-1").has_value());
+  CHECK(rsl::strtol("-123abc", &end, 10).value() == -123);
+  CHECK(rsl::strtol("z", nullptr, 36).value() == 35);
+  CHECK(rsl::strtoll("-9223372036854775808", nullptr, 10).value() == rsl::numeric_limits<int64>::min());
+
+  // a negative unsigned value wraps around, like it does in C
+  str = "-5 rest";
+  CHECK(rsl::strtoul(str, &end, 10).value() == static_cast<ulong>(-5));
+  CHECK(end == str + 2);
+  CHECK(rsl::strtoull("-1", nullptr, 10).value() == rsl::numeric_limits<uint64>::max());
+  CHECK(rsl::strtoul("+5", nullptr, 10).value() == 5);
+  CHECK(!rsl::strtoul("--5", nullptr, 10).has_value());
+
+  // the base prefix is only skipped for base 0 and 16
+  str = "0x10";
+  CHECK(rsl::strtol(str, &end, 16).value() == 16);
+  CHECK(end == str + 4);
+  CHECK(rsl::strtoul(str, nullptr, 0).value() == 16);
+  CHECK(rsl::strtol("0X1f", nullptr, 0).value() == 31);
+  CHECK(rsl::strtol(str, &end, 10).value() == 0);
+  CHECK(end == str + 1);
+  CHECK(rsl::strtol("010", nullptr, 0).value() == 8);
+  CHECK(rsl::strtol("010", nullptr, 10).value() == 10);
+}
+
+TEST_CASE("to_chars float shortest")
+{
+  char8 buf[64]; // NOLINT(modernize-avoid-c-arrays)
+
+  CHECK(write(buf, 0.0) == "0");
+  CHECK(write(buf, -0.0) == "-0");
+  CHECK(write(buf, 1.0) == "1");
+  CHECK(write(buf, 0.1) == "0.1");
+  CHECK(write(buf, 0.3) == "0.3");
+  CHECK(write(buf, 1.5f) == "1.5");
+  CHECK(write(buf, 0.1f) == "0.1");
+  CHECK(write(buf, 123456.0) == "123456");
+  CHECK(write(buf, 1e22) == "1e+22");
+  CHECK(write(buf, 1e-7) == "1e-07");
+  CHECK(write(buf, 5e-324) == "5e-324");
+  CHECK(write(buf, 1.7976931348623157e308) == "1.7976931348623157e+308");
+  CHECK(write(buf, rsl::numeric_limits<float64>::infinity()) == "inf");
+  CHECK(write(buf, -rsl::numeric_limits<float64>::infinity()) == "-inf");
+  CHECK(write(buf, rsl::numeric_limits<float64>::quiet_NaN()) == "nan");
+}
+
+TEST_CASE("to_chars float formats")
+{
+  char8 buf[64]; // NOLINT(modernize-avoid-c-arrays)
+  rsl::to_chars_result res {};
+
+  res = rsl::to_chars(rsl::begin(buf), rsl::end(buf), 1234.5, rsl::chars_format::scientific);
+  CHECK(rsl::string_view(buf, static_cast<count_t>(res.ptr - buf)) == "1.2345e+03");
+  res = rsl::to_chars(rsl::begin(buf), rsl::end(buf), 1e-5, rsl::chars_format::fixed);
+  CHECK(rsl::string_view(buf, static_cast<count_t>(res.ptr - buf)) == "0.00001");
+  res = rsl::to_chars(rsl::begin(buf), rsl::end(buf), 1.0, rsl::chars_format::hex);
+  CHECK(rsl::string_view(buf, static_cast<count_t>(res.ptr - buf)) == "1p+0");
+  res = rsl::to_chars(rsl::begin(buf), rsl::end(buf), 0.5, rsl::chars_format::hex);
+  CHECK(rsl::string_view(buf, static_cast<count_t>(res.ptr - buf)) == "1p-1");
+
+  res = rsl::to_chars(rsl::begin(buf), rsl::end(buf), 3.14159, rsl::chars_format::fixed, 2);
+  CHECK(rsl::string_view(buf, static_cast<count_t>(res.ptr - buf)) == "3.14");
+  res = rsl::to_chars(rsl::begin(buf), rsl::end(buf), 2.5, rsl::chars_format::fixed, 0);
+  CHECK(rsl::string_view(buf, static_cast<count_t>(res.ptr - buf)) == "2");
+  res = rsl::to_chars(rsl::begin(buf), rsl::end(buf), 1234.5, rsl::chars_format::scientific, 1);
+  CHECK(rsl::string_view(buf, static_cast<count_t>(res.ptr - buf)) == "1.2e+03");
+
+  // not enough room
+  res = rsl::to_chars(rsl::begin(buf), rsl::begin(buf) + 3, 1.2345);
+  CHECK(res.ec == rsl::errc::value_too_large);
+  CHECK(res.ptr == rsl::begin(buf) + 3);
+}
+
+TEST_CASE("from_chars float")
+{
+  CHECK(read<float64>("0") == 0.0);
+  CHECK(read<float64>("1") == 1.0);
+  CHECK(read<float64>("-2.5") == -2.5);
+  CHECK(read<float64>("0.1") == 0.1);
+  CHECK(read<float64>(".5") == 0.5);
+  CHECK(read<float64>("1e10") == 1e10);
+  CHECK(read<float64>("1E-10") == 1e-10);
+  CHECK(read<float64>("1.7976931348623157e308") == 1.7976931348623157e308);
+  CHECK(read<float64>("4.9406564584124654e-324") == 5e-324);
+  CHECK(read<float32>("3.4028235e38") == 3.4028235e38f);
+  CHECK(read<float32>("0.1") == 0.1f);
+  CHECK(read<float64>("inf") == rsl::numeric_limits<float64>::infinity());
+  CHECK(read<float64>("-Infinity") == -rsl::numeric_limits<float64>::infinity());
+  const float64 nan = read<float64>("nan");
+  CHECK(nan != nan);
+
+  // more than 19 digits, which doesn't fit the fast path
+  CHECK(read<float64>("0.1000000000000000055511151231257827021181583404541015625") == 0.1);
+  CHECK(read<float64>("123456789012345678901234567890") == 123456789012345678901234567890.0);
+  // exactly halfway between 1 and the next double, ties to even
+  CHECK(read<float64>("1.00000000000000011102230246251565404236316680908203125") == 1.0);
+  CHECK(read<float64>("1.00000000000000011102230246251565404236316680908203126") == 1.0000000000000002);
+
+  float64 value = 1.0;
+  const char8* str = "abc";
+  rsl::from_chars_result res = rsl::from_chars(str, str + 3, value);
+  CHECK(res.ec == rsl::errc::invalid_argument);
+  CHECK(res.ptr == str);
+  CHECK(value == 1.0);
+
+  str = "1e400";
+  res = rsl::from_chars(str, str + 5, value);
+  CHECK(res.ec == rsl::errc::result_out_of_range);
+  CHECK(value == 1.0);
+
+  // the exponent isn't part of the number in fixed format
+  str = "1e5";
+  res = rsl::from_chars(str, str + 3, value, rsl::chars_format::fixed);
+  CHECK(res.ec == rsl::errc {});
+  CHECK(res.ptr == str + 1);
+  CHECK(value == 1.0);
+
+  str = "1.8p1";
+  res = rsl::from_chars(str, str + 5, value, rsl::chars_format::hex);
+  CHECK(res.ec == rsl::errc {});
+  CHECK(value == 3.0);
+}
+
+TEST_CASE("float round trip")
+{
+  char8 buf[64]; // NOLINT(modernize-avoid-c-arrays)
+  uint64 state = 1;
+  for(card32 i = 0; i < 100'000; ++i)
+  {
+    // random bit patterns cover subnormals and every exponent
+    const float64 value64 = rsl::bit_cast<float64>(next_random(state));
+    // nan doesn't compare equal to itself
+    if(value64 == value64)
+    {
+      REQUIRE(read<float64>(write(buf, value64)) == value64);
+    }
+
+    const float32 value32 = rsl::bit_cast<float32>(static_cast<uint32>(next_random(state) >> 32));
+    if(value32 == value32)
+    {
+      REQUIRE(read<float32>(write(buf, value32)) == value32);
+    }
+  }
+}
+
+TEST_CASE("string utils float conversions")
+{
+  CHECK(rsl::to_string(1.5f) == "1.5000");
+  CHECK(rsl::to_string(-0.125) == "-0.1250");
+  CHECK(rsl::to_string(1.05) == "1.0500");
+  CHECK(rsl::internal::to_string<rsl::string>(2.0 / 3.0, 2) == "0.67");
+
+  CHECK(rsl::stof("1.25", 4).value() == 1.25f);
+  CHECK(rsl::stof("+1.25", 5).value() == 1.25f);
+  CHECK(rsl::stof("-3e2", 4).value() == -300.0f);
+  CHECK(rsl::stof(L"0.5", 3).value() == 0.5f);
+  CHECK(!rsl::stof("1.2.3", 5).has_value());
+  CHECK(!rsl::stof("", 0).has_value());
+
+  CHECK(rsl::strtod("0.1", nullptr).value() == 0.1);
+  CHECK(rsl::strtod("  -2.5e-3", nullptr).value() == -2.5e-3);
+  CHECK(rsl::strtod("0x1.8p1", nullptr).value() == 3.0);
+  CHECK(rsl::strtof("3.4028235e38", nullptr).value() == 3.4028235e38f);
+}
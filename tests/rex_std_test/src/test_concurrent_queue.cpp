@@ -0,0 +1,126 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_concurrent_queue.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+// NOLINTBEGIN
+
+#include "rex_std/atomic.h"
+#include "rex_std/bonus/mpmc_queue.h"
+#include "rex_std/bonus/spsc_queue.h"
+#include "rex_std/string.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+  // every producer pushes a distinct range of values, so the consumers can check nothing got lost or duplicated
+  template <typename Queue>
+  void produce_and_consume(Queue& queue, card32 numProducers, card32 numConsumers, card64 perProducer)
+  {
+    const card64 total = numProducers * perProducer;
+    rsl::atomic<card64> sum(0);
+    std::vector<std::thread> threads;
+
+    for(card32 p = 0; p < numProducers; ++p)
+    {
+      threads.emplace_back(
+          [&, p]()
+          {
+            for(card64 i = 0; i < perProducer; ++i)
+            {
+              queue.push(p * perProducer + i);
+            }
+          });
+    }
+    for(card32 c = 0; c < numConsumers; ++c)
+    {
+      threads.emplace_back(
+          [&]()
+          {
+            card64 local_sum = 0;
+            for(card64 i = 0; i < total / numConsumers; ++i)
+            {
+              card64 value = 0;
+              queue.pop(value);
+              local_sum += value;
+            }
+            sum.fetch_add(local_sum);
+          });
+    }
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+
+    CHECK(sum.load() == total * (total - 1) / 2);
+    CHECK(queue.empty_approx());
+  }
+} // namespace
+
+TEST_CASE("spsc queue")
+{
+  rsl::spsc_queue<rsl::string> queue(3);
+  CHECK(queue.capacity() == 4);
+
+  CHECK(queue.try_push(rsl::string("a")));
+  CHECK(queue.try_emplace(3, 'b'));
+  CHECK(queue.size_approx() == 2);
+
+  const rsl::string batch[] = {rsl::string("c"), rsl::string("d"), rsl::string("e")};
+  CHECK(queue.try_push_n(batch, 3) == 2);
+  CHECK(!queue.try_push(rsl::string("f")));
+
+  rsl::string value;
+  CHECK(queue.try_pop(value));
+  CHECK(value == "a");
+
+  rsl::string popped[4];
+  CHECK(queue.try_pop_n(popped, 4) == 3);
+  CHECK(popped[0] == "bbb");
+  CHECK(popped[2] == "d");
+  CHECK(!queue.try_pop(value));
+
+  // the items that are left get destroyed with the queue
+  CHECK(queue.try_push(rsl::string("a string too long to fit in the small buffer")));
+
+  rsl::spsc_queue<card64> small_queue(8);
+  produce_and_consume(small_queue, 1, 1, 100000);
+}
+
+TEST_CASE("mpmc queue")
+{
+  rsl::mpmc_queue<rsl::string> queue(4);
+
+  const rsl::string batch[] = {rsl::string("a"), rsl::string("b"), rsl::string("c"), rsl::string("d"), rsl::string("e")};
+  CHECK(queue.try_push_n(batch, 5) == 4);
+  CHECK(!queue.try_push(rsl::string("f")));
+
+  rsl::string value;
+  CHECK(queue.try_pop(value));
+  CHECK(value == "a");
+  CHECK(queue.try_emplace(2, 'g'));
+
+  rsl::string popped[4];
+  CHECK(queue.try_pop_n(popped, 4) == 4);
+  CHECK(popped[3] == "gg");
+  CHECK(!queue.try_pop(value));
+
+  CHECK(queue.try_push(rsl::string("a string too long to fit in the small buffer")));
+
+  rsl::mpmc_queue<card64> small_queue(8);
+  produce_and_consume(small_queue, 4, 4, 20000);
+  produce_and_consume(small_queue, 8, 2, 5000);
+}
+
+// NOLINTEND
@@ -0,0 +1,218 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_console_buf.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+// NOLINTBEGIN
+
+#include "rex_std/bonus/iostream/console_buf.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(RSL_PLATFORM_WINDOWS)
+  #include <Windows.h>
+#elif defined(RSL_PLATFORM_LINUX)
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+namespace
+{
+  using console_buf = rsl::console_buf<char8>;
+  using traits      = rsl::char_traits<char8>;
+
+  // the console is redirected to a file, so the console buffer is fully buffered
+  const char* g_console_file = "rsl_test_console_buf.txt";
+
+  rsl::internal::console_handle open_console_file(bool forWriting)
+  {
+#if defined(RSL_PLATFORM_WINDOWS)
+    if(forWriting)
+    {
+      return CreateFileA(g_console_file, GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    }
+    return CreateFileA(g_console_file, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+    return forWriting ? open(g_console_file, O_WRONLY | O_CREAT | O_TRUNC, 0644) : open(g_console_file, O_RDONLY);
+#endif
+  }
+  void close_console_file(rsl::internal::console_handle handle)
+  {
+#if defined(RSL_PLATFORM_WINDOWS)
+    CloseHandle(handle);
+#else
+    close(handle);
+#endif
+  }
+
+  std::string read_console_file()
+  {
+    std::ifstream file(g_console_file, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+  }
+  void write_console_file(const std::string& content)
+  {
+    std::ofstream file(g_console_file, std::ios::binary | std::ios::trunc);
+    file << content;
+  }
+
+  // every character is different from its neighbours, so a chunk written out of order shows up
+  std::string make_content(card32 size)
+  {
+    std::string content;
+    for(card32 i = 0; i < size; ++i)
+    {
+      content += static_cast<char>('a' + i % 26);
+    }
+    return content;
+  }
+} // namespace
+
+TEST_CASE("console_buf fully buffered")
+{
+  const rsl::internal::console_handle handle = open_console_file(true);
+  {
+    console_buf buf(handle);
+    buf.pubsetbuf(nullptr, 16);
+
+    // a newline doesn't flush when the console isn't a terminal
+    CHECK(buf.sputn("hello\n", 6) == 6);
+    CHECK(read_console_file().empty());
+    for(char8 c = 'a'; c < 'k'; ++c)
+    {
+      CHECK(buf.sputc(c) == c);
+    }
+    CHECK(read_console_file().empty());
+
+    // the put area is full, so the next character writes everything
+    CHECK(buf.sputc('k') == 'k');
+    CHECK(read_console_file() == "hello\nabcdefghijk");
+
+    CHECK(buf.sputn("xyz", 3) == 3);
+    CHECK(read_console_file() == "hello\nabcdefghijk");
+    CHECK(buf.pubsync() == 0);
+    CHECK(read_console_file() == "hello\nabcdefghijkxyz");
+
+    CHECK(buf.sputn("tail", 4) == 4);
+    CHECK(read_console_file() == "hello\nabcdefghijkxyz");
+  }
+  // the console buffer writes what's pending before it's destroyed
+  CHECK(read_console_file() == "hello\nabcdefghijkxyztail");
+  close_console_file(handle);
+
+  std::remove(g_console_file);
+}
+
+TEST_CASE("console_buf unbuffered")
+{
+  const rsl::internal::console_handle handle = open_console_file(true);
+  {
+    console_buf buf(handle);
+    CHECK(buf.sputn("pending", 7) == 7);
+
+    // making it unbuffered writes what's pending, every write after it goes to the console right away
+    buf.pubsetbuf(nullptr, 0);
+    CHECK(read_console_file() == "pending");
+    CHECK(buf.sputn("abc", 3) == 3);
+    CHECK(read_console_file() == "pendingabc");
+    CHECK(buf.sputc('d') == 'd');
+    CHECK(read_console_file() == "pendingabcd");
+  }
+  CHECK(read_console_file() == "pendingabcd");
+  close_console_file(handle);
+
+  std::remove(g_console_file);
+}
+
+TEST_CASE("console_buf big writes")
+{
+  // a write that doesn't fit in the put area is written together with what's pending, in order
+  const std::string big = make_content(static_cast<card32>(rsl::internal::g_default_console_buffer_size) * 3 + 7);
+  rsl::internal::console_handle handle = open_console_file(true);
+  {
+    console_buf buf(handle);
+    CHECK(buf.sputn("start", 5) == 5);
+    CHECK(buf.sputn(big.data(), static_cast<rsl::streamsize>(big.size())) == static_cast<rsl::streamsize>(big.size()));
+    CHECK(read_console_file() == "start" + big);
+    CHECK(buf.sputn("end", 3) == 3);
+  }
+  CHECK(read_console_file() == "start" + big + "end");
+  close_console_file(handle);
+
+  // same with a put area provided by the user
+  handle = open_console_file(true);
+  {
+    char8 put_area[8];
+    console_buf buf(handle);
+    buf.pubsetbuf(put_area, 8);
+    CHECK(buf.sputn("abc", 3) == 3);
+    CHECK(buf.sputn(big.data(), static_cast<rsl::streamsize>(big.size())) == static_cast<rsl::streamsize>(big.size()));
+    CHECK(buf.sputc('x') == 'x');
+    CHECK(read_console_file() == "abc" + big);
+  }
+  CHECK(read_console_file() == "abc" + big + "x");
+  close_console_file(handle);
+
+  std::remove(g_console_file);
+}
+
+TEST_CASE("console_buf reading")
+{
+  // bigger than the get area, so it needs to be refilled
+  const std::string content = make_content(1000);
+  write_console_file(content);
+
+  // underflow doesn't advance, uflow does
+  rsl::internal::console_handle handle = open_console_file(false);
+  {
+    console_buf buf(handle);
+    CHECK(buf.sgetc() == 'a');
+    CHECK(buf.sgetc() == 'a');
+    CHECK(buf.sbumpc() == 'a');
+    CHECK(buf.sbumpc() == 'b');
+    CHECK(buf.sgetc() == 'c');
+
+    std::string read = "ab";
+    for(traits::int_type ch = buf.sbumpc(); !traits::eq_int_type(ch, traits::eof()); ch = buf.sbumpc())
+    {
+      read += traits::to_char_type(ch);
+    }
+    CHECK(read == content);
+    CHECK(traits::eq_int_type(buf.sgetc(), traits::eof()));
+  }
+  close_console_file(handle);
+
+  // reading from the get area and directly from the console, starting with uflow
+  handle = open_console_file(false);
+  {
+    console_buf buf(handle);
+    CHECK(buf.sbumpc() == 'a');
+
+    std::string read = "a";
+    char8 chunk[300];
+    for(rsl::streamsize num_read = buf.sgetn(chunk, 300); num_read > 0; num_read = buf.sgetn(chunk, 300))
+    {
+      read.append(chunk, static_cast<size_t>(num_read));
+    }
+    CHECK(read == content);
+  }
+  close_console_file(handle);
+
+  std::remove(g_console_file);
+}
+
+// NOLINTEND
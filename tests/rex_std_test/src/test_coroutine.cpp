@@ -0,0 +1,232 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_coroutine.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+// NOLINTBEGIN
+
+#include "rex_std/atomic.h"
+#include "rex_std/bonus/coroutine.h"
+#include "rex_std/bonus/thread/thread_pool.h"
+#include "rex_std/bonus/thread/timer_queue.h"
+#include "rex_std/chrono.h"
+#include "rex_std/generator.h"
+#include "rex_std/string.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+  // counts the frames still alive, to check a frame is freed with the allocator it came from
+  rsl::atomic<card32> g_live_frames(0);
+
+  class counting_allocator
+  {
+  public:
+    void* allocate(rsl::size_t count)
+    {
+      g_live_frames.fetch_add(1);
+      return rsl::allocator().allocate(count);
+    }
+    void deallocate(void* ptr, rsl::size_t count)
+    {
+      g_live_frames.fetch_sub(1);
+      rsl::allocator().deallocate(ptr, count);
+    }
+  };
+
+  rsl::task<card32> value_task(card32 value)
+  {
+    co_return value;
+  }
+
+  rsl::task<card64> sum_task(card32 count)
+  {
+    card64 sum = 0;
+    for(card32 i = 0; i < count; ++i)
+    {
+      sum += co_await value_task(i);
+    }
+    co_return sum;
+  }
+
+  card32 g_referenced = 42;
+  rsl::task<card32&> reference_task()
+  {
+    co_return g_referenced;
+  }
+
+  rsl::task<void> void_task(card32& out)
+  {
+    out = co_await value_task(7);
+  }
+
+  rsl::task<rsl::string> string_task()
+  {
+    co_return rsl::string("a string too long to fit in the small buffer");
+  }
+
+  rsl::task<card32> arena_task(rsl::allocator_arg_t, counting_allocator, card32 value)
+  {
+    co_return value + 1;
+  }
+
+  rsl::generator<card32> iota(card32 count)
+  {
+    for(card32 i = 0; i < count; ++i)
+    {
+      co_yield i;
+    }
+  }
+
+  rsl::generator<rsl::string> copies()
+  {
+    rsl::string value("x");
+    co_yield value;
+    value = "y";
+    co_yield value;
+  }
+
+  rsl::generator<card32> arena_iota(rsl::allocator_arg_t, counting_allocator, card32 count)
+  {
+    for(card32 i = 0; i < count; ++i)
+    {
+      co_yield i;
+    }
+  }
+
+  rsl::task<card32> double_on_pool(rsl::thread_pool& pool, card32 value)
+  {
+    co_await rsl::schedule_on(pool);
+    co_return value * 2;
+  }
+
+  rsl::task<card64> sum_on_pool(rsl::thread_pool& pool, card32 count)
+  {
+    card64 sum = 0;
+    for(card32 i = 0; i < count; ++i)
+    {
+      sum += co_await double_on_pool(pool, i);
+    }
+    co_return sum;
+  }
+
+  rsl::task<rsl::chrono::steady_clock::duration> timed_sleep(rsl::timer_queue& timers, rsl::chrono::milliseconds duration)
+  {
+    const auto start = rsl::chrono::steady_clock::now();
+    co_await rsl::sleep_for(timers, duration);
+    co_return rsl::chrono::steady_clock::now() - start;
+  }
+
+  rsl::task<card32> sleep_on_pool(rsl::timer_queue& timers, rsl::thread_pool& pool, card32 ms)
+  {
+    co_await rsl::sleep_for(timers, rsl::chrono::milliseconds(ms), pool);
+    co_return ms;
+  }
+} // namespace
+
+TEST_CASE("task")
+{
+  CHECK(rsl::sync_wait(value_task(3)) == 3);
+  CHECK(rsl::sync_wait(reference_task()) == 42);
+
+  card32 out = 0;
+  rsl::sync_wait(void_task(out));
+  CHECK(out == 7);
+
+  CHECK(rsl::sync_wait(string_task()) == "a string too long to fit in the small buffer");
+  rsl::task<rsl::string> lvalue_task = string_task();
+  CHECK(rsl::sync_wait(lvalue_task) == "a string too long to fit in the small buffer");
+  CHECK(lvalue_task.is_ready());
+
+  // every await finishes synchronously, symmetric transfer keeps this from growing the stack
+  CHECK(rsl::sync_wait(sum_task(100000)) == 4999950000ll);
+
+  CHECK(rsl::sync_wait(arena_task(rsl::allocator_arg, counting_allocator(), 1)) == 2);
+  CHECK(g_live_frames.load() == 0);
+}
+
+TEST_CASE("generator")
+{
+  card32 sum = 0;
+  for(card32 value : iota(10))
+  {
+    sum += value;
+  }
+  CHECK(sum == 45);
+
+  rsl::string joined;
+  for(rsl::string&& value : copies())
+  {
+    joined += value;
+  }
+  CHECK(joined == "xy");
+
+  {
+    rsl::generator<card32> gen = arena_iota(rsl::allocator_arg, counting_allocator(), 5);
+    CHECK(g_live_frames.load() == 1);
+    auto it = gen.begin();
+    CHECK(*it == 0);
+    ++it;
+    CHECK(*it == 1);
+    // the generator is destroyed before it ran to completion
+  }
+  CHECK(g_live_frames.load() == 0);
+}
+
+TEST_CASE("coroutines on a thread pool")
+{
+  rsl::thread_pool pool(4);
+  CHECK(rsl::sync_wait(double_on_pool(pool, 21)) == 42);
+  CHECK(rsl::sync_wait(sum_on_pool(pool, 1000)) == 999000);
+
+  // a worker waiting on a coroutine keeps running the tasks of its pool
+  rsl::future<card64> from_worker = pool.submit([&]() { return rsl::sync_wait(sum_on_pool(pool, 100)); });
+  CHECK(from_worker.get() == 9900);
+
+  rsl::atomic<card64> total(0);
+  std::vector<std::thread> threads;
+  for(card32 i = 0; i < 8; ++i)
+  {
+    threads.emplace_back([&]() { total.fetch_add(rsl::sync_wait(sum_on_pool(pool, 100))); });
+  }
+  for(std::thread& thread : threads)
+  {
+    thread.join();
+  }
+  CHECK(total.load() == 8 * 9900);
+}
+
+TEST_CASE("coroutines on a timer queue")
+{
+  rsl::thread_pool pool(2);
+  rsl::timer_queue timers;
+
+  CHECK(rsl::sync_wait(timed_sleep(timers, rsl::chrono::milliseconds(10))) >= rsl::chrono::milliseconds(10));
+  CHECK(rsl::sync_wait(sleep_on_pool(timers, pool, 5)) == 5);
+
+  // timers scheduled from many threads, later ones getting earlier deadlines
+  rsl::atomic<card32> total(0);
+  std::vector<std::thread> threads;
+  for(card32 i = 0; i < 8; ++i)
+  {
+    threads.emplace_back([&, i]() { total.fetch_add(rsl::sync_wait(sleep_on_pool(timers, pool, 10 - i))); });
+  }
+  for(std::thread& thread : threads)
+  {
+    thread.join();
+  }
+  CHECK(total.load() == 52);
+}
+
+// NOLINTEND
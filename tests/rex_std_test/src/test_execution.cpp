@@ -0,0 +1,372 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_execution.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/algorithm.h"
+#include "rex_std/atomic.h"
+#include "rex_std/bonus/thread/thread_pool.h"
+#include "rex_std/bonus/thread/work_stealing_deque.h"
+#include "rex_std/execution.h"
+#include "rex_std/functional.h"
+#include "rex_std/list.h"
+#include "rex_std/string.h"
+#include "rex_std/vector.h"
+
+#include <thread>
+
+namespace
+{
+  // sizes around the grain sizes of the parallel algorithms
+  constexpr card32 g_sizes[] = {0, 1, 10, 2048, 4097, 100'000};
+
+  // a simple lcg so the tests are reproducible
+  card32 next_random(card32& state)
+  {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+  }
+
+  rsl::vector<int32> random_ints(card32 size, card32 maxValue)
+  {
+    card32 state = size;
+    rsl::vector<int32> vec;
+    for(card32 i = 0; i < size; ++i)
+    {
+      vec.push_back(static_cast<int32>(next_random(state) % maxValue));
+    }
+    return vec;
+  }
+
+  card64 fib(rsl::thread_pool& pool, card32 n) // NOLINT(misc-no-recursion)
+  {
+    if(n < 2)
+    {
+      return n;
+    }
+
+    card64 lhs = 0;
+    card64 rhs = 0;
+    pool.invoke([&]() { lhs = fib(pool, n - 1); }, [&]() { rhs = fib(pool, n - 2); });
+    return lhs + rhs;
+  }
+
+  // every level submits one half and waits on it, a waiting worker has to keep running tasks or this deadlocks
+  card64 fib_submit(rsl::thread_pool& pool, card32 n) // NOLINT(misc-no-recursion)
+  {
+    if(n < 2)
+    {
+      return n;
+    }
+
+    rsl::future<card64> lhs = pool.submit([&pool, n]() { return fib_submit(pool, n - 1); });
+    const card64 rhs        = fib_submit(pool, n - 2);
+    return lhs.get() + rhs;
+  }
+} // namespace
+
+TEST_CASE("work stealing deque")
+{
+  rsl::work_stealing_deque<int32> deque(2);
+  int32 values[] = {0, 1, 2, 3, 4};
+
+  CHECK(deque.empty());
+  CHECK(deque.pop() == nullptr);
+  CHECK(deque.steal() == nullptr);
+  // popping an empty deque has to leave it empty
+  CHECK(deque.empty());
+  CHECK(deque.size() == 0);
+
+  // pushing more than the capacity grows the deque
+  for(int32& value : values)
+  {
+    deque.push(&value);
+  }
+  CHECK(deque.size() == 5);
+
+  // the owner pops the newest, thieves steal the oldest
+  CHECK(deque.pop() == &values[4]);
+  CHECK(deque.steal() == &values[0]);
+  CHECK(deque.pop() == &values[3]);
+  CHECK(deque.steal() == &values[1]);
+  CHECK(deque.pop() == &values[2]);
+  CHECK(deque.empty());
+}
+
+TEST_CASE("work stealing deque with thieves")
+{
+  constexpr card32 num_items   = 100'000;
+  constexpr card32 num_thieves = 4;
+
+  rsl::work_stealing_deque<card32> deque;
+  rsl::vector<card32> items;
+  rsl::vector<rsl::atomic<card32>> times_taken(rsl::Size(num_items));
+  for(card32 i = 0; i < num_items; ++i)
+  {
+    items.push_back(i);
+  }
+
+  rsl::atomic<bool> done(false);
+  rsl::vector<std::thread> thieves;
+  for(card32 i = 0; i < num_thieves; ++i)
+  {
+    thieves.emplace_back(
+        [&]()
+        {
+          while(!done.load())
+          {
+            if(card32* item = deque.steal())
+            {
+              times_taken[*item].fetch_add(1);
+            }
+          }
+        });
+  }
+
+  // the owner pops some of the items itself while the thieves are stealing
+  for(card32 i = 0; i < num_items; ++i)
+  {
+    deque.push(&items[i]);
+    if(i % 4 == 0)
+    {
+      if(card32* item = deque.pop())
+      {
+        times_taken[*item].fetch_add(1);
+      }
+    }
+  }
+  while(card32* item = deque.pop())
+  {
+    times_taken[*item].fetch_add(1);
+  }
+
+  done.store(true);
+  for(std::thread& thief : thieves)
+  {
+    thief.join();
+  }
+
+  // every item is taken exactly once, by either the owner or a thief
+  bool all_taken_once = true;
+  for(const rsl::atomic<card32>& taken : times_taken)
+  {
+    all_taken_once &= taken.load() == 1;
+  }
+  CHECK(all_taken_once);
+}
+
+TEST_CASE("thread pool")
+{
+  for(card32 num_workers : {1, 2, 4})
+  {
+    rsl::thread_pool pool(num_workers);
+    CHECK(pool.num_workers() == num_workers);
+
+    // fork join, called from outside of the pool
+    CHECK(fib(pool, 20) == 6765);
+
+    // every index is visited exactly once
+    rsl::vector<rsl::atomic<card32>> visits(rsl::Size(10'000));
+    pool.parallel_for(0, visits.size(), 0,
+                      [&](card64 first, card64 last)
+                      {
+                        for(card64 i = first; i < last; ++i)
+                        {
+                          visits[static_cast<card32>(i)].fetch_add(1);
+                        }
+                      });
+    bool all_visited_once = true;
+    for(const rsl::atomic<card32>& visit : visits)
+    {
+      all_visited_once &= visit.load() == 1;
+    }
+    CHECK(all_visited_once);
+  }
+
+  // multiple threads outside of the pool using it at the same time
+  rsl::thread_pool pool(2);
+  rsl::atomic<card32> num_correct(0);
+  rsl::vector<std::thread> threads;
+  for(card32 i = 0; i < 4; ++i)
+  {
+    threads.emplace_back(
+        [&]()
+        {
+          if(fib(pool, 15) == 610)
+          {
+            num_correct.fetch_add(1);
+          }
+        });
+  }
+  for(std::thread& thread : threads)
+  {
+    thread.join();
+  }
+  CHECK(num_correct.load() == 4);
+}
+
+TEST_CASE("thread pool submit and then")
+{
+  for(card32 num_workers : {1, 2, 4})
+  {
+    rsl::thread_pool pool(num_workers);
+
+    rsl::future<card64> fib_result = pool.submit([&pool]() { return fib_submit(pool, 16); });
+    CHECK(fib_result.get() == 987);
+    CHECK(!fib_result.valid());
+
+    rsl::atomic<card32> num_calls(0);
+    rsl::future<void> void_result = pool.submit([&]() { num_calls.fetch_add(1); });
+    void_result.wait();
+    CHECK(void_result.is_ready());
+    void_result.get();
+    CHECK(num_calls.load() == 1);
+
+    // bigger than the biggest block of the task allocator
+    rsl::future<rsl::string> string_result = pool.submit([]() { return rsl::string(1000, 'x'); });
+    CHECK(string_result.get() == rsl::string(1000, 'x'));
+
+    // a chain of continuations, none of them blocks a thread
+    rsl::future<card32> chain = pool.submit([]() { return 0; });
+    for(card32 i = 0; i < 100; ++i)
+    {
+      chain = pool.then(rsl::move(chain), [](rsl::future<card32> previous) { return previous.get() + 1; });
+    }
+    CHECK(chain.get() == 100);
+
+    // a continuation on a future that's already ready gets scheduled immediately
+    rsl::future<card32> ready = pool.submit([]() { return 5; });
+    ready.wait();
+    rsl::future<void> after_ready = pool.then(rsl::move(ready), [&](rsl::future<card32> previous) { num_calls.fetch_add(previous.get()); });
+    after_ready.get();
+    CHECK(num_calls.load() == 6);
+
+    // fan out from inside the pool and fan back in
+    rsl::future<card64> total = pool.submit(
+        [&pool]()
+        {
+          rsl::vector<rsl::future<card64>> children;
+          for(card32 i = 0; i < 1000; ++i)
+          {
+            children.push_back(pool.then(pool.submit([i]() { return static_cast<card64>(i); }), [](rsl::future<card64> child) { return child.get() * 2; }));
+          }
+
+          card64 sum = 0;
+          for(rsl::future<card64>& child : children)
+          {
+            sum += child.get();
+          }
+          return sum;
+        });
+    CHECK(total.get() == 999 * 1000);
+  }
+}
+
+TEST_CASE("execution policies")
+{
+  CHECK(rsl::is_execution_policy_v<rsl::execution::sequenced_policy>);
+  CHECK(rsl::is_execution_policy_v<rsl::execution::parallel_policy>);
+  CHECK(rsl::is_execution_policy_v<rsl::execution::parallel_unsequenced_policy>);
+  CHECK(rsl::is_execution_policy_v<rsl::execution::unsequenced_policy>);
+  CHECK(!rsl::is_execution_policy_v<int32>);
+
+  rsl::thread_pool pool(2);
+  CHECK(&rsl::execution::par.on(pool).pool() == &pool);
+  CHECK(&rsl::execution::par.pool() == &rsl::thread_pool::default_pool());
+}
+
+TEST_CASE("parallel for_each, transform and reduce")
+{
+  rsl::thread_pool pool(4);
+  const rsl::execution::parallel_policy par = rsl::execution::par.on(pool);
+
+  for(card32 size : g_sizes)
+  {
+    rsl::vector<int32> vec = random_ints(size, 1000);
+    rsl::vector<int32> expected;
+    for(int32 value : vec)
+    {
+      expected.push_back(value * 2);
+    }
+
+    rsl::for_each(par, vec.begin(), vec.end(), [](int32& value) { value *= 2; });
+    CHECK(vec == expected);
+
+    rsl::vector<int32> squares(rsl::Size(vec.size()));
+    CHECK(rsl::transform(par, vec.begin(), vec.end(), squares.begin(), [](int32 value) { return value * value; }) == squares.end());
+    rsl::vector<int32> sums(rsl::Size(vec.size()));
+    CHECK(rsl::transform(rsl::execution::par_unseq.on(pool), vec.begin(), vec.end(), squares.begin(), sums.begin(), rsl::plus<int32>()) == sums.end());
+
+    bool all_transformed = true;
+    card64 expected_sum  = 0;
+    for(card32 i = 0; i < vec.size(); ++i)
+    {
+      all_transformed &= squares[i] == vec[i] * vec[i];
+      all_transformed &= sums[i] == vec[i] + squares[i];
+      expected_sum += vec[i];
+    }
+    CHECK(all_transformed);
+    CHECK(rsl::reduce(par, vec.begin(), vec.end(), card64(0)) == expected_sum);
+    CHECK(rsl::reduce(rsl::execution::seq, vec.begin(), vec.end(), card64(0)) == expected_sum);
+    CHECK(rsl::reduce(par, vec.begin(), vec.end(), card64(0), [](card64 lhs, card64 rhs) { return (rsl::max)(lhs, rhs); }) == (vec.empty() ? 0 : *rsl::max_element(vec.begin(), vec.end())));
+  }
+
+  // ranges that aren't random access fall back to a single thread
+  rsl::list<int32> list = {1, 2, 3, 4};
+  rsl::for_each(par, list.begin(), list.end(), [](int32& value) { value += 1; });
+  CHECK(rsl::reduce(par, list.begin(), list.end()) == 14);
+}
+
+TEST_CASE("parallel copy and fill")
+{
+  rsl::thread_pool pool(4);
+
+  for(card32 size : g_sizes)
+  {
+    rsl::vector<int32> vec(rsl::Size(size));
+    rsl::fill(rsl::execution::par.on(pool), vec.begin(), vec.end(), 7);
+    CHECK(rsl::count(vec.begin(), vec.end(), 7) == size);
+
+    rsl::vector<int32> src = random_ints(size, 1'000'000);
+    CHECK(rsl::copy(rsl::execution::par.on(pool), src.begin(), src.end(), vec.begin()) == vec.end());
+    CHECK(vec == src);
+  }
+}
+
+TEST_CASE("parallel sort")
+{
+  for(card32 num_workers : {1, 3, 4})
+  {
+    rsl::thread_pool pool(num_workers);
+
+    for(card32 size : g_sizes)
+    {
+      for(card32 max_value : {4u, 1'000'000u})
+      {
+        rsl::vector<int32> vec = random_ints(size, max_value);
+        rsl::vector<int32> copy = vec;
+        rsl::sort(rsl::execution::par.on(pool), vec.begin(), vec.end());
+        CHECK(rsl::is_sorted(vec.begin(), vec.end()));
+        CHECK(rsl::is_permutation(vec.begin(), vec.end(), copy.begin()));
+      }
+
+      // non trivial types get moved into the buffer and back
+      rsl::vector<rsl::string> strings;
+      for(int32 value : random_ints(size, 100'000))
+      {
+        strings.push_back(rsl::to_string(value));
+      }
+      rsl::sort(rsl::execution::par.on(pool), strings.begin(), strings.end(), rsl::greater<rsl::string>());
+      CHECK(rsl::is_sorted(strings.begin(), strings.end(), rsl::greater<rsl::string>()));
+    }
+  }
+}
@@ -0,0 +1,266 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_filebuf.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+// NOLINTBEGIN
+
+#include "rex_std/fstream.h"
+
+#include <cstdio>
+#include <string>
+
+namespace
+{
+  using filebuf = rsl::basic_filebuf<char8, rsl::char_traits<char8>>;
+
+  const char* g_test_file = "rsl_test_filebuf.bin";
+
+  constexpr rsl::io::openmode g_read_mode  = rsl::io::openmode::in | rsl::io::openmode::binary;
+  constexpr rsl::io::openmode g_write_mode = rsl::io::openmode::out | rsl::io::openmode::trunc | rsl::io::openmode::binary;
+  constexpr rsl::io::openmode g_rw_mode    = rsl::io::openmode::in | rsl::io::openmode::out | rsl::io::openmode::binary;
+
+  // the content of the file, read through a separate file buffer
+  std::string read_file(const char* filename = g_test_file)
+  {
+    filebuf buf;
+    REQUIRE(buf.open(filename, g_read_mode) != nullptr);
+
+    std::string content;
+    char8 chunk[256];
+    for(rsl::streamsize num_read = buf.sgetn(chunk, 256); num_read > 0; num_read = buf.sgetn(chunk, 256))
+    {
+      content.append(chunk, static_cast<size_t>(num_read));
+    }
+    return content;
+  }
+
+  void write_file(const std::string& content)
+  {
+    filebuf buf;
+    REQUIRE(buf.open(g_test_file, g_write_mode) != nullptr);
+    REQUIRE(buf.sputn(content.data(), static_cast<rsl::streamsize>(content.size())) == static_cast<rsl::streamsize>(content.size()));
+  }
+} // namespace
+
+TEST_CASE("filebuf write read round trip")
+{
+  // small writes are gathered, big ones bypass the buffer, both have to end up in order
+  std::string expected;
+  {
+    filebuf buf;
+    REQUIRE(buf.open(g_test_file, g_write_mode) != nullptr);
+    for(card32 i = 0; i < 1000; ++i)
+    {
+      const std::string line = std::to_string(i) + "\n";
+      CHECK(buf.sputn(line.data(), static_cast<rsl::streamsize>(line.size())) == static_cast<rsl::streamsize>(line.size()));
+      expected += line;
+    }
+    const std::string big(rsl::internal::g_default_filebuf_buffer_size * 2 + 13, 'x');
+    CHECK(buf.sputn(big.data(), static_cast<rsl::streamsize>(big.size())) == static_cast<rsl::streamsize>(big.size()));
+    expected += big;
+    CHECK(buf.sputn("end", 3) == 3);
+    expected += "end";
+  }
+  CHECK(read_file() == expected);
+
+  // reads of all sizes, mixing buffered and direct ones
+  {
+    filebuf buf;
+    REQUIRE(buf.open(g_test_file, g_read_mode) != nullptr);
+    std::string content;
+    rsl::streamsize chunk_size = 1;
+    std::string chunk(rsl::internal::g_default_filebuf_buffer_size * 2, '\0');
+    for(rsl::streamsize num_read = buf.sgetn(chunk.data(), chunk_size); num_read > 0; num_read = buf.sgetn(chunk.data(), chunk_size))
+    {
+      content.append(chunk.data(), static_cast<size_t>(num_read));
+      chunk_size = chunk_size * 7 % static_cast<rsl::streamsize>(chunk.size()) + 1;
+    }
+    CHECK(content == expected);
+  }
+
+  std::remove(g_test_file);
+}
+
+TEST_CASE("filebuf mixing reads and writes")
+{
+  // reading flushes the pending writes first and continues right after them
+  write_file("0123456789");
+  {
+    filebuf buf;
+    REQUIRE(buf.open(g_test_file, g_rw_mode) != nullptr);
+    CHECK(buf.sputn("abc", 3) == 3);
+    char8 read[4] = {};
+    CHECK(buf.sgetn(read, 3) == 3);
+    CHECK(std::string(read) == "345");
+  }
+  CHECK(read_file() == "abc3456789");
+
+  // a read fills the whole buffer, a write after it still has to happen right after what was handed out
+  write_file("0123456789");
+  {
+    filebuf buf;
+    REQUIRE(buf.open(g_test_file, g_rw_mode) != nullptr);
+    char8 read[3] = {};
+    CHECK(buf.sgetn(read, 2) == 2);
+    CHECK(std::string(read) == "01");
+    CHECK(buf.sputn("xy", 2) == 2);
+    CHECK(buf.sgetn(read, 2) == 2);
+    CHECK(std::string(read) == "45");
+  }
+  CHECK(read_file() == "01xy456789");
+
+  std::remove(g_test_file);
+}
+
+TEST_CASE("filebuf app and ate")
+{
+  write_file("hello");
+  {
+    filebuf buf;
+    REQUIRE(buf.open(g_test_file, rsl::io::openmode::out | rsl::io::openmode::app | rsl::io::openmode::binary) != nullptr);
+    CHECK(buf.sputn(" world", 6) == 6);
+  }
+  CHECK(read_file() == "hello world");
+
+  {
+    filebuf buf;
+    REQUIRE(buf.open(g_test_file, g_rw_mode | rsl::io::openmode::ate) != nullptr);
+    // ate starts at the end, so there's nothing left to read
+    char8 read[4] = {};
+    CHECK(buf.sgetn(read, 3) == 0);
+    CHECK(buf.sputn("!", 1) == 1);
+  }
+  CHECK(read_file() == "hello world!");
+
+  std::remove(g_test_file);
+}
+
+TEST_CASE("filebuf reopen")
+{
+  filebuf buf;
+  REQUIRE(buf.open(g_test_file, g_write_mode) != nullptr);
+  CHECK(buf.sputn("pending", 7) == 7);
+
+  // opening an open file buffer fails and keeps the pending writes
+  CHECK(buf.open("rsl_test_filebuf_other.bin", g_write_mode) == nullptr);
+  CHECK(buf.is_open());
+  CHECK(buf.close() != nullptr);
+  CHECK(!buf.is_open());
+  CHECK(read_file() == "pending");
+
+  // once closed, it can be opened again
+  REQUIRE(buf.open(g_test_file, g_write_mode) != nullptr);
+  CHECK(buf.close() != nullptr);
+  CHECK(read_file().empty());
+
+  std::remove(g_test_file);
+  std::remove("rsl_test_filebuf_other.bin");
+}
+
+#if defined(RSL_PLATFORM_LINUX)
+// Windows only allows paths over MAX_PATH when long paths are enabled on the machine
+TEST_CASE("filebuf long paths")
+{
+  // "./" repeated makes a path of over 256 characters that still names a file in the working directory.
+  // the view stops before the trailing garbage, so the path has to be copied to be null terminated
+  std::string path;
+  while(path.size() < 300)
+  {
+    path += "./";
+  }
+  path += g_test_file;
+  const rsl::string_view view(path.data(), static_cast<count_t>(path.size()));
+  path += "garbage";
+
+  {
+    filebuf buf;
+    REQUIRE(buf.open(view, g_write_mode) != nullptr);
+    CHECK(buf.sputn("long", 4) == 4);
+  }
+  CHECK(read_file() == "long");
+
+  std::remove(g_test_file);
+}
+#endif
+
+TEST_CASE("filebuf unbuffered")
+{
+  filebuf buf;
+  REQUIRE(buf.open(g_test_file, g_write_mode) != nullptr);
+  buf.pubsetbuf(nullptr, 0);
+
+  // every write goes to the file right away
+  CHECK(buf.sputn("abc", 3) == 3);
+  CHECK(read_file() == "abc");
+  CHECK(buf.sputn("def", 3) == 3);
+  CHECK(read_file() == "abcdef");
+  CHECK(buf.close() != nullptr);
+
+  // a buffered file buffer only writes when it's synced
+  REQUIRE(buf.open(g_test_file, g_write_mode) != nullptr);
+  buf.pubsetbuf(nullptr, 64);
+  CHECK(buf.sputn("abc", 3) == 3);
+  CHECK(read_file().empty());
+  CHECK(buf.pubsync() == 0);
+  CHECK(read_file() == "abc");
+  CHECK(buf.close() != nullptr);
+
+  std::remove(g_test_file);
+}
+
+TEST_CASE("filebuf direct io with an unaligned buffer")
+{
+  constexpr rsl::io::openmode direct_write_mode = g_write_mode | rsl::io::openmode::direct;
+  constexpr rsl::io::openmode direct_read_mode  = g_read_mode | rsl::io::openmode::direct;
+
+  // 1 byte past a block boundary, which direct io can't read into or write from
+  alignas(4096) static char8 storage[3 * 4096];
+  char8* unaligned = storage + 1;
+
+  std::string content;
+  for(int i = 0; i < 3 * 4096 + 100; ++i)
+  {
+    content += static_cast<char>('a' + i % 26);
+  }
+
+  {
+    filebuf buf;
+    // not every file system supports direct io
+    if(buf.open(g_test_file, direct_write_mode) == nullptr)
+    {
+      return;
+    }
+    buf.pubsetbuf(unaligned, 4096);
+    CHECK(buf.sputn(content.data(), static_cast<rsl::streamsize>(content.size())) == static_cast<rsl::streamsize>(content.size()));
+  }
+  CHECK(read_file() == content);
+
+  // the buffer is checked when the file is opened as well, and a size that's not a whole block is rejected too
+  {
+    filebuf buf;
+    buf.pubsetbuf(storage, 1000);
+    REQUIRE(buf.open(g_test_file, direct_read_mode) != nullptr);
+
+    std::string read;
+    char8 chunk[700];
+    for(rsl::streamsize num_read = buf.sgetn(chunk, 700); num_read > 0; num_read = buf.sgetn(chunk, 700))
+    {
+      read.append(chunk, static_cast<size_t>(num_read));
+    }
+    CHECK(read == content);
+  }
+
+  std::remove(g_test_file);
+}
+
+// NOLINTEND
@@ -0,0 +1,233 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_flat_hash_map.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/hashtable/flat_hash_map.h"
+#include "rex_std/bonus/hashtable/flat_hash_set.h"
+
+#include "rex_std_test/test_allocator.h"
+#include "rex_std_test/test_object.h"
+
+TEST_CASE("flat_hash_map construction")
+{
+  using namespace rsl::test;
+
+  using hash_table = rsl::flat_hash_map<int, test_object, rsl::hash<int>, rsl::equal_to<int>, test_allocator>;
+
+  // flat_hash_map()
+  {
+    card32 num_allocs = test_allocator::all_num_allocs();
+    card32 num_frees  = test_allocator::all_num_frees();
+
+    const hash_table map;
+
+    CHECK(map.empty());
+    CHECK(map.size() == 0);
+    CHECK(map.capacity() == 0);
+    CHECK(map.load_factor() == 0.0f);
+    CHECK(map.begin() == map.end());
+    CHECK(map.find(0) == map.end());
+
+    // an empty map doesn't allocate
+    CHECK(test_allocator::all_num_allocs() == num_allocs);
+    CHECK(test_allocator::all_num_frees() == num_frees);
+  }
+  // flat_hash_map(Size capacity)
+  {
+    card32 num_allocs = test_allocator::all_num_allocs();
+    card32 num_frees  = test_allocator::all_num_frees();
+
+    const hash_table map(20_size);
+
+    CHECK(map.size() == 0);
+    CHECK(map.capacity() == 31);
+    CHECK(map.load_factor() == 0.0f);
+
+    CHECK(test_allocator::all_num_allocs() == num_allocs + 1);
+    CHECK(test_allocator::all_num_frees() == num_frees);
+  }
+  // flat_hash_map(initializer_list)
+  {
+    const hash_table map = {{0, 0}, {1, 1}, {1, 2}};
+
+    CHECK(map.size() == 2);
+    CHECK(map.capacity() > 0);
+    CHECK(map.load_factor() > 0.0f);
+    CHECK(map.at(1) == 1);
+  }
+  // flat_hash_map(const flat_hash_map&)
+  {
+    const hash_table map = {{0, 0}, {1, 1}, {2, 2}};
+    const hash_table copy(map);
+
+    CHECK(copy.size() == 3);
+    CHECK(copy == map);
+  }
+  // flat_hash_map(flat_hash_map&&)
+  {
+    hash_table map = {{0, 0}, {1, 1}, {2, 2}};
+    const hash_table moved(rsl::move(map));
+
+    CHECK(moved.size() == 3);
+    CHECK(map.empty()); // NOLINT(bugprone-use-after-move, hicpp-invalid-access-moved)
+    CHECK(map.find(0) == map.end()); // NOLINT(bugprone-use-after-move, hicpp-invalid-access-moved)
+  }
+}
+
+TEST_CASE("flat_hash_map element access")
+{
+  using namespace rsl::test;
+  using hash_table = rsl::flat_hash_map<int, test_object, rsl::hash<int>, rsl::equal_to<int>, test_allocator>;
+
+  hash_table map = {{0, 10}, {1, 11}};
+
+  CHECK(map[0] == 10);
+  CHECK(map[1] == 11);
+  CHECK(map[2] == 0);
+
+  card32 num_allocs = map.get_allocator().num_allocs();
+  card32 num_frees  = map.get_allocator().num_frees();
+
+  CHECK(map.at(0) == 10);
+  CHECK(map.at(1) == 11);
+
+  CHECK(map.count(0) == 1);
+  CHECK(map.count(1) == 1);
+  CHECK(map.count(2) == 1);
+  CHECK(map.count(3) == 0);
+
+  CHECK(map.find(0) != map.cend());
+  CHECK(map.find(1) != map.cend());
+  CHECK(map.find(2) != map.cend());
+  CHECK(map.find(3) == map.cend());
+
+  CHECK(map.contains(2));
+  CHECK(!map.contains(3));
+
+  // lookups never allocate
+  CHECK(map.get_allocator().num_allocs() == num_allocs);
+  CHECK(map.get_allocator().num_frees() == num_frees);
+}
+
+TEST_CASE("flat_hash_map insert and erase")
+{
+  using namespace rsl::test;
+  using hash_table = rsl::flat_hash_map<int, test_object, rsl::hash<int>, rsl::equal_to<int>, test_allocator>;
+
+  hash_table map;
+
+  auto res = map.emplace(1, 1);
+  CHECK(res.emplace_successful);
+  CHECK(res.inserted_element->key == 1);
+  res = map.emplace(1, 2);
+  CHECK(!res.emplace_successful);
+  CHECK(res.inserted_element->value == 1);
+
+  res = map.try_emplace(2, 2);
+  CHECK(res.emplace_successful);
+  res = map.insert_or_assign(2, test_object(3));
+  CHECK(!res.emplace_successful);
+  CHECK(map.at(2) == 3);
+
+  CHECK(map.erase(1) == 1);
+  CHECK(map.erase(1) == 0);
+  CHECK(map.size() == 1);
+
+  // grow well past the initial capacity
+  for(int i = 0; i < 1000; ++i)
+  {
+    map[i] = i;
+  }
+  CHECK(map.size() == 1000);
+  CHECK(map.load_factor() <= map.max_load_factor());
+
+  int count = 0;
+  for(const auto& kv : map)
+  {
+    CHECK(kv.key == kv.value);
+    ++count;
+  }
+  CHECK(count == 1000);
+
+  // erase every even key through iterators
+  for(auto it = map.begin(); it != map.end();)
+  {
+    it = it->key % 2 == 0 ? map.erase(it) : ++it;
+  }
+  CHECK(map.size() == 500);
+  CHECK(!map.contains(0));
+  CHECK(map.contains(1));
+
+  CHECK(rsl::erase_if(map, [](const auto& kv) { return kv.key < 100; }) == 50);
+  CHECK(map.size() == 450);
+
+  map.clear();
+  CHECK(map.empty());
+  CHECK(map.begin() == map.end());
+}
+
+TEST_CASE("flat_hash_map erase churn")
+{
+  using namespace rsl::test;
+  using hash_table = rsl::flat_hash_map<int, test_object, rsl::hash<int>, rsl::equal_to<int>, test_allocator>;
+
+  test_object::reset();
+
+  {
+    hash_table map;
+    for(int i = 0; i < 1000; ++i)
+    {
+      map[i] = i;
+    }
+    const card32 capacity = map.capacity();
+
+    // keep the size constant while replacing all keys many times over.
+    // deleted slots get reused or cleaned up, so the table doesn't keep growing.
+    for(int round = 0; round < 100; ++round)
+    {
+      for(int i = 0; i < 1000; ++i)
+      {
+        CHECK(map.erase(round * 1000 + i) == 1);
+        map[(round + 1) * 1000 + i] = i;
+      }
+    }
+
+    CHECK(map.size() == 1000);
+    CHECK(map.capacity() == capacity);
+    CHECK(map.at(100500) == 500);
+  }
+
+  // every element got destroyed
+  CHECK(test_object::is_clear());
+}
+
+TEST_CASE("flat_hash_set")
+{
+  using namespace rsl::test;
+  using hash_set = rsl::flat_hash_set<int, rsl::hash<int>, rsl::equal_to<int>, test_allocator>;
+
+  hash_set set = {1, 2, 3, 3};
+
+  CHECK(set.size() == 3);
+  CHECK(set.contains(1));
+  CHECK(set.contains(3));
+  CHECK(!set.contains(4));
+
+  CHECK(set.insert(4).emplace_successful);
+  CHECK(!set.insert(4).emplace_successful);
+  CHECK(set.erase(1) == 1);
+  CHECK(set.size() == 3);
+
+  const hash_set copy(set);
+  CHECK(copy == set);
+}
@@ -0,0 +1,253 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_future.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+// NOLINTBEGIN
+
+#include "rex_std/atomic.h"
+#include "rex_std/bonus/thread/thread_pool.h"
+#include "rex_std/future.h"
+#include "rex_std/string.h"
+#include "rex_std/vector.h"
+
+#include <thread>
+
+namespace
+{
+  // counts the allocations still alive, to check the shared state is freed with the allocator it came from
+  rsl::atomic<card32> g_live_allocations(0);
+
+  class counting_allocator
+  {
+  public:
+    void* allocate(rsl::size_t count)
+    {
+      g_live_allocations.fetch_add(1);
+      return rsl::allocator().allocate(count);
+    }
+    void deallocate(void* ptr, rsl::size_t count)
+    {
+      g_live_allocations.fetch_sub(1);
+      rsl::allocator().deallocate(ptr, count);
+    }
+  };
+} // namespace
+
+TEST_CASE("promise and future")
+{
+  rsl::promise<card32> promise;
+  rsl::future<card32> future = promise.get_future();
+  CHECK(future.valid());
+  CHECK(!future.is_ready());
+  CHECK(future.wait_for(rsl::chrono::milliseconds(1)) == rsl::future_status::timeout);
+
+  std::thread producer([&]() { promise.set_value(5); });
+  CHECK(future.get() == 5);
+  CHECK(!future.valid());
+  producer.join();
+
+  rsl::promise<void> void_promise;
+  rsl::future<void> void_future = void_promise.get_future();
+  void_promise.set_value();
+  CHECK(void_future.wait_for(rsl::chrono::milliseconds(1)) == rsl::future_status::ready);
+  void_future.get();
+
+  // a promise going away without a value still makes its future ready
+  rsl::future<card32> broken;
+  {
+    rsl::promise<card32> abandoned;
+    broken = abandoned.get_future();
+  }
+  CHECK(broken.is_ready());
+}
+
+TEST_CASE("promise with allocator")
+{
+  {
+    rsl::promise<rsl::string> promise(rsl::allocator_arg, counting_allocator());
+    CHECK(g_live_allocations.load() == 1);
+    rsl::future<rsl::string> future = promise.get_future();
+    promise.set_value(rsl::string("value"));
+
+    // the state lives on as long as the future does
+    rsl::promise<rsl::string> moved = rsl::move(promise);
+    {
+      rsl::promise<rsl::string> destroyed = rsl::move(moved);
+    }
+    CHECK(g_live_allocations.load() == 1);
+    CHECK(future.get() == "value");
+  }
+  CHECK(g_live_allocations.load() == 0);
+  CHECK(rsl::uses_allocator_v<rsl::promise<card32>, counting_allocator>);
+}
+
+TEST_CASE("promise of a reference")
+{
+  rsl::string value("value");
+
+  rsl::promise<rsl::string&> promise;
+  rsl::future<rsl::string&> future = promise.get_future();
+  promise.set_value(value);
+
+  // the future refers to the value, nothing gets copied
+  rsl::string& res = future.get();
+  CHECK(&res == &value);
+
+  rsl::promise<const card32&> shared_promise;
+  rsl::shared_future<const card32&> shared = shared_promise.get_future().share();
+  const card32 number                      = 5;
+  shared_promise.set_value(number);
+  CHECK(&shared.get() == &number);
+}
+
+TEST_CASE("shared future")
+{
+  rsl::promise<card32> promise;
+  rsl::shared_future<card32> shared = promise.get_future().share();
+  rsl::shared_future<card32> copy   = shared;
+
+  rsl::atomic<card32> sum(0);
+  rsl::vector<std::thread> threads;
+  for(card32 i = 0; i < 4; ++i)
+  {
+    threads.emplace_back([&sum, shared]() { sum.fetch_add(shared.get()); });
+  }
+  promise.set_value(10);
+  for(std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  CHECK(sum.load() == 40);
+  CHECK(copy.get() == 10);
+  CHECK(shared.valid());
+}
+
+TEST_CASE("future then")
+{
+  // the continuation runs on the thread setting the value
+  rsl::promise<card32> promise;
+  rsl::future<card32> doubled = promise.get_future().then([](rsl::future<card32> value) { return value.get() * 2; });
+  CHECK(!doubled.is_ready());
+  promise.set_value(21);
+  CHECK(doubled.is_ready());
+  CHECK(doubled.get() == 42);
+
+  // a continuation on a ready future runs immediately
+  rsl::promise<rsl::string> ready;
+  ready.set_value(rsl::string("abc"));
+  rsl::future<card32> length = ready.get_future().then([](rsl::future<rsl::string> value) { return static_cast<card32>(value.get().length()); });
+  CHECK(length.is_ready());
+  CHECK(length.get() == 3);
+
+  rsl::promise<card32> shared_promise;
+  rsl::shared_future<card32> shared = shared_promise.get_future();
+  rsl::future<card32> plus_one      = shared.then([](rsl::shared_future<card32> value) { return value.get() + 1; });
+  shared_promise.set_value(1);
+  CHECK(plus_one.get() == 2);
+  CHECK(shared.get() == 1);
+
+  // continuations on an executor run on a worker of the pool
+  rsl::thread_pool pool(2);
+  rsl::future<card32> on_pool = pool.submit([]() { return 3; }).then(pool, [](rsl::future<card32> value) { return value.get() * 3; });
+  CHECK(on_pool.get() == 9);
+}
+
+TEST_CASE("when all")
+{
+  rsl::vector<rsl::promise<card32>> promises(rsl::Size(10));
+  rsl::vector<rsl::future<card32>> futures;
+  for(rsl::promise<card32>& promise : promises)
+  {
+    futures.push_back(promise.get_future());
+  }
+
+  rsl::future<rsl::vector<rsl::future<card32>>> all = rsl::when_all(futures.begin(), futures.end());
+  for(card32 i = 0; i < 9; ++i)
+  {
+    promises[i].set_value(i);
+  }
+  CHECK(!all.is_ready());
+  promises[9].set_value(9);
+  CHECK(all.is_ready());
+
+  card32 sum = 0;
+  for(rsl::future<card32>& future : all.get())
+  {
+    sum += future.get();
+  }
+  CHECK(sum == 45);
+
+  rsl::promise<card32> first;
+  rsl::promise<rsl::string> second;
+  rsl::future<rsl::tuple<rsl::future<card32>, rsl::future<rsl::string>>> both = rsl::when_all(first.get_future(), second.get_future());
+  second.set_value(rsl::string("second"));
+  CHECK(!both.is_ready());
+  first.set_value(1);
+  rsl::tuple<rsl::future<card32>, rsl::future<rsl::string>> results = both.get();
+  CHECK(rsl::get<0>(results).get() == 1);
+  CHECK(rsl::get<1>(results).get() == "second");
+
+  CHECK(rsl::when_all().is_ready());
+}
+
+TEST_CASE("when any")
+{
+  rsl::vector<rsl::promise<card32>> promises(rsl::Size(10));
+  rsl::vector<rsl::future<card32>> futures;
+  for(rsl::promise<card32>& promise : promises)
+  {
+    futures.push_back(promise.get_future());
+  }
+
+  rsl::future<rsl::when_any_result<rsl::vector<rsl::future<card32>>>> any = rsl::when_any(futures.begin(), futures.end());
+  CHECK(!any.is_ready());
+  promises[3].set_value(3);
+  CHECK(any.is_ready());
+
+  rsl::when_any_result<rsl::vector<rsl::future<card32>>> result = any.get();
+  CHECK(result.index == 3);
+  CHECK(result.futures[3].get() == 3);
+
+  rsl::promise<card32> never;
+  rsl::promise<card32> ready;
+  ready.set_value(2);
+  rsl::future<rsl::when_any_result<rsl::tuple<rsl::future<card32>, rsl::future<card32>>>> either = rsl::when_any(never.get_future(), ready.get_future());
+  CHECK(either.is_ready());
+  CHECK(either.get().index == 1);
+}
+
+TEST_CASE("future fan out on a thread pool")
+{
+  rsl::thread_pool pool(4);
+  rsl::vector<rsl::future<card32>> futures;
+  for(card32 i = 0; i < 1000; ++i)
+  {
+    futures.push_back(pool.submit([i]() { return i; }).then([](rsl::future<card32> value) { return value.get() + 1; }));
+  }
+
+  rsl::future<card32> total = rsl::when_all(futures.begin(), futures.end())
+                                  .then(
+                                      [](rsl::future<rsl::vector<rsl::future<card32>>> all)
+                                      {
+                                        card32 sum = 0;
+                                        for(rsl::future<card32>& future : all.get())
+                                        {
+                                          sum += future.get();
+                                        }
+                                        return sum;
+                                      });
+  CHECK(total.get() == 1000 * 1001 / 2);
+}
+
+// NOLINTEND
@@ -10,10 +10,134 @@
 //
 // ============================================
 
-namespace rsl::test
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/functional/fast_hash.h"
+#include "rex_std/bonus/functional/hash_lower.h"
+#include "rex_std/bonus/functional/wyhash.h"
+#include "rex_std/bonus/hashtable/hash_map.h"
+#include "rex_std/bit.h"
+#include "rex_std/string.h"
+#include "rex_std/string_view.h"
+
+// NOLINTBEGIN
+
+namespace
+{
+  // the test vectors of the reference implementation, the seed is the index of the string
+  constexpr const char8* g_wyhash_inputs[] = {"", "a", "abc", "message digest", "abcdefghijklmnopqrstuvwxyz", "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", "12345678901234567890123456789012345678901234567890123456789012345678901234567890"};
+  constexpr uint64 g_wyhash_outputs[] = {0x93228a4de0eec5a2ull, 0xc5bac3db178713c4ull, 0xa97f2f7b1d9b3314ull, 0x786d1f1df3801df4ull, 0xdca5a8138ad37c87ull, 0xb9e734f117cfaf70ull, 0x6cc5eab49a92d617ull};
+} // namespace
+
+// the hash has to work at compile time
+static_assert(rsl::wyhash::compute("", 0, 0) == 0x93228a4de0eec5a2ull);
+static_assert(rsl::wyhash::compute("message digest", 14, 3) == 0x786d1f1df3801df4ull);
+static_assert(rsl::wyhash::compute_as_lower("MeSSage DIGEST", 14, 3) == 0x786d1f1df3801df4ull);
+static_assert(rsl::hash_mix(0) == 0);
+static_assert(rsl::fast_hash<int>{}(1) != rsl::fast_hash<int>{}(2));
+
+TEST_CASE("wyhash test vectors")
+{
+  for(card32 i = 0; i < 7; ++i)
+  {
+    const char8* input = g_wyhash_inputs[i];
+    CHECK(rsl::wyhash::compute(input, rsl::strlen(input), i) == g_wyhash_outputs[i]);
+    CHECK(rsl::wyhash::internal::compute_bytewise(input, rsl::strlen(input), i) == g_wyhash_outputs[i]);
+  }
+}
+
+TEST_CASE("wyhash runtime matches compile time")
 {
-  inline namespace v1
+  char8 buffer[512];
+  for(card32 i = 0; i < 512; ++i)
   {
+    buffer[i] = static_cast<char8>(i * 31 + (i >> 3));
+  }
 
+  // every length up to a few times the 48 byte block, from unaligned addresses
+  for(card32 len = 0; len < 300; ++len)
+  {
+    for(card32 offset = 0; offset < 8; ++offset)
+    {
+      CHECK(rsl::wyhash::compute(buffer + offset, len, len) == rsl::wyhash::internal::compute_bytewise(buffer + offset, len, len));
+    }
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("wyhash as lower")
+{
+  const rsl::string_view lower = "the quick brown fox jumps over the lazy dog, 0123456789 times";
+  const rsl::string_view mixed = "The Quick BROWN fox Jumps OVER the lazy DOG, 0123456789 Times";
+
+  for(card32 len = 0; len <= lower.length(); ++len)
+  {
+    CHECK(rsl::wyhash::compute_as_lower(mixed.data(), len) == rsl::wyhash::compute(lower.data(), len));
+  }
+
+  CHECK(rsl::hash_lower<rsl::string_view>{}(mixed) == rsl::hash<rsl::string_view>{}(lower));
+}
+
+TEST_CASE("wyhash of wide strings")
+{
+  // wide strings are hashed as their bytes, this is what rsl::hash of a wide string uses with RSL_ENABLE_64BIT_HASH
+  const char16 wide[] = u"message digest";
+  char8 bytes[sizeof(wide)];
+  rsl::memcpy(bytes, wide, sizeof(wide));
+
+  CHECK(rsl::wyhash::compute(wide, 28, 3) == rsl::wyhash::compute(bytes, 28, 3));
+  CHECK(rsl::wyhash::compute(wide, 28, 3) == rsl::wyhash::internal::compute_bytewise(bytes, 28, 3));
+  CHECK(rsl::wyhash::compute(wide, 28, 3) != rsl::wyhash::compute("message digest", 14, 3));
+}
+
+TEST_CASE("hash mix")
+{
+  // flipping a single input bit flips about half of the output bits
+  card32 total_flipped_bits = 0;
+  card32 num_samples        = 0;
+  for(uint64 x = 0; x < 100; ++x)
+  {
+    const uint64 input = x * 0x9E3779B97F4A7C15ull;
+    for(card32 bit = 0; bit < 64; ++bit)
+    {
+      total_flipped_bits += rsl::popcount(rsl::hash_mix(input) ^ rsl::hash_mix(input ^ (1ull << bit)));
+      ++num_samples;
+    }
+  }
+
+  const float32 avg_flipped_bits = static_cast<float32>(total_flipped_bits) / static_cast<float32>(num_samples);
+  CHECK(avg_flipped_bits > 31.0f);
+  CHECK(avg_flipped_bits < 33.0f);
+
+  // sequential keys end up in different buckets of a power of 2 table
+  bool buckets[1024] = {};
+  card32 num_used_buckets = 0;
+  for(int32 i = 0; i < 1024; ++i)
+  {
+    const rsl::hash_result bucket = rsl::fast_hash<int32>{}(i * 1024) & 1023;
+    num_used_buckets += buckets[bucket] ? 0 : 1;
+    buckets[bucket] = true;
+  }
+  // with a random hash, about 1 - 1/e of the buckets get used
+  CHECK(num_used_buckets > 600);
+}
+
+TEST_CASE("fast hash")
+{
+  const rsl::string str    = "a string long enough to not fit in the small string buffer";
+  const rsl::string_view sv = str;
+
+  CHECK(rsl::fast_hash<rsl::string>{}(str) == rsl::fast_hash<rsl::string_view>{}(sv));
+  CHECK(rsl::fast_hash<float32>{}(0.0f) == rsl::fast_hash<float32>{}(-0.0f));
+  CHECK(rsl::fast_hash<float64>{}(1.5) != rsl::fast_hash<float64>{}(1.0));
+
+  // it can be used as the hash of a hash container, including heterogeneous lookups
+  rsl::hash_map<rsl::string, int, rsl::fast_hash<rsl::string>> map;
+  map.emplace(rsl::string("hello"), 1);
+  map.emplace(rsl::string("world"), 2);
+
+  CHECK(map.find(rsl::string_view("hello")) != map.end());
+  CHECK(map.find(rsl::string_view("world"))->value == 2);
+  CHECK(map.find(rsl::string_view("other")) == map.end());
+}
+
+// NOLINTEND
@@ -0,0 +1,183 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_intrusive_concurrent.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+// NOLINTBEGIN
+
+#include "rex_std/atomic.h"
+#include "rex_std/bonus/intrusive_mpsc_queue.h"
+#include "rex_std/bonus/intrusive_stack.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+  struct job : rsl::intrusive_mpsc_node, rsl::intrusive_stack_node
+  {
+    card64 value = 0;
+  };
+} // namespace
+
+TEST_CASE("intrusive mpsc queue")
+{
+  rsl::intrusive_mpsc_queue<job> queue;
+  CHECK(queue.empty_approx());
+  CHECK(queue.try_pop() == nullptr);
+
+  job a;
+  job b;
+  queue.push(&a);
+  queue.push(&b);
+  CHECK(!queue.empty_approx());
+  CHECK(queue.try_pop() == &a);
+  CHECK(queue.try_pop() == &b);
+  CHECK(queue.try_pop() == nullptr);
+  CHECK(queue.empty_approx());
+
+  // a popped node can be pushed again
+  queue.push(&a);
+  CHECK(queue.try_pop() == &a);
+  CHECK(queue.try_pop() == nullptr);
+
+  // every producer pushes its own range of values, the consumer checks they arrive in order per producer
+  constexpr card32 num_producers = 8;
+  constexpr card64 per_producer  = 20000;
+  std::vector<std::vector<job>> jobs(num_producers, std::vector<job>(per_producer));
+  std::vector<std::thread> producers;
+  for(card32 p = 0; p < num_producers; ++p)
+  {
+    producers.emplace_back(
+        [&, p]()
+        {
+          for(card64 i = 0; i < per_producer; ++i)
+          {
+            jobs[p][i].value = p * per_producer + i;
+            queue.push(&jobs[p][i]);
+          }
+        });
+  }
+
+  const card64 total = num_producers * per_producer;
+  card64 sum         = 0;
+  bool in_order      = true;
+  std::vector<card64> last(num_producers, -1);
+  for(card64 num_popped = 0; num_popped < total;)
+  {
+    job* popped = queue.try_pop();
+    if(popped == nullptr)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    const card64 producer = popped->value / per_producer;
+    in_order              = in_order && popped->value % per_producer > last[producer];
+    last[producer]        = popped->value % per_producer;
+    sum += popped->value;
+    ++num_popped;
+  }
+  for(std::thread& producer : producers)
+  {
+    producer.join();
+  }
+
+  CHECK(in_order);
+  CHECK(sum == total * (total - 1) / 2);
+  CHECK(queue.try_pop() == nullptr);
+}
+
+TEST_CASE("intrusive stack")
+{
+  rsl::intrusive_stack<job> stack;
+  CHECK(stack.empty_approx());
+  CHECK(stack.try_pop() == nullptr);
+
+  job a;
+  job b;
+  stack.push(&a);
+  stack.push(&b);
+  CHECK(stack.try_pop() == &b);
+  CHECK(stack.try_pop() == &a);
+  CHECK(stack.empty_approx());
+
+  stack.push(&a);
+  stack.push(&b);
+  job* all = stack.pop_all();
+  CHECK(all == &b);
+  CHECK(rsl::intrusive_stack<job>::next(all) == &a);
+  CHECK(rsl::intrusive_stack<job>::next(&a) == nullptr);
+  CHECK(stack.pop_all() == nullptr);
+
+  // threads keep popping a node and pushing it back, which is exactly where ABA would strike.
+  // a node that's owned by 2 threads at once or a node that got lost would show up in the counts
+  constexpr card32 num_threads = 8;
+  constexpr card32 num_nodes   = 64;
+  constexpr card32 num_rounds  = 50000;
+  std::vector<job> nodes(num_nodes);
+  std::vector<rsl::atomic<card32>> owners(num_nodes);
+  for(job& node : nodes)
+  {
+    stack.push(&node);
+  }
+
+  rsl::atomic<card64> num_ops(0);
+  rsl::atomic<card32> num_shared(0);
+  std::vector<std::thread> threads;
+  for(card32 t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back(
+        [&]()
+        {
+          for(card32 i = 0; i < num_rounds; ++i)
+          {
+            job* node = stack.try_pop();
+            if(node == nullptr)
+            {
+              continue;
+            }
+
+            const card64 index = node - nodes.data();
+            if(owners[index].exchange(1) != 0)
+            {
+              num_shared.fetch_add(1);
+            }
+            ++node->value;
+            owners[index].store(0);
+            stack.push(node);
+            num_ops.fetch_add(1);
+          }
+        });
+  }
+  for(std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  card32 num_left = 0;
+  while(stack.try_pop() != nullptr)
+  {
+    ++num_left;
+  }
+  card64 total = 0;
+  for(const job& node : nodes)
+  {
+    total += node.value;
+  }
+
+  CHECK(num_shared.load() == 0);
+  CHECK(num_left == num_nodes);
+  CHECK(total == num_ops.load());
+}
+
+// NOLINTEND
@@ -0,0 +1,279 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_math.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bit.h"
+#include "rex_std/limits.h"
+#include "rex_std/math.h"
+#include "rex_std/vector.h"
+
+namespace
+{
+  // how many representable values lie between lhs and rhs
+  uint64 ulp_distance(float64 lhs, float64 rhs)
+  {
+    const auto ordered = [](float64 value)
+    {
+      const int64 bits = rsl::bit_cast<int64>(value);
+      return bits < 0 ? rsl::numeric_limits<int64>::min() - bits : bits;
+    };
+    const int64 lhs_bits = ordered(lhs);
+    const int64 rhs_bits = ordered(rhs);
+    return lhs_bits < rhs_bits ? static_cast<uint64>(rhs_bits - lhs_bits) : static_cast<uint64>(lhs_bits - rhs_bits);
+  }
+  uint64 ulp_distance(float32 lhs, float32 rhs)
+  {
+    const auto ordered = [](float32 value)
+    {
+      const int32 bits = rsl::bit_cast<int32>(value);
+      return bits < 0 ? static_cast<int64>(rsl::numeric_limits<int32>::min()) - bits : static_cast<int64>(bits);
+    };
+    const int64 lhs_bits = ordered(lhs);
+    const int64 rhs_bits = ordered(rhs);
+    return lhs_bits < rhs_bits ? static_cast<uint64>(rhs_bits - lhs_bits) : static_cast<uint64>(lhs_bits - rhs_bits);
+  }
+
+  template <typename T>
+  bool is_nan(T value)
+  {
+    return value != value; // NOLINT(misc-redundant-expression)
+  }
+
+  // a simple lcg so the tests are reproducible
+  uint64 next_random(uint64& state)
+  {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state;
+  }
+  // a random value in [min, max)
+  float64 random_in(uint64& state, float64 min, float64 max)
+  {
+    return min + (max - min) * static_cast<float64>(next_random(state) >> 11) / 9007199254740992.0;
+  }
+} // namespace
+
+TEST_CASE("math constexpr")
+{
+  // these go through the constexpr implementations
+  constexpr float64 sqrt2 = rsl::sqrt(2.0);
+  constexpr float64 exp1  = rsl::exp(1.0);
+  constexpr float64 log10 = rsl::log(10.0);
+  constexpr float64 sin1  = rsl::sin(1.0);
+  constexpr float64 cos1  = rsl::cos(1.0);
+  constexpr int32 pow3    = rsl::pow(3, 4);
+
+  static_assert(pow3 == 81);
+  CHECK(ulp_distance(sqrt2, 1.4142135623730951) <= 1);
+  CHECK(ulp_distance(exp1, 2.718281828459045) <= 1);
+  CHECK(ulp_distance(log10, 2.302585092994046) <= 1);
+  CHECK(rsl::abs(sin1 - 0.8414709848078965) < 1e-12);
+  CHECK(rsl::abs(cos1 - 0.5403023058681398) < 1e-12);
+
+  constexpr float64 exp_underflow = rsl::exp(-800.0);
+  constexpr float64 log_zero      = rsl::log(0.0);
+  CHECK(exp_underflow == 0.0);
+  CHECK(log_zero == -rsl::numeric_limits<float64>::infinity());
+}
+
+TEST_CASE("math sqrt")
+{
+  // sqrtsd is correctly rounded
+  CHECK(rsl::sqrt(2.0) == 1.4142135623730951);
+  CHECK(rsl::sqrt(2.0f) == 1.41421354f);
+  CHECK(rsl::sqrt(16.0) == 4.0);
+  CHECK(rsl::sqrt(0.0) == 0.0);
+  CHECK(rsl::sqrt(1e-320) > 0.0);
+  CHECK(rsl::sqrt(rsl::numeric_limits<float64>::infinity()) == rsl::numeric_limits<float64>::infinity());
+  CHECK(is_nan(rsl::sqrt(-1.0)));
+
+  uint64 state = 1;
+  for(card32 i = 0; i < 10'000; ++i)
+  {
+    const float64 x    = random_in(state, 0.0, 1e6);
+    const float64 root = rsl::sqrt(x);
+    // the exact root lies within half an ulp, so squaring it lands within an ulp of x
+    REQUIRE(ulp_distance(root * root, x) <= 1);
+  }
+}
+
+TEST_CASE("math sin cos")
+{
+  struct expected
+  {
+    float64 x;
+    float64 sin;
+    float64 cos;
+  };
+  // correctly rounded results
+  const expected values[] = // NOLINT(modernize-avoid-c-arrays)
+      {
+          {0.5, 0.479425538604203, 0.8775825618903728},
+          {1.0, 0.8414709848078965, 0.5403023058681398},
+          {2.0, 0.9092974268256817, -0.4161468365471424},
+          {3.0, 0.1411200080598672, -0.9899924966004454},
+          {10.0, -0.5440211108893698, -0.8390715290764524},
+          {100.0, -0.5063656411097588, 0.8623188722876839},
+          {-7.25, -0.8230808790115055, 0.5679241732886948},
+          {1000000.0, -0.34999350217129294, 0.9367521275331447},
+      };
+  for(const expected& value : values)
+  {
+    CHECK(ulp_distance(rsl::sin(value.x), value.sin) <= 1);
+    CHECK(ulp_distance(rsl::cos(value.x), value.cos) <= 1);
+    CHECK(ulp_distance(rsl::sin(static_cast<float32>(value.x)), static_cast<float32>(value.sin)) <= 1);
+    CHECK(ulp_distance(rsl::cos(static_cast<float32>(value.x)), static_cast<float32>(value.cos)) <= 1);
+  }
+
+  // the sign of zero is kept
+  CHECK(rsl::bit_cast<uint64>(rsl::sin(-0.0)) == rsl::bit_cast<uint64>(-0.0));
+  CHECK(rsl::bit_cast<uint32>(rsl::sin(-0.0f)) == rsl::bit_cast<uint32>(-0.0f));
+  CHECK(rsl::cos(0.0) == 1.0);
+  CHECK(is_nan(rsl::sin(rsl::numeric_limits<float64>::infinity())));
+  CHECK(is_nan(rsl::cos(rsl::numeric_limits<float32>::infinity())));
+  CHECK(is_nan(rsl::sin(rsl::numeric_limits<float64>::quiet_nan())));
+
+  // too big for the fast range reduction
+  CHECK(rsl::abs(rsl::sin(1e22) - -0.8522008497671888) < 1e-15);
+
+  uint64 state = 1;
+  for(card32 i = 0; i < 10'000; ++i)
+  {
+    const float64 x = random_in(state, -1e4, 1e4);
+    const float64 s = rsl::sin(x);
+    const float64 c = rsl::cos(x);
+    REQUIRE(rsl::abs(s * s + c * c - 1.0) < 4 * rsl::numeric_limits<float64>::epsilon());
+
+    // float32 only loses the final rounding
+    const float32 xf = static_cast<float32>(x);
+    REQUIRE(ulp_distance(rsl::sin(xf), static_cast<float32>(rsl::sin(static_cast<float64>(xf)))) <= 1);
+    REQUIRE(ulp_distance(rsl::cos(xf), static_cast<float32>(rsl::cos(static_cast<float64>(xf)))) <= 1);
+  }
+
+  // right next to multiples of pi/2, where the range reduction cancels the most bits
+  for(card32 n = 1; n < 1000; ++n)
+  {
+    const float64 x = n * rsl::half_pi_v<float64>;
+    REQUIRE(rsl::abs(rsl::sin(x) - (n % 2 == 0 ? 0.0 : (n % 4 == 1 ? 1.0 : -1.0))) < 1e-12);
+  }
+}
+
+TEST_CASE("math exp log")
+{
+  CHECK(ulp_distance(rsl::exp(0.5), 1.6487212707001282) <= 1);
+  CHECK(ulp_distance(rsl::exp(1.0), 2.718281828459045) <= 1);
+  CHECK(ulp_distance(rsl::exp(-1.0), 0.36787944117144233) <= 1);
+  CHECK(ulp_distance(rsl::exp(10.0), 22026.465794806718) <= 1);
+  CHECK(ulp_distance(rsl::exp(-10.0), 4.5399929762484854e-05) <= 1);
+  CHECK(ulp_distance(rsl::exp(100.0), 2.6881171418161356e+43) <= 1);
+  CHECK(ulp_distance(rsl::exp(700.0), 1.0142320547350045e+304) <= 1);
+  CHECK(ulp_distance(rsl::exp(-700.0), 9.85967654375977e-305) <= 1);
+  CHECK(ulp_distance(rsl::exp(1.0f), 2.71828183f) <= 1);
+  CHECK(ulp_distance(rsl::exp(-10.0f), 4.53999298e-05f) <= 1);
+
+  CHECK(rsl::exp(0.0) == 1.0);
+  CHECK(rsl::exp(1000.0) == rsl::numeric_limits<float64>::infinity());
+  CHECK(rsl::exp(-1000.0) == 0.0);
+  CHECK(rsl::exp(100.0f) == rsl::numeric_limits<float32>::infinity());
+  CHECK(rsl::exp(-rsl::numeric_limits<float64>::infinity()) == 0.0);
+  // results in the subnormal range
+  CHECK(rsl::exp(-745.0) == rsl::numeric_limits<float64>::denorm_min());
+  CHECK(rsl::exp(-103.5f) > 0.0f);
+
+  CHECK(ulp_distance(rsl::log(0.5), -0.6931471805599453) <= 1);
+  CHECK(ulp_distance(rsl::log(2.0), 0.6931471805599453) <= 1);
+  CHECK(ulp_distance(rsl::log(10.0), 2.302585092994046) <= 1);
+  CHECK(ulp_distance(rsl::log(1e-300), -690.7755278982137) <= 1);
+  CHECK(ulp_distance(rsl::log(1e300), 690.7755278982137) <= 1);
+  CHECK(ulp_distance(rsl::log(123456.789), 11.723646487185881) <= 1);
+  CHECK(ulp_distance(rsl::log(rsl::numeric_limits<float64>::denorm_min()), -744.4400719213812) <= 1);
+  CHECK(ulp_distance(rsl::log(10.0f), 2.30258512f) <= 1);
+
+  CHECK(rsl::log(1.0) == 0.0);
+  CHECK(rsl::log(0.0) == -rsl::numeric_limits<float64>::infinity());
+  CHECK(rsl::log(rsl::numeric_limits<float64>::infinity()) == rsl::numeric_limits<float64>::infinity());
+  CHECK(is_nan(rsl::log(-1.0)));
+  CHECK(is_nan(rsl::log(-1.0f)));
+
+  uint64 state = 1;
+  for(card32 i = 0; i < 10'000; ++i)
+  {
+    const float64 x = random_in(state, -700.0, 700.0);
+    REQUIRE(rsl::abs(rsl::log(rsl::exp(x)) - x) <= 2 * rsl::numeric_limits<float64>::epsilon() * (rsl::abs(x) + 1.0));
+  }
+}
+
+TEST_CASE("math pow")
+{
+  CHECK(rsl::pow(2, 10) == 1024);
+  CHECK(rsl::pow(3, 0) == 1);
+  CHECK(rsl::pow(-2, 3) == -8);
+  CHECK(rsl::pow(10ull, 19) == 10'000'000'000'000'000'000ull);
+  CHECK(rsl::pow(2.0, 1023) == 8.98846567431158e307);
+  CHECK(rsl::pow(0.5f, 3) == 0.125f);
+}
+
+TEST_CASE("math batch")
+{
+  uint64 state = 1;
+  rsl::vector<float32> values32;
+  rsl::vector<float64> values64;
+  for(card32 i = 0; i < 1000; ++i)
+  {
+    const float64 value = random_in(state, -1e4, 1e4);
+    values32.push_back(static_cast<float32>(value));
+    values64.push_back(value);
+  }
+  // values the vectorized pass can't handle
+  const float64 special[] = {0.0, -0.0, 1e30, -1e30, 1e300, rsl::numeric_limits<float64>::infinity(), rsl::numeric_limits<float64>::quiet_nan(), 100.0, -120.0, 720.0, -740.0, 3 * rsl::half_pi_v<float64>}; // NOLINT(modernize-avoid-c-arrays)
+  for(float64 value : special)
+  {
+    values32.push_back(static_cast<float32>(value));
+    values64.push_back(value);
+  }
+
+  rsl::vector<float32> res32(rsl::Size(values32.size()));
+  rsl::vector<float64> res64(rsl::Size(values64.size()));
+
+  // the batch versions give exactly the same results as the scalar ones
+  rsl::sin_n(values32.data(), res32.data(), values32.size());
+  rsl::sin_n(values64.data(), res64.data(), values64.size());
+  for(count_t i = 0; i < values32.size(); ++i)
+  {
+    REQUIRE(rsl::bit_cast<uint32>(res32[i]) == rsl::bit_cast<uint32>(rsl::sin(values32[i])));
+    REQUIRE(rsl::bit_cast<uint64>(res64[i]) == rsl::bit_cast<uint64>(rsl::sin(values64[i])));
+  }
+
+  for(float32& value : values32)
+  {
+    value /= 100.0f;
+  }
+  for(float64& value : values64)
+  {
+    value /= 10.0;
+  }
+  rsl::exp_n(values32.data(), res32.data(), values32.size());
+  rsl::exp_n(values64.data(), res64.data(), values64.size());
+  for(count_t i = 0; i < values32.size(); ++i)
+  {
+    REQUIRE(rsl::bit_cast<uint32>(res32[i]) == rsl::bit_cast<uint32>(rsl::exp(values32[i])));
+    REQUIRE(rsl::bit_cast<uint64>(res64[i]) == rsl::bit_cast<uint64>(rsl::exp(values64[i])));
+  }
+
+  // in place
+  rsl::vector<float64> in_place = values64;
+  rsl::sin_n(in_place.data(), in_place.data(), in_place.size());
+  for(count_t i = 0; i < in_place.size(); ++i)
+  {
+    REQUIRE(rsl::bit_cast<uint64>(in_place[i]) == rsl::bit_cast<uint64>(rsl::sin(values64[i])));
+  }
+}
@@ -10,10 +10,173 @@
 //
 // ============================================
 
-namespace rsl::test
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/cstring.h"
+#include "rex_std/internal/algorithm/memcmp.h"
+#include "rex_std/internal/memory/memcpy.h"
+#include "rex_std/internal/memory/memmove.h"
+#include "rex_std/internal/memory/memset.h"
+#include "rex_std/internal/string/memchr.h"
+
+// NOLINTBEGIN
+
+namespace
+{
+  // sizes around the boundaries of the word, sse and avx kernels
+  constexpr card64 g_mem_test_sizes[] = {0, 1, 2, 3, 4, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 129, 255, 256, 1000, 4099};
+  constexpr card64 g_mem_test_buffer_size = 4200;
+  // forward overlap, backward overlap and no overlap when moving from offset 8
+  constexpr card64 g_mem_test_move_offsets[] = {0, 3, 32, 40};
+
+  void fill_pattern(uint8* buffer, card64 size)
+  {
+    for(card64 i = 0; i < size; ++i)
+    {
+      buffer[i] = static_cast<uint8>(i * 7 + 3);
+    }
+  }
+} // namespace
+
+TEST_CASE("memcpy")
+{
+  uint8 src[g_mem_test_buffer_size];
+  uint8 dst[g_mem_test_buffer_size];
+  fill_pattern(src, g_mem_test_buffer_size);
+
+  for(card64 size : g_mem_test_sizes)
+  {
+    for(card64 offset = 0; offset < 4; ++offset)
+    {
+      rsl::internal::memset_bytewise(dst, 0, g_mem_test_buffer_size);
+      rsl::memcpy(dst + offset, src + 1, size);
+
+      bool matches = true;
+      for(card64 i = 0; i < size; ++i)
+      {
+        matches &= dst[offset + i] == src[1 + i];
+      }
+      CHECK(matches);
+      CHECK(dst[offset + size] == 0);
+    }
+  }
+}
+
+TEST_CASE("memmove")
+{
+  uint8 buffer[g_mem_test_buffer_size + 64];
+  uint8 expected[g_mem_test_buffer_size + 64];
+
+  for(card64 size : g_mem_test_sizes)
+  {
+    for(card64 dst_offset : g_mem_test_move_offsets)
+    {
+      fill_pattern(buffer, sizeof(buffer));
+      fill_pattern(expected, sizeof(expected));
+
+      rsl::memmove(buffer + dst_offset, buffer + 8, size);
+      rsl::internal::memmove_bytewise(expected + dst_offset, expected + 8, size);
+
+      bool matches = true;
+      for(card64 i = 0; i < sizeof(buffer); ++i)
+      {
+        matches &= buffer[i] == expected[i];
+      }
+      CHECK(matches);
+    }
+  }
+}
+
+TEST_CASE("memset")
 {
-  inline namespace v1
+  uint8 dst[g_mem_test_buffer_size];
+
+  for(card64 size : g_mem_test_sizes)
   {
+    rsl::internal::memset_bytewise(dst, 0, g_mem_test_buffer_size);
+    rsl::memset(dst + 1, 0x5a, size);
 
+    bool matches = true;
+    for(card64 i = 0; i < size; ++i)
+    {
+      matches &= dst[1 + i] == 0x5a;
+    }
+    CHECK(matches);
+    CHECK(dst[0] == 0);
+    CHECK(dst[1 + size] == 0);
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("memchr")
+{
+  char8 buffer[g_mem_test_buffer_size];
+  rsl::internal::memset_bytewise(buffer, 'a', g_mem_test_buffer_size);
+
+  for(card64 size : g_mem_test_sizes)
+  {
+    for(card64 offset = 0; offset < 4; ++offset)
+    {
+      // the needle right past the end should never be found
+      buffer[offset + size] = 'b';
+      CHECK(rsl::memchr(buffer + offset, 'b', size) == nullptr);
+
+      if(size > 0)
+      {
+        buffer[offset + size - 1] = 'b';
+        CHECK(rsl::memchr(buffer + offset, 'b', size) == buffer + offset + size - 1);
+        buffer[offset] = 'b';
+        CHECK(rsl::memchr(buffer + offset, 'b', size) == buffer + offset);
+        buffer[offset]            = 'a';
+        buffer[offset + size - 1] = 'a';
+      }
+      buffer[offset + size] = 'a';
+    }
+  }
+}
+
+TEST_CASE("memcmp")
+{
+  uint8 lhs[g_mem_test_buffer_size];
+  uint8 rhs[g_mem_test_buffer_size];
+  fill_pattern(lhs, g_mem_test_buffer_size);
+  fill_pattern(rhs, g_mem_test_buffer_size);
+
+  for(card64 size : g_mem_test_sizes)
+  {
+    CHECK(rsl::memcmp(lhs, rhs, size) == 0);
+    if(size == 0)
+    {
+      continue;
+    }
+
+    // bytes are compared as unsigned values
+    rhs[size - 1] = 0xFF;
+    CHECK(rsl::memcmp(lhs, rhs, size) < 0);
+    CHECK(rsl::memcmp(rhs, lhs, size) > 0);
+    rhs[size - 1] = lhs[size - 1];
+
+    rhs[size / 2] = static_cast<uint8>(lhs[size / 2] - 1);
+    CHECK(rsl::memcmp(lhs, rhs, size) > 0);
+    rhs[size / 2] = lhs[size / 2];
+  }
+}
+
+TEST_CASE("strlen")
+{
+  char8 buffer[g_mem_test_buffer_size];
+  rsl::internal::memset_bytewise(buffer, 'a', g_mem_test_buffer_size);
+
+  for(card64 size : g_mem_test_sizes)
+  {
+    for(card64 offset = 0; offset < 4; ++offset)
+    {
+      buffer[offset + size] = '\0';
+      CHECK(rsl::strlen(buffer + offset) == static_cast<count_t>(size));
+      buffer[offset + size] = 'a';
+    }
+  }
+
+  static_assert(rsl::strlen("hello") == 5);
+}
+
+// NOLINTEND
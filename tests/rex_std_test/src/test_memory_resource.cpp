@@ -0,0 +1,252 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_memory_resource.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/hashtable/hash_map.h"
+#include "rex_std/deque.h"
+#include "rex_std/map.h"
+#include "rex_std/memory_resource.h"
+#include "rex_std/string.h"
+#include "rex_std/vector.h"
+
+namespace
+{
+  // forwards to the new delete resource and keeps track of what's still alive
+  class counting_resource : public rsl::pmr::memory_resource
+  {
+  public:
+    card32 live_allocations  = 0;
+    card32 total_allocations = 0;
+    size_t live_bytes        = 0;
+
+  private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+      ++live_allocations;
+      ++total_allocations;
+      live_bytes += bytes;
+      return rsl::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+      --live_allocations;
+      live_bytes -= bytes;
+      rsl::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const rsl::pmr::memory_resource& other) const override
+    {
+      return this == &other;
+    }
+  };
+
+  bool is_aligned(const void* p, size_t alignment)
+  {
+    return reinterpret_cast<uintptr>(p) % alignment == 0; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+  }
+} // namespace
+
+TEST_CASE("default memory resource")
+{
+  CHECK(rsl::pmr::get_default_resource() == rsl::pmr::new_delete_resource());
+  CHECK(*rsl::pmr::new_delete_resource() == *rsl::pmr::new_delete_resource());
+  CHECK(*rsl::pmr::new_delete_resource() != *rsl::pmr::null_memory_resource());
+
+  counting_resource resource;
+  CHECK(rsl::pmr::set_default_resource(&resource) == rsl::pmr::new_delete_resource());
+  CHECK(rsl::pmr::get_default_resource() == &resource);
+  CHECK(rsl::pmr::polymorphic_allocator().resource() == &resource);
+
+  // passing nullptr resets the default resource
+  CHECK(rsl::pmr::set_default_resource(nullptr) == &resource);
+  CHECK(rsl::pmr::get_default_resource() == rsl::pmr::new_delete_resource());
+
+  void* p = rsl::pmr::new_delete_resource()->allocate(100, 64);
+  CHECK(is_aligned(p, 64));
+  rsl::pmr::new_delete_resource()->deallocate(p, 100, 64);
+}
+
+TEST_CASE("monotonic_buffer_resource")
+{
+  // allocating from the initial buffer
+  {
+    alignas(16) char8 buffer[256];
+    counting_resource upstream;
+    rsl::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), &upstream);
+    CHECK(resource.upstream_resource() == &upstream);
+
+    void* a = resource.allocate(10, 1);
+    void* b = resource.allocate(8, 8);
+    CHECK(a == buffer);
+    CHECK(is_aligned(b, 8));
+    CHECK(static_cast<char8*>(b) - static_cast<char8*>(a) == 16);
+    CHECK(upstream.total_allocations == 0);
+
+    // deallocating does nothing
+    resource.deallocate(b, 8, 8);
+    CHECK(resource.allocate(8, 8) != b);
+
+    // the buffer is exhausted, the next allocation goes to upstream
+    void* c = resource.allocate(300, 32);
+    CHECK(is_aligned(c, 32));
+    CHECK(upstream.live_allocations == 1);
+
+    // release frees the upstream buffers and starts from the initial buffer again
+    resource.release();
+    CHECK(upstream.live_allocations == 0);
+    CHECK(resource.allocate(10, 1) == buffer);
+  }
+
+  // buffers grow geometrically
+  {
+    counting_resource upstream;
+    {
+      rsl::pmr::monotonic_buffer_resource resource(64, &upstream);
+      for(int i = 0; i < 1000; ++i)
+      {
+        void* p = resource.allocate(16, 16);
+        CHECK(is_aligned(p, 16));
+      }
+      CHECK(upstream.live_allocations < 16);
+      CHECK(upstream.live_bytes >= 16000);
+    }
+    // the resource frees everything when it's destroyed
+    CHECK(upstream.live_allocations == 0);
+  }
+}
+
+TEST_CASE("unsynchronized_pool_resource")
+{
+  counting_resource upstream;
+  {
+    rsl::pmr::pool_options opts;
+    opts.max_blocks_per_chunk        = 64;
+    opts.largest_required_pool_block = 200;
+
+    rsl::pmr::unsynchronized_pool_resource resource(opts, &upstream);
+    CHECK(resource.upstream_resource() == &upstream);
+    CHECK(resource.options().max_blocks_per_chunk == 64);
+    CHECK(resource.options().largest_required_pool_block == 256);
+
+    void* a = resource.allocate(24, 8);
+    void* b = resource.allocate(24, 8);
+    CHECK(a != b);
+    CHECK(upstream.live_allocations == 1);
+
+    // freed blocks are handed out again first
+    resource.deallocate(a, 24, 8);
+    CHECK(resource.allocate(24, 8) == a);
+
+    // blocks meet the requested alignment
+    void* c = resource.allocate(8, 64);
+    CHECK(is_aligned(c, 64));
+    resource.deallocate(c, 8, 64);
+
+    // big allocations go straight to upstream
+    const card32 num_allocations = upstream.live_allocations;
+    void* big                    = resource.allocate(1000, 8);
+    CHECK(upstream.live_allocations == num_allocations + 1);
+    resource.deallocate(big, 1000, 8);
+    CHECK(upstream.live_allocations == num_allocations);
+
+    // release also frees big allocations that haven't been deallocated
+    resource.allocate(1000, 8);
+    resource.allocate(5000, 128);
+    resource.release();
+    CHECK(upstream.live_allocations == 0);
+
+    for(int i = 0; i < 10000; ++i)
+    {
+      resource.allocate(static_cast<size_t>(i % 256) + 1, 8);
+    }
+  }
+  CHECK(upstream.live_allocations == 0);
+}
+
+TEST_CASE("synchronized_pool_resource")
+{
+  counting_resource upstream;
+  {
+    rsl::pmr::synchronized_pool_resource resource(&upstream);
+    void* a = resource.allocate(32);
+    resource.deallocate(a, 32);
+    CHECK(resource.allocate(32) == a);
+    CHECK(resource.upstream_resource() == &upstream);
+  }
+  CHECK(upstream.live_allocations == 0);
+}
+
+TEST_CASE("polymorphic_allocator with containers")
+{
+  counting_resource upstream;
+  rsl::pmr::monotonic_buffer_resource arena(&upstream);
+  rsl::pmr::unsynchronized_pool_resource pool(&upstream);
+
+  CHECK(rsl::pmr::polymorphic_allocator(&arena) == rsl::pmr::polymorphic_allocator(&arena));
+  CHECK(rsl::pmr::polymorphic_allocator(&arena) != rsl::pmr::polymorphic_allocator(&pool));
+
+  // vector
+  {
+    rsl::vector<int, rsl::pmr::polymorphic_allocator> vec(rsl::pmr::polymorphic_allocator(&arena));
+    for(int i = 0; i < 1000; ++i)
+    {
+      vec.push_back(i);
+    }
+    CHECK(vec.size() == 1000);
+    CHECK(vec[999] == 999);
+    CHECK(vec.get_allocator().resource() == &arena);
+  }
+  // string
+  {
+    rsl::basic_string<char8, rsl::char_traits<char8>, rsl::pmr::polymorphic_allocator> str(rsl::pmr::polymorphic_allocator(&arena));
+    for(int i = 0; i < 100; ++i)
+    {
+      str += "rex";
+    }
+    CHECK(str.size() == 300);
+  }
+  // deque
+  {
+    rsl::deque<int, rsl::pmr::polymorphic_allocator> deque(rsl::pmr::polymorphic_allocator(&pool));
+    for(int i = 0; i < 1000; ++i)
+    {
+      deque.push_back(i);
+      deque.push_front(i);
+    }
+    CHECK(deque.size() == 2000);
+  }
+  // map
+  {
+    rsl::map<int, int, rsl::less<int>, rsl::pmr::polymorphic_allocator> map(rsl::pmr::polymorphic_allocator(&pool));
+    for(int i = 0; i < 1000; ++i)
+    {
+      map.emplace(i, i);
+    }
+    CHECK(map.size() == 1000);
+    CHECK(map.at(500) == 500);
+  }
+  // hash_map
+  {
+    rsl::hash_map<int, int, rsl::hash<int>, rsl::equal_to<int>, rsl::pmr::polymorphic_allocator> map(rsl::pmr::polymorphic_allocator(&pool));
+    for(int i = 0; i < 1000; ++i)
+    {
+      map.emplace(i, i);
+    }
+    CHECK(map.size() == 1000);
+    CHECK(map.at(500) == 500);
+  }
+
+  CHECK(upstream.live_allocations > 0);
+  arena.release();
+  pool.release();
+  CHECK(upstream.live_allocations == 0);
+}
@@ -0,0 +1,81 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_mutex.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/condition_variable.h"
+#include "rex_std/mutex.h"
+#include "rex_std/vector.h"
+
+#include <thread>
+
+TEST_CASE("mutex")
+{
+  rsl::mutex mtx;
+
+  CHECK(mtx.try_lock());
+  CHECK(!mtx.try_lock());
+  mtx.unlock();
+
+  // all increments have to be visible after the threads are joined
+  constexpr card32 num_threads           = 8;
+  constexpr card32 increments_per_thread = 10'000;
+  card32 counter                         = 0;
+
+  rsl::vector<std::thread> threads;
+  for(card32 i = 0; i < num_threads; ++i)
+  {
+    threads.emplace_back(
+        [&]()
+        {
+          for(card32 j = 0; j < increments_per_thread; ++j)
+          {
+            const rsl::unique_lock<rsl::mutex> lock(mtx);
+            ++counter;
+          }
+        });
+  }
+  for(std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  CHECK(counter == num_threads * increments_per_thread);
+}
+
+TEST_CASE("condition_variable")
+{
+  rsl::mutex mtx;
+  rsl::condition_variable cv;
+
+  // 2 threads taking turns, every turn needs a notify to get to the other thread
+  constexpr card32 num_turns = 1000;
+  card32 turn                = 0;
+
+  auto player = [&](card32 me)
+  {
+    for(card32 i = 0; i < num_turns; ++i)
+    {
+      rsl::unique_lock<rsl::mutex> lock(mtx);
+      cv.wait(lock, [&]() { return turn % 2 == me; });
+      ++turn;
+      cv.notify_all();
+    }
+  };
+
+  std::thread ping(player, 0);
+  std::thread pong(player, 1);
+  ping.join();
+  pong.join();
+
+  CHECK(turn == 2 * num_turns);
+}
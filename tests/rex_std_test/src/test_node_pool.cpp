@@ -0,0 +1,277 @@
+// ============================================
+//
+// REX - STANDARD LIBRARY IMPLEMENTATION
+//
+// Author: Nick De Breuck
+// Twitter: @nick_debreuck
+//
+// File: test_node_pool.cpp
+// Copyright (c) Nick De Breuck 2023
+//
+// ============================================
+
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/bonus/hashtable/hash_map.h"
+#include "rex_std/bonus/memory/node_pool.h"
+#include "rex_std/bonus/memory/node_pool_allocator.h"
+#include "rex_std/forward_list.h"
+#include "rex_std/list.h"
+#include "rex_std/map.h"
+#include "rex_std/set.h"
+
+TEST_CASE("node_pool")
+{
+  rsl::node_pool pool;
+
+  CHECK(pool.stats().live_nodes == 0);
+  CHECK(pool.stats().slab_count == 0);
+
+  void* a = pool.allocate(24);
+  void* b = pool.allocate(24);
+  void* c = pool.allocate(100);
+  CHECK(a != b);
+  CHECK(reinterpret_cast<uintptr>(a) % rsl::g_node_pool_granularity == 0); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+  CHECK(reinterpret_cast<uintptr>(c) % rsl::g_node_pool_granularity == 0); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+  CHECK(pool.stats().live_nodes == 3);
+  CHECK(pool.stats().slab_count == 2); // 1 slab per block size
+
+  // freed blocks are handed out again first
+  pool.deallocate(a, 24);
+  CHECK(pool.allocate(24) == a);
+
+  // big allocations don't go through the pool
+  void* big = pool.allocate(rsl::g_node_pool_max_block_size + 1);
+  CHECK(pool.stats().live_nodes == 3);
+  CHECK(pool.stats().live_large_allocations == 1);
+  pool.deallocate(big, rsl::g_node_pool_max_block_size + 1);
+  CHECK(pool.stats().live_large_allocations == 0);
+
+  pool.deallocate(a, 24);
+  pool.deallocate(b, 24);
+  pool.deallocate(c, 100);
+  CHECK(pool.stats().live_nodes == 0);
+  CHECK(pool.stats().slab_count == 2); // slabs are kept until the pool is released
+
+  pool.release();
+  CHECK(pool.stats().slab_count == 0);
+  CHECK(pool.stats().slab_bytes == 0);
+
+  // releasing frees the big allocations that are still alive as well
+  pool.allocate(rsl::g_node_pool_max_block_size + 1);
+  pool.allocate(rsl::g_node_pool_max_block_size * 4);
+  CHECK(pool.stats().live_large_allocations == 2);
+  pool.release();
+  CHECK(pool.stats().live_large_allocations == 0);
+}
+
+TEST_CASE("node_pool_allocator with node containers")
+{
+  // list
+  {
+    rsl::list<int, rsl::node_pool_allocator> list;
+    for(int i = 0; i < 1000; ++i)
+    {
+      list.push_back(i);
+    }
+    CHECK(list.get_allocator().stats().live_nodes == 1000);
+    CHECK(list.get_allocator().stats().slab_count > 0);
+
+    list.clear();
+    CHECK(list.get_allocator().stats().live_nodes == 0);
+  }
+  // forward_list
+  {
+    rsl::forward_list<int, rsl::node_pool_allocator> list;
+    for(int i = 0; i < 1000; ++i)
+    {
+      list.push_front(i);
+    }
+    CHECK(list.get_allocator().stats().live_nodes == 1000);
+    CHECK(list.front() == 999);
+  }
+  // map
+  {
+    rsl::map<int, int, rsl::less<int>, rsl::node_pool_allocator> map;
+    for(int i = 0; i < 1000; ++i)
+    {
+      map.emplace(i, i);
+    }
+    CHECK(map.get_allocator().stats().live_nodes == 1000);
+    CHECK(map.at(500) == 500);
+  }
+  // hash_map
+  {
+    rsl::hash_map<int, int, rsl::hash<int>, rsl::equal_to<int>, rsl::node_pool_allocator> map;
+    for(int i = 0; i < 1000; ++i)
+    {
+      map.emplace(i, i);
+    }
+    // the bucket array is too big for the pool at this point, so only the nodes are in there
+    CHECK(map.get_allocator().stats().live_nodes == 1000);
+    CHECK(map.get_allocator().stats().live_large_allocations == 1);
+    CHECK(map.at(500) == 500);
+  }
+}
+
+TEST_CASE("node_pool_allocator churn")
+{
+  rsl::map<int, int, rsl::less<int>, rsl::node_pool_allocator> map;
+  for(int i = 0; i < 1000; ++i)
+  {
+    map.emplace(i, i);
+  }
+  const card64 slab_count = map.get_allocator().stats().slab_count;
+
+  // replacing every element many times over reuses the freed nodes, no new slabs are needed
+  for(int round = 1; round < 100; ++round)
+  {
+    for(int i = 0; i < 1000; ++i)
+    {
+      map.erase((round - 1) * 1000 + i);
+      map.emplace(round * 1000 + i, i);
+    }
+  }
+
+  CHECK(map.size() == 1000);
+  CHECK(map.get_allocator().stats().live_nodes == 1000);
+  CHECK(map.get_allocator().stats().slab_count == slab_count);
+}
+
+TEST_CASE("node_pool_allocator copy and move")
+{
+  using list_type = rsl::list<int, rsl::node_pool_allocator>;
+
+  list_type list = {1, 2, 3};
+
+  // allocators that didn't create their pool yet each end up with their own
+  const rsl::node_pool_allocator first;
+  const rsl::node_pool_allocator second;
+  CHECK(first == first);
+  CHECK(first != second);
+
+  // a copy gets its own pool
+  list_type copy(list);
+  CHECK(copy.get_allocator() != list.get_allocator());
+  CHECK(copy.get_allocator().stats().live_nodes == 3);
+  CHECK(list.get_allocator().stats().live_nodes == 3);
+
+  // moving takes the pool with it
+  list_type moved(rsl::move(list));
+  CHECK(moved.get_allocator().stats().live_nodes == 3);
+  CHECK(list.empty()); // NOLINT(bugprone-use-after-move, hicpp-invalid-access-moved)
+  CHECK(moved.front() == 1);
+  CHECK(moved.back() == 3);
+
+  // swapping swaps the pools along with the nodes
+  list_type other = {4, 5};
+  moved.swap(other);
+  CHECK(moved.get_allocator().stats().live_nodes == 2);
+  CHECK(other.get_allocator().stats().live_nodes == 3);
+  CHECK(moved.front() == 4);
+  CHECK(other.front() == 1);
+
+  // copy assignment allocates from the pool of the assigned to list
+  moved = other;
+  CHECK(moved.get_allocator().stats().live_nodes == 3);
+  CHECK(other.get_allocator().stats().live_nodes == 3);
+}
+
+TEST_CASE("node_pool_allocator move with a different allocator")
+{
+  using list_type = rsl::list<int, rsl::node_pool_allocator>;
+
+  // the list that's moved from, and with it its pool, is destroyed before the result gets used
+  const auto move_to_other_pool = []()
+  {
+    list_type list = {1, 2, 3};
+    list_type res(rsl::move(list), rsl::node_pool_allocator());
+    CHECK(res.get_allocator() != list.get_allocator()); // NOLINT(bugprone-use-after-move, hicpp-invalid-access-moved)
+    CHECK(res.get_allocator().stats().live_nodes == 3);
+    return res;
+  };
+
+  const list_type moved = move_to_other_pool();
+  CHECK(moved.size() == 3);
+  CHECK(moved.get_allocator().stats().live_nodes == 3);
+  CHECK(moved.front() == 1);
+  CHECK(moved.back() == 3);
+}
+
+TEST_CASE("node_pool_allocator move node containers with a different allocator")
+{
+  using forward_list_type = rsl::forward_list<int, rsl::node_pool_allocator>;
+  using map_type          = rsl::map<int, int, rsl::less<int>, rsl::node_pool_allocator>;
+  using set_type          = rsl::set<int, rsl::less<int>, rsl::node_pool_allocator>;
+
+  // every source container and its pool is gone before the results get used
+  const auto move_forward_list = []()
+  {
+    forward_list_type list = {1, 2, 3};
+    forward_list_type res(rsl::move(list), rsl::node_pool_allocator());
+    CHECK(res.get_allocator().stats().live_nodes == 3);
+    return res;
+  };
+  const auto move_map = []()
+  {
+    map_type map;
+    for(int i = 0; i < 100; ++i)
+    {
+      map.emplace(i, i * 2);
+    }
+    map_type res(rsl::move(map), rsl::node_pool_allocator());
+    CHECK(res.get_allocator().stats().live_nodes == 100);
+    return res;
+  };
+  const auto move_set = []()
+  {
+    set_type set;
+    for(int i = 0; i < 100; ++i)
+    {
+      set.insert(i);
+    }
+    set_type res(rsl::move(set), rsl::node_pool_allocator());
+    CHECK(res.get_allocator().stats().live_nodes == 100);
+    return res;
+  };
+
+  const forward_list_type list = move_forward_list();
+  CHECK(list.get_allocator().stats().live_nodes == 3);
+  CHECK(list.front() == 1);
+  CHECK(*rsl::next(list.begin(), 2) == 3);
+
+  const map_type map = move_map();
+  CHECK(map.size() == 100);
+  CHECK(map.get_allocator().stats().live_nodes == 100);
+  CHECK(map.at(0) == 0);
+  CHECK(map.at(99) == 198);
+
+  const set_type set = move_set();
+  CHECK(set.size() == 100);
+  CHECK(set.get_allocator().stats().live_nodes == 100);
+  CHECK(set.count(50) == 1);
+  CHECK(*set.begin() == 0);
+}
+
+TEST_CASE("thread_local_node_pool_allocator")
+{
+  using list_type = rsl::list<int, rsl::thread_local_node_pool_allocator>;
+
+  const card64 live_nodes = rsl::node_pool::thread_local_pool().stats().live_nodes;
+
+  {
+    list_type a = {1, 2, 3};
+    list_type b = {4, 5};
+
+    // all containers of a thread share the same pool
+    CHECK(a.get_allocator() == b.get_allocator());
+    CHECK(rsl::node_pool::thread_local_pool().stats().live_nodes == live_nodes + 5);
+
+    // so nodes can be spliced between them
+    a.splice(a.end(), b);
+    CHECK(a.size() == 5);
+    CHECK(b.empty());
+  }
+
+  CHECK(rsl::node_pool::thread_local_pool().stats().live_nodes == live_nodes);
+}
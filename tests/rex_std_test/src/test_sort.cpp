@@ -4,16 +4,360 @@
 //
 // Author: Nick De Breuck
 // Twitter: @nick_debreuck
-// 
+//
 // File: test_sort.cpp
 // Copyright (c) Nick De Breuck 2023
 //
 // ============================================
 
-namespace rsl::test
+#include "rex_std_test/catch2/catch.hpp"
+
+#include "rex_std/algorithm.h"
+#include "rex_std/bonus/algorithm/radix_sort.h"
+#include "rex_std/functional.h"
+#include "rex_std/limits.h"
+#include "rex_std/string.h"
+#include "rex_std/vector.h"
+
+namespace
+{
+  // sizes around the insertion sort and ninther thresholds of pdq sort
+  constexpr card32 g_sizes[] = {0, 1, 2, 3, 10, 23, 24, 25, 127, 128, 129, 1000, 10'000};
+
+  // a simple lcg so the tests are reproducible
+  card32 next_random(card32& state)
+  {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+  }
+
+  rsl::vector<int32> random_ints(card32 size, card32 maxValue)
+  {
+    card32 state = size;
+    rsl::vector<int32> vec;
+    for(card32 i = 0; i < size; ++i)
+    {
+      vec.push_back(static_cast<int32>(next_random(state) % maxValue));
+    }
+    return vec;
+  }
+  rsl::vector<int32> sorted_ints(card32 size)
+  {
+    rsl::vector<int32> vec;
+    for(card32 i = 0; i < size; ++i)
+    {
+      vec.push_back(static_cast<int32>(i));
+    }
+    return vec;
+  }
+  rsl::vector<int32> reversed_ints(card32 size)
+  {
+    rsl::vector<int32> vec;
+    for(card32 i = 0; i < size; ++i)
+    {
+      vec.push_back(static_cast<int32>(size - i));
+    }
+    return vec;
+  }
+  rsl::vector<int32> organ_pipe_ints(card32 size)
+  {
+    rsl::vector<int32> vec;
+    for(card32 i = 0; i < size; ++i)
+    {
+      vec.push_back(static_cast<int32>(i < size / 2 ? i : size - i));
+    }
+    return vec;
+  }
+
+  struct keyed_value
+  {
+    int32 key;
+    card32 index;
+  };
+
+  // only compares the key, so the index tells us if equal keys kept their order
+  bool compare_keys(const keyed_value& lhs, const keyed_value& rhs)
+  {
+    return lhs.key < rhs.key;
+  }
+
+  // the key is in [0, maxValue), so a small max value results in a lot of equal keys
+  rsl::vector<keyed_value> random_keyed_values(card32 size, card32 maxValue)
+  {
+    rsl::vector<keyed_value> vec;
+    for(int32 key : random_ints(size, maxValue))
+    {
+      vec.push_back(keyed_value {key, static_cast<card32>(vec.size())});
+    }
+    return vec;
+  }
+
+  bool is_stable_sorted(const rsl::vector<keyed_value>& vec)
+  {
+    for(card32 i = 1; i < vec.size(); ++i)
+    {
+      if(vec[i].key < vec[i - 1].key || (vec[i].key == vec[i - 1].key && vec[i].index < vec[i - 1].index))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // forwards to rsl::allocator, but counts how many times it got used
+  class counting_allocator
+  {
+  public:
+    card32 num_allocations = 0;
+
+    void* allocate(card64 size)
+    {
+      ++num_allocations;
+      return rsl::allocator().allocate(size);
+    }
+    void deallocate(void* ptr, card64 size)
+    {
+      rsl::allocator().deallocate(ptr, size);
+    }
+  };
+
+  // checks the vector is sorted and still holds the same elements
+  template <typename T, typename Compare>
+  bool sorts_correctly(rsl::vector<T> vec, Compare compare)
+  {
+    rsl::vector<T> copy = vec;
+    rsl::sort(vec.begin(), vec.end(), compare);
+    if(!rsl::is_sorted(vec.begin(), vec.end(), compare))
+    {
+      return false;
+    }
+    return rsl::is_permutation(vec.begin(), vec.end(), copy.begin());
+  }
+} // namespace
+
+TEST_CASE("sort distributions")
 {
-  inline namespace v1
+  for(card32 size : g_sizes)
   {
+    CHECK(sorts_correctly(random_ints(size, 1'000'000), rsl::less<int32>()));
+    CHECK(sorts_correctly(random_ints(size, 4), rsl::less<int32>()));
+    CHECK(sorts_correctly(sorted_ints(size), rsl::less<int32>()));
+    CHECK(sorts_correctly(reversed_ints(size), rsl::less<int32>()));
+    CHECK(sorts_correctly(organ_pipe_ints(size), rsl::less<int32>()));
+  }
+}
 
+TEST_CASE("sort with a custom comparison")
+{
+  for(card32 size : g_sizes)
+  {
+    // rsl::greater takes the branchless partition, a lambda doesn't
+    CHECK(sorts_correctly(random_ints(size, 1'000'000), rsl::greater<int32>()));
+    CHECK(sorts_correctly(random_ints(size, 1'000'000), [](int32 lhs, int32 rhs) { return lhs < rhs; }));
+    CHECK(sorts_correctly(random_ints(size, 4), [](int32 lhs, int32 rhs) { return lhs > rhs; }));
+  }
+}
+
+TEST_CASE("sort non arithmetic types")
+{
+  for(card32 size : g_sizes)
+  {
+    rsl::vector<rsl::string> strings;
+    for(int32 value : random_ints(size, 1000))
+    {
+      strings.push_back(rsl::to_string(value));
+    }
+    CHECK(sorts_correctly(strings, rsl::less<rsl::string>()));
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("stable sort keeps the order of equal elements")
+{
+  for(card32 size : g_sizes)
+  {
+    for(card32 max_value : {4u, 1000u, 1'000'000u})
+    {
+      rsl::vector<keyed_value> vec = random_keyed_values(size, max_value);
+      rsl::stable_sort(vec.begin(), vec.end(), compare_keys);
+      CHECK(is_stable_sorted(vec));
+    }
+  }
+}
+
+TEST_CASE("stable sort distributions")
+{
+  for(card32 size : g_sizes)
+  {
+    rsl::vector<int32> vec = sorted_ints(size);
+    rsl::stable_sort(vec.begin(), vec.end());
+    CHECK(rsl::is_sorted(vec.begin(), vec.end()));
+
+    vec = reversed_ints(size);
+    rsl::stable_sort(vec.begin(), vec.end());
+    CHECK(rsl::is_sorted(vec.begin(), vec.end()));
+
+    vec = organ_pipe_ints(size);
+    rsl::stable_sort(vec.begin(), vec.end());
+    CHECK(rsl::is_sorted(vec.begin(), vec.end()));
+  }
+}
+
+TEST_CASE("stable sort with a scratch buffer")
+{
+  for(card32 size : g_sizes)
+  {
+    // a buffer that's too small for most merges, they'll merge in place
+    rsl::vector<keyed_value> vec = random_keyed_values(size, 100);
+    alignas(keyed_value) char8 small_buffer[sizeof(keyed_value) * 16];
+    rsl::stable_sort(vec.begin(), vec.end(), compare_keys, reinterpret_cast<keyed_value*>(small_buffer), 16); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    CHECK(is_stable_sorted(vec));
+
+    // no buffer at all
+    vec = random_keyed_values(size, 100);
+    rsl::stable_sort(vec.begin(), vec.end(), compare_keys, nullptr, 0);
+    CHECK(is_stable_sorted(vec));
+  }
+}
+
+TEST_CASE("stable sort with an allocator")
+{
+  counting_allocator alloc;
+
+  // small ranges don't need to merge, so they don't allocate
+  rsl::vector<keyed_value> vec = random_keyed_values(10, 100);
+  rsl::stable_sort(vec.begin(), vec.end(), compare_keys, alloc);
+  CHECK(is_stable_sorted(vec));
+  CHECK(alloc.num_allocations == 0);
+
+  vec = random_keyed_values(10'000, 100);
+  rsl::stable_sort(vec.begin(), vec.end(), compare_keys, alloc);
+  CHECK(is_stable_sorted(vec));
+  CHECK(alloc.num_allocations == 1);
+}
+
+TEST_CASE("radix sort integers")
+{
+  for(card32 size : g_sizes)
+  {
+    rsl::vector<int32> vec = random_ints(size, 1'000'000);
+    for(card32 i = 0; i < vec.size(); i += 2)
+    {
+      vec[i] = -vec[i];
+    }
+    rsl::vector<int32> buffer(rsl::Size(vec.size()));
+    rsl::radix_sort(vec.begin(), vec.end(), buffer.data());
+    CHECK(rsl::is_sorted(vec.begin(), vec.end()));
+
+    rsl::vector<uint64> vec64;
+    for(int32 value : random_ints(size, 1'000'000))
+    {
+      vec64.push_back(static_cast<uint64>(value) << 20);
+    }
+    rsl::radix_sort(vec64.begin(), vec64.end());
+    CHECK(rsl::is_sorted(vec64.begin(), vec64.end()));
+  }
+}
+
+TEST_CASE("radix sort floats")
+{
+  rsl::vector<float32> vec = {3.0f, -0.5f, 0.0f, -rsl::numeric_limits<float32>::infinity(), 1e-40f, rsl::numeric_limits<float32>::infinity(), -1e-40f, -100.0f, 2.5f};
+  rsl::radix_sort(vec.begin(), vec.end());
+  CHECK(rsl::is_sorted(vec.begin(), vec.end()));
+
+  rsl::vector<float64> vec64;
+  for(int32 value : random_ints(1000, 1'000'000))
+  {
+    vec64.push_back((static_cast<float64>(value) - 500'000.0) / 3.0);
+  }
+  rsl::radix_sort(vec64.begin(), vec64.end());
+  CHECK(rsl::is_sorted(vec64.begin(), vec64.end()));
+}
+
+TEST_CASE("radix sort with a key extractor")
+{
+  for(card32 size : g_sizes)
+  {
+    // the radix sort is stable, just like stable sort
+    rsl::vector<keyed_value> vec = random_keyed_values(size, 100);
+    rsl::vector<keyed_value> buffer(rsl::Size(vec.size()));
+    rsl::radix_sort(vec.begin(), vec.end(), buffer.data(), [](const keyed_value& value) { return value.key; });
+    CHECK(is_stable_sorted(vec));
+  }
+}
+
+TEST_CASE("radix sort strings")
+{
+  for(card32 size : g_sizes)
+  {
+    rsl::vector<rsl::string> strings;
+    for(int32 value : random_ints(size, 100'000))
+    {
+      // values of different lengths, which share prefixes
+      strings.push_back(rsl::to_string(value));
+    }
+    strings.push_back(rsl::string(""));
+    rsl::radix_sort(strings.begin(), strings.end());
+    CHECK(rsl::is_sorted(strings.begin(), strings.end()));
+
+    rsl::vector<rsl::string_view> views;
+    for(const rsl::string& str : strings)
+    {
+      views.push_back(str);
+    }
+    rsl::reverse(views.begin(), views.end());
+    rsl::radix_sort(views.begin(), views.end());
+    CHECK(rsl::is_sorted(views.begin(), views.end()));
+  }
+}
+
+TEST_CASE("radix sort wide strings")
+{
+  for(card32 size : g_sizes)
+  {
+    // code units that differ in their high byte only sort correctly when it's looked at first
+    rsl::vector<rsl::u16string> strings16;
+    rsl::vector<rsl::u32string> strings32;
+    const rsl::vector<int32> values = random_ints(size, 100'000);
+    for(card32 i = 0; i + 1 < values.size(); i += 2)
+    {
+      rsl::u16string str16;
+      rsl::u32string str32;
+      for(int32 value = values[i]; value != 0; value /= 7)
+      {
+        str16.push_back(static_cast<char16_t>(value * 613));
+        str32.push_back(static_cast<char32_t>(static_cast<uint32>(value) * 613u * static_cast<uint32>(values[i + 1])));
+      }
+      strings16.push_back(str16);
+      strings32.push_back(str32);
+    }
+
+    rsl::radix_sort(strings16.begin(), strings16.end());
+    CHECK(rsl::is_sorted(strings16.begin(), strings16.end()));
+    rsl::radix_sort(strings32.begin(), strings32.end());
+    CHECK(rsl::is_sorted(strings32.begin(), strings32.end()));
+  }
+}
+
+TEST_CASE("radix sort long shared prefixes")
+{
+  // every byte of a shared prefix used to take a level of recursion, which overflowed the stack
+  const rsl::string prefix(100'000, 'x');
+  const rsl::u32string wide_prefix(100'000, U'x');
+  rsl::vector<rsl::string> strings;
+  rsl::vector<rsl::u32string> wide_strings;
+  for(int32 value : random_ints(1000, 100))
+  {
+    strings.push_back(prefix + rsl::to_string(value));
+    wide_strings.push_back(wide_prefix + static_cast<char32_t>(value));
+  }
+  // strings that are a prefix of all the ones after them
+  for(card32 i = 0; i < 1000; ++i)
+  {
+    strings.push_back(rsl::string(1000 - i, 'a'));
+  }
+
+  rsl::radix_sort(strings.begin(), strings.end());
+  CHECK(rsl::is_sorted(strings.begin(), strings.end()));
+  rsl::radix_sort(wide_strings.begin(), wide_strings.end());
+  CHECK(rsl::is_sorted(wide_strings.begin(), wide_strings.end()));
+}
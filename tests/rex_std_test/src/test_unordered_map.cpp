@@ -12,6 +12,9 @@
 
 #include "rex_std_test/catch2/catch.hpp"
 
+#include "rex_std/bit.h"
+#include "rex_std/bonus/functional/fast_hash.h"
+#include "rex_std/bonus/hashtable/power_of_two_rehash_policy.h"
 #include "rex_std/unordered_map.h"
 
 #include "rex_std_test/test_allocator.h"
@@ -151,4 +154,58 @@ TEST_CASE("unordered_map load factor")
   CHECK(map.load_factor() <= map.get_max_load_factor());
   map.insert({ 14, 0 });
   CHECK(map.load_factor() <= map.get_max_load_factor());
-}
\ No newline at end of file
+}
+TEST_CASE("unordered_map power of two buckets")
+{
+  using namespace rsl::test;
+  using hash_table = rsl::hash_map<int, test_object, rsl::fast_hash<int>, rsl::equal_to<int>, test_allocator, rsl::power_of_two_rehash_policy>;
+
+  // requested bucket counts get rounded up to the next power of 2
+  {
+    const hash_table map(10_size);
+    CHECK(map.bucket_count() == 16);
+  }
+
+  hash_table map;
+  for(int i = 0; i < 1000; ++i)
+  {
+    map.insert({i, i});
+    CHECK(rsl::has_single_bit(static_cast<uint32>(map.bucket_count())));
+    CHECK(map.load_factor() <= map.get_max_load_factor());
+  }
+  CHECK(map.size() == 1000);
+  CHECK(map.bucket_count() == 1024);
+
+  for(int i = 0; i < 1000; ++i)
+  {
+    CHECK(map.at(i) == i);
+  }
+  CHECK(map.find(1000) == map.cend());
+
+  for(int i = 0; i < 1000; i += 2)
+  {
+    CHECK(map.erase(i) == 1);
+  }
+  CHECK(map.size() == 500);
+  CHECK(!map.contains(0));
+  CHECK(map.contains(1));
+
+  map.rehash(3000);
+  CHECK(map.bucket_count() == 4096);
+  CHECK(map.at(999) == 999);
+
+  map.set_max_load_factor(0.25f);
+  CHECK(map.get_max_load_factor() == 0.25f);
+  CHECK(map.load_factor() <= map.get_max_load_factor());
+  CHECK(map.at(501) == 501);
+}
+
+TEST_CASE("unordered_map prime buckets")
+{
+  using namespace rsl::test;
+  using hash_table = rsl::unordered_map<int, test_object, rsl::hash<int>, rsl::equal_to<int>, test_allocator>;
+
+  // requested bucket counts get rounded up to the next prime
+  const hash_table map(10_size);
+  CHECK(map.bucket_count() == 11);
+}
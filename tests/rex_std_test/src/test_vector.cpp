@@ -13,6 +13,7 @@
 #include "rex_std_test/catch2/catch.hpp"
 
 #include "rex_std/vector.h"
+#include "rex_std/memory.h"
 #include "rex_std/bonus/utility/scopeguard.h"
 
 #include "rex_std_test/test_allocator.h"
@@ -1970,3 +1971,128 @@ TEST_CASE("vector bug with inseration")
 
   vec1.insert(vec1.cend(), vec2.cbegin(), vec2.cend());
 }
+
+namespace
+{
+  struct slow_growing
+  {
+    card32 value;
+  };
+
+  // hands out a single fixed buffer and grows it in place, so the vector never has to move its elements
+  class expanding_allocator
+  {
+  public:
+    void* allocate(card64 count)
+    {
+      REQUIRE(count <= static_cast<card64>(sizeof(m_buffer)));
+      return m_buffer;
+    }
+    void deallocate(void* /*ptr*/, card64 /*count*/) {}
+    bool try_expand(void* /*ptr*/, card64 /*oldCount*/, card64 newCount)
+    {
+      ++m_num_expands;
+      return newCount <= static_cast<card64>(sizeof(m_buffer));
+    }
+    template <typename U>
+    void destroy(U* p)
+    {
+      p->~U();
+    }
+
+    card32 num_expands() const
+    {
+      return m_num_expands;
+    }
+
+  private:
+    alignas(16) char8 m_buffer[1024] = {};
+    card32 m_num_expands = 0;
+  };
+
+  bool operator==(const expanding_allocator& lhs, const expanding_allocator& rhs)
+  {
+    return &lhs == &rhs;
+  }
+  bool operator!=(const expanding_allocator& lhs, const expanding_allocator& rhs)
+  {
+    return !(lhs == rhs);
+  }
+} // namespace
+
+namespace rsl
+{
+  inline namespace v1
+  {
+    template <>
+    struct vector_growth_policy<slow_growing, rsl::allocator>
+    {
+      using type = vector_growth_one_and_half;
+    };
+  } // namespace v1
+} // namespace rsl
+
+TEST_CASE("vector relocation")
+{
+  static_assert(rsl::is_trivially_relocatable_v<card32>);
+  static_assert(rsl::is_trivially_relocatable_v<rsl::unique_ptr<card32>>);
+  static_assert(rsl::is_trivially_relocatable_v<rsl::vector<card32>>);
+  // the buffer of this allocator lives inside of it, so the vector can't be memcpy'd
+  static_assert(!rsl::is_trivially_relocatable_v<rsl::vector<card32, expanding_allocator>>);
+  // the small string buffer is pointed to by the string itself
+  static_assert(!rsl::is_trivially_relocatable_v<rsl::string>);
+
+  rsl::vector<rsl::unique_ptr<card32>> vec;
+  for(card32 i = 0; i < 100; ++i)
+  {
+    vec.push_back(rsl::make_unique<card32>(i));
+  }
+  vec.insert(vec.cbegin(), rsl::make_unique<card32>(-1));
+  vec.emplace(vec.cbegin() + 50, rsl::make_unique<card32>(-2));
+  vec.erase(vec.cbegin() + 1);
+  vec.erase(vec.cbegin() + 10, vec.cbegin() + 20);
+
+  REQUIRE(vec.size() == 91);
+  CHECK(*vec[0] == -1);
+  CHECK(*vec[1] == 1);
+  CHECK(*vec[9] == 9);
+  CHECK(*vec[10] == 20);
+  CHECK(*vec[38] == 48);
+  CHECK(*vec[39] == -2);
+  CHECK(*vec[40] == 49);
+  CHECK(*vec[90] == 99);
+}
+
+TEST_CASE("vector growth")
+{
+  rsl::vector<card32> doubling;
+  rsl::vector<slow_growing> one_and_half;
+  for(card32 i = 0; i < 9; ++i)
+  {
+    doubling.push_back(i);
+    one_and_half.push_back(slow_growing {i});
+  }
+  CHECK(doubling.capacity() == 16);
+  CHECK(one_and_half.capacity() == 9);
+
+  CHECK(rsl::vector_growth_double::new_capacity(10, 11, 4) == 20);
+  CHECK(rsl::vector_growth_double::new_capacity(10, 30, 4) == 30);
+  CHECK(rsl::vector_growth_one_and_half::new_capacity(10, 11, 4) == 15);
+  // small buffers aren't rounded, big buffers are rounded up to whole pages
+  CHECK(rsl::vector_growth_page_rounded<>::new_capacity(10, 11, 4) == 20);
+  CHECK(rsl::vector_growth_page_rounded<>::new_capacity(5000, 5001, 4) == 10240);
+
+  rsl::vector<card32, expanding_allocator> expanding;
+  expanding.push_back(0);
+  const card32* data = expanding.data();
+  for(card32 i = 1; i < 100; ++i)
+  {
+    expanding.push_back(i);
+  }
+  expanding.insert(expanding.cbegin(), 3, -1);
+  CHECK(expanding.data() == data);
+  CHECK(expanding.get_allocator().num_expands() > 0);
+  CHECK(expanding[2] == -1);
+  CHECK(expanding[3] == 0);
+  CHECK(expanding[102] == 99);
+}